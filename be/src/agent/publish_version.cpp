@@ -16,6 +16,8 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
+
 #include "common/compiler_util.h"
 #include "common/tracer.h"
 #include "fmt/format.h"
@@ -36,20 +38,15 @@ namespace starrocks {
 const uint32_t PUBLISH_VERSION_SUBMIT_MAX_RETRY = 10;
 bvar::LatencyRecorder g_publish_latency("be", "publish");
 
-struct TabletPublishVersionTask {
-    // input params
-    int64_t txn_id{0};
-    int64_t partition_id{0};
-    int64_t tablet_id{0};
-    int64_t version{0}; // requested publish version
-    RowsetSharedPtr rowset;
-    // output params
-    Status st;
-    // max continuous version after publish is done
-    // or 0 which means tablet not found or publish task cannot be submitted
-    int64_t max_continuous_version{0};
-    bool is_double_write{false};
-};
+void sort_tablet_publish_version_tasks(std::vector<TabletPublishVersionTask>& tablet_tasks) {
+    auto publish_cost = [](const TabletPublishVersionTask& task) -> size_t {
+        return task.rowset ? task.rowset->data_disk_size() : 0;
+    };
+    std::stable_sort(tablet_tasks.begin(), tablet_tasks.end(),
+                     [&](const TabletPublishVersionTask& lhs, const TabletPublishVersionTask& rhs) {
+                         return publish_cost(lhs) > publish_cost(rhs);
+                     });
+}
 
 void run_publish_version_task(ThreadPoolToken* token, const TPublishVersionRequest& publish_version_req,
                               TFinishTaskRequest& finish_task, std::unordered_set<DataDir*>& affected_dirs,
@@ -118,6 +115,10 @@ void run_publish_version_task(ThreadPoolToken* token, const TPublishVersionReque
     span->SetAttribute("num_partition", num_partition);
     span->SetAttribute("num_tablet", num_active_tablet);
 
+    // The task is finished only after its slowest tablet, so submit the tablets with the largest rowsets
+    // first, otherwise a large tablet queued behind many small ones adds its whole publish time to the tail.
+    sort_tablet_publish_version_tasks(tablet_tasks);
+
     std::mutex affected_dirs_lock;
     for (auto& tablet_task : tablet_tasks) {
         uint32_t retry_time = 0;
@@ -14,9 +14,12 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "agent/agent_common.h"
+#include "common/status.h"
 #include "gen_cpp/AgentService_types.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/Types_types.h"
@@ -25,6 +28,27 @@ namespace starrocks {
 
 class ThreadPoolToken;
 class DataDir;
+class Rowset;
+using RowsetSharedPtr = std::shared_ptr<Rowset>;
+
+struct TabletPublishVersionTask {
+    // input params
+    int64_t txn_id{0};
+    int64_t partition_id{0};
+    int64_t tablet_id{0};
+    int64_t version{0}; // requested publish version
+    RowsetSharedPtr rowset;
+    // output params
+    Status st;
+    // max continuous version after publish is done
+    // or 0 which means tablet not found or publish task cannot be submitted
+    int64_t max_continuous_version{0};
+    bool is_double_write{false};
+};
+
+// Order the tablets of a publish task by the disk size of their rowsets, the largest first. Tablets of the
+// same size keep their order.
+void sort_tablet_publish_version_tasks(std::vector<TabletPublishVersionTask>& tablet_tasks);
 
 void run_publish_version_task(ThreadPoolToken* token, const TPublishVersionRequest& publish_version_task,
                               TFinishTaskRequest& finish_task, std::unordered_set<DataDir*>& affected_dirs,
@@ -26,8 +26,7 @@ public:
     Status _fill_buffer() override;
 
     char* _find_line_delimiter(CSVBuffer& buffer, size_t pos) override {
-        // Intend no implementation just for compiling
-        return nullptr;
+        return buffer.find(_parse_options.row_delimiter, pos);
     }
 
 private:
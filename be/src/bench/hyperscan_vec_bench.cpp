@@ -26,6 +26,7 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exprs/like_predicate.h"
 #include "exprs/string_functions.h"
 
 namespace starrocks {
@@ -154,6 +155,63 @@ BENCHMARK(BM_HyperScan_Eval)->Apply(BM_HyperScan_Eval_Arg);
     BM_HyperScan_Eval/100/0/iterations:10000     100563 ns       100588 ns        10000
      */
 
+// `col LIKE '%p0%' OR col LIKE '%p1%' OR ...`, evaluated predicate by predicate as the OR chain does by default,
+// or by one MultiPatternMatcher.
+static void BM_MultiPatternLike_Eval(benchmark::State& state) {
+    size_t num_patterns = state.range(0);
+    bool use_multi_pattern = state.range(1);
+
+    const size_t num_rows = 4096;
+    ColumnPtr column = Bench::create_random_column(TypeDescriptor(TYPE_VARCHAR), num_rows, false, false, 64);
+    std::vector<std::string> patterns;
+    for (size_t i = 0; i < num_patterns; i++) {
+        patterns.emplace_back("%err" + std::to_string(i) + "%");
+    }
+
+    std::vector<std::unique_ptr<FunctionContext>> contexts;
+    std::vector<Columns> args;
+    for (const auto& p : patterns) {
+        contexts.emplace_back(FunctionContext::create_test_context());
+        args.push_back({column, ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(p), num_rows)});
+        contexts.back()->set_constant_columns(args.back());
+        ASSERT_OK(LikePredicate::like_prepare(contexts.back().get(), FunctionContext::THREAD_LOCAL));
+    }
+    MultiPatternMatcher matcher;
+    std::vector<MultiPatternMatcher::Pattern> multi_patterns;
+    for (const auto& p : patterns) {
+        multi_patterns.push_back({p, true});
+    }
+    ASSERT_OK(matcher.compile(multi_patterns));
+
+    for (auto _ : state) {
+        if (use_multi_pattern) {
+            auto res = matcher.match(column);
+            ASSERT_TRUE(res.ok());
+        } else {
+            Filter filter(num_rows, 0);
+            for (size_t i = 0; i < contexts.size(); i++) {
+                auto res = LikePredicate::like(contexts[i].get(), args[i]);
+                ASSERT_TRUE(res.ok());
+                const auto& data = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(res.value())->get_data();
+                for (size_t row = 0; row < num_rows; row++) {
+                    filter[row] |= data[row];
+                }
+            }
+        }
+    }
+    for (auto& ctx : contexts) {
+        ASSERT_OK(LikePredicate::like_close(ctx.get(), FunctionContext::THREAD_LOCAL));
+    }
+}
+
+BENCHMARK(BM_MultiPatternLike_Eval)
+        ->Args({4, false})
+        ->Args({4, true})
+        ->Args({16, false})
+        ->Args({16, true})
+        ->Args({64, false})
+        ->Args({64, true});
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,296 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// Drives JoinHashTable, the core of HashJoinBuildOperator/HashJoinProbeOperator, with synthetic chunks.
+// Both sides have a key column and a payload column of the same type, all of them are output.
+class JoinHashTablePerf {
+public:
+    struct Options {
+        LogicalType key_type = TYPE_INT;
+        int64_t build_rows = 0;
+        // number of distinct keys on the build side
+        int64_t cardinality = 0;
+        int null_percent = 0;
+        // draw keys from a power law distribution, so a few hot keys have most of the rows
+        bool skew = false;
+        // percent of the probe rows that find a match
+        int match_percent = 100;
+    };
+
+    explicit JoinHashTablePerf(const Options& opts) : _opts(opts) {}
+
+    void SetUp();
+    void TearDown();
+
+    void do_build_bench(benchmark::State& state);
+    void do_probe_bench(benchmark::State& state);
+
+private:
+    static constexpr int kProbeChunks = 64;
+
+    int64_t next_key(int64_t range);
+    ColumnPtr create_column(int64_t num_rows, int64_t key_range);
+    ChunkPtr create_chunk(int64_t num_rows, int64_t key_range, SlotId first_slot_id);
+    void add_tuple_descriptor(TDescriptorTableBuilder* builder);
+    std::shared_ptr<RowDescriptor> create_row_desc(TDescriptorTableBuilder* builder, TTupleId tuple_id);
+    HashTableParam create_table_param();
+    void build_hash_table(JoinHashTable* hash_table, const std::vector<ChunkPtr>& build_chunks);
+
+    Options _opts;
+    TypeDescriptor _type;
+    std::mt19937_64 _rng{0};
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _runtime_profile;
+    std::shared_ptr<RowDescriptor> _probe_desc;
+    std::shared_ptr<RowDescriptor> _build_desc;
+};
+
+void JoinHashTablePerf::SetUp() {
+    config::vector_chunk_size = 4096;
+    _type = _opts.key_type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(255)
+                                           : TypeDescriptor::from_logical_type(_opts.key_type);
+
+    TQueryOptions query_options;
+    query_options.batch_size = config::vector_chunk_size;
+    _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    _runtime_state->init_instance_mem_tracker();
+    _runtime_profile = std::make_shared<RuntimeProfile>("join_hash_table_bench");
+
+    TDescriptorTableBuilder builder;
+    add_tuple_descriptor(&builder);
+    add_tuple_descriptor(&builder);
+    _probe_desc = create_row_desc(&builder, 0);
+    _build_desc = create_row_desc(&builder, 1);
+}
+
+void JoinHashTablePerf::TearDown() {
+    _probe_desc.reset();
+    _build_desc.reset();
+    _runtime_state.reset();
+}
+
+int64_t JoinHashTablePerf::next_key(int64_t range) {
+    double u = std::uniform_real_distribution<double>(0, 1)(_rng);
+    if (_opts.skew) {
+        u = std::pow(u, 4);
+    }
+    return std::min<int64_t>(range - 1, u * range);
+}
+
+ColumnPtr JoinHashTablePerf::create_column(int64_t num_rows, int64_t key_range) {
+    ColumnPtr column = ColumnHelper::create_column(_type, _opts.null_percent > 0);
+    column->reserve(num_rows);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (int64_t i = 0; i < num_rows; i++) {
+        if (percent(_rng) < _opts.null_percent) {
+            column->append_nulls(1);
+            continue;
+        }
+        int64_t key = next_key(key_range);
+        if (_opts.key_type == TYPE_INT) {
+            column->append_datum(Datum(static_cast<int32_t>(key)));
+        } else if (_opts.key_type == TYPE_BIGINT) {
+            column->append_datum(Datum(key));
+        } else {
+            std::string value = "key_" + std::to_string(key);
+            column->append_datum(Datum(Slice(value)));
+        }
+    }
+    return column;
+}
+
+ChunkPtr JoinHashTablePerf::create_chunk(int64_t num_rows, int64_t key_range, SlotId first_slot_id) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(create_column(num_rows, key_range), first_slot_id);
+    chunk->append_column(create_column(num_rows, key_range), first_slot_id + 1);
+    return chunk;
+}
+
+void JoinHashTablePerf::add_tuple_descriptor(TDescriptorTableBuilder* builder) {
+    TTupleDescriptorBuilder tuple_desc_builder;
+    for (int i = 0; i < 2; i++) {
+        TSlotDescriptorBuilder slot_desc_builder;
+        if (_opts.key_type == TYPE_VARCHAR) {
+            slot_desc_builder.string_type(255);
+        } else {
+            slot_desc_builder.type(_opts.key_type);
+        }
+        slot_desc_builder.column_name("c" + std::to_string(i)).column_pos(i).nullable(_opts.null_percent > 0);
+        tuple_desc_builder.add_slot(slot_desc_builder.build());
+    }
+    tuple_desc_builder.build(builder);
+}
+
+std::shared_ptr<RowDescriptor> JoinHashTablePerf::create_row_desc(TDescriptorTableBuilder* builder,
+                                                                 TTupleId tuple_id) {
+    DescriptorTbl* tbl = nullptr;
+    CHECK(DescriptorTbl::create(_runtime_state.get(), &_pool, builder->desc_tbl(), &tbl, config::vector_chunk_size)
+                  .ok());
+    return std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{tuple_id});
+}
+
+HashTableParam JoinHashTablePerf::create_table_param() {
+    HashTableParam param;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.build_row_desc = _build_desc.get();
+    param.probe_row_desc = _probe_desc.get();
+    // slots 0 and 1 are on the probe side, 2 and 3 on the build side
+    param.probe_output_slots = {0, 1};
+    param.build_output_slots = {2, 3};
+    param.join_keys.emplace_back(JoinKeyDesc{&_type, false, nullptr});
+    param.search_ht_timer = ADD_TIMER(_runtime_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(_runtime_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "OutputProbeColumnTime");
+    return param;
+}
+
+void JoinHashTablePerf::build_hash_table(JoinHashTable* hash_table, const std::vector<ChunkPtr>& build_chunks) {
+    hash_table->create(create_table_param());
+    for (const auto& chunk : build_chunks) {
+        hash_table->append_chunk(chunk, {chunk->get_column_by_slot_id(2)});
+    }
+    CHECK(hash_table->build(_runtime_state.get()).ok());
+}
+
+void JoinHashTablePerf::do_build_bench(benchmark::State& state) {
+    std::vector<ChunkPtr> build_chunks;
+    size_t build_bytes = 0;
+    for (int64_t rows = 0; rows < _opts.build_rows; rows += config::vector_chunk_size) {
+        auto num_rows = std::min<int64_t>(config::vector_chunk_size, _opts.build_rows - rows);
+        build_chunks.emplace_back(create_chunk(num_rows, _opts.cardinality, 2));
+        build_bytes += build_chunks.back()->bytes_usage();
+    }
+
+    int64_t ht_bytes = 0;
+    for (auto _ : state) {
+        JoinHashTable hash_table;
+        build_hash_table(&hash_table, build_chunks);
+        ht_bytes = hash_table.mem_usage();
+        state.PauseTiming();
+        hash_table.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * _opts.build_rows);
+    state.SetBytesProcessed(state.iterations() * build_bytes);
+    state.counters["HashTableBytes"] = ht_bytes;
+}
+
+void JoinHashTablePerf::do_probe_bench(benchmark::State& state) {
+    std::vector<ChunkPtr> build_chunks;
+    for (int64_t rows = 0; rows < _opts.build_rows; rows += config::vector_chunk_size) {
+        auto num_rows = std::min<int64_t>(config::vector_chunk_size, _opts.build_rows - rows);
+        build_chunks.emplace_back(create_chunk(num_rows, _opts.cardinality, 2));
+    }
+    JoinHashTable hash_table;
+    build_hash_table(&hash_table, build_chunks);
+
+    // keys beyond the build side cardinality don't find a match
+    int64_t probe_key_range = _opts.cardinality * 100 / std::max(1, _opts.match_percent);
+    std::vector<ChunkPtr> probe_chunks;
+    size_t probe_bytes = 0;
+    for (int i = 0; i < kProbeChunks; i++) {
+        probe_chunks.emplace_back(create_chunk(config::vector_chunk_size, probe_key_range, 0));
+        probe_bytes += probe_chunks.back()->bytes_usage();
+    }
+
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        for (const auto& probe_chunk : probe_chunks) {
+            // the hash table may take columns out of the probe chunk
+            state.PauseTiming();
+            ChunkPtr chunk = probe_chunk->clone_unique();
+            Columns key_columns{chunk->get_column_by_slot_id(0)};
+            state.ResumeTiming();
+
+            bool has_remain = true;
+            while (has_remain) {
+                auto result = std::make_shared<Chunk>();
+                CHECK(hash_table.probe(_runtime_state.get(), key_columns, &chunk, &result, &has_remain).ok());
+                output_rows += result->num_rows();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kProbeChunks * config::vector_chunk_size);
+    state.SetBytesProcessed(state.iterations() * probe_bytes);
+    state.counters["HashTableBytes"] = hash_table.mem_usage();
+    state.counters["OutputRows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+    hash_table.close();
+}
+
+static JoinHashTablePerf::Options parse_options(benchmark::State& state) {
+    JoinHashTablePerf::Options opts;
+    opts.key_type = static_cast<LogicalType>(state.range(0));
+    opts.build_rows = state.range(1);
+    opts.cardinality = state.range(2);
+    opts.null_percent = state.range(3);
+    opts.skew = state.range(4) != 0;
+    opts.match_percent = state.range(5);
+    return opts;
+}
+
+static void bench_join_build(benchmark::State& state) {
+    JoinHashTablePerf perf(parse_options(state));
+    perf.SetUp();
+    perf.do_build_bench(state);
+    perf.TearDown();
+}
+
+static void bench_join_probe(benchmark::State& state) {
+    JoinHashTablePerf perf(parse_options(state));
+    perf.SetUp();
+    perf.do_probe_bench(state);
+    perf.TearDown();
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // key type, build rows, cardinality, null percent, skew, match percent
+    for (int64_t type : {TYPE_INT, TYPE_BIGINT, TYPE_VARCHAR}) {
+        // unique keys, small and large hash table
+        b->Args({type, 1 << 14, 1 << 14, 0, 0, 100});
+        b->Args({type, 1 << 22, 1 << 22, 0, 0, 100});
+        // selective probe
+        b->Args({type, 1 << 22, 1 << 22, 0, 0, 10});
+        // duplicated and skewed keys
+        b->Args({type, 1 << 20, 1 << 16, 0, 1, 100});
+        // nullable keys
+        b->Args({type, 1 << 20, 1 << 20, 20, 0, 100});
+    }
+}
+
+BENCHMARK(bench_join_build)->Apply(process_args);
+BENCHMARK(bench_join_probe)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
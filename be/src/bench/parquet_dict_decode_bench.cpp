@@ -98,6 +98,56 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// Decode a nullable INT column from dict encoded data. state.range(0) is the null rate in percent,
+// state.range(1) selects the fused `DictDecoder::next_batch_with_nulls` (1) or the per-run
+// `Decoder::next_batch_with_nulls` (0).
+static void BM_DictDecoderWithNulls(benchmark::State& state) {
+    auto null_score = state.range(0);
+    bool fused = state.range(1);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<uint16_t> is_nulls(kTestChunkSize);
+    std::vector<int32_t> values;
+    for (int i = 0; i < kTestChunkSize; i++) {
+        int random_number = dist(rng);
+        is_nulls[i] = random_number < null_score;
+        if (!is_nulls[i]) {
+            values.push_back(random_number % kDictSize);
+        }
+    }
+
+    DictEncoder<int32_t> encoder;
+    (void)encoder.append((const uint8_t*)values.data(), values.size());
+    Slice data = encoder.build();
+    PlainEncoder<int32_t> dict_encoder;
+    size_t num_dicts = 0;
+    (void)encoder.encode_dict(&dict_encoder, &num_dicts);
+    PlainDecoder<int32_t> dict_page_decoder;
+    (void)dict_page_decoder.set_data(dict_encoder.build());
+
+    DictDecoder<int32_t> dict_decoder;
+    (void)dict_decoder.set_dict(kTestChunkSize, num_dicts, &dict_page_decoder);
+
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor{TYPE_INT}, true);
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        (void)dict_decoder.set_data(data);
+        state.ResumeTiming();
+        if (fused) {
+            (void)dict_decoder.next_batch_with_nulls(kTestChunkSize, is_nulls.data(), VALUE, column.get());
+        } else {
+            (void)dict_decoder.Decoder::next_batch_with_nulls(kTestChunkSize, is_nulls.data(), VALUE, column.get());
+        }
+    }
+}
+
+BENCHMARK(BM_DictDecoderWithNulls)
+        ->ArgsProduct({benchmark::CreateDenseRange(0, 100, 20), {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
 } // namespace parquet
 } // namespace starrocks
 
@@ -0,0 +1,256 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "fs/fs_memory.h"
+#include "gen_cpp/tablet_schema.pb.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/del_vector.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_iterator.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "storage/types.h"
+
+namespace starrocks {
+
+// Writes one segment with SegmentWriter into a memory file system and scans it with SegmentIterator.
+// Columns: c0 INT sorted key, c1 INT uniformly distributed, c2 VARCHAR with a configurable number of
+// distinct values (low cardinality gets dictionary pages), c3 BIGINT payload.
+class SegmentScanPerf {
+public:
+    enum PredicateKind { NONE = 0, INT_RANGE = 1, VARCHAR_EQ = 2 };
+
+    struct Options {
+        CompressionTypePB compression = LZ4_FRAME;
+        int64_t num_rows = 0;
+        int64_t varchar_cardinality = 0;
+        PredicateKind predicate = NONE;
+        // percent of rows that pass the INT_RANGE predicate
+        int selectivity = 100;
+        // percent of rows marked deleted in the delete vector
+        int delete_percent = 0;
+        bool bitmap_index = false;
+    };
+
+    explicit SegmentScanPerf(const Options& opts) : _opts(opts) {}
+
+    void SetUp();
+    void do_bench(benchmark::State& state);
+
+private:
+    class FixedDelvecLoader : public DelvecLoader {
+    public:
+        explicit FixedDelvecLoader(DelVectorPtr delvec) : _delvec(std::move(delvec)) {}
+        Status load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) override {
+            *pdelvec = _delvec;
+            return Status::OK();
+        }
+
+    private:
+        DelVectorPtr _delvec;
+    };
+
+    static constexpr int32_t kMaxIntValue = 1000000;
+    static constexpr char kSegmentFile[] = "/segment_scan_bench/0.dat";
+
+    static ColumnPB create_column_pb(int32_t id, const std::string& type, int32_t length, bool key);
+    void write_segment();
+    Status scan(OlapReaderStatistics* stats, int64_t* output_rows);
+
+    Options _opts;
+    std::shared_ptr<MemoryFileSystem> _fs;
+    TabletSchemaSPtr _tablet_schema;
+    std::shared_ptr<Segment> _segment;
+    uint64_t _file_size = 0;
+    std::shared_ptr<DelvecLoader> _delvec_loader;
+};
+
+ColumnPB SegmentScanPerf::create_column_pb(int32_t id, const std::string& type, int32_t length, bool key) {
+    ColumnPB col;
+    col.set_unique_id(id);
+    col.set_name("c" + std::to_string(id));
+    col.set_type(type);
+    col.set_is_key(key);
+    col.set_is_nullable(false);
+    col.set_length(length);
+    col.set_index_length(std::min(length, 16));
+    col.set_aggregation("NONE");
+    return col;
+}
+
+void SegmentScanPerf::SetUp() {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    schema_pb.set_compression_type(_opts.compression);
+    *schema_pb.add_column() = create_column_pb(0, "INT", 4, true);
+    *schema_pb.add_column() = create_column_pb(1, "INT", 4, false);
+    auto* varchar_col = schema_pb.add_column();
+    *varchar_col = create_column_pb(2, "VARCHAR", 64, false);
+    varchar_col->set_has_bitmap_index(_opts.bitmap_index);
+    *schema_pb.add_column() = create_column_pb(3, "BIGINT", 8, false);
+    _tablet_schema = TabletSchema::create(schema_pb);
+
+    _fs = std::make_shared<MemoryFileSystem>();
+    CHECK(_fs->create_dir("/segment_scan_bench").ok());
+    write_segment();
+    _segment = *Segment::open(_fs, FileInfo{kSegmentFile}, 0, _tablet_schema);
+
+    if (_opts.delete_percent > 0) {
+        std::mt19937 rng(0);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::vector<uint32_t> dels;
+        for (uint32_t i = 0; i < _opts.num_rows; i++) {
+            if (percent(rng) < _opts.delete_percent) {
+                dels.push_back(i);
+            }
+        }
+        auto delvec = std::make_shared<DelVector>();
+        delvec->init(1, dels.data(), dels.size());
+        _delvec_loader = std::make_shared<FixedDelvecLoader>(std::move(delvec));
+    }
+}
+
+void SegmentScanPerf::write_segment() {
+    auto wfile = *_fs->new_writable_file(kSegmentFile);
+    SegmentWriter writer(std::move(wfile), 0, _tablet_schema, SegmentWriterOptions());
+    CHECK(writer.init().ok());
+
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> int_dist(0, kMaxIntValue - 1);
+    std::uniform_int_distribution<int64_t> varchar_dist(0, _opts.varchar_cardinality - 1);
+    auto schema = ChunkHelper::convert_schema(_tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    for (int64_t row = 0; row < _opts.num_rows; row++) {
+        auto& cols = chunk->columns();
+        cols[0]->append_datum(Datum(static_cast<int32_t>(row)));
+        cols[1]->append_datum(Datum(int_dist(rng)));
+        std::string value = "value_" + std::to_string(varchar_dist(rng));
+        cols[2]->append_datum(Datum(Slice(value)));
+        cols[3]->append_datum(Datum(static_cast<int64_t>(row * 7)));
+        if (chunk->num_rows() == config::vector_chunk_size || row + 1 == _opts.num_rows) {
+            CHECK(writer.append_chunk(*chunk).ok());
+            chunk->reset();
+        }
+    }
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    CHECK(writer.finalize(&_file_size, &index_size, &footer_position).ok());
+}
+
+Status SegmentScanPerf::scan(OlapReaderStatistics* stats, int64_t* output_rows) {
+    SegmentReadOptions seg_opts;
+    seg_opts.fs = _fs;
+    seg_opts.stats = stats;
+    seg_opts.tablet_schema = _tablet_schema;
+    seg_opts.chunk_size = config::vector_chunk_size;
+
+    std::unique_ptr<ColumnPredicate> predicate;
+    if (_opts.predicate == INT_RANGE) {
+        std::string bound = std::to_string(static_cast<int64_t>(kMaxIntValue) * _opts.selectivity / 100);
+        predicate.reset(new_column_lt_predicate(get_type_info(TYPE_INT), 1, bound));
+    } else if (_opts.predicate == VARCHAR_EQ) {
+        predicate.reset(new_column_eq_predicate(get_type_info(TYPE_VARCHAR), 2, "value_1"));
+    }
+    if (predicate != nullptr) {
+        PredicateAndNode pred_root;
+        pred_root.add_child(PredicateColumnNode{predicate.get()});
+        seg_opts.pred_tree = PredicateTree::create(std::move(pred_root));
+    }
+    if (_delvec_loader != nullptr) {
+        seg_opts.is_primary_keys = true;
+        seg_opts.version = 1;
+        seg_opts.delvec_loader = _delvec_loader;
+    }
+
+    auto schema = ChunkHelper::convert_schema(_tablet_schema);
+    auto iter = new_segment_iterator(_segment, schema, seg_opts);
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    while (true) {
+        chunk->reset();
+        auto st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        *output_rows += chunk->num_rows();
+    }
+    iter->close();
+    return Status::OK();
+}
+
+void SegmentScanPerf::do_bench(benchmark::State& state) {
+    int64_t output_rows = 0;
+    OlapReaderStatistics stats;
+    for (auto _ : state) {
+        CHECK(scan(&stats, &output_rows).ok());
+    }
+    state.SetItemsProcessed(state.iterations() * _opts.num_rows);
+    state.SetBytesProcessed(state.iterations() * _file_size);
+    state.counters["SegmentBytes"] = _file_size;
+    state.counters["OutputRows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+    state.counters["RawRowsRead"] = benchmark::Counter(stats.raw_rows_read, benchmark::Counter::kAvgIterations);
+}
+
+static void bench_segment_scan(benchmark::State& state) {
+    SegmentScanPerf::Options opts;
+    opts.compression = static_cast<CompressionTypePB>(state.range(0));
+    opts.num_rows = 1 << 20;
+    opts.varchar_cardinality = state.range(1);
+    opts.predicate = static_cast<SegmentScanPerf::PredicateKind>(state.range(2));
+    opts.selectivity = state.range(3);
+    opts.delete_percent = state.range(4);
+    opts.bitmap_index = state.range(5) != 0;
+
+    SegmentScanPerf perf(opts);
+    perf.SetUp();
+    perf.do_bench(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // compression, varchar cardinality, predicate, selectivity, delete percent, bitmap index
+    for (int64_t compression : {LZ4_FRAME, ZSTD, NO_COMPRESSION}) {
+        // full scan, dictionary and plain encoded varchar
+        b->Args({compression, 100, SegmentScanPerf::NONE, 100, 0, 0});
+        b->Args({compression, 1 << 20, SegmentScanPerf::NONE, 100, 0, 0});
+    }
+    // range predicate, late materialization of the other columns
+    for (int64_t selectivity : {1, 10, 50, 90}) {
+        b->Args({LZ4_FRAME, 100, SegmentScanPerf::INT_RANGE, selectivity, 0, 0});
+    }
+    // equality predicate on the dictionary encoded column, with and without bitmap index
+    b->Args({LZ4_FRAME, 100, SegmentScanPerf::VARCHAR_EQ, 100, 0, 0});
+    b->Args({LZ4_FRAME, 100, SegmentScanPerf::VARCHAR_EQ, 100, 0, 1});
+    b->Args({LZ4_FRAME, 10000, SegmentScanPerf::VARCHAR_EQ, 100, 0, 1});
+    // delete vector
+    for (int64_t delete_percent : {1, 10, 50}) {
+        b->Args({LZ4_FRAME, 100, SegmentScanPerf::NONE, 100, delete_percent, 0});
+    }
+}
+
+BENCHMARK(bench_segment_scan)->Apply(process_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "exprs/function_context.h"
+#include "exprs/string_functions.h"
+
+namespace starrocks {
+
+// Strings of 64 chars, one in |utf8_every| chars is a 3-bytes chinese char, 0 means ascii only.
+static ColumnPtr create_mixed_column(size_t num_rows, int utf8_every) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> char_gen('a', 'z');
+    auto column = BinaryColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        std::string s;
+        for (int j = 0; j < 64; j++) {
+            if (utf8_every > 0 && (i + j) % utf8_every == 0) {
+                s.append("博");
+            } else {
+                s.push_back(static_cast<char>(char_gen(rng)));
+            }
+        }
+        column->append(s);
+    }
+    return column;
+}
+
+enum StringFn { SUBSTR_LEFT, SUBSTR_RIGHT, REVERSE, UPPER, CHAR_LENGTH };
+
+static void BM_Utf8StringFunction(benchmark::State& state) {
+    auto fn = static_cast<StringFn>(state.range(0));
+    int utf8_every = state.range(1);
+    const size_t num_rows = 4096;
+
+    Columns columns{create_mixed_column(num_rows, utf8_every)};
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto substr_state = std::make_unique<SubstrState>();
+    substr_state->is_const = true;
+    substr_state->pos = fn == SUBSTR_LEFT ? 40 : -40;
+    substr_state->len = 20;
+    ctx->set_function_state(FunctionContext::FRAGMENT_LOCAL, substr_state.get());
+
+    for (auto _ : state) {
+        StatusOr<ColumnPtr> res;
+        switch (fn) {
+        case SUBSTR_LEFT:
+        case SUBSTR_RIGHT:
+            res = StringFunctions::substring(ctx.get(), columns);
+            break;
+        case REVERSE:
+            res = StringFunctions::reverse(ctx.get(), columns);
+            break;
+        case UPPER:
+            res = StringFunctions::upper(ctx.get(), columns);
+            break;
+        case CHAR_LENGTH:
+            res = StringFunctions::utf8_length(ctx.get(), columns);
+            break;
+        }
+        ASSERT_TRUE(res.ok());
+        benchmark::DoNotOptimize(res.value());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+// ascii only, a few multi-byte chars, mostly multi-byte chars
+BENCHMARK(BM_Utf8StringFunction)->ArgsProduct({{SUBSTR_LEFT, SUBSTR_RIGHT, REVERSE, UPPER, CHAR_LENGTH}, {0, 32, 2}});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
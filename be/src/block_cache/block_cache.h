@@ -90,6 +90,11 @@ public:
 
     bool has_disk_cache() const { return _disk_quota.load(std::memory_order_relaxed) > 0; }
 
+    // The total cache space of memory and disk.
+    size_t capacity() const {
+        return _mem_quota.load(std::memory_order_relaxed) + _disk_quota.load(std::memory_order_relaxed);
+    }
+
     bool available() const { return is_initialized() && (has_mem_cache() || has_disk_cache()); }
 
     DataCacheEngineType engine_type();
@@ -28,6 +28,11 @@ public:
         _hit_bytes << hit_bytes;
         _miss_bytes << miss_bytes;
     }
+    // Bytes read from remote storage that the admission policy kept out of the cache.
+    void update_admission_rejected(uint64_t frequency_bytes, uint64_t large_scan_bytes) {
+        _reject_frequency_bytes << frequency_bytes;
+        _reject_large_scan_bytes << large_scan_bytes;
+    }
     double hit_rate() const { return hit_rate_calculate(_hit_bytes.get_value(), _miss_bytes.get_value()); }
     double hit_rate_last_minute() const {
         return hit_rate_calculate(_hit_bytes_last_minute.get_value(), _miss_bytes_last_minute.get_value());
@@ -36,9 +41,13 @@ public:
     ssize_t get_miss_bytes() const { return _miss_bytes.get_value(); }
     ssize_t get_hit_bytes_last_minute() const { return _hit_bytes_last_minute.get_value(); }
     ssize_t get_miss_bytes_last_minute() const { return _miss_bytes_last_minute.get_value(); }
+    ssize_t get_reject_frequency_bytes() const { return _reject_frequency_bytes.get_value(); }
+    ssize_t get_reject_large_scan_bytes() const { return _reject_large_scan_bytes.get_value(); }
     void reset() {
         _hit_bytes.reset();
         _miss_bytes.reset();
+        _reject_frequency_bytes.reset();
+        _reject_large_scan_bytes.reset();
     }
 
 private:
@@ -55,5 +64,7 @@ private:
     bvar::Adder<ssize_t> _miss_bytes;
     bvar::Window<bvar::Adder<ssize_t>> _hit_bytes_last_minute{&_hit_bytes, 60};
     bvar::Window<bvar::Adder<ssize_t>> _miss_bytes_last_minute{&_miss_bytes, 60};
+    bvar::Adder<ssize_t> _reject_frequency_bytes;
+    bvar::Adder<ssize_t> _reject_large_scan_bytes;
 };
 } // namespace starrocks
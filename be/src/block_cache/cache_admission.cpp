@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_admission.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/bit_util.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+// The sketch is large enough to count every block of the cache, but kept within 16MB.
+static constexpr size_t kMinSketchWidth = 1024;
+static constexpr size_t kMaxSketchWidth = 4 * 1024 * 1024;
+
+FrequencySketch::FrequencySketch(size_t width) {
+    width = BitUtil::next_power_of_two(std::max<size_t>(width, 1));
+    _mask = width - 1;
+    _table.assign(kDepth * width, 0);
+    _sample_size = 10 * width;
+}
+
+size_t FrequencySketch::_index(uint64_t hash, int row) const {
+    // double hashing, the high half is odd so that the rows don't collide on the same slots
+    auto h1 = static_cast<uint32_t>(hash);
+    uint64_t h2 = (hash >> 32) | 1;
+    return row * width() + ((h1 + row * h2) & _mask);
+}
+
+uint32_t FrequencySketch::increment(uint64_t hash) {
+    uint32_t estimate = kMaxCount;
+    bool added = false;
+    for (int i = 0; i < kDepth; i++) {
+        uint8_t& counter = _table[_index(hash, i)];
+        if (counter < kMaxCount) {
+            counter++;
+            added = true;
+        }
+        estimate = std::min<uint32_t>(estimate, counter);
+    }
+    if (added && ++_additions >= _sample_size) {
+        _age();
+    }
+    return estimate;
+}
+
+uint32_t FrequencySketch::frequency(uint64_t hash) const {
+    uint32_t estimate = kMaxCount;
+    for (int i = 0; i < kDepth; i++) {
+        estimate = std::min<uint32_t>(estimate, _table[_index(hash, i)]);
+    }
+    return estimate;
+}
+
+void FrequencySketch::_age() {
+    for (auto& counter : _table) {
+        counter >>= 1;
+    }
+    _additions /= 2;
+}
+
+CacheAdmission* CacheAdmission::instance() {
+    static CacheAdmission admission;
+    return &admission;
+}
+
+CacheAdmission::Result CacheAdmission::admit(const std::string& cache_key, int64_t offset, int64_t file_size,
+                                             int8_t priority, size_t cache_capacity, size_t block_size) {
+    int32_t min_frequency = config::datacache_admission_min_frequency;
+    int32_t large_scan_ratio = config::datacache_admission_large_scan_ratio;
+    if (priority > 0 || (min_frequency <= 1 && large_scan_ratio <= 0)) {
+        return ADMIT;
+    }
+
+    int64_t block_index = block_size > 0 ? offset / block_size : offset;
+    uint64_t seed = HashUtil::hash64(cache_key.data(), cache_key.size(), 0);
+    uint64_t hash = HashUtil::hash64(&block_index, sizeof(block_index), seed);
+
+    if (min_frequency > 1) {
+        size_t width = block_size > 0 ? cache_capacity / block_size : 0;
+        width = BitUtil::next_power_of_two(std::clamp(width, kMinSketchWidth, kMaxSketchWidth));
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_sketch == nullptr || _sketch->width() != width) {
+            _sketch = std::make_unique<FrequencySketch>(width);
+        }
+        if (_sketch->increment(hash) < static_cast<uint32_t>(min_frequency)) {
+            return REJECT_FREQUENCY;
+        }
+    }
+
+    if (large_scan_ratio > 0 && cache_capacity > 0 &&
+        static_cast<double>(file_size) * 100 > static_cast<double>(cache_capacity) * large_scan_ratio) {
+        if (static_cast<int32_t>((hash >> 32) % 100) >= config::datacache_admission_large_scan_probability) {
+            return REJECT_LARGE_SCAN;
+        }
+    }
+    return ADMIT;
+}
+
+} // namespace starrocks
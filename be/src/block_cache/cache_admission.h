@@ -0,0 +1,78 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+// Count-min sketch of how often a key was seen recently, the frequency estimator of TinyLFU.
+// Counters saturate at 15, and all of them are halved once a sample of 10x the width has been
+// recorded, so keys that are not read any more fade out. Not thread safe.
+class FrequencySketch {
+public:
+    // |width| is rounded up to a power of two.
+    explicit FrequencySketch(size_t width);
+
+    // Record one occurrence of |hash|, returns its estimated frequency including this one.
+    uint32_t increment(uint64_t hash);
+
+    uint32_t frequency(uint64_t hash) const;
+
+    size_t width() const { return _mask + 1; }
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    size_t _index(uint64_t hash, int row) const;
+    void _age();
+
+    // kDepth rows of width() counters
+    std::vector<uint8_t> _table;
+    size_t _mask = 0;
+    size_t _additions = 0;
+    size_t _sample_size = 0;
+};
+
+// Decides whether a block read from remote storage is written into the datacache, so that one-off large
+// scans don't evict the working set:
+// - frequency: a block is only admitted once it has been missed `datacache_admission_min_frequency` times
+//   recently.
+// - large scan: only `datacache_admission_large_scan_probability` percent of the blocks of a file larger than
+//   `datacache_admission_large_scan_ratio` percent of the cache capacity are admitted. The sampled blocks
+//   are picked by their hash, so rescanning the file fills in the same blocks.
+// Blocks with a cache priority above 0 (set by the cache rule of the table) are always admitted.
+class CacheAdmission {
+public:
+    enum Result { ADMIT, REJECT_FREQUENCY, REJECT_LARGE_SCAN };
+
+    static CacheAdmission* instance();
+
+    // |cache_key| identifies the file of |file_size| bytes and |offset| the block in it.
+    Result admit(const std::string& cache_key, int64_t offset, int64_t file_size, int8_t priority,
+                 size_t cache_capacity, size_t block_size);
+
+private:
+    std::mutex _mutex;
+    // Sized by the number of blocks the cache holds, rebuilt when the capacity changes.
+    std::unique_ptr<FrequencySketch> _sketch;
+};
+
+} // namespace starrocks
@@ -79,12 +79,27 @@ void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* in
     }
     _bytes.resize(cur_byte_size);
 
+    // Rows picked in order (filters, the probe side of a join) are copied with one memcpy per run of
+    // consecutive indexes. Random gathers (the build side of a join) are bound by cache misses on the
+    // source bytes, so the bytes of the row a few iterations ahead are prefetched.
+    static constexpr size_t kPrefetchDistance = 8;
     auto* dest_bytes = _bytes.data();
-    for (size_t i = 0; i < size; i++) {
-        uint32_t row_idx = indexes[from + i];
-        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
-        strings::memcpy_inlined(dest_bytes + _offsets[cur_row_count + i], src_bytes.data() + src_offsets[row_idx],
-                                str_size);
+    const auto* src_data = src_bytes.data();
+    const uint32_t* selected = indexes + from;
+    size_t i = 0;
+    while (i < size) {
+        uint32_t run_begin = selected[i];
+        size_t run_end = i + 1;
+        while (run_end < size && selected[run_end] == selected[run_end - 1] + 1) {
+            run_end++;
+        }
+        if (run_end + kPrefetchDistance < size) {
+            __builtin_prefetch(src_data + src_offsets[selected[run_end + kPrefetchDistance]]);
+        }
+        uint32_t run_last = selected[run_end - 1];
+        strings::memcpy_inlined(dest_bytes + _offsets[cur_row_count + i], src_data + src_offsets[run_begin],
+                                src_offsets[run_last + 1] - src_offsets[run_begin]);
+        i = run_end;
     }
 
     _slices_cache = false;
@@ -432,6 +447,18 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
 
     uint8_t* data = _bytes.data();
 
+    // Move the consecutive selected rows [src, src + count) to result_offset with one memmove,
+    // and shift their offsets by the distance they are moved.
+    [[maybe_unused]] auto move_rows = [&](size_t src, size_t count) {
+        const T bytes = _offsets[src + count] - _offsets[src];
+        const T distance = _offsets[src] - _offsets[result_offset];
+        memmove(data + _offsets[result_offset], data + _offsets[src], bytes);
+        for (size_t i = 1; i <= count; ++i) {
+            _offsets[result_offset + i] = _offsets[src + i] - distance;
+        }
+        result_offset += count;
+    };
+
 #ifdef __AVX2__
     const uint8_t* f_data = filter.data();
 
@@ -447,38 +474,16 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
             // all no hit, pass
         } else if (mask == 0xffffffff) {
             // all hit, copy all
-
-            // copy data
-            T size = _offsets[start_offset + batch_nums] - _offsets[start_offset];
-            memmove(data + _offsets[result_offset], data + _offsets[start_offset], size);
-
-            // set offsets, try vectorized
-            T* offset_data = _offsets.data();
-            for (int i = 0; i < batch_nums; ++i) {
-                // TODO: performance, all sub one same offset ?
-                offset_data[result_offset + i + 1] = offset_data[result_offset + i] +
-                                                     offset_data[start_offset + i + 1] - offset_data[start_offset + i];
-            }
-
-            result_offset += batch_nums;
+            move_rows(start_offset, batch_nums);
         } else {
-            // skip not hit row, it's will reduce compare when filter layout is sparse,
-            // like "00010001...", but is ineffective when the filter layout is dense.
-
-            uint32_t zero_count = Bits::CountTrailingZerosNonZero32(mask);
-            uint32_t i = zero_count;
-            while (i < batch_nums) {
-                mask = zero_count < 31 ? mask >> (zero_count + 1) : 0;
-
-                T size = _offsets[start_offset + i + 1] - _offsets[start_offset + i];
-                // copy date
-                memmove(data + _offsets[result_offset], data + _offsets[start_offset + i], size);
-
-                // set offsets
-                _offsets[result_offset + 1] = _offsets[result_offset] + size;
-                zero_count = Bits::CountTrailingZeros32(mask);
-                result_offset += 1;
-                i += (zero_count + 1);
+            // copy each run of hit rows with one memmove, which skips the not hit rows when the filter
+            // layout is sparse, like "00010001...", and moves few but long runs when it is dense.
+            uint64_t remaining = mask;
+            while (remaining != 0) {
+                uint32_t run_begin = Bits::CountTrailingZerosNonZero64(remaining);
+                uint32_t run_length = Bits::CountTrailingZerosNonZero64(~(remaining >> run_begin));
+                move_rows(start_offset + run_begin, run_length);
+                remaining &= ~((uint64_t(1) << (run_begin + run_length)) - 1);
             }
         }
         start_offset += batch_nums;
@@ -298,11 +298,15 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
-    if (!force && SIMD::count_zero(selection) == 0) {
+    // The rows before the first unselected one are already in place, so each column is only compacted
+    // from there on. The columns copy the runs of the selected rows in batches.
+    size_t first_unselected = SIMD::find_zero(selection, 0);
+    if (!force && first_unselected == selection.size()) {
         return num_rows();
     }
     for (auto& column : _columns) {
-        column->filter(selection);
+        DCHECK_EQ(column->size(), selection.size());
+        column->filter_range(selection, first_unselected, selection.size());
     }
     return num_rows();
 }
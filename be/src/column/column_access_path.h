@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -64,6 +65,10 @@ public:
 
     bool is_from_compaction() const { return _from_compaction; }
 
+    // Return true only for the first call. The segments read by a scan share its access paths, it's used to
+    // count the json sub paths read by the scan once rather than once per segment.
+    bool mark_json_access_recorded() { return !_json_access_recorded.exchange(true, std::memory_order_relaxed); }
+
     bool is_key() const { return _type == TAccessPathType::type::KEY; }
 
     bool is_offset() const { return _type == TAccessPathType::type::OFFSET; }
@@ -111,6 +116,8 @@ private:
 
     bool _from_compaction = false;
 
+    std::atomic<bool> _json_access_recorded{false};
+
     // the data type of the subfield
     TypeDescriptor _value_type;
 
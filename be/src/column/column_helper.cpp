@@ -130,6 +130,17 @@ size_t ColumnHelper::count_nulls(const starrocks::ColumnPtr& col) {
     return SIMD::count_nonzero(null_data);
 }
 
+bool ColumnHelper::is_all_null(const ColumnPtr& col) {
+    if (col->only_null()) {
+        return true;
+    }
+    if (!col->is_nullable() || !col->has_null() || col->empty()) {
+        return false;
+    }
+    const Buffer<uint8_t>& null_data = as_raw_column<NullableColumn>(col)->null_column_data();
+    return !SIMD::contain_zero(null_data);
+}
+
 size_t ColumnHelper::count_true_with_notnull(const starrocks::ColumnPtr& col) {
     if (col->only_null()) {
         return 0;
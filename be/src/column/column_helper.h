@@ -63,6 +63,9 @@ public:
     static void or_two_filters(Filter* __restrict filter, const uint8_t* __restrict selected);
     static void or_two_filters(size_t count, uint8_t* __restrict filter, const uint8_t* __restrict selected);
     static size_t count_nulls(const ColumnPtr& col);
+    // Whether every row of a non-empty |col| is null. Stops at the first non-null row and doesn't read
+    // the null column when |col| has no null.
+    static bool is_all_null(const ColumnPtr& col);
 
     /**
      * 1 (not null and is true)
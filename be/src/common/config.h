@@ -199,6 +199,13 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// After a chunk fails to reach rpc_compress_ratio_threshold, the exchange sink sends this many
+// following chunks uncompressed before probing the codec again. 0 means always try to compress.
+CONF_mInt32(rpc_compress_skip_chunks_after_reject, "16");
+// Whether the exchange sink may omit the null maps of nullable columns without nulls when bit 8 of
+// transmission_encode_level is set. BEs of older versions can not decode it, so enable it only after
+// every BE of the cluster is upgraded.
+CONF_mBool(enable_transmission_encode_null_map, "false");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -237,6 +244,12 @@ CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// The max number of rowsets a direct schema change of a lake tablet converts at the same time.
+// Sorted schema changes and schema changes that evaluate expressions always convert one rowset at a time.
+CONF_mInt32(lake_schema_change_max_parallel_rowsets, "4");
+// The number of threads shared by the direct schema changes of lake tablets to convert rowsets in parallel.
+// 0 means the number of cpu cores.
+CONF_Int32(lake_schema_change_convert_thread_num, "0");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
@@ -276,12 +289,19 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// Only admit a data page into the storage page cache the second time it is read within a recent window,
+// so that large one-pass scans do not evict the hot working set.
+CONF_mBool(enable_storage_page_cache_admission_filter, "false");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
 CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
+// Capacity in bytes of the cache of inverted index query results (term -> rowid bitmap of a segment),
+// shared by all queries. 0 disables the cache. The memory is tracked by the inverted_index_query_cache
+// mem tracker.
+CONF_mInt64(inverted_index_query_cache_capacity, "67108864");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -305,6 +325,11 @@ CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
 // too many candidates lead to OOM or cpu overload.
 // when candidate num reach this value, the condidate with lowest score will be dropped.
 CONF_mInt64(max_compaction_candidate_num, "40960");
+// Weight of recent query scans when picking compaction candidates. The candidates are picked by their score
+// scaled by 1 + weight * log2(1 + recent query scans of the tablet), so frequently scanned tablets whose read
+// amplification costs the most are compacted first. The reported compaction scores stay unscaled.
+// 0 means pick by compaction score only.
+CONF_mDouble(compaction_query_scan_score_weight, "0");
 
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
@@ -316,6 +341,9 @@ CONF_mInt32(update_compaction_per_tablet_min_interval_seconds, "120"); // 2min
 // if this value is 0, auto chunk size calculation algorithm will be used
 // set this value to none zero if auto algorithm isn't working well
 CONF_mInt32(update_compaction_chunk_size_for_row_store, "0");
+// Capacity in bytes of the LRU cache of encoded rows served by primary key point lookups
+// (LocalTabletReader::multi_get). 0 disables the cache.
+CONF_mInt64(short_circuit_row_cache_capacity, "0");
 CONF_mInt64(max_update_compaction_num_singleton_deltas, "500");
 CONF_mInt64(update_compaction_size_threshold, "268435456");
 CONF_mInt64(update_compaction_result_bytes, "1073741824");
@@ -346,6 +374,11 @@ CONF_mInt32(max_compaction_concurrency, "-1");
 // Threshold to logging compaction trace, in seconds.
 CONF_mInt32(compaction_trace_threshold, "60");
 
+// IO priority level (0 highest, 7 lowest) in the best-effort class that compaction threads read and write with,
+// so that the disk scheduler serves query scans first. Only honored by the BFQ and CFQ schedulers.
+// -1 keeps the default priority.
+CONF_mInt32(compaction_io_priority_level, "-1");
+
 // If enabled, will verify compaction/schema-change output rowset correctness
 CONF_mBool(enable_rowset_verify, "false");
 
@@ -387,6 +420,10 @@ CONF_mInt64(max_queueing_memtable_per_tablet, "2");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 // 0 means disable
 CONF_mInt64(stale_memtable_flush_time_sec, "0");
+// when memory usage is full, flush the largest memtables first until the memory usage drops below the high
+// watermark, instead of flushing every memtable larger than 1/4 of write_buffer_size. With many concurrently
+// loaded tablets this produces fewer and larger segments under the same memory limit.
+CONF_mBool(enable_flush_largest_memtables_first, "true");
 
 // delta writer hang after this time, be will exit since storage is in error state
 CONF_Int32(be_exit_after_disk_write_hang_second, "60");
@@ -473,6 +510,10 @@ CONF_Bool(use_mmap_allocate_chunk, "false");
 // acquire more free memory which can not be used by other modules
 CONF_Int64(chunk_reserved_bytes_limit, "2147483648");
 
+// Max bytes of freed column buffers (4KB to 1MB) each thread keeps to reuse for the next chunks,
+// cached buffers aren't charged to any mem tracker. 0 disables the cache.
+CONF_mInt64(column_buffer_cache_max_bytes_per_thread, "1048576");
+
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
 
@@ -499,7 +540,8 @@ CONF_String(scratch_dirs, "/tmp");
 // then only the first writable directory is used
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
-// Linux transparent huge page.
+// Linux transparent huge page. When enabled, the buckets of large join and aggregation hash tables
+// are advised to be backed by huge pages.
 CONF_Bool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
@@ -689,6 +731,12 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// Bytes a chunk is sized for. OLAP scans read fewer rows than the chunk size per chunk when their
+// estimated row width exceeds it. 0 means row count only.
+CONF_mInt64(chunk_target_bytes, "16777216");
+// The max bytes of a chunk merged from small chunks by the pipeline chunk accumulator.
+CONF_mInt64(chunk_accumulator_max_bytes, "268435456");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -774,6 +822,11 @@ CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
 // * "-n": negative integer, means n times of number of cpu cores.
 CONF_Int64(pipeline_prepare_thread_pool_thread_num, "0");
 CONF_Int64(pipeline_prepare_thread_pool_queue_size, "102400");
+// When enabled, the prepare of pipeline drivers and their submission to the driver executor are offloaded
+// to pipeline_prepare_thread_pool, so exec_plan_fragment returns once the fragment has been built and
+// registered. This lets the FE deploy the next fragments while drivers of the earlier ones are warming up.
+// The fragment request is copied so that it outlives the offloaded prepare.
+CONF_mBool(enable_pipeline_async_fragment_execute, "false");
 // The number of threads for executing sink io task in pipeline engine, vCPUs by default.
 CONF_Int64(pipeline_sink_io_thread_pool_thread_num, "0");
 CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
@@ -791,6 +844,30 @@ CONF_mBool(pipeline_print_profile, "false");
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
 
+// The max times that adaptive DOP can raise the DOP of a pipeline over the DOP of its upstream source pipeline,
+// when the source turns out much larger than estimated. 1 means adaptive DOP can only lower the DOP.
+CONF_mInt32(pipeline_adaptive_dop_max_scale_up_factor, "1");
+// The upper bound of the DOP raised by adaptive DOP.
+CONF_mInt32(pipeline_adaptive_dop_max_dop, "64");
+// Whether to put a local driver queue of each execution thread in front of the shared driver queue, so that
+// the short drivers yielded by an execution thread are rescheduled on the same thread without contending for
+// the lock of the shared driver queue, and the idle execution threads steal the drivers from the busy ones.
+CONF_Bool(pipeline_enable_driver_queue_work_stealing, "false");
+// The max number of drivers in the local driver queue of each execution thread.
+CONF_Int32(pipeline_driver_queue_local_capacity, "4");
+// Whether the poller sleeps until the blocked drivers are notified by the operators such as exchange source,
+// hash join probe and scan, instead of spinning over all the blocked drivers.
+CONF_mBool(enable_pipeline_event_driven_poller, "false");
+// In the event-driven mode, the poller still checks all the blocked drivers once every this interval,
+// which covers the drivers which are never notified, e.g. blocked by the operators not supporting notification.
+CONF_mInt64(pipeline_poller_fallback_interval_us, "1000");
+// Whether the heavy operators (sort and hash join build) split their blocking work into resumable work units,
+// so that the driver can yield between work units once its time slice is used up.
+CONF_mBool(pipeline_enable_operator_yield, "false");
+// Whether to collect the hardware counters (cycles, instructions, LLC misses, branch misses) of push_chunk
+// and pull_chunk via perf_event for each operator, only takes effect for the queries with profile enabled.
+CONF_mBool(pipeline_enable_hardware_perf_counters, "false");
+
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
@@ -854,6 +931,14 @@ CONF_Int64(object_storage_connect_timeout_ms, "-1");
 // value is greater than 0 and less than 1000.
 // When it's 0, low speed limit check will be disabled.
 CONF_Int64(object_storage_request_timeout_ms, "-1");
+// Send a second GET for a read of object storage that hasn't completed within the p95 latency of recent reads,
+// but not before `object_storage_hedge_read_min_delay_ms`, and use whichever response comes first. It cuts the
+// tail latency of scans at the cost of a copy per read and some duplicated requests.
+CONF_mBool(object_storage_hedge_read_enable, "false");
+CONF_mInt64(object_storage_hedge_read_min_delay_ms, "50");
+// The number of threads sending the GETs of hedged reads. The GETs never queue for a thread, a read that finds
+// them all busy isn't hedged.
+CONF_Int32(object_storage_hedge_read_thread_num, "64");
 // Request timeout for object storage specialized for rename_file operation.
 // if this parameter is 0, use object_storage_request_timeout_ms instead.
 CONF_Int64(object_storage_rename_file_request_timeout_ms, "30000");
@@ -864,6 +949,9 @@ CONF_mBool(s3_use_list_objects_v1, "false");
 
 // Lake
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// Coalesce the page reads of local (shared-nothing) segments into larger reads once the row ranges to scan are
+// known, same as io_coalesce_lake_read_enable does for lake segments. Helps HDD and cloud disks.
+CONF_mBool(io_coalesce_local_read_enable, "false");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
@@ -888,10 +976,28 @@ CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
 CONF_mBool(parquet_statistics_process_more_filter_enable, "true");
+// Skip row groups whose column bloom filters contain none of the values of an equality or IN predicate.
+// Off by default: the filter of every such column is read with an extra synchronous IO per row group, which
+// only pays off when the predicates are selective and the files are written with bloom filters.
+CONF_mBool(parquet_reader_bloom_filter_enable, "false");
+// Capacity in bytes of the cache of decompressed parquet pages of external tables, shared across queries.
+// A hit skips decompressing the page, its compressed bytes are still read when the IO of the row group is
+// coalesced. 0 disables the cache.
+CONF_mInt64(parquet_page_cache_capacity, "0");
+// Capacity in bytes of the cache of row positions removed from data files by iceberg position delete files
+// and paimon deletion vectors, shared across queries. The memory is tracked by the position_delete_cache
+// mem tracker. 0 disables the cache.
+CONF_mInt64(position_delete_cache_capacity, "134217728");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Derive the coalescing distance of external table reads from the latency and bandwidth observed on
+// the same storage, instead of using io_coalesce_read_max_distance_size. The distance is kept between
+// io_coalesce_adaptive_min_distance_size and io_coalesce_read_max_buffer_size. The remote reads are only
+// measured while it is enabled.
+CONF_mBool(io_coalesce_adaptive_distance_enable, "false");
+CONF_mInt64(io_coalesce_adaptive_min_distance_size, "65536");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -910,6 +1016,9 @@ CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
 CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
 CONF_Int32(hdfs_client_max_cache_size, "64");
 CONF_Int32(hdfs_client_io_read_retry, "0");
+// Number of opened hdfs files kept for reuse by the following scan ranges of the same file, which saves the
+// NameNode round trips of reopening it. 0 disables the cache.
+CONF_mInt32(hdfs_file_handle_cache_capacity, "0");
 
 // Enable output trace logs in aws-sdk-cpp for diagnosis purpose.
 // Once logging is enabled in your application, the SDK will generate log files in your current working directory
@@ -1010,6 +1119,10 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// Insert the latest tablet metadata of each tablet and tablet schemas into the lake metacache with durable
+// priority, so that they are only evicted after all segments, delete vectors and txn logs have been evicted.
+// Metadata of older versions is always inserted with normal priority.
+CONF_mBool(lake_metacache_durable_metadata, "false");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
@@ -1073,6 +1186,13 @@ CONF_mInt32(spill_init_partition, "16");
 // make sure 2^spill_max_partition_level < spill_max_partition_size
 CONF_Int32(spill_max_partition_level, "7");
 CONF_Int32(spill_max_partition_size, "1024");
+// Whether the spillable hash join keeps the partitions which fit in its memory budget in memory and only spills the
+// rest (hybrid hash join), instead of spilling every partition once its mem table is full.
+CONF_mBool(enable_hybrid_hash_join_spill, "false");
+// A non-partition ROW_NUMBER TopN whose offset + limit exceeds this many rows is executed by the spillable full sort
+// when sort spill is enabled, so that it cannot run out of memory. The merge of the sorted runs still stops after
+// offset + limit rows. A negative value disables it.
+CONF_mInt64(spillable_topn_limit_threshold, "1048576");
 
 // The maximum size of a single log block container file, this is not a hard limit.
 // If the file size exceeds this limit, a new file will be created to store the block.
@@ -1083,6 +1203,15 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
 // min bytes size of spill read buffer. if the buffer size is less than this value, we will disable buffer read
 CONF_Int64(spill_read_buffer_min_bytes, "1048576");
+// bytes size of the read buffer of a spill block on remote storage when the query does not enable buffer read,
+// so that the small header of each spilled chunk does not cost a separate remote request. 0 disables it.
+// the streams of a driver read at the same time share its spill read buffer budget, and each one is bounded by
+// its share of the budget.
+CONF_mInt64(spill_remote_read_buffer_bytes, "1048576");
+// The maximum bytes per second of spill IO of each workgroup, including the blocks written and read back.
+// Spill IO tasks of a workgroup exceeding it yield and are requeued by the IO executor once the budget allows more IO,
+// so that the spilling queries of one workgroup can not saturate the disks shared with the others. 0 means unlimited.
+CONF_mInt64(spill_io_bytes_per_second_per_workgroup, "0");
 CONF_mInt64(mem_limited_chunk_queue_block_size, "8388608");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
@@ -1129,6 +1258,16 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Number of blocks read ahead when a scan misses the datacache on consecutive blocks, so that a sequential
+// cold scan issues fewer and larger remote reads. 0 disables read-ahead.
+CONF_mInt32(datacache_read_ahead_blocks, "0");
+// Admission control of the datacache, see `CacheAdmission`. A block read from remote storage is only written into
+// the cache once it has been missed this many times recently. 0 or 1 admits every block.
+CONF_mInt32(datacache_admission_min_frequency, "0");
+// Files larger than this percentage of the datacache capacity are considered large scans, of which only
+// `datacache_admission_large_scan_probability` percent of the blocks are admitted. 0 disables it.
+CONF_mInt32(datacache_admission_large_scan_ratio, "0");
+CONF_mInt32(datacache_admission_large_scan_probability, "10");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1263,6 +1402,18 @@ CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // mem limit for partition hash join probe side buffer
 CONF_mInt64(partition_hash_join_probe_limit_size, "134217728");
+// The max number of partitions of partition hash join. The partitions are doubled from 16 up to this number
+// when the build side outgrows the L3 cache, so that each partition still fits in the cache. Should be a power
+// of 2, and the values not greater than 16 keep falling back to a single partition instead.
+CONF_mInt32(partition_hash_join_max_partition_num, "128");
+// Whether the hash join on fixed-size keys (one integer key, or several keys packed into 8 or 16 bytes) tries the
+// open-addressing hash table first, which probes 16 slots per SIMD compare instead of chasing bucket chains. It is
+// kept only when at least 90% of the build keys are distinct, otherwise the bucket-chained table is built.
+CONF_mBool(enable_join_hash_map_open_addressing, "false");
+// Whether the hash join builds a blocked bloom filter of the build keys when the hash table is too large to stay
+// in the cache, and tests it before the buckets while probing. The probe skips the filter when more than half of
+// the probe rows pass it, which makes it pay off for the joins where most probe rows have no match.
+CONF_mBool(enable_join_probe_bloom_filter, "true");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
@@ -1279,6 +1430,16 @@ CONF_mInt32(update_cache_evict_internal_sec, "11");
 CONF_mBool(enable_auto_evict_update_cache, "true");
 
 CONF_mInt64(load_tablet_timeout_seconds, "60");
+// Number of threads used to deserialize and init the tablets of one data dir when BE starts. The meta
+// is still iterated by a single thread. 1 or less means loading the tablets in the iterating thread.
+CONF_Int32(load_tablet_threads_per_data_dir, "4");
+
+// Minutes of operator time kept by the continuous profiler, which attributes the time of pipeline operators
+// to workgroups, queries and fragment instances. 0 disables it.
+CONF_mInt32(continuous_profiler_window_minutes, "0");
+// Distinct (workgroup, query, fragment instance, operator) keys kept per minute, the time of the others is only
+// kept per workgroup and operator. Each key takes about 200 bytes.
+CONF_mInt32(continuous_profiler_max_keys_per_minute, "10000");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
 
@@ -1291,6 +1452,14 @@ CONF_Double(default_mv_resource_group_spill_mem_limit_threshold, "0.8");
 
 CONF_Bool(enable_resource_group_bind_cpus, "true");
 CONF_mBool(enable_resource_group_cpu_borrowing, "true");
+// A query of the resource group declaring target latency becomes urgent, once its elapsed time exceeds this ratio
+// of the target latency. The drivers and scan tasks of urgent queries are scheduled before the other resource groups,
+// and the resource groups without target latency yield to them.
+CONF_mDouble(workgroup_slo_urgent_ratio, "0.5");
+// Whether to bind each pipeline execution and scan thread to the cpus of a single NUMA node,
+// instead of all the cpus of its executor set. The threads are spread over the NUMA nodes evenly,
+// and the memory first touched by a thread, such as the columns built by it, is allocated from its local node.
+CONF_Bool(enable_pipeline_numa_aware, "false");
 
 // Max size of key columns size of primary key table, default value is 128 bytes
 CONF_mInt32(primary_key_limit_size, "128");
@@ -1323,6 +1492,8 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// The max number of file deletion batches a single vacuum task keeps running at the same time.
+CONF_mInt64(lake_vacuum_max_inflight_delete_batches, "4");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1335,6 +1506,12 @@ CONF_mBool(lake_enable_vertical_compaction_fill_data_cache, "false");
 
 CONF_mInt32(dictionary_cache_refresh_timeout_ms, "60000"); // 1 min
 CONF_mInt32(dictionary_cache_refresh_threadpool_size, "8");
+// Append the columns of a chunk to their column writers in parallel when the chunk being written to a segment
+// has at least this many columns. Encoding wide chunks column by column on one flush thread dominates the flush
+// time of wide tables. 0 disables it.
+CONF_mInt32(segment_writer_parallel_append_min_columns, "0");
+// Max threads of the pool used by segment_writer_parallel_append_min_columns. 0 means the number of cpu cores.
+CONF_Int32(segment_writer_parallel_append_thread_num, "0");
 // json flat flag
 CONF_mBool(enable_json_flat, "true");
 
@@ -1356,6 +1533,16 @@ CONF_mInt32(json_flat_column_max, "100");
 // for whitelist on flat json remain data, max set 1kb
 CONF_mInt32(json_flat_remain_filter_max_bytes, "1024");
 
+// a json path read by at least this many scans is a hot path, compaction flattens hot paths before the
+// others and with json_flat_hot_path_sparsity_factor instead of json_flat_sparsity_factor. 0 disables it.
+CONF_mInt32(json_flat_hot_path_min_access, "10");
+// the scan counts of the json paths are halved every this many seconds, so the paths no longer read by
+// queries stop being hot. 0 disables the decay.
+CONF_mInt64(json_flat_hot_path_access_decay_sec, "3600");
+
+// extract hot json path when row_num * hot_path_sparsity_factor < hit_row_num
+CONF_mDouble(json_flat_hot_path_sparsity_factor, "0.3");
+
 // Allowable intervals for continuous generation of pk dumps
 // Disable when pk_dump_interval_seconds <= 0
 CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
@@ -1372,11 +1559,27 @@ CONF_mInt32(olap_string_max_length, "1048576");
 // Skip get from pk index when light pk compaction publish is enabled
 CONF_mBool(enable_light_pk_compaction_publish, "true");
 
+// An OR chain of at least this many LIKE/REGEXP predicates with constant patterns on the same column is
+// evaluated by one hyperscan database scanning each value once. 0 disables it.
+CONF_mInt32(like_multi_pattern_min_num, "4");
+
+// Expensive deterministic string functions (regexp_extract, parse_url, get_json_string...) are evaluated
+// once per distinct value of their input column when a chunk has at most this ratio of distinct values,
+// and the results are gathered to the rows. 0 disables it.
+CONF_mDouble(function_dict_eval_max_distinct_ratio, "0.25");
+// Chunks with fewer rows than this are always evaluated row by row.
+CONF_mInt32(function_dict_eval_min_rows, "256");
+
 // jit LRU cache size for total 32 shards, it will be an auto value if it <=0:
 // mem_limit = system memory or process memory limit if set.
 // if mem_limit < 16 GB, disable JIT.
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
+// Compile JIT expressions in the background instead of in the prepare of the query. Queries run interpreted until
+// the compiled function is ready and swap it in at the next chunk, so a new expression doesn't pay the compile cost.
+CONF_mBool(jit_async_compile, "false");
+// The number of threads compiling JIT expressions in the background, 0 means always compile in the prepare.
+CONF_Int32(jit_async_compile_thread_num, "2");
 
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
@@ -1407,6 +1610,9 @@ CONF_Bool(report_python_worker_error, "true");
 CONF_Bool(python_worker_reuse, "true");
 CONF_Int32(python_worker_expire_time_sec, "300");
 CONF_mBool(enable_pk_strict_memcheck, "true");
+// Keep the delete vector replaced by each apply in the del vec cache as well, so readers that captured
+// the previous version of a frequently updated primary key table don't load it from the meta store.
+CONF_mBool(enable_pk_previous_del_vec_cache, "false");
 CONF_mBool(skip_lake_pk_preload, "false");
 // Reduce core file size by not dumping jemalloc retain pages
 CONF_mBool(enable_core_file_size_optimization, "true");
@@ -161,6 +161,8 @@ Status HiveDataSource::open(RuntimeState* state) {
         _scan_range.datacache_options.priority == -1) {
         _datacache_options.enable_datacache = false;
     }
+    // The modification time also keys the cached hdfs file handles, even if the datacache is disabled.
+    _datacache_options.modification_time = _scan_range.modification_time;
     _use_file_metacache = config::datacache_enable && BlockCache::instance()->has_mem_cache();
     if (state->query_options().__isset.enable_file_metacache) {
         _use_file_metacache &= state->query_options().enable_file_metacache;
@@ -479,6 +481,10 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.datacache_skip_read_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheSkipReadBytes", TUnit::BYTES, prefix);
         _profile.datacache_read_timer = ADD_CHILD_TIMER(_runtime_profile, "DataCacheReadTimer", prefix);
+        _profile.datacache_skip_write_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheSkipWriteCounter", TUnit::UNIT, prefix);
+        _profile.datacache_skip_write_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheSkipWriteBytes", TUnit::BYTES, prefix);
         _profile.datacache_write_counter =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheWriteCounter", TUnit::UNIT, prefix);
         _profile.datacache_write_bytes =
@@ -492,6 +498,15 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferCounter", TUnit::UNIT, prefix);
         _profile.datacache_read_block_buffer_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferBytes", TUnit::BYTES, prefix);
+        ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadMemLatency", TUnit::NONE, prefix);
+        ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadDiskLatency", TUnit::NONE, prefix);
+        for (int i = 0; i < io::IOLatencyHistogram::kNumBuckets; i++) {
+            const std::string bucket = io::IOLatencyHistogram::kBucketNames[i];
+            _profile.datacache_read_mem_latency[i] = ADD_CHILD_COUNTER(
+                    _runtime_profile, "DataCacheReadMem" + bucket, TUnit::UNIT, "DataCacheReadMemLatency");
+            _profile.datacache_read_disk_latency[i] = ADD_CHILD_COUNTER(
+                    _runtime_profile, "DataCacheReadDisk" + bucket, TUnit::UNIT, "DataCacheReadDiskLatency");
+        }
     }
 
     {
@@ -504,6 +519,12 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.fs_bytes_read_counter = ADD_CHILD_COUNTER(_runtime_profile, "FSIOBytesRead", TUnit::BYTES, prefix);
         _profile.fs_io_counter = ADD_CHILD_COUNTER(_runtime_profile, "FSIOCounter", TUnit::UNIT, prefix);
         _profile.fs_io_timer = ADD_CHILD_TIMER(_runtime_profile, "FSIOTime", prefix);
+        ADD_CHILD_COUNTER(_runtime_profile, "FSIOLatency", TUnit::NONE, prefix);
+        for (int i = 0; i < io::IOLatencyHistogram::kNumBuckets; i++) {
+            _profile.fs_io_latency[i] =
+                    ADD_CHILD_COUNTER(_runtime_profile, std::string("FSIO") + io::IOLatencyHistogram::kBucketNames[i],
+                                      TUnit::UNIT, "FSIOLatency");
+        }
     }
 
     if (hdfs_scan_node.__isset.table_name) {
@@ -32,6 +32,7 @@
 #include "runtime/mem_pool.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
+#include "util/huge_pages.h"
 #include "util/phmap/phmap.h"
 #include "util/phmap/phmap_dump.h"
 
@@ -39,6 +40,11 @@ namespace starrocks {
 
 using AggDataPtr = uint8_t*;
 
+// The buckets of large one level agg hash maps are advised to be backed by huge pages.
+template <typename Key, typename Hash, typename Eq = phmap::priv::hash_default_eq<Key>>
+using AggFlatHashMap =
+        phmap::flat_hash_map<Key, AggDataPtr, Hash, Eq, HugePageAllocator<phmap::priv::Pair<const Key, AggDataPtr>>>;
+
 // =====================
 // one level agg hash map
 template <PhmapSeed seed>
@@ -46,27 +52,26 @@ using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
 using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
-using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggHashMap = AggFlatHashMap<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
-using Int64AggHashMap = phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+using Int64AggHashMap = AggFlatHashMap<int64_t, StdHashWithSeed<int64_t, seed>>;
 template <PhmapSeed seed>
-using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+using Int128AggHashMap = AggFlatHashMap<int128_t, Hash128WithSeed<seed>>;
 template <PhmapSeed seed>
-using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
+using DateAggHashMap = AggFlatHashMap<DateValue, StdHashWithSeed<DateValue, seed>>;
 template <PhmapSeed seed>
-using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
+using TimeStampAggHashMap = AggFlatHashMap<TimestampValue, StdHashWithSeed<TimestampValue, seed>>;
 template <PhmapSeed seed>
-using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+using SliceAggHashMap = AggFlatHashMap<Slice, SliceHashWithSeed<seed>, SliceEqual>;
 
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
-using FixedSize4SliceAggHashMap = phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+using FixedSize4SliceAggHashMap = AggFlatHashMap<SliceKey4, FixedSizeSliceKeyHash<SliceKey4, seed>>;
 template <PhmapSeed seed>
-using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+using FixedSize8SliceAggHashMap = AggFlatHashMap<SliceKey8, FixedSizeSliceKeyHash<SliceKey8, seed>>;
 template <PhmapSeed seed>
-using FixedSize16SliceAggHashMap =
-        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+using FixedSize16SliceAggHashMap = AggFlatHashMap<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 // =====================
 // two level agg hash map
@@ -180,7 +185,10 @@ struct AggHashMapWithOneNumberKeyWithNullable
             (*not_founds).assign(chunk_size, 0);
         }
 
-        if (bucket_count < prefetch_threhold) {
+        if (has_long_runs(column)) {
+            this->template compute_agg_runs<Func, allocate_and_compute_state, compute_not_founds>(
+                    column, agg_states, std::forward<Func>(allocate_func), not_founds);
+        } else if (bucket_count < prefetch_threhold) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     column, agg_states, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -214,7 +222,10 @@ struct AggHashMapWithOneNumberKeyWithNullable
 
             // Shortcut: if nullable column has no nulls.
             if (!nullable_column->has_null()) {
-                if (this->hash_map.bucket_count() < prefetch_threhold) {
+                if (has_long_runs(data_column)) {
+                    this->template compute_agg_runs<Func, allocate_and_compute_state, compute_not_founds>(
+                            data_column, agg_states, std::forward<Func>(allocate_func), not_founds);
+                } else if (this->hash_map.bucket_count() < prefetch_threhold) {
                     this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                             data_column, agg_states, std::forward<Func>(allocate_func), not_founds);
                 } else {
@@ -287,6 +298,60 @@ struct AggHashMapWithOneNumberKeyWithNullable
         }
     }
 
+    // Keys of sorted or clustered input come in runs, e.g. a scan ordered by the group by key, and each
+    // run only needs one hash table lookup. Float keys are excluded, -0.0 and 0.0 compare equal but may
+    // hash differently.
+    static constexpr size_t kMinAvgRunLength = 4;
+
+    static bool has_long_runs(const ColumnType* column) {
+        if constexpr (std::is_integral_v<FieldType> || std::is_same_v<FieldType, int128_t>) {
+            const auto& data = column->get_data();
+            size_t num_rows = data.size();
+            size_t num_runs = 1;
+            for (size_t i = 1; i < num_rows; i++) {
+                num_runs += data[i] != data[i - 1];
+            }
+            return num_rows > 0 && num_runs * kMinAvgRunLength <= num_rows;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_runs(ColumnType* column, Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
+                                          Filter* not_founds) {
+        const auto& data = column->get_data();
+        size_t num_rows = data.size();
+        size_t i = 0;
+        while (i < num_rows) {
+            FieldType key = data[i];
+            size_t run_end = i + 1;
+            while (run_end < num_rows && data[run_end] == key) {
+                run_end++;
+            }
+
+            if constexpr (allocate_and_compute_state) {
+                // only the first row of the run creates the key
+                auto iter = this->hash_map.lazy_emplace(key, [&](const auto& ctor) {
+                    if constexpr (compute_not_founds) {
+                        DCHECK(not_founds);
+                        (*not_founds)[i] = 1;
+                    }
+                    ctor(key, allocate_func(key));
+                });
+                std::fill(agg_states->begin() + i, agg_states->begin() + run_end, iter->second);
+            } else if constexpr (compute_not_founds) {
+                DCHECK(not_founds);
+                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                    std::fill(agg_states->begin() + i, agg_states->begin() + run_end, iter->second);
+                } else {
+                    std::fill(not_founds->begin() + i, not_founds->begin() + run_end, 1);
+                }
+            }
+            i = run_end;
+        }
+    }
+
     template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
     ALWAYS_NOINLINE void compute_agg_through_null_data(size_t chunk_size, NullableColumn* nullable_column,
                                                        Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
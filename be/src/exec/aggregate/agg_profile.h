@@ -71,4 +71,18 @@ struct AggStatistics {
     RuntimeProfile::HighWaterMarkCounter* chunk_buffer_peak_memory{};
     RuntimeProfile::HighWaterMarkCounter* chunk_buffer_peak_size{};
 };
+
+// Memory held by the parts of the hash table of an aggregator, shown in the profile once the input is consumed.
+struct AggMemoryUsage {
+    // buckets of the hash map or hash set
+    int64_t hash_table = 0;
+    // serialized keys
+    int64_t mem_pool = 0;
+    // memory allocated by the aggregate functions out of their states
+    int64_t agg_state = 0;
+    // the aggregate states
+    int64_t allocator = 0;
+
+    int64_t total() const { return hash_table + mem_pool + agg_state + allocator; }
+};
 } // namespace starrocks
\ No newline at end of file
@@ -103,6 +103,26 @@ void AggrAutoContext::update_continuous_limit() {
     continuous_limit = continuous_limit * 2 > ContinuousUpperLimit ? ContinuousUpperLimit : continuous_limit * 2;
 }
 
+void AggrAutoContext::reset_continuous_limit() {
+    continuous_limit = InitContinuousLimit;
+}
+
+void AggrAutoContext::update_hit_ratio(const size_t hit_count, const size_t chunk_size) {
+    if (chunk_size == 0) {
+        return;
+    }
+    hit_ratio = hit_ratio * (1 - HitRatioDecay) + HitRatioDecay * hit_count / chunk_size;
+}
+
+bool AggrAutoContext::should_leave_pass_through(const size_t hit_count, const size_t chunk_size) {
+    return !is_low_reduction(hit_count, chunk_size) && !is_low_hit_ratio();
+}
+
+bool AggrAutoContext::should_leave_selective_preagg(const size_t hit_count, const size_t chunk_size) {
+    return (is_high_reduction(hit_count, chunk_size) && is_high_hit_ratio()) ||
+           (is_low_reduction(hit_count, chunk_size) && is_low_hit_ratio());
+}
+
 size_t AggrAutoContext::get_continuous_limit() {
     return continuous_limit;
 }
@@ -1074,6 +1094,38 @@ Status Aggregator::output_chunk_by_streaming_with_selection(Chunk* input_chunk,
     return Status::OK();
 }
 
+AggMemoryUsage Aggregator::memory_usage_breakdown() const {
+    AggMemoryUsage usage;
+    if (!is_hash_set() && _group_by_expr_ctxs.empty()) {
+        return usage;
+    }
+    usage.hash_table = is_hash_set() ? _hash_set_variant.reserved_memory_usage(nullptr)
+                                     : _hash_map_variant.reserved_memory_usage(nullptr);
+    usage.mem_pool = _mem_pool != nullptr ? _mem_pool->total_reserved_bytes() : 0;
+    usage.agg_state = agg_state_memory_usage();
+    usage.allocator = allocator_memory_usage();
+    return usage;
+}
+
+void Aggregator::update_memory_usage_counters() {
+    if (!is_hash_set() && _group_by_expr_ctxs.empty()) {
+        return;
+    }
+    auto usage = memory_usage_breakdown();
+    auto* total = ADD_COUNTER(_runtime_profile, "AggMemoryUsage", TUnit::BYTES);
+    // Not "HashTableMemoryUsage", which the operators set to the hash table and the mem pool on close.
+    auto* hash_table = ADD_CHILD_COUNTER(_runtime_profile, "HashBucketsMemoryUsage", TUnit::BYTES, "AggMemoryUsage");
+    auto* mem_pool = ADD_CHILD_COUNTER(_runtime_profile, "MemPoolMemoryUsage", TUnit::BYTES, "AggMemoryUsage");
+    auto* agg_state = ADD_CHILD_COUNTER(_runtime_profile, "AggStateMemoryUsage", TUnit::BYTES, "AggMemoryUsage");
+    auto* allocator =
+            ADD_CHILD_COUNTER(_runtime_profile, "AggStateAllocatorMemoryUsage", TUnit::BYTES, "AggMemoryUsage");
+    COUNTER_SET(total, usage.total());
+    COUNTER_SET(hash_table, usage.hash_table);
+    COUNTER_SET(mem_pool, usage.mem_pool);
+    COUNTER_SET(agg_state, usage.agg_state);
+    COUNTER_SET(allocator, usage.allocator);
+}
+
 void Aggregator::try_convert_to_two_level_map() {
     auto current_size = _hash_map_variant.reserved_memory_usage(mem_pool());
     if (current_size > two_level_memory_threshold) {
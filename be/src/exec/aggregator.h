@@ -176,18 +176,34 @@ struct AggrAutoContext {
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
+    static constexpr size_t InitContinuousLimit = 100;
+    // PASS_THROUGH probes one chunk out of every PassThroughSampleInterval chunks against the hash table
+    static constexpr size_t PassThroughSampleInterval = 32;
+    // weight of the latest probed chunk in the sliding hit ratio
+    static constexpr double HitRatioDecay = 0.2;
     std::string get_auto_state_string(const AggrAutoState& state);
     size_t get_continuous_limit();
     void update_continuous_limit();
+    void reset_continuous_limit();
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
     bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
+    // Track the hit ratio of the chunks probed against the hash table over a sliding (exponentially decayed)
+    // window, so a long PASS_THROUGH or SELECTIVE_PREAGG stretch notices when the input changes its regime.
+    void update_hit_ratio(const size_t hit_count, const size_t chunk_size);
+    bool is_high_hit_ratio() const { return hit_ratio >= HighReduction; }
+    bool is_low_hit_ratio() const { return hit_ratio <= LowReduction; }
+    // PASS_THROUGH leaves early once a sampled chunk and the window both show the input is no longer lowly reduced
+    bool should_leave_pass_through(const size_t hit_count, const size_t chunk_size);
+    // SELECTIVE_PREAGG leaves early once the latest chunk and the window agree on a high or a low reduction
+    bool should_leave_selective_preagg(const size_t hit_count, const size_t chunk_size);
     size_t init_preagg_count = 0;
     size_t adjust_count = 0;
     size_t pass_through_count = 0;
     size_t force_preagg_count = 0;
     size_t preagg_count = 0;
     size_t selective_preagg_count = 0;
-    size_t continuous_limit = 100;
+    size_t continuous_limit = InitContinuousLimit;
+    double hit_ratio = 0;
 };
 
 struct StreamingHtMinReductionEntry {
@@ -307,6 +323,12 @@ public:
         }
     }
 
+    // The parts memory_usage() is made of.
+    AggMemoryUsage memory_usage_breakdown() const;
+    // Add and set the counters of memory_usage_breakdown(), called once the input is consumed. The counters are
+    // only added to the profiles of aggregators with a hash table.
+    void update_memory_usage_counters();
+
     TStreamingPreaggregationMode::type& streaming_preaggregation_mode() { return _streaming_preaggregation_mode; }
     TStreamingPreaggregationMode::type streaming_preaggregation_mode() const { return _streaming_preaggregation_mode; }
     const AggHashMapVariant& hash_map_variant() { return _hash_map_variant; }
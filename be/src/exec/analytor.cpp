@@ -14,6 +14,7 @@
 
 #include "exec/analytor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <ios>
 #include <memory>
@@ -167,7 +168,9 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _need_partition_materializing = true;
         }
 
-        if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count")) {
+        // min/max are not invertible, they only rescan the frame when the row leaving it may be the extreme
+        if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count" ||
+              fn.name.function_name == "min" || fn.name.function_name == "max")) {
             _use_removable_cumulative_process = false;
         }
 
@@ -275,6 +278,8 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
                                                         _order_ctxs[i]->root()->is_constant(), 0);
     }
 
+    _removable_chunk_num = _compute_removable_chunk_num(state->chunk_size());
+
     SCOPED_TIMER(_runtime_profile->total_time_counter());
 
     _peak_buffered_rows = ADD_PEAK_COUNTER(_runtime_profile, "PeakBufferedRows", TUnit::UNIT);
@@ -507,8 +512,22 @@ Status Analytor::_check_has_error() {
     return Status::OK();
 }
 
+int64_t Analytor::_compute_removable_chunk_num(int64_t chunk_size) const {
+    const int64_t removable_chunk_num = config::pipeline_analytic_removable_chunk_num;
+    // A bounded ROWS frame only looks back -_rows_start_offset rows from the current row. Removing about as many rows
+    // as are kept keeps the buffer proportional to the frame rather than to the removable chunk number, and the cost
+    // of shifting the kept rows in each removal stays amortized.
+    if (_need_partition_materializing || _is_unbounded_preceding ||
+        _tnode.analytic_node.window.type != TAnalyticWindowType::ROWS) {
+        return removable_chunk_num;
+    }
+    const int64_t kept_rows = std::max<int64_t>(-_rows_start_offset, 0);
+    const int64_t chunk_num = (kept_rows + chunk_size - 1) / chunk_size;
+    return std::max<int64_t>(1, std::min(chunk_num, removable_chunk_num));
+}
+
 void Analytor::_remove_unused_rows(RuntimeState* state) {
-    const size_t chunk_num = config::pipeline_analytic_removable_chunk_num;
+    const size_t chunk_num = _removable_chunk_num;
     // Keep at least one chunk, because the process of _find_partition_end() may access the end position of
     // the last chunk.
     if (_removed_chunk_index + chunk_num + 1 >= _input_chunk_first_row_positions.size()) {
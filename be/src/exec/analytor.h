@@ -147,6 +147,8 @@ private:
     // (_agg_intput_columns, _partition_columns, _order_columns), and these big columns may cause significant memory usage,
     // so parts of first rows will be removed as long as it is not necessary for window evaluation.
     void _remove_unused_rows(RuntimeState* state);
+    // Number of chunks released at a time by _remove_unused_rows, bounded by the frame of a ROWS window
+    int64_t _compute_removable_chunk_num(int64_t chunk_size) const;
     Status _add_chunk(const ChunkPtr& chunk);
     // If src_column is const, but dst is not, unpack src_column then append. Otherwise just append
     void _append_column(size_t chunk_size, Column* dst_column, ColumnPtr& src_column);
@@ -291,6 +293,8 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    // Number of chunks released at a time by _remove_unused_rows
+    int64_t _removable_chunk_num = 0;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -62,6 +62,8 @@ public:
     struct SlotInfo {
         SlotInfo() : id(-2) {}
         SlotId id;
+        // index of the column of the slot in the src chunk, which has the same layout for every chunk
+        int column_index = -1;
         TypeDescriptor type;
         std::string key;
     };
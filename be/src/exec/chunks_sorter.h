@@ -139,6 +139,11 @@ public:
 
     virtual bool has_pending_data() { return false; }
 
+    // The sorter may split sorting procedure into resumable work units, see Operator::has_pending_work.
+    // update() and done() only schedule these work units, which are run by do_pending_work one at a time.
+    virtual bool has_pending_work() const { return false; }
+    virtual Status do_pending_work(RuntimeState* state) { return Status::OK(); }
+
     bool has_output() { return spiller() == nullptr || !spiller()->spilled() || spiller()->has_output_data(); }
 
     const std::shared_ptr<spill::Spiller>& spiller() const { return _spiller; }
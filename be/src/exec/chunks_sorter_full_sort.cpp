@@ -50,6 +50,12 @@ void ChunksSorterFullSort::setup_runtime(RuntimeState* state, RuntimeProfile* pr
 
 Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk) {
     RETURN_IF_ERROR(_merge_unsorted(state, chunk));
+    if (_yieldable) {
+        if (_staging_unsorted_rows >= max_buffered_rows || _staging_unsorted_bytes >= max_buffered_bytes) {
+            _pending_stage = PendingStage::CONCAT;
+        }
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_partial_sort(state, false));
 
     return Status::OK();
@@ -102,28 +108,53 @@ Status ChunksSorterFullSort::_partial_sort(RuntimeState* state, bool done) {
     }
     bool reach_limit = _staging_unsorted_rows >= max_buffered_rows || _staging_unsorted_bytes >= max_buffered_bytes;
     if (done || reach_limit) {
-        _max_num_rows = std::max<int>(_max_num_rows, _staging_unsorted_rows);
-        _profiler->input_required_memory->update(_staging_unsorted_bytes);
-        concat_chunks(_unsorted_chunk, _staging_unsorted_chunks, _staging_unsorted_rows);
-        _staging_unsorted_chunks.clear();
-        RETURN_IF_ERROR(_unsorted_chunk->upgrade_if_overflow());
+        RETURN_IF_ERROR(_concat_unsorted());
+        RETURN_IF_ERROR(_sort_unsorted(state));
+        RETURN_IF_ERROR(_materialize_sorted());
+    }
+
+    return Status::OK();
+}
+
+Status ChunksSorterFullSort::_concat_unsorted() {
+    _max_num_rows = std::max<int>(_max_num_rows, _staging_unsorted_rows);
+    _profiler->input_required_memory->update(_staging_unsorted_bytes);
+    concat_chunks(_unsorted_chunk, _staging_unsorted_chunks, _staging_unsorted_rows);
+    _staging_unsorted_chunks.clear();
+    return _unsorted_chunk->upgrade_if_overflow();
+}
+
+Status ChunksSorterFullSort::_sort_unsorted(RuntimeState* state) {
+    SCOPED_TIMER(_sort_timer);
+    DataSegment segment(_sort_exprs, _unsorted_chunk);
+    _sort_permutation.resize(0);
+    // Scans whose sort key is a prefix of the ORDER BY produce ordered rows. Checking it stops at the first
+    // inversion, so it is cheap for unordered input and saves both the sort and the permutation otherwise.
+    _unsorted_is_presorted = SortedRun(_unsorted_chunk, segment.order_by_columns).is_sorted(_sort_desc);
+    if (_unsorted_is_presorted) {
+        COUNTER_UPDATE(_profiler->num_presorted_runs, 1);
+        return Status::OK();
+    }
+    return sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc, &_sort_permutation);
+}
 
-        SCOPED_TIMER(_sort_timer);
-        DataSegment segment(_sort_exprs, _unsorted_chunk);
-        _sort_permutation.resize(0);
-        RETURN_IF_ERROR(
-                sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc, &_sort_permutation));
-        auto sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_chunk->num_rows());
+Status ChunksSorterFullSort::_materialize_sorted() {
+    SCOPED_TIMER(_sort_timer);
+    size_t num_rows = _unsorted_chunk->num_rows();
+    auto sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_is_presorted ? 0 : num_rows);
+    if (_unsorted_is_presorted) {
+        sorted_chunk->swap_chunk(*_unsorted_chunk);
+        _unsorted_is_presorted = false;
+    } else {
         materialize_by_permutation(sorted_chunk.get(), {_unsorted_chunk}, _sort_permutation);
         RETURN_IF_ERROR(sorted_chunk->upgrade_if_overflow());
-
-        _sorted_chunks.emplace_back(std::move(sorted_chunk));
-        _total_rows += _unsorted_chunk->num_rows();
-        _unsorted_chunk->reset();
-        _staging_unsorted_rows = 0;
-        _staging_unsorted_bytes = 0;
     }
 
+    _sorted_chunks.emplace_back(std::move(sorted_chunk));
+    _total_rows += num_rows;
+    _unsorted_chunk->reset();
+    _staging_unsorted_rows = 0;
+    _staging_unsorted_bytes = 0;
     return Status::OK();
 }
 
@@ -252,6 +283,13 @@ starrocks::ChunkPtr ChunksSorterFullSort::_late_materialize_tmpl(const starrocks
     return final_chunk;
 }
 Status ChunksSorterFullSort::do_done(RuntimeState* state) {
+    if (_yieldable) {
+        _is_done = true;
+        if (_pending_stage == PendingStage::NONE) {
+            _pending_stage = _staging_unsorted_rows > 0 ? PendingStage::CONCAT : PendingStage::MERGE;
+        }
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_partial_sort(state, true));
     {
         _sort_permutation = {};
@@ -262,6 +300,33 @@ Status ChunksSorterFullSort::do_done(RuntimeState* state) {
     return Status::OK();
 }
 
+Status ChunksSorterFullSort::do_pending_work(RuntimeState* state) {
+    switch (_pending_stage) {
+    case PendingStage::NONE:
+        break;
+    case PendingStage::CONCAT:
+        RETURN_IF_ERROR(_concat_unsorted());
+        _pending_stage = PendingStage::SORT;
+        break;
+    case PendingStage::SORT:
+        RETURN_IF_ERROR(_sort_unsorted(state));
+        _pending_stage = PendingStage::MATERIALIZE;
+        break;
+    case PendingStage::MATERIALIZE:
+        RETURN_IF_ERROR(_materialize_sorted());
+        // done() may be invoked while the partial sort is pending, then go on merging all the sorted runs.
+        _pending_stage = _is_done ? PendingStage::MERGE : PendingStage::NONE;
+        break;
+    case PendingStage::MERGE:
+        _sort_permutation = {};
+        _unsorted_chunk.reset();
+        RETURN_IF_ERROR(_merge_sorted(state));
+        _pending_stage = PendingStage::NONE;
+        break;
+    }
+    return Status::OK();
+}
+
 Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_output_timer);
     if (_merged_runs.num_chunks() == 0) {
@@ -26,11 +26,13 @@ struct ChunksSorterFullSortProfiler {
             : profile(runtime_profile) {
         input_required_memory = ADD_COUNTER(profile, "InputRequiredMemory", TUnit::BYTES);
         num_sorted_runs = ADD_COUNTER(profile, "NumSortedRuns", TUnit::UNIT);
+        num_presorted_runs = ADD_COUNTER(profile, "NumPresortedRuns", TUnit::UNIT);
     }
 
     RuntimeProfile* profile{};
     RuntimeProfile::Counter* input_required_memory = nullptr;
     RuntimeProfile::Counter* num_sorted_runs = nullptr;
+    RuntimeProfile::Counter* num_presorted_runs = nullptr;
 };
 class ChunksSorterFullSort : public ChunksSorter {
 public:
@@ -59,13 +61,24 @@ public:
     void setup_runtime(RuntimeState* state, starrocks::RuntimeProfile* profile,
                        MemTracker* parent_mem_tracker) override;
 
+    // Split the partial sort and the final merge into resumable work units.
+    void set_yieldable(bool yieldable) { _yieldable = yieldable; }
+    bool has_pending_work() const override { return _pending_stage != PendingStage::NONE; }
+    Status do_pending_work(RuntimeState* state) override;
+
 private:
+    // Work units of the sorting procedure when it is yieldable.
+    enum class PendingStage { NONE, CONCAT, SORT, MATERIALIZE, MERGE };
+
     // Three stages of sorting procedure:
     // 1. Accumulate input chunks into a big chunk(but not exceed the kMaxBufferedChunkSize), to reduce the memory copy during merge
     // 2. Sort the accumulated big chunk partially
     // 3. Merge all big-chunks into global sorted
     Status _merge_unsorted(RuntimeState* state, const ChunkPtr& chunk);
     Status _partial_sort(RuntimeState* state, bool done);
+    Status _concat_unsorted();
+    Status _sort_unsorted(RuntimeState* state);
+    Status _materialize_sorted();
     Status _merge_sorted(RuntimeState* state);
     void _split_late_and_early_chunks();
     void _assign_ordinals();
@@ -79,6 +92,7 @@ protected:
 
     size_t _total_rows = 0;        // Total rows of sorting data
     Permutation _sort_permutation; // Temp permutation for sorting
+    bool _unsorted_is_presorted = false; // _unsorted_chunk already arrives in order, e.g. from a sort-key ordered scan
     size_t _staging_unsorted_rows = 0;
     size_t _staging_unsorted_bytes = 0;
     std::vector<ChunkPtr> _staging_unsorted_chunks;
@@ -104,6 +118,10 @@ protected:
     std::vector<SlotId> _column_id_to_slot_id;
     std::vector<ChunkUniquePtr> _early_materialized_chunks;
     std::vector<ChunkUniquePtr> _late_materialized_chunks;
+
+    bool _yieldable = false;
+    bool _is_done = false;
+    PendingStage _pending_stage = PendingStage::NONE;
 };
 
 } // namespace starrocks
@@ -113,7 +113,7 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
 }
 
 size_t ChunksSorterHeapSort::get_output_rows() const {
-    return _merged_segment.chunk->num_rows();
+    return _merged_segment.chunk == nullptr ? 0 : _merged_segment.chunk->num_rows();
 }
 
 Status ChunksSorterHeapSort::do_done(RuntimeState* state) {
@@ -146,7 +146,8 @@ Status ChunksSorterHeapSort::do_done(RuntimeState* state) {
 
 Status ChunksSorterHeapSort::get_next(ChunkPtr* chunk, bool* eos) {
     ScopedTimer<MonotonicStopWatch> timer(_output_timer);
-    if (_next_output_row >= _merged_segment.chunk->num_rows()) {
+    // nothing was ever pushed into the heap, e.g. a partition of partition topn with LIMIT 0
+    if (_merged_segment.chunk == nullptr || _next_output_row >= _merged_segment.chunk->num_rows()) {
         *chunk = nullptr;
         *eos = true;
         return Status::OK();
@@ -30,6 +30,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/mem_tracker.h"
 #include "util/cpu_info.h"
+#include "util/failpoint/fail_point.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -443,10 +444,14 @@ private:
 
     void _init_partition_nums(const HashTableParam& param);
     Status _convert_to_single_partition();
-    Status _append_chunk_to_partitions(const ChunkPtr& chunk);
+    Status _double_partitions();
+    Status _append_chunk_to_partitions(const ChunkPtr& chunk,
+                                       const std::vector<std::unique_ptr<SingleHashJoinBuilder>>& builders);
 
 private:
-    std::vector<std::unique_ptr<SingleHashJoinBuilder>> _builders;
+    using Builders = std::vector<std::unique_ptr<SingleHashJoinBuilder>>;
+    Builders _builders;
+    HashTableParam _param;
 
     size_t _partition_num = 0;
     size_t _partition_join_min_rows = 0;
@@ -567,6 +572,7 @@ void AdaptivePartitionHashJoinBuilder::_init_partition_nums(const HashTableParam
 }
 
 void AdaptivePartitionHashJoinBuilder::create(const HashTableParam& param) {
+    _param = param;
     _init_partition_nums(param);
     for (size_t i = 0; i < _partition_num; ++i) {
         _builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
@@ -626,8 +632,9 @@ int64_t AdaptivePartitionHashJoinBuilder::ht_mem_usage() const {
 }
 
 Status AdaptivePartitionHashJoinBuilder::_convert_to_single_partition() {
-    // merge all partition data to the first partition
-    for (size_t i = 1; i < _partition_num; ++i) {
+    // merge all partition data to the first partition, _partition_num may have been reset to 1 by
+    // _adjust_partition_rows, so iterate _builders instead.
+    for (size_t i = 1; i < _builders.size(); ++i) {
         _builders[0]->hash_table().merge_ht(_builders[i]->hash_table());
     }
     _builders.resize(1);
@@ -635,11 +642,65 @@ Status AdaptivePartitionHashJoinBuilder::_convert_to_single_partition() {
     return Status::OK();
 }
 
-Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const ChunkPtr& chunk) {
+DEFINE_FAIL_POINT(partition_hash_join_force_double_partitions);
+DEFINE_FAIL_POINT(partition_hash_join_double_partitions_failed);
+
+// Double the partitions instead of falling back to a single partition, when the build side outgrows the partitions.
+// Since the partition of a row is the lowest bits of its hash value, the rows of partition i are split into the new
+// partitions i and (i + _partition_num). Each old partition is released as soon as its rows are re-partitioned, so
+// the extra memory is about one partition at a time. On failure the moved rows are lost and the build fails, so all
+// the partitions are left empty but usable, until the builder is closed.
+Status AdaptivePartitionHashJoinBuilder::_double_partitions() {
+    // The build chunk consists of the slots of the build tuples, so the build keys can be evaluated against it again.
+    static constexpr size_t BATCH_SIZE = 4096;
+    const size_t new_partition_num = _partition_num * 2;
+
+    Builders new_builders;
+    for (size_t i = 0; i < new_partition_num; ++i) {
+        new_builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
+        new_builders.back()->create(_param);
+    }
+
+    auto status = [&]() -> Status {
+        for (auto& builder : _builders) {
+            const ChunkPtr& build_chunk = builder->hash_table().get_build_chunk();
+            // The first row of the build chunk is the default row of the hash table.
+            for (size_t offset = 1; offset < build_chunk->num_rows(); offset += BATCH_SIZE) {
+                size_t count = std::min(BATCH_SIZE, build_chunk->num_rows() - offset);
+                ChunkPtr chunk = build_chunk->clone_empty(count);
+                chunk->append(*build_chunk, offset, count);
+                RETURN_IF_ERROR(_append_chunk_to_partitions(chunk, new_builders));
+            }
+            // release the old partition, but keep an empty hash table for the accessors
+            builder->reset(_param);
+            FAIL_POINT_TRIGGER_RETURN_ERROR(partition_hash_join_double_partitions_failed);
+        }
+        return Status::OK();
+    }();
+    if (!status.ok()) {
+        for (auto& builder : _builders) {
+            builder->reset(_param);
+        }
+        for (auto& builder : new_builders) {
+            builder->close();
+        }
+        return status;
+    }
+
+    for (auto& builder : _builders) {
+        builder->close();
+    }
+    _builders = std::move(new_builders);
+    _partition_num = new_partition_num;
+    COUNTER_SET(_hash_joiner.build_metrics().partition_nums, (int64_t)_partition_num);
+    return Status::OK();
+}
+
+Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const ChunkPtr& chunk, const Builders& builders) {
     const std::vector<ExprContext*>& build_partition_keys = _hash_joiner.build_expr_ctxs();
 
     size_t num_rows = chunk->num_rows();
-    size_t num_partitions = _builders.size();
+    size_t num_partitions = builders.size();
     size_t num_partition_cols = build_partition_keys.size();
 
     std::vector<ColumnPtr> partition_columns(num_partition_cols);
@@ -689,14 +750,27 @@ Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const Chunk
         // TODO: make builder implements append with selective
         auto partition_chunk = chunk->clone_empty();
         partition_chunk->append_selective(*chunk, selection.data(), from, size);
-        RETURN_IF_ERROR(_builders[i]->append_chunk(std::move(partition_chunk)));
+        RETURN_IF_ERROR(builders[i]->append_chunk(std::move(partition_chunk)));
     }
     return Status::OK();
 }
 
 Status AdaptivePartitionHashJoinBuilder::do_append_chunk(const ChunkPtr& chunk) {
+    FAIL_POINT_TRIGGER_EXECUTE(partition_hash_join_force_double_partitions, {
+        if (_partition_num > 1) {
+            RETURN_IF_ERROR(_double_partitions());
+        }
+    });
     if (_partition_num > 1 && hash_table_row_count() > _partition_join_max_rows) {
-        RETURN_IF_ERROR(_convert_to_single_partition());
+        const auto max_partition_num = static_cast<size_t>(std::max(config::partition_hash_join_max_partition_num, 1));
+        while (_partition_num > 1 && _partition_num * 2 <= max_partition_num &&
+               hash_table_row_count() > _partition_join_max_rows) {
+            RETURN_IF_ERROR(_double_partitions());
+            _adjust_partition_rows(ht_mem_usage() / hash_table_row_count());
+        }
+        if (_partition_num == 1 || hash_table_row_count() > _partition_join_max_rows) {
+            RETURN_IF_ERROR(_convert_to_single_partition());
+        }
     }
 
     if (_partition_num > 1 && ++_pushed_chunks % 8 == 0) {
@@ -708,7 +782,7 @@ Status AdaptivePartitionHashJoinBuilder::do_append_chunk(const ChunkPtr& chunk)
     }
 
     if (_partition_num > 1) {
-        RETURN_IF_ERROR(_append_chunk_to_partitions(chunk));
+        RETURN_IF_ERROR(_append_chunk_to_partitions(chunk, _builders));
     } else {
         RETURN_IF_ERROR(_builders[0]->do_append_chunk(chunk));
     }
@@ -56,6 +56,12 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
     build_keys_per_bucket = ADD_COUNTER(runtime_profile, "BuildKeysPerBucket%", TUnit::UNIT);
     hash_table_memory_usage = ADD_COUNTER(runtime_profile, "HashTableMemoryUsage", TUnit::BYTES);
+    build_chunk_memory_usage =
+            ADD_CHILD_COUNTER(runtime_profile, "BuildChunkMemoryUsage", TUnit::BYTES, "HashTableMemoryUsage");
+    hash_buckets_memory_usage =
+            ADD_CHILD_COUNTER(runtime_profile, "HashBucketsMemoryUsage", TUnit::BYTES, "HashTableMemoryUsage");
+    hash_keys_memory_usage =
+            ADD_CHILD_COUNTER(runtime_profile, "HashKeysMemoryUsage", TUnit::BYTES, "HashTableMemoryUsage");
     partial_runtime_bloom_filter_bytes = ADD_COUNTER(runtime_profile, "PartialRuntimeBloomFilterBytes", TUnit::BYTES);
     partition_nums = ADD_COUNTER(runtime_profile, "PartitionNums", TUnit::UNIT);
 }
@@ -380,7 +386,18 @@ Status HashJoiner::_calc_filter_for_other_conjunct(ChunkPtr* chunk, Filter& filt
     hit_all = false;
     filter.assign((*chunk)->num_rows(), 1);
 
+    size_t selected_count = filter.size();
     for (auto* ctx : _other_join_conjunct_ctxs) {
+        // Once the previous conjuncts keep only a few candidate rows, evaluate the rest of them over those rows only.
+        if (selected_count * OTHER_CONJUNCT_SELECTIVE_EVAL_FACTOR <= filter.size()) {
+            RETURN_IF_ERROR(_calc_selective_filter_for_other_conjunct(ctx, chunk, filter, filter_all));
+            if (filter_all) {
+                break;
+            }
+            selected_count = SIMD::count_nonzero(filter);
+            continue;
+        }
+
         ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate((*chunk).get()))
         size_t true_count = ColumnHelper::count_true_with_notnull(column);
 
@@ -399,6 +416,7 @@ Status HashJoiner::_calc_filter_for_other_conjunct(ChunkPtr* chunk, Filter& filt
                 filter_all = true;
                 break;
             }
+            selected_count = SIMD::count_nonzero(filter);
         }
     }
 
@@ -412,6 +430,51 @@ Status HashJoiner::_calc_filter_for_other_conjunct(ChunkPtr* chunk, Filter& filt
     return Status::OK();
 }
 
+// Gather the selected rows of the columns referenced by the conjunct instead of evaluating it over the whole chunk,
+// then scatter the result back into filter.
+Status HashJoiner::_calc_selective_filter_for_other_conjunct(ExprContext* ctx, ChunkPtr* chunk, Filter& filter,
+                                                            bool& filter_all) {
+    std::vector<SlotId> slot_ids;
+    ctx->root()->get_slot_ids(&slot_ids);
+
+    std::vector<uint32_t> selection;
+    selection.reserve(filter.size());
+    for (uint32_t i = 0; i < filter.size(); i++) {
+        if (filter[i]) {
+            selection.emplace_back(i);
+        }
+    }
+
+    auto selected_chunk = std::make_shared<Chunk>();
+    for (SlotId slot_id : slot_ids) {
+        if (selected_chunk->is_slot_exist(slot_id)) {
+            continue;
+        }
+        const ColumnPtr& src_column = (*chunk)->get_column_by_slot_id(slot_id);
+        ColumnPtr dst_column = src_column->clone_empty();
+        dst_column->append_selective(*src_column, selection);
+        selected_chunk->append_column(std::move(dst_column), slot_id);
+    }
+    if (selected_chunk->num_columns() == 0) {
+        // no column referenced, e.g. constant conjunct, fallback to evaluate over the whole chunk
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate((*chunk).get()));
+        ColumnHelper::merge_two_filters(column, &filter, &filter_all);
+        return Status::OK();
+    }
+
+    ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(selected_chunk.get()));
+    Filter selected_filter(selection.size(), 1);
+    ColumnHelper::merge_two_filters(column, &selected_filter);
+
+    size_t hit_count = 0;
+    for (size_t i = 0; i < selection.size(); i++) {
+        filter[selection[i]] = selected_filter[i];
+        hit_count += selected_filter[i];
+    }
+    filter_all = hit_count == 0;
+    return Status::OK();
+}
+
 void HashJoiner::_process_row_for_other_conjunct(ChunkPtr* chunk, size_t start_column, size_t column_count,
                                                  bool filter_all, bool hit_all, const Filter& filter) {
     if (filter_all) {
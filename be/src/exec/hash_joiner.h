@@ -159,6 +159,9 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* runtime_filter_num = nullptr;
     RuntimeProfile::Counter* build_keys_per_bucket = nullptr;
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
+    RuntimeProfile::Counter* build_chunk_memory_usage = nullptr;
+    RuntimeProfile::Counter* hash_buckets_memory_usage = nullptr;
+    RuntimeProfile::Counter* hash_keys_memory_usage = nullptr;
     RuntimeProfile::Counter* partial_runtime_bloom_filter_bytes = nullptr;
     RuntimeProfile::Counter* partition_nums = nullptr;
 
@@ -190,6 +193,8 @@ public:
 
         auto old_phase = HashJoinPhase::BUILD;
         _phase.compare_exchange_strong(old_phase, HashJoinPhase::PROBE);
+        // Wake up the probe drivers waiting for the hash table.
+        notify_observers();
     }
     void enter_post_probe_phase() {
         HashJoinPhase old_phase = HashJoinPhase::PROBE;
@@ -384,6 +389,8 @@ private:
     StatusOr<ChunkPtr> _pull_probe_output_chunk(RuntimeState* state);
 
     Status _calc_filter_for_other_conjunct(ChunkPtr* chunk, Filter& filter, bool& filter_all, bool& hit_all);
+    static Status _calc_selective_filter_for_other_conjunct(ExprContext* ctx, ChunkPtr* chunk, Filter& filter,
+                                                            bool& filter_all);
     static void _process_row_for_other_conjunct(ChunkPtr* chunk, size_t start_column, size_t column_count,
                                                 bool filter_all, bool hit_all, const Filter& filter);
 
@@ -399,6 +406,10 @@ private:
     Status _create_runtime_bloom_filters(RuntimeState* state, int64_t limit);
 
 private:
+    // The remaining other conjuncts are evaluated over the gathered candidate rows once no more than
+    // 1/OTHER_CONJUNCT_SELECTIVE_EVAL_FACTOR of them are still selected.
+    static constexpr size_t OTHER_CONJUNCT_SELECTIVE_EVAL_FACTOR = 4;
+
     const THashJoinNode& _hash_join_node;
     ObjectPool* _pool;
 
@@ -14,6 +14,10 @@
 
 #include "exec/hdfs_scanner.h"
 
+#include <bvar/bvar.h>
+
+#include <algorithm>
+
 #include "block_cache/block_cache_hit_rate_counter.hpp"
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
@@ -26,15 +30,44 @@
 
 namespace starrocks {
 
+// Latency of the reads from the file system in microseconds, counted for all the scans of the BE.
+static bvar::LatencyRecorder g_hdfs_scanner_fs_read_latency("hdfs_scanner", "fs_read_latency");
+
+// Adds the time of an IO to `io_ns` and `io_latency` of the stats, and to |latency| if any.
+class ScopedIOTimer {
+public:
+    ScopedIOTimer(HdfsScanStats* stats, bvar::LatencyRecorder* latency) : _stats(stats), _latency(latency) {
+        _watch.start();
+    }
+
+    ~ScopedIOTimer() {
+        int64_t elapsed_ns = _watch.elapsed_time();
+        _stats->io_ns += elapsed_ns;
+        _stats->io_latency.add(elapsed_ns);
+        if (_latency != nullptr) {
+            *_latency << elapsed_ns / 1000;
+        }
+    }
+
+private:
+    MonotonicStopWatch _watch;
+    HdfsScanStats* _stats;
+    bvar::LatencyRecorder* _latency;
+};
+
 class CountedSeekableInputStream final : public io::SeekableInputStreamWrapper {
 public:
-    explicit CountedSeekableInputStream(const std::shared_ptr<io::SeekableInputStream>& stream, HdfsScanStats* stats)
-            : io::SeekableInputStreamWrapper(stream.get(), kDontTakeOwnership), _stream(stream), _stats(stats) {}
+    explicit CountedSeekableInputStream(const std::shared_ptr<io::SeekableInputStream>& stream, HdfsScanStats* stats,
+                                        bvar::LatencyRecorder* latency = nullptr)
+            : io::SeekableInputStreamWrapper(stream.get(), kDontTakeOwnership),
+              _stream(stream),
+              _stats(stats),
+              _latency(latency) {}
 
     ~CountedSeekableInputStream() override = default;
 
     StatusOr<int64_t> read(void* data, int64_t size) override {
-        SCOPED_RAW_TIMER(&_stats->io_ns);
+        ScopedIOTimer timer(_stats, _latency);
         _stats->io_count += 1;
         ASSIGN_OR_RETURN(auto nread, _stream->read(data, size));
         _stats->bytes_read += nread;
@@ -42,7 +75,7 @@ public:
     }
 
     Status read_at_fully(int64_t offset, void* data, int64_t size) override {
-        SCOPED_RAW_TIMER(&_stats->io_ns);
+        ScopedIOTimer timer(_stats, _latency);
         _stats->io_count += 1;
         _stats->bytes_read += size;
         return _stream->read_at_fully(offset, data, size);
@@ -54,7 +87,7 @@ public:
     }
 
     StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override {
-        SCOPED_RAW_TIMER(&_stats->io_ns);
+        ScopedIOTimer timer(_stats, _latency);
         _stats->io_count += 1;
         ASSIGN_OR_RETURN(auto nread, _stream->read_at(offset, out, count));
         _stats->bytes_read += nread;
@@ -64,6 +97,7 @@ public:
 private:
     std::shared_ptr<io::SeekableInputStream> _stream;
     HdfsScanStats* _stats;
+    bvar::LatencyRecorder* _latency;
 };
 
 bool HdfsScannerParams::is_lazy_materialization_slot(SlotId slot_id) const {
@@ -220,19 +254,32 @@ void HdfsScanner::close() noexcept {
 StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_file(
         std::shared_ptr<io::SharedBufferedInputStream>& shared_buffered_input_stream,
         std::shared_ptr<io::CacheInputStream>& cache_input_stream, const OpenFileOptions& options) {
-    ASSIGN_OR_RETURN(std::unique_ptr<RandomAccessFile> raw_file, options.fs->new_random_access_file(options.path))
+    RandomAccessFileOptions file_options;
+    file_options.modification_time = options.datacache_options.modification_time;
+    ASSIGN_OR_RETURN(std::unique_ptr<RandomAccessFile> raw_file,
+                     options.fs->new_random_access_file(file_options, options.path))
     const int64_t file_size = options.file_size;
     raw_file->set_size(file_size);
     const std::string& filename = raw_file->filename();
 
     std::shared_ptr<io::SeekableInputStream> input_stream = raw_file->stream();
 
-    input_stream = std::make_shared<CountedSeekableInputStream>(input_stream, options.fs_stats);
+    input_stream = std::make_shared<CountedSeekableInputStream>(input_stream, options.fs_stats,
+                                                                &g_hdfs_scanner_fs_read_latency);
 
     shared_buffered_input_stream = std::make_shared<io::SharedBufferedInputStream>(input_stream, filename, file_size);
-    const io::SharedBufferedInputStream::CoalesceOptions shared_options = {
+    io::SharedBufferedInputStream::CoalesceOptions shared_options = {
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+    if (config::io_coalesce_adaptive_distance_enable) {
+        // merge the gaps that are cheaper to read than to pay another request for, as measured on this storage
+        int64_t distance = io::ReadCostModel::of(filename)->break_even_distance();
+        if (distance > 0) {
+            shared_options.max_dist_size =
+                    std::clamp<int64_t>(distance, config::io_coalesce_adaptive_min_distance_size,
+                                        shared_options.max_buffer_size);
+        }
+    }
     shared_buffered_input_stream->set_coalesce_options(shared_options);
     input_stream = shared_buffered_input_stream;
 
@@ -249,6 +296,7 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
             cache_input_stream->set_enable_async_populate_mode(datacache_options.enable_datacache_async_populate_mode);
             cache_input_stream->set_enable_cache_io_adaptor(datacache_options.enable_datacache_io_adaptor);
             cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
+            cache_input_stream->set_read_ahead_blocks(config::datacache_read_ahead_blocks);
             input_stream = cache_input_stream;
         }
         cache_input_stream->set_priority(datacache_options.datacache_priority);
@@ -387,6 +435,8 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_read_timer, stats.read_cache_ns);
         COUNTER_UPDATE(profile->datacache_skip_read_counter, stats.skip_read_cache_count);
         COUNTER_UPDATE(profile->datacache_skip_read_bytes, stats.skip_read_cache_bytes);
+        COUNTER_UPDATE(profile->datacache_skip_write_counter, stats.skip_write_cache_count);
+        COUNTER_UPDATE(profile->datacache_skip_write_bytes, stats.skip_write_cache_bytes);
         COUNTER_UPDATE(profile->datacache_write_counter, stats.write_cache_count);
         COUNTER_UPDATE(profile->datacache_write_bytes, stats.write_cache_bytes);
         COUNTER_UPDATE(profile->datacache_write_timer, stats.write_cache_ns);
@@ -394,6 +444,10 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
+        for (int i = 0; i < io::IOLatencyHistogram::kNumBuckets; i++) {
+            COUNTER_UPDATE(profile->datacache_read_mem_latency[i], stats.read_mem_cache_latency.counts[i]);
+            COUNTER_UPDATE(profile->datacache_read_disk_latency[i], stats.read_disk_cache_latency.counts[i]);
+        }
 
         if (_scanner_params.datacache_options.enable_cache_select) {
             // For cache select, we will update load datacache metrics
@@ -425,6 +479,9 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->fs_bytes_read_counter, _fs_stats.bytes_read);
         COUNTER_UPDATE(profile->fs_io_timer, _fs_stats.io_ns);
         COUNTER_UPDATE(profile->fs_io_counter, _fs_stats.io_count);
+        for (int i = 0; i < io::IOLatencyHistogram::kNumBuckets; i++) {
+            COUNTER_UPDATE(profile->fs_io_latency[i], _fs_stats.io_latency.counts[i]);
+        }
     }
 
     // update scanner private profile.
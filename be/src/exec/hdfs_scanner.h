@@ -24,6 +24,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "fs/fs.h"
 #include "io/cache_input_stream.h"
+#include "io/io_latency_histogram.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
@@ -48,6 +49,7 @@ struct HdfsScanStats {
     int64_t io_ns = 0;
     int64_t io_count = 0;
     int64_t bytes_read = 0;
+    io::IOLatencyHistogram io_latency;
 
     int64_t expr_filter_ns = 0;
     int64_t column_read_ns = 0;
@@ -61,6 +63,7 @@ struct HdfsScanStats {
     int64_t level_decode_ns = 0;
     int64_t value_decode_ns = 0;
     int64_t page_read_ns = 0;
+    int64_t page_cache_hit_count = 0;
     // reader init
     int64_t footer_read_ns = 0;
     int64_t footer_cache_read_ns = 0;
@@ -73,6 +76,9 @@ struct HdfsScanStats {
     int64_t group_chunk_read_ns = 0;
     int64_t group_dict_filter_ns = 0;
     int64_t group_dict_decode_ns = 0;
+    // bloom filter
+    int64_t group_bloom_filter_read_ns = 0;
+    int64_t group_bloom_filter_skip = 0;
     // io coalesce
     int64_t group_active_lazy_coalesce_together = 0;
     int64_t group_active_lazy_coalesce_seperately = 0;
@@ -124,6 +130,8 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_read_timer = nullptr;
     RuntimeProfile::Counter* datacache_skip_read_counter = nullptr;
     RuntimeProfile::Counter* datacache_skip_read_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_counter = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_bytes = nullptr;
     RuntimeProfile::Counter* datacache_write_counter = nullptr;
     RuntimeProfile::Counter* datacache_write_bytes = nullptr;
     RuntimeProfile::Counter* datacache_write_timer = nullptr;
@@ -131,6 +139,8 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_write_fail_bytes = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_counter = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_read_mem_latency[io::IOLatencyHistogram::kNumBuckets] = {nullptr};
+    RuntimeProfile::Counter* datacache_read_disk_latency[io::IOLatencyHistogram::kNumBuckets] = {nullptr};
 
     RuntimeProfile::Counter* shared_buffered_shared_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_io_bytes = nullptr;
@@ -146,6 +156,7 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* fs_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* fs_io_timer = nullptr;
     RuntimeProfile::Counter* fs_io_counter = nullptr;
+    RuntimeProfile::Counter* fs_io_latency[io::IOLatencyHistogram::kNumBuckets] = {nullptr};
 };
 
 struct HdfsScannerParams {
@@ -689,17 +689,39 @@ StatusOr<size_t> HdfsOrcScanner::_do_get_next(ChunkPtr* chunk) {
             continue;
         }
 
+        // The filter of the rows read by the active columns that survived, the dict filter has already
+        // removed some of them from the active columns but the lazy columns still read all of them.
+        Filter* lazy_filter = &_chunk_filter;
+        if (has_used_dict_filter) {
+            _lazy_filter.assign(_dict_filter.size(), 0);
+            for (size_t i = 0, j = 0; i < _dict_filter.size(); i++) {
+                if (_dict_filter[i]) {
+                    _lazy_filter[i] = _chunk_filter[j++];
+                }
+            }
+            lazy_filter = &_lazy_filter;
+        }
+        // Only decode the lazy columns from the first to the last surviving row, the rows outside are
+        // skipped, which is cheaper than decoding and then filtering them.
+        size_t first_row = SIMD::find_nonzero(*lazy_filter, 0);
+        size_t last_row = lazy_filter->size() - 1;
+        while (last_row > first_row && (*lazy_filter)[last_row] == 0) {
+            last_row--;
+        }
+        if (first_row != 0 || last_row + 1 != lazy_filter->size()) {
+            _app_stats.late_materialize_skip_rows += lazy_filter->size() - (last_row - first_row + 1);
+            lazy_filter->erase(lazy_filter->begin() + last_row + 1, lazy_filter->end());
+            lazy_filter->erase(lazy_filter->begin(), lazy_filter->begin() + first_row);
+        }
+
         {
             SCOPED_RAW_TIMER(&_app_stats.column_read_ns);
-            RETURN_IF_ERROR(_orc_reader->lazy_seek_to(position.row_in_stripe));
-            RETURN_IF_ERROR(_orc_reader->lazy_read_next(read_num_values));
+            RETURN_IF_ERROR(_orc_reader->lazy_seek_to(position.row_in_stripe + first_row));
+            RETURN_IF_ERROR(_orc_reader->lazy_read_next(lazy_filter->size()));
         }
         {
             SCOPED_RAW_TIMER(&_app_stats.column_convert_ns);
-            if (has_used_dict_filter) {
-                _orc_reader->lazy_filter_on_cvb(&_dict_filter);
-            }
-            _orc_reader->lazy_filter_on_cvb(&_chunk_filter);
+            _orc_reader->lazy_filter_on_cvb(lazy_filter);
             StatusOr<ChunkPtr> ret = _orc_reader->get_lazy_chunk();
             RETURN_IF_ERROR(ret);
             Chunk& ret_ck = *(ret.value());
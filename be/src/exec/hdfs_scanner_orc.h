@@ -67,6 +67,7 @@ private:
     std::shared_ptr<OrcRowReaderFilter> _orc_row_reader_filter;
     Filter _dict_filter;
     Filter _chunk_filter;
+    Filter _lazy_filter;
     std::set<int64_t> _need_skip_rowids;
     std::unique_ptr<ORCHdfsFileStream> _input_stream;
 };
@@ -56,6 +56,7 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     RuntimeProfile::Counter* level_decode_timer = nullptr;
     RuntimeProfile::Counter* value_decode_timer = nullptr;
     RuntimeProfile::Counter* page_read_timer = nullptr;
+    RuntimeProfile::Counter* page_cache_hit_counter = nullptr;
 
     // reader init
     RuntimeProfile::Counter* footer_read_timer = nullptr;
@@ -71,6 +72,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     RuntimeProfile::Counter* group_dict_filter_timer = nullptr;
     RuntimeProfile::Counter* group_dict_decode_timer = nullptr;
 
+    // bloom filter
+    RuntimeProfile::Counter* group_bloom_filter_read_timer = nullptr;
+    RuntimeProfile::Counter* group_bloom_filter_skip = nullptr;
+
     // io coalesce
     RuntimeProfile::Counter* group_active_lazy_coalesce_together = nullptr;
     RuntimeProfile::Counter* group_active_lazy_coalesce_seperately = nullptr;
@@ -105,12 +110,16 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     value_decode_timer = ADD_CHILD_TIMER(root, "ValueDecodeTime", kParquetProfileSectionPrefix);
 
     page_read_timer = ADD_CHILD_TIMER(root, "PageReadTime", kParquetProfileSectionPrefix);
+    page_cache_hit_counter = ADD_CHILD_COUNTER(root, "PageCacheHitCount", TUnit::UNIT, kParquetProfileSectionPrefix);
     footer_read_timer = ADD_CHILD_TIMER(root, "ReaderInitFooterRead", kParquetProfileSectionPrefix);
     column_reader_init_timer = ADD_CHILD_TIMER(root, "ReaderInitColumnReaderInit", kParquetProfileSectionPrefix);
 
     group_chunk_read_timer = ADD_CHILD_TIMER(root, "GroupChunkRead", kParquetProfileSectionPrefix);
     group_dict_filter_timer = ADD_CHILD_TIMER(root, "GroupDictFilter", kParquetProfileSectionPrefix);
     group_dict_decode_timer = ADD_CHILD_TIMER(root, "GroupDictDecode", kParquetProfileSectionPrefix);
+    group_bloom_filter_read_timer = ADD_CHILD_TIMER(root, "GroupBloomFilterRead", kParquetProfileSectionPrefix);
+    group_bloom_filter_skip =
+            ADD_CHILD_COUNTER(root, "GroupBloomFilterSkipCounter", TUnit::UNIT, kParquetProfileSectionPrefix);
 
     group_active_lazy_coalesce_together = ADD_CHILD_COUNTER(root, "GroupActiveLazyColumnIOCoalesceTogether",
                                                             TUnit::UNIT, kParquetProfileSectionPrefix);
@@ -130,6 +139,7 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(value_decode_timer, _app_stats.value_decode_ns);
     COUNTER_UPDATE(level_decode_timer, _app_stats.level_decode_ns);
     COUNTER_UPDATE(page_read_timer, _app_stats.page_read_ns);
+    COUNTER_UPDATE(page_cache_hit_counter, _app_stats.page_cache_hit_count);
     COUNTER_UPDATE(footer_read_timer, _app_stats.footer_read_ns);
     COUNTER_UPDATE(footer_cache_write_counter, _app_stats.footer_cache_write_count);
     COUNTER_UPDATE(footer_cache_write_bytes, _app_stats.footer_cache_write_bytes);
@@ -140,6 +150,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(group_chunk_read_timer, _app_stats.group_chunk_read_ns);
     COUNTER_UPDATE(group_dict_filter_timer, _app_stats.group_dict_filter_ns);
     COUNTER_UPDATE(group_dict_decode_timer, _app_stats.group_dict_decode_ns);
+    COUNTER_UPDATE(group_bloom_filter_read_timer, _app_stats.group_bloom_filter_read_ns);
+    COUNTER_UPDATE(group_bloom_filter_skip, _app_stats.group_bloom_filter_skip);
     COUNTER_UPDATE(group_active_lazy_coalesce_together, _app_stats.group_active_lazy_coalesce_together);
     COUNTER_UPDATE(group_active_lazy_coalesce_seperately, _app_stats.group_active_lazy_coalesce_seperately);
     int64_t page_stats = _app_stats.has_page_statistics ? 1 : 0;
@@ -17,6 +17,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
+#include "exec/position_delete_cache.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "formats/orc/orc_input_stream.h"
 #include "formats/parquet/file_reader.h"
@@ -133,6 +134,18 @@ Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::s
     }
 }
 
+Status IcebergDeleteBuilder::build_position_delete(PositionDeleteBuilder* builder, const std::string& timezone,
+                                                   const TIcebergDeleteFile& delete_file) const {
+    // A delete file is never rewritten in place, its path and length identify its content.
+    std::string cache_key = strings::Substitute("$0:$1:$2", delete_file.full_path, delete_file.length, _datafile_path);
+    return PositionDeleteCache::get_or_build(
+            cache_key,
+            [&](std::set<int64_t>* rowids) {
+                return builder->build(timezone, delete_file.full_path, delete_file.length, rowids);
+            },
+            _need_skip_rowids);
+}
+
 Status ORCEqualityDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
                                        int64_t file_length, const std::shared_ptr<DefaultMORProcessor> mor_processor,
                                        std::vector<SlotDescriptor*> slot_descs,
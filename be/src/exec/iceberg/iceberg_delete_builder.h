@@ -131,8 +131,8 @@ public:
                      const std::vector<SlotDescriptor*>& slots, RuntimeState* state,
                      std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ORCPositionDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ORCPositionDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return build_position_delete(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
             return ORCEqualityDeleteBuilder(_fs, _datacache_options, _datafile_path)
                     .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
@@ -149,8 +149,8 @@ public:
                          const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
                          std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ParquetPositionDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ParquetPositionDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return build_position_delete(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
             return ParquetEqualityDeleteBuilder(_fs, _datacache_options, _datafile_path)
                     .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
@@ -163,6 +163,9 @@ public:
     }
 
 private:
+    Status build_position_delete(PositionDeleteBuilder* builder, const std::string& timezone,
+                                 const TIcebergDeleteFile& delete_file) const;
+
     FileSystem* _fs;
     std::string _datafile_path;
     std::set<int64_t>* _need_skip_rowids;
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
 #include "serde/column_array_serde.h"
@@ -76,8 +77,8 @@ void HashTableProbeState::consider_probe_time_locality() {
 
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->first, table_items->bucket_size);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->next, table_items->row_count + 1);
     table_items->build_slice.resize(table_items->row_count + 1);
     table_items->build_pool = std::make_unique<MemPool>();
 }
@@ -340,6 +341,8 @@ void JoinHashTable::create(const HashTableParam& param) {
     _table_items->join_type = param.join_type;
     _table_items->mor_reader_mode = param.mor_reader_mode;
     _table_items->enable_late_materialization = param.enable_late_materialization;
+    _table_items->enable_open_addressing = config::enable_join_hash_map_open_addressing;
+    _table_items->enable_probe_bloom_filter = config::enable_join_probe_bloom_filter;
 
     if (_table_items->join_type == TJoinOp::RIGHT_SEMI_JOIN || _table_items->join_type == TJoinOp::RIGHT_ANTI_JOIN ||
         _table_items->join_type == TJoinOp::RIGHT_OUTER_JOIN) {
@@ -521,23 +524,27 @@ void JoinHashTable::_init_join_keys() {
     }
 }
 
-int64_t JoinHashTable::mem_usage() const {
-    int64_t usage = 0;
+JoinHashTableMemUsage JoinHashTable::mem_usage_breakdown() const {
+    JoinHashTableMemUsage usage;
     if (_table_items->build_chunk != nullptr) {
-        usage += _table_items->build_chunk->memory_usage();
+        usage.build_chunk += _table_items->build_chunk->memory_usage();
+    }
+    usage.buckets += _table_items->first.capacity() * sizeof(uint32_t);
+    usage.buckets += _table_items->next.capacity() * sizeof(uint32_t);
+    usage.buckets += _table_items->ctrl.capacity();
+    if (_table_items->bloom_filter != nullptr) {
+        usage.buckets += _table_items->bloom_filter->get_alloc_size();
     }
-    usage += _table_items->first.capacity() * sizeof(uint32_t);
-    usage += _table_items->next.capacity() * sizeof(uint32_t);
     if (_table_items->build_pool != nullptr) {
-        usage += _table_items->build_pool->total_reserved_bytes();
+        usage.keys += _table_items->build_pool->total_reserved_bytes();
     }
     if (_probe_state->probe_pool != nullptr) {
-        usage += _probe_state->probe_pool->total_reserved_bytes();
+        usage.keys += _probe_state->probe_pool->total_reserved_bytes();
     }
     if (_table_items->build_key_column != nullptr) {
-        usage += _table_items->build_key_column->memory_usage();
+        usage.keys += _table_items->build_key_column->memory_usage();
     }
-    usage += _table_items->build_slice.size() * sizeof(Slice);
+    usage.keys += _table_items->build_slice.size() * sizeof(Slice);
     return usage;
 }
 
@@ -29,7 +29,9 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "exprs/runtime_filter.h"
 #include "simd/simd.h"
+#include "util/huge_pages.h"
 #include "util/phmap/phmap.h"
 
 #if defined(__aarch64__)
@@ -113,6 +115,12 @@ struct JoinHashTableItems {
     // about the bucket-chained hash table of this kind.
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
+    // The tags of the open-addressing layout, see JoinHashMapOpenAddressing.
+    Buffer<uint8_t> ctrl;
+    // The blocked bloom filter of the build keys. It is only built when the buckets are too large to stay in
+    // the cache, and the probe tests it before reading "first", so that most probe rows without a match
+    // skip the random access to the buckets.
+    std::shared_ptr<SimdBlockFilter> bloom_filter = nullptr;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column = nullptr;
     uint32_t bucket_size = 0;
@@ -132,6 +140,10 @@ struct JoinHashTableItems {
     bool cache_miss_serious = false;
     bool mor_reader_mode = false;
     bool enable_late_materialization = false;
+    // Whether the open-addressing layout may be tried for the fixed-size keys, and whether it is used.
+    bool enable_open_addressing = false;
+    bool open_addressing = false;
+    bool enable_probe_bloom_filter = false;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -229,6 +241,16 @@ struct HashTableProbeState {
     size_t probe_chunks = 0;
     uint32_t detect_step = 1;
     bool last_enable_interleaving = true;
+    // used to adaptively consult the bloom filter of the hash table, which is skipped when most probe rows
+    // pass it. The pass rate is checked again every 64 chunks once it is skipped.
+    static constexpr double BLOOM_FILTER_MAX_PASS_RATE = 0.5;
+    bool use_bloom_filter = true;
+    size_t bloom_filter_skipped_chunks = 0;
+
+    bool should_use_bloom_filter() { return use_bloom_filter || (++bloom_filter_skipped_chunks & 63) == 0; }
+    void update_bloom_filter_pass_rate(size_t passed_rows, size_t rows) {
+        use_bloom_filter = passed_rows <= rows * BLOOM_FILTER_MAX_PASS_RATE;
+    }
 
     std::set<std::coroutine_handle<ProbeCoroutine::ProbePromise>> handles;
 
@@ -344,6 +366,16 @@ public:
         return phmap::priv::NormalizeCapacity(expect_bucket_size) + 1;
     }
 
+    // Same as buffer->assign(size, 0). The buckets and chains of the hash table are accessed randomly,
+    // so huge pages are advised for them before they are touched.
+    template <typename T>
+    static void assign_hash_table_buffer(Buffer<T>* buffer, size_t size) {
+        buffer->clear();
+        buffer->reserve(size);
+        madvise_huge_pages(buffer->data(), buffer->capacity() * sizeof(T));
+        buffer->resize(size, 0);
+    }
+
     template <typename CppType>
     static uint32_t calc_bucket_num(const CppType& value, uint32_t bucket_size) {
         using HashFunc = JoinKeyHash<CppType>;
@@ -359,6 +391,50 @@ public:
         }
     }
 
+    // The hash of a join key only has 32 significant bits, so spread it to 64 bits for the bloom filter,
+    // which takes the low bits as the block index and the high bits to set the bits in the block.
+    static uint64_t calc_bloom_filter_hash(size_t hash) { return hash * 0x9E3779B97F4A7C15ULL; }
+
+    template <typename CppType>
+    static void build_bloom_filter(JoinHashTableItems* table_items, const Buffer<CppType>& keys,
+                                   const uint8_t* is_nulls) {
+        using HashFunc = JoinKeyHash<CppType>;
+
+        auto bloom_filter = std::make_shared<SimdBlockFilter>();
+        bloom_filter->init(table_items->row_count);
+        for (uint32_t i = 1; i < table_items->row_count + 1; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                bloom_filter->insert_hash(calc_bloom_filter_hash(HashFunc()(keys[i])));
+            }
+        }
+        table_items->bloom_filter = std::move(bloom_filter);
+    }
+
+    // Same as calc_bucket_nums and reading "first", except that the keys rejected by the bloom filter
+    // never touch the buckets.
+    template <typename CppType>
+    static void lookup_with_bloom_filter(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                         const Buffer<CppType>& keys, const uint8_t* is_nulls, uint32_t count) {
+        using HashFunc = JoinKeyHash<CppType>;
+
+        const auto& bloom_filter = *table_items.bloom_filter;
+        size_t rows = 0;
+        size_t passed_rows = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            probe_state->next[i] = 0;
+            if (is_nulls != nullptr && is_nulls[i] != 0) {
+                continue;
+            }
+            rows++;
+            const size_t hash = HashFunc()(keys[i]);
+            if (bloom_filter.test_hash(calc_bloom_filter_hash(hash))) {
+                probe_state->next[i] = table_items.first[hash & (table_items.bucket_size - 1)];
+                passed_rows++;
+            }
+        }
+        probe_state->update_bloom_filter_pass_rate(passed_rows, rows);
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -386,6 +462,142 @@ public:
     }
 };
 
+// Open-addressing layout of the join hash table for fixed-size keys, in the style of SwissTable.
+//
+// "JoinHashTableItems.first" holds one build row index per slot and "JoinHashTableItems.ctrl" holds a
+// 7-bit tag of the key hash per slot (0 marks an empty slot). A probe starts at the group of 16 slots the
+// hash points to, compares the tags of the whole group at once, and only reads the build key of the slots
+// whose tag matches, so most missing keys cost a single cache line of "ctrl". Build rows whose key is
+// already in the table are chained behind its slot through "JoinHashTableItems.next", so that a chain
+// only holds equal keys and the probe loops of JoinHashMap can walk it unchanged.
+//
+// It only pays off when the build keys are (almost) unique, so the build gives up and returns false once
+// too many duplicated keys are seen, and the caller rebuilds the bucket-chained layout instead.
+template <typename CppType>
+class JoinHashMapOpenAddressing {
+public:
+    static constexpr bool supported = std::is_integral_v<CppType> || std::is_same_v<CppType, int128_t>;
+    static constexpr uint32_t GROUP_WIDTH = 16;
+    // At least this ratio of the build rows must hold distinct keys.
+    static constexpr double MIN_DISTINCT_RATIO = 0.9;
+
+    // |is_nulls| is indexed by build row and may be null when the keys have no null.
+    static bool build(JoinHashTableItems* table_items, const Buffer<CppType>& keys, const uint8_t* is_nulls) {
+        const uint32_t row_count = table_items->row_count;
+        // Keep the load factor no more than 0.5.
+        const size_t capacity = std::max<size_t>(GROUP_WIDTH, phmap::priv::NormalizeCapacity(2UL * row_count) + 1);
+        if (capacity > JoinHashMapHelper::MAX_BUCKET_SIZE) {
+            return false;
+        }
+        const auto mask = static_cast<uint32_t>(capacity - 1);
+        const auto max_duplicates = static_cast<uint32_t>(row_count * (1 - MIN_DISTINCT_RATIO));
+
+        auto& ctrl = table_items->ctrl;
+        auto& first = table_items->first;
+        auto& next = table_items->next;
+        JoinHashMapHelper::assign_hash_table_buffer(&ctrl, capacity);
+        JoinHashMapHelper::assign_hash_table_buffer(&first, capacity);
+        JoinHashMapHelper::assign_hash_table_buffer(&next, row_count + 1);
+
+        uint32_t duplicates = 0;
+        for (uint32_t i = 1; i < row_count + 1; i++) {
+            if (is_nulls != nullptr && is_nulls[i] != 0) {
+                continue;
+            }
+            const uint32_t hash = JoinKeyHash<CppType>()(keys[i]);
+            const uint8_t tag = _tag(hash);
+            uint32_t group = hash & mask & ~(GROUP_WIDTH - 1);
+            while (true) {
+                uint32_t matches = _match(&ctrl[group], tag);
+                uint32_t found = 0;
+                while (matches != 0) {
+                    const uint32_t slot = group + __builtin_ctz(matches);
+                    if (keys[first[slot]] == keys[i]) {
+                        found = first[slot];
+                        break;
+                    }
+                    matches &= matches - 1;
+                }
+                if (found != 0) {
+                    next[i] = next[found];
+                    next[found] = i;
+                    if (++duplicates > max_duplicates) {
+                        ctrl.clear();
+                        first.assign(table_items->bucket_size, 0);
+                        next.assign(row_count + 1, 0);
+                        return false;
+                    }
+                    break;
+                }
+                const uint32_t empties = _match(&ctrl[group], 0);
+                if (empties != 0) {
+                    const uint32_t slot = group + __builtin_ctz(empties);
+                    ctrl[slot] = tag;
+                    first[slot] = i;
+                    break;
+                }
+                group = (group + GROUP_WIDTH) & mask;
+            }
+        }
+
+        table_items->bucket_size = capacity;
+        table_items->open_addressing = true;
+        return true;
+    }
+
+    // Finds the first build row matching each probe key and saves it to |next|, or 0 if there is none.
+    static void lookup(const JoinHashTableItems& table_items, const Buffer<CppType>& build_keys,
+                       const Buffer<CppType>& probe_keys, const uint8_t* is_nulls, uint32_t probe_row_count,
+                       Buffer<uint32_t>* next) {
+        const uint8_t* ctrl = table_items.ctrl.data();
+        const uint32_t* first = table_items.first.data();
+        const uint32_t mask = table_items.bucket_size - 1;
+
+        for (uint32_t i = 0; i < probe_row_count; i++) {
+            (*next)[i] = 0;
+            if (is_nulls != nullptr && is_nulls[i] != 0) {
+                continue;
+            }
+            const uint32_t hash = JoinKeyHash<CppType>()(probe_keys[i]);
+            const uint8_t tag = _tag(hash);
+            uint32_t group = hash & mask & ~(GROUP_WIDTH - 1);
+            while (true) {
+                uint32_t matches = _match(ctrl + group, tag);
+                while (matches != 0) {
+                    const uint32_t slot = group + __builtin_ctz(matches);
+                    if (build_keys[first[slot]] == probe_keys[i]) {
+                        (*next)[i] = first[slot];
+                        break;
+                    }
+                    matches &= matches - 1;
+                }
+                if ((*next)[i] != 0 || _match(ctrl + group, 0) != 0) {
+                    break;
+                }
+                group = (group + GROUP_WIDTH) & mask;
+            }
+        }
+    }
+
+private:
+    // The high bit is always set so that a tag never equals to the empty slot.
+    static uint8_t _tag(uint32_t hash) { return static_cast<uint8_t>((hash >> 25) | 0x80); }
+
+    // Returns a bitmap of the slots of the group whose control byte equals to |value|.
+    static uint32_t _match(const uint8_t* group, uint8_t value) {
+#ifdef __SSE2__
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else
+        uint32_t bits = 0;
+        for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+            bits |= static_cast<uint32_t>(group[i] == value) << i;
+        }
+        return bits;
+#endif
+    }
+};
+
 template <LogicalType LT>
 class JoinBuildFunc {
 public:
@@ -425,6 +637,9 @@ public:
                                      HashTableProbeState* probe_state);
 
 private:
+    static Buffer<uint8_t> _build_is_nulls(const NullColumns& null_columns, uint32_t row_count);
+    static bool _build_open_addressing(JoinHashTableItems* table_items, const Columns& data_columns,
+                                       const NullColumns& null_columns);
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                const Columns& data_columns, uint32_t start, uint32_t count);
 
@@ -459,6 +674,10 @@ public:
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
     static bool equal(const CppType& x, const CppType& y) { return x == y; }
+
+private:
+    // Returns the null flags of the probe keys, or null if there is no null.
+    static const uint8_t* _init_null_array(HashTableProbeState* probe_state);
 };
 
 template <LogicalType LT>
@@ -805,6 +1024,25 @@ private:
 #define JoinHashMapForFixedSizeKey(LT) JoinHashMap<LT, FixedSizeJoinBuildFunc<LT>, FixedSizeJoinProbeFunc<LT>>
 #define JoinHashMapForSerializedKey(LT) JoinHashMap<LT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
 
+// Memory held by the components of a JoinHashTable, shown in the profile of the build operator.
+struct JoinHashTableMemUsage {
+    // the build rows
+    int64_t build_chunk = 0;
+    // "first", "next", "ctrl" and the bloom filter
+    int64_t buckets = 0;
+    // the build and probe keys which aren't columns of the build chunk, and the pools holding them
+    int64_t keys = 0;
+
+    int64_t total() const { return build_chunk + buckets + keys; }
+
+    JoinHashTableMemUsage& operator+=(const JoinHashTableMemUsage& rhs) {
+        build_chunk += rhs.build_chunk;
+        buckets += rhs.buckets;
+        keys += rhs.keys;
+        return *this;
+    }
+};
+
 class JoinHashTable {
 public:
     JoinHashTable() = default;
@@ -851,7 +1089,8 @@ public:
     void remove_duplicate_index(Filter* filter);
     JoinHashTableItems* table_items() const { return _table_items.get(); }
 
-    int64_t mem_usage() const;
+    int64_t mem_usage() const { return mem_usage_breakdown().total(); }
+    JoinHashTableMemUsage mem_usage_breakdown() const;
 
 private:
     void _init_probe_column(const HashTableParam& param);
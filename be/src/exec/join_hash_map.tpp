@@ -25,8 +25,8 @@ namespace starrocks {
 template <LogicalType LT>
 void JoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->first, table_items->bucket_size);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->next, table_items->row_count + 1);
 }
 
 template <LogicalType LT>
@@ -55,6 +55,20 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
+    if constexpr (JoinHashMapOpenAddressing<CppType>::supported) {
+        if (table_items->enable_open_addressing) {
+            const uint8_t* is_nulls = nullptr;
+            if (table_items->key_columns[0]->is_nullable()) {
+                auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+                is_nulls = nullable_column->null_column()->get_data().data();
+            }
+            if (JoinHashMapOpenAddressing<CppType>::build(table_items, data, is_nulls)) {
+                table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
+                return;
+            }
+        }
+    }
+
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
@@ -73,6 +87,15 @@ void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableI
         }
     }
     table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
+
+    if (table_items->enable_probe_bloom_filter && table_items->ht_cache_miss_serious()) {
+        const uint8_t* is_nulls = nullptr;
+        if (table_items->key_columns[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+            is_nulls = nullable_column->null_column()->get_data().data();
+        }
+        JoinHashMapHelper::build_bloom_filter<CppType>(table_items, data, is_nulls);
+    }
 }
 
 template <LogicalType LT>
@@ -80,8 +103,8 @@ void DirectMappingJoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTabl
     static constexpr size_t BUCKET_SIZE =
             (int64_t)(RunTimeTypeLimits<LT>::max_value()) - (int64_t)(RunTimeTypeLimits<LT>::min_value()) + 1L;
     table_items->bucket_size = BUCKET_SIZE;
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->first, table_items->bucket_size);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->next, table_items->row_count + 1);
 }
 
 template <LogicalType LT>
@@ -124,8 +147,8 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
 template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->first, table_items->bucket_size);
+    JoinHashMapHelper::assign_hash_table_buffer(&table_items->next, table_items->row_count + 1);
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
@@ -151,6 +174,13 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
         }
     }
 
+    if constexpr (JoinHashMapOpenAddressing<CppType>::supported) {
+        if (table_items->enable_open_addressing && _build_open_addressing(table_items, data_columns, null_columns)) {
+            table_items->calculate_ht_info(table_items->build_key_column->byte_size());
+            return;
+        }
+    }
+
     // serialize and build hash table
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
@@ -169,6 +199,39 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
         _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem);
     }
     table_items->calculate_ht_info(table_items->build_key_column->byte_size());
+
+    if (table_items->enable_probe_bloom_filter && table_items->ht_cache_miss_serious()) {
+        Buffer<uint8_t> is_nulls = _build_is_nulls(null_columns, row_count);
+        JoinHashMapHelper::build_bloom_filter<CppType>(table_items, get_key_data(*table_items),
+                                                       is_nulls.empty() ? nullptr : is_nulls.data());
+    }
+}
+
+template <LogicalType LT>
+Buffer<uint8_t> FixedSizeJoinBuildFunc<LT>::_build_is_nulls(const NullColumns& null_columns, uint32_t row_count) {
+    Buffer<uint8_t> is_nulls;
+    if (!null_columns.empty()) {
+        is_nulls.assign(row_count + 1, 0);
+        for (const auto& null_column : null_columns) {
+            const auto& null_data = null_column->get_data();
+            for (uint32_t i = 1; i < row_count + 1; i++) {
+                is_nulls[i] |= null_data[i];
+            }
+        }
+    }
+    return is_nulls;
+}
+
+template <LogicalType LT>
+bool FixedSizeJoinBuildFunc<LT>::_build_open_addressing(JoinHashTableItems* table_items, const Columns& data_columns,
+                                                        const NullColumns& null_columns) {
+    uint32_t row_count = table_items->row_count;
+    JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), 1,
+                                                           row_count);
+
+    Buffer<uint8_t> is_nulls = _build_is_nulls(null_columns, row_count);
+    return JoinHashMapOpenAddressing<CppType>::build(table_items, get_key_data(*table_items),
+                                                     is_nulls.empty() ? nullptr : is_nulls.data());
 }
 
 template <LogicalType LT>
@@ -264,6 +327,23 @@ template <LogicalType LT>
 void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     size_t probe_row_count = probe_state->probe_row_count;
     auto& data = get_key_data(*probe_state);
+    if constexpr (JoinHashMapOpenAddressing<CppType>::supported) {
+        if (table_items.open_addressing) {
+            const uint8_t* is_nulls = _init_null_array(probe_state);
+            JoinHashMapOpenAddressing<CppType>::lookup(table_items, JoinBuildFunc<LT>::get_key_data(table_items), data,
+                                                       is_nulls, probe_row_count, &probe_state->next);
+            probe_state->consider_probe_time_locality();
+            return;
+        }
+    }
+    if (table_items.bloom_filter != nullptr && probe_state->should_use_bloom_filter()) {
+        const uint8_t* is_nulls = _init_null_array(probe_state);
+        JoinHashMapHelper::lookup_with_bloom_filter<CppType>(table_items, probe_state, data, is_nulls,
+                                                             probe_row_count);
+        probe_state->consider_probe_time_locality();
+        return;
+    }
+
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
 
     if ((*probe_state->key_columns)[0]->is_nullable()) {
@@ -296,6 +376,19 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
     probe_state->null_array = nullptr;
 }
 
+template <LogicalType LT>
+const uint8_t* JoinProbeFunc<LT>::_init_null_array(HashTableProbeState* probe_state) {
+    probe_state->null_array = nullptr;
+    if ((*probe_state->key_columns)[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
+        if (nullable_column->has_null()) {
+            probe_state->null_array = &nullable_column->null_column()->get_data();
+            return probe_state->null_array->data();
+        }
+    }
+    return nullptr;
+}
+
 template <LogicalType LT>
 const Buffer<typename JoinProbeFunc<LT>::CppType>& JoinProbeFunc<LT>::get_key_data(
         const HashTableProbeState& probe_state) {
@@ -350,6 +443,15 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
+    if (table_items.open_addressing) {
+        JoinHashMapOpenAddressing<CppType>::lookup(table_items, FixedSizeJoinBuildFunc<LT>::get_key_data(table_items),
+                                                   data, nullptr, row_count, &probe_state->next);
+        return;
+    }
+    if (table_items.bloom_filter != nullptr && probe_state->should_use_bloom_filter()) {
+        JoinHashMapHelper::lookup_with_bloom_filter<CppType>(table_items, probe_state, data, nullptr, row_count);
+        return;
+    }
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
     for (uint32_t i = 0; i < row_count; i++) {
@@ -376,6 +478,16 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
+    if (table_items.open_addressing) {
+        JoinHashMapOpenAddressing<CppType>::lookup(table_items, FixedSizeJoinBuildFunc<LT>::get_key_data(table_items),
+                                                   data, probe_state->is_nulls.data(), row_count, &probe_state->next);
+        return;
+    }
+    if (table_items.bloom_filter != nullptr && probe_state->should_use_bloom_filter()) {
+        JoinHashMapHelper::lookup_with_bloom_filter<CppType>(table_items, probe_state, data,
+                                                             probe_state->is_nulls.data(), row_count);
+        return;
+    }
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
     for (uint32_t i = 0; i < row_count; i++) {
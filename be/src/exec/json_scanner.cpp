@@ -499,7 +499,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
         uint32_t key_index = 0;
         for (auto field : *row) {
             int column_index;
-            std::string_view key = field.unescaped_key();
+            std::string_view key;
 
             // _prev_parsed_position records the chunk column index for each key of previous parsed json object.
             // For example, if previous json object is
@@ -519,7 +519,19 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
             // index for 'b' is 2. Since previous parsed json object doesn't contain 'c', key 'c' 's column index
             // needs to be searched from the _slot_desc_dict, and if the key 'c' refers to the 3rd column of chunk,
             // then we will update the _prev_parsed_position to be [{'a', 1, int}, {'b', 2, int}, {'c', 3, int}].
-            if (LIKELY(_prev_parsed_position.size() > key_index && _prev_parsed_position[key_index].key == key)) {
+            //
+            // The key is first compared with the raw key in the json text, so that a key matching the previous
+            // object doesn't need to be unescaped.
+            bool key_matched = false;
+            if (LIKELY(_prev_parsed_position.size() > key_index && _prev_parsed_position[key_index].raw_comparable)) {
+                simdjson::ondemand::raw_json_string raw_key = field.key();
+                key_matched = raw_key.unsafe_is_equal(_prev_parsed_position[key_index].key);
+            }
+            if (!key_matched) {
+                key = field.unescaped_key();
+                key_matched = _prev_parsed_position.size() > key_index && _prev_parsed_position[key_index].key == key;
+            }
+            if (LIKELY(key_matched)) {
                 // obtain column_index from previous parsed position
                 column_index = _prev_parsed_position[key_index].column_index;
                 if (column_index < 0) {
@@ -535,7 +547,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
                     if (_prev_parsed_position.size() <= key_index) {
                         _prev_parsed_position.emplace_back(key);
                     } else {
-                        _prev_parsed_position[key_index].key = key;
+                        _prev_parsed_position[key_index].set_key(key);
                         _prev_parsed_position[key_index].column_index = -1;
                     }
                     key_index++;
@@ -543,14 +555,14 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
                 }
 
                 auto slot_desc = itr->second;
-                auto type_desc = _type_desc_dict[key];
+                const auto& type_desc = _type_desc_dict[key];
 
                 // update the prev parsed position
                 column_index = chunk->get_index_by_slot_id(slot_desc->id());
                 if (_prev_parsed_position.size() <= key_index) {
                     _prev_parsed_position.emplace_back(key, column_index, type_desc);
                 } else {
-                    _prev_parsed_position[key_index].key = key;
+                    _prev_parsed_position[key_index].set_key(key);
                     _prev_parsed_position[key_index].column_index = column_index;
                     _prev_parsed_position[key_index].type = type_desc;
                 }
@@ -95,11 +95,21 @@ public:
     Status close();
 
     struct PreviousParsedItem {
-        PreviousParsedItem(const std::string_view& key) : key(key), column_index(-1) {}
+        PreviousParsedItem(const std::string_view& key) : column_index(-1) { set_key(key); }
         PreviousParsedItem(const std::string_view& key, int column_index, const TypeDescriptor& type)
-                : key(key), type(type), column_index(column_index) {}
+                : type(type), column_index(column_index) {
+            set_key(key);
+        }
+
+        void set_key(const std::string_view& k) {
+            key = k;
+            raw_comparable = k.find_first_of("\\\"") == std::string_view::npos;
+        }
 
         std::string key;
+        // Whether the key can be compared with the raw (escaped) key in the json text, which is true
+        // unless it has a character that is escaped in json.
+        bool raw_comparable = false;
         TypeDescriptor type;
         int column_index;
     };
@@ -86,6 +86,8 @@ public:
 
     int estimated_max_concurrent_chunks() const;
 
+    size_t estimated_scan_row_bytes() const { return _estimated_scan_row_bytes; }
+
     static StatusOr<TabletSharedPtr> get_tablet(const TInternalScanRange* scan_range);
     static StatusOr<std::vector<RowsetSharedPtr>> capture_tablet_rowsets(const TabletSharedPtr& tablet,
                                                                          const TInternalScanRange* scan_range);
@@ -14,15 +14,27 @@
 
 #include "paimon_delete_file_builder.h"
 
+#include <fmt/format.h>
 #include <roaring/roaring.h>
 
 #include <bitset>
 
+#include "exec/position_delete_cache.h"
 #include "util/raw_container.h"
 
 namespace starrocks {
 
 Status PaimonDeleteFileBuilder::build(const TPaimonDeletionFile* paimon_deletion_file) {
+    // Index files of paimon are never rewritten, a deletion vector is identified by its file and range.
+    std::string cache_key = fmt::format("paimon:{}:{}:{}", paimon_deletion_file->path, paimon_deletion_file->offset,
+                                        paimon_deletion_file->length);
+    return PositionDeleteCache::get_or_build(
+            cache_key, [&](std::set<int64_t>* rowids) { return _read_deletion_vector(paimon_deletion_file, rowids); },
+            _need_skip_rowids);
+}
+
+Status PaimonDeleteFileBuilder::_read_deletion_vector(const TPaimonDeletionFile* paimon_deletion_file,
+                                                      std::set<int64_t>* rowids) {
     auto& path = paimon_deletion_file->path;
     auto& length = paimon_deletion_file->length;
     auto& offset = paimon_deletion_file->offset;
@@ -60,7 +72,7 @@ Status PaimonDeleteFileBuilder::build(const TPaimonDeletionFile* paimon_deletion
     uint32_t bitmap_cardinality = roaring_bitmap_get_cardinality(bitmap);
     std::unique_ptr<uint32_t[]> bitmap_array(new uint32_t[bitmap_cardinality]);
     roaring_bitmap_to_uint32_array(bitmap, bitmap_array.get());
-    _need_skip_rowids->insert(bitmap_array.get(), bitmap_array.get() + bitmap_cardinality);
+    rowids->insert(bitmap_array.get(), bitmap_array.get() + bitmap_cardinality);
 
     roaring_bitmap_free(bitmap);
 
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <set>
+
 #include "fs/fs.h"
 #include "gen_cpp/PlanNodes_types.h"
 
@@ -24,9 +26,12 @@ public:
     PaimonDeleteFileBuilder(FileSystem* fs, std::set<int64_t>* need_skip_rowids)
             : _fs(fs), _need_skip_rowids(need_skip_rowids) {}
     ~PaimonDeleteFileBuilder() = default;
+    // The positions of a deletion vector are kept in PositionDeleteCache across queries.
     Status build(const TPaimonDeletionFile* paimon_deletion_file);
 
 private:
+    Status _read_deletion_vector(const TPaimonDeletionFile* paimon_deletion_file, std::set<int64_t>* rowids);
+
     uint32_t swap_endian32(uint32_t val) {
         return ((val << 24) & 0xFF000000) | ((val << 8) & 0x00FF0000) | ((val >> 8) & 0x0000FF00) |
                ((val >> 24) & 0x000000FF);
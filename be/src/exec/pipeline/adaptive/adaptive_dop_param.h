@@ -21,6 +21,9 @@ namespace starrocks::pipeline {
 struct AdaptiveDopParam {
     size_t max_block_rows_per_driver_seq = 0;
     int64_t max_output_amplification_factor = 0;
+    // The max times that the downstream DOP can be raised over the upstream DOP,
+    // when the source turns out much larger than estimated. 1 means never scale up.
+    size_t max_scale_up_factor = 1;
 };
 
 } // namespace starrocks::pipeline
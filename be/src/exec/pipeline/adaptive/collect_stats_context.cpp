@@ -39,8 +39,9 @@ Status BlockState::push_chunk(int32_t driver_seq, ChunkPtr chunk) {
     size_t prev_num_rows = _num_rows.fetch_add(num_chunk_rows);
 
     // It receives _max_buffer_rows rows after this push_chunk, so transform to PASSTHROUGH state.
+    // The source is larger than expected, so scale up the downstream DOP if possible.
     if (prev_num_rows < _max_buffer_rows && prev_num_rows + num_chunk_rows >= _max_buffer_rows) {
-        _ctx->_transform_state(CollectStatsStateEnum::PASSTHROUGH, _ctx->_upstream_dop);
+        _ctx->_transform_state(CollectStatsStateEnum::PASSTHROUGH, _ctx->_scaled_up_dop());
     }
     return Status::OK();
 }
@@ -85,26 +86,41 @@ std::string PassthroughState::name() const {
 
 PassthroughState::PassthroughState(CollectStatsContext* const ctx)
         : CollectStatsState(ctx),
-          _in_chunk_queue_per_driver_seq(ctx->_max_dop),
-          _unpluging_per_driver_seq(ctx->_max_dop) {}
+          _in_chunk_queue_per_driver_seq(ctx->_max_dop * ctx->_scale_up_factor),
+          _unpluging_per_driver_seq(ctx->_max_dop * ctx->_scale_up_factor),
+          _num_pushed_chunks_per_driver_seq(ctx->_max_dop) {}
+
+int32_t PassthroughState::_next_downstream_driver_seq(int32_t upstream_driver_seq) const {
+    if (!_ctx->is_scaled_up()) {
+        return upstream_driver_seq;
+    }
+    const size_t scale_up_factor = _ctx->_downstream_dop / _ctx->_upstream_dop;
+    const size_t k = _num_pushed_chunks_per_driver_seq[upstream_driver_seq] % scale_up_factor;
+    return upstream_driver_seq + k * _ctx->_upstream_dop;
+}
 
 bool PassthroughState::need_input(int32_t driver_seq) const {
-    return _in_chunk_queue_per_driver_seq[driver_seq].queue.size_approx() < MAX_PASSTHROUGH_CHUNKS_PER_DRIVER_SEQ;
+    return _in_chunk_queue_per_driver_seq[_next_downstream_driver_seq(driver_seq)].queue.size_approx() <
+           MAX_PASSTHROUGH_CHUNKS_PER_DRIVER_SEQ;
 }
 
 Status PassthroughState::push_chunk(int32_t driver_seq, ChunkPtr chunk) {
-    auto& [chunk_queue, token] = _in_chunk_queue_per_driver_seq[driver_seq];
+    auto& [chunk_queue, token] = _in_chunk_queue_per_driver_seq[_next_downstream_driver_seq(driver_seq)];
     if (UNLIKELY(!chunk_queue.enqueue(token, std::move(chunk)))) {
         return Status::MemoryLimitExceeded(
                 "allocation failed when enqueueing into the passthrough queue of CollectStatsSink");
     }
+    _num_pushed_chunks_per_driver_seq[driver_seq]++;
     return Status::OK();
 }
 
 bool PassthroughState::has_output(int32_t driver_seq) const {
-    const auto& buffer_chunk_queue = _ctx->_buffer_chunk_queue(driver_seq);
-    if (!buffer_chunk_queue.empty()) {
-        return true;
+    // The chunks buffered by BlockState are only passed to the first upstream_dop downstream drivers.
+    if (driver_seq < _ctx->_upstream_dop) {
+        const auto& buffer_chunk_queue = _ctx->_buffer_chunk_queue(driver_seq);
+        if (!buffer_chunk_queue.empty()) {
+            return true;
+        }
     }
 
     size_t num_chunks = _in_chunk_queue_per_driver_seq[driver_seq].queue.size_approx();
@@ -120,18 +136,20 @@ bool PassthroughState::has_output(int32_t driver_seq) const {
         return true;
     }
 
-    if (_ctx->_is_finishing_per_driver_seq[driver_seq]) {
+    if (_ctx->_is_finishing_per_driver_seq[driver_seq % _ctx->_upstream_dop]) {
         return num_chunks > 0;
     }
     return false;
 }
 
 StatusOr<ChunkPtr> PassthroughState::pull_chunk(int32_t driver_seq) {
-    auto& buffer_chunk_queue = _ctx->_buffer_chunk_queue(driver_seq);
-    if (!buffer_chunk_queue.empty()) {
-        auto chunk = std::move(buffer_chunk_queue.front());
-        buffer_chunk_queue.pop();
-        return chunk;
+    if (driver_seq < _ctx->_upstream_dop) {
+        auto& buffer_chunk_queue = _ctx->_buffer_chunk_queue(driver_seq);
+        if (!buffer_chunk_queue.empty()) {
+            auto chunk = std::move(buffer_chunk_queue.front());
+            buffer_chunk_queue.pop();
+            return chunk;
+        }
     }
 
     auto& passthrough_chunk_queue = _in_chunk_queue_per_driver_seq[driver_seq].queue;
@@ -147,18 +165,24 @@ Status PassthroughState::set_finishing(int32_t driver_seq) {
 }
 
 bool PassthroughState::is_downstream_finished(int32_t driver_seq) const {
-    if (!_ctx->_is_finishing_per_driver_seq[driver_seq]) {
+    if (!_ctx->_is_finishing_per_driver_seq[driver_seq % _ctx->_upstream_dop]) {
         return false;
     }
 
-    const auto& buffer_chunk_queue = _ctx->_buffer_chunk_queue(driver_seq);
+    const bool is_buffer_empty = driver_seq >= _ctx->_upstream_dop || _ctx->_buffer_chunk_queue(driver_seq).empty();
     const auto& passthrough_chunk_queue = _in_chunk_queue_per_driver_seq[driver_seq].queue;
     // _is_finishing_per_driver_seq is set to true using memory_order_release after all the chunks are enqueued.
     // Therefore, enqueueing chunk hapens before setting _is_finishing_per_driver_seq to true.
-    return buffer_chunk_queue.empty() && passthrough_chunk_queue.size_approx() <= 0;
+    return is_buffer_empty && passthrough_chunk_queue.size_approx() <= 0;
 }
 bool PassthroughState::is_upstream_finished(int32_t driver_seq) const {
-    return _ctx->_is_finished_per_driver_seq[driver_seq];
+    // The upstream driver is finished only if all the downstream drivers which it passes chunks to are finished.
+    for (size_t seq = driver_seq; seq < _ctx->_downstream_dop; seq += _ctx->_upstream_dop) {
+        if (!_ctx->_is_finished_per_driver_seq[seq]) {
+            return false;
+        }
+    }
+    return true;
 }
 
 /// RoundRobinState.
@@ -228,12 +252,13 @@ bool RoundRobinState::is_upstream_finished(int32_t driver_seq) const {
 CollectStatsContext::CollectStatsContext(RuntimeState* const runtime_state, size_t max_dop,
                                          const AdaptiveDopParam& param)
         : _max_dop(max_dop),
+          _scale_up_factor(std::max<size_t>(1, compute_max_le_power2(param.max_scale_up_factor))),
           _max_block_rows_per_driver_seq(param.max_block_rows_per_driver_seq > 0 ? param.max_block_rows_per_driver_seq
                                                                                  : 1),
           _max_output_amplification_factor(param.max_output_amplification_factor),
           _buffer_chunk_queue_per_driver_seq(max_dop),
           _is_finishing_per_driver_seq(max_dop),
-          _is_finished_per_driver_seq(max_dop),
+          _is_finished_per_driver_seq(max_dop * _scale_up_factor),
           _runtime_state(runtime_state),
           _blocking_event(Event::create_event()) {
     _state_payloads[CollectStatsStateEnum::BLOCK] = std::make_unique<BlockState>(this);
@@ -303,6 +328,14 @@ void CollectStatsContext::_transform_state(CollectStatsStateEnum state_enum, siz
     _blocking_event->finish(_runtime_state);
 }
 
+size_t CollectStatsContext::_scaled_up_dop() const {
+    size_t scale_up_factor = _scale_up_factor;
+    while (scale_up_factor > 1 && _upstream_dop * scale_up_factor > _max_scaled_up_dop) {
+        scale_up_factor /= 2;
+    }
+    return _upstream_dop * scale_up_factor;
+}
+
 CollectStatsContext::BufferChunkQueue& CollectStatsContext::_buffer_chunk_queue(int32_t driver_seq) {
     return _buffer_chunk_queue_per_driver_seq[driver_seq];
 }
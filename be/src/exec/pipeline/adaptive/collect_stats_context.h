@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/adaptive/adaptive_fwd.h"
 #include "exec/pipeline/context_with_dependency.h"
@@ -51,6 +53,12 @@ enum class CollectStatsStateEnum { BLOCK = 0, PASSTHROUGH, ROUND_ROBIN };
 ///   when SourceOp has been EOS before BlockState receives max_block_rows_per_driver_seq*DOP rows.
 ///   - It adjust DOP of pipeline#2 to compute_max_le_power2(num_rows/max_block_rows_per_driver_seq),
 ///   - and passes chunks from the i-th pipeline#1 driver to the j-th pipeline#2 driver, where j=i%new_dop.
+/// - PassthroughState can also scale up DOP of pipeline#2 to upstream_dop*scale_up_factor,
+///   if scale_up_factor of AdaptiveDopParam is larger than 1.
+///   - It passes chunks from the i-th pipeline#1 driver to the (i+k*upstream_dop)-th pipeline#2 driver
+///     in a round-robin manner of k, where k is in [0, scale_up_factor).
+///   - The i-th pipeline#1 driver is finished only when all its pipeline#2 drivers are finished.
+///   - It is only enabled when pipeline#2 doesn't depend on other pipelines, whose DOP is fixed.
 class CollectStatsContext final : public ContextWithDependency {
 public:
     CollectStatsContext(RuntimeState* const runtime_state, size_t max_dop, const AdaptiveDopParam& param);
@@ -71,9 +79,13 @@ public:
     Status set_finished(int32_t driver_seq);
 
     bool is_downstream_ready() const;
+    // Whether the downstream DOP has been raised over the upstream DOP.
+    bool is_scaled_up() const { return _downstream_dop > _upstream_dop; }
     size_t upstream_dop() const { return _upstream_dop; }
     size_t downstream_dop() const { return _downstream_dop; }
     void set_downstream_dop(size_t downstream_dop) { _downstream_dop = downstream_dop; }
+    // Bound the DOP scaled up by PassthroughState, it must be called before the upstream drivers run.
+    void set_max_scaled_up_dop(size_t max_dop) { _max_scaled_up_dop = max_dop; }
     void incr_sinker() { ++_upstream_dop; }
 
     const int64_t max_output_amplification_factor() const { return _max_output_amplification_factor; }
@@ -88,6 +100,8 @@ private:
     void _set_state(CollectStatsStateEnum state_enum);
     void _transform_state(CollectStatsStateEnum state_enum, size_t downstream_dop);
     BufferChunkQueue& _buffer_chunk_queue(int32_t driver_seq);
+    // upstream_dop times the largest power of two not larger than _scale_up_factor that fits in _max_scaled_up_dop.
+    size_t _scaled_up_dop() const;
 
 private:
     friend class BlockState;
@@ -100,6 +114,9 @@ private:
     // _upstream_dop and _downstream_dop are DOP of CollectStatsSinkOperator and CollectStatsSourceOperator.
     // They are both power of two, and upstream_dop is times of downstream_dop.
     const size_t _max_dop;
+    // The power of two, and the max DOP of CollectStatsSourceOperator is _max_dop*_scale_up_factor.
+    const size_t _scale_up_factor;
+    size_t _max_scaled_up_dop = std::numeric_limits<size_t>::max();
     size_t _upstream_dop = 0;
     size_t _downstream_dop = 0;
 
@@ -186,8 +203,14 @@ private:
         // token is used to ensure that the order of dequeueing is the same as enqueueing.
         ChunkQueue::producer_token_t token;
     };
+    // Return the downstream driver_seq which the next chunk of the upstream driver_seq is passed to.
+    int32_t _next_downstream_driver_seq(int32_t upstream_driver_seq) const;
+
+    // Indexed by the downstream driver_seq.
     std::vector<ChunkQueueWrapper> _in_chunk_queue_per_driver_seq;
     mutable std::vector<uint8_t> _unpluging_per_driver_seq;
+    // Indexed by the upstream driver_seq, only used when scaling up DOP.
+    std::vector<size_t> _num_pushed_chunks_per_driver_seq;
 };
 
 class RoundRobinState final : public CollectStatsState {
@@ -87,7 +87,7 @@ SourceOperatorFactory::AdaptiveState CollectStatsSourceOperatorFactory::adaptive
 /// - Constraints:
 ///   - DOP *= output_amplification_factor.
 ///   - DOP >= DOP of dependent pipelines.
-///   - DOP <= CollectStatsSinkOperatorFactory::degree_of_parallelism.
+///   - DOP <= CollectStatsSinkOperatorFactory::degree_of_parallelism, unless CsSink has scaled up DOP.
 void CollectStatsSourceOperatorFactory::adjust_dop() {
     if (_has_adjusted_dop) {
         return;
@@ -105,8 +105,9 @@ void CollectStatsSourceOperatorFactory::adjust_dop() {
     const auto& dependent_pipelines = group_dependent_pipelines();
 
     // 1. Use the source dop from context, which is adjusted by CsSink.
+    // The scaled up dop is kept as it is, since there are no dependent pipelines in this case.
     _degree_of_parallelism = downstream_dop;
-    if (_degree_of_parallelism == upstream_dop) {
+    if (_degree_of_parallelism >= upstream_dop) {
         return;
     }
 
@@ -53,6 +53,7 @@ public:
 
     SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override;
     void adjust_dop() override;
+    void set_max_scaled_up_dop(size_t max_dop) { _ctx->set_max_scaled_up_dop(max_dop); }
 
 private:
     static constexpr size_t ABSENT_ADJUSTED_DOP = 0;
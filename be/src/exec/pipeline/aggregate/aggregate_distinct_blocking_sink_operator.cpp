@@ -47,6 +47,7 @@ Status AggregateDistinctBlockingSinkOperator::set_finishing(RuntimeState* state)
     }
 
     COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_set_variant().size());
+    _aggregator->update_memory_usage_counters();
 
     // If hash set is empty, we don't need to return value
     if (_aggregator->hash_set_variant().size() == 0) {
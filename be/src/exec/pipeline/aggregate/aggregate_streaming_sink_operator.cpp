@@ -167,6 +167,11 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  * should be small enough to limit the size of hash table.
  *
  * SELECTIVE_PREAGG state aggregates continuous_limit chunks, then shifting to ADJUST state.
+ *
+ * The hit ratio of the chunks probed against the hash table is also tracked over a sliding window. PASS_THROUGH
+ * probes one sampled chunk every AggrAutoContext::PassThroughSampleInterval chunks, and both PASS_THROUGH and
+ * SELECTIVE_PREAGG go back to ADJUST early with a reset continuous_limit once the window shows that the input
+ * has changed its regime.
  */
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
@@ -206,6 +211,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         }
 
         size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
+        _auto_context.update_hit_ratio(hit_count, chunk_size);
         if (_auto_context.adjust_count < continuous_limit && _auto_context.is_low_reduction(hit_count, chunk_size)) {
             RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
             _auto_context.pass_through_count++;
@@ -250,8 +256,31 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         break;
     }
     case AggrAutoState::PASS_THROUGH: {
-        RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
         _auto_context.pass_through_count++;
+        if (_auto_context.pass_through_count % AggrAutoContext::PassThroughSampleInterval == 0) {
+            // probe a sampled chunk, so that the input turning into highly aggregated is noticed
+            // without waiting for the whole continuous_limit
+            {
+                SCOPED_TIMER(_aggregator->agg_compute_timer());
+                TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(chunk_size));
+            }
+            size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
+            _auto_context.update_hit_ratio(hit_count, chunk_size);
+            RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(chunk, chunk_size, false));
+            if (_auto_context.should_leave_pass_through(hit_count, chunk_size)) {
+                _auto_state = AggrAutoState::ADJUST;
+                _auto_context.pass_through_count = 0;
+                _auto_context.preagg_count = 0;
+                _auto_context.adjust_count = 0;
+                _auto_context.reset_continuous_limit();
+                VLOG_ROW << "auto agg: hit ratio " << _auto_context.hit_ratio << " "
+                         << _auto_context.get_auto_state_string(AggrAutoState::PASS_THROUGH) << " -> "
+                         << _auto_context.get_auto_state_string(_auto_state);
+                break;
+            }
+        } else {
+            RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
+        }
         if (_auto_context.pass_through_count > continuous_limit) {
             _auto_state =
                     allocated_bytes < AggrAutoContext::MaxHtSize ? AggrAutoState::FORCE_PREAGG : AggrAutoState::ADJUST;
@@ -285,7 +314,19 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     case AggrAutoState::SELECTIVE_PREAGG: {
         RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(chunk, chunk_size, true));
         _auto_context.selective_preagg_count++;
-        if (_auto_context.selective_preagg_count > continuous_limit) {
+
+        size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
+        _auto_context.update_hit_ratio(hit_count, chunk_size);
+        if (_auto_context.should_leave_selective_preagg(hit_count, chunk_size)) {
+            // the window shows the input is no longer in the middle, let ADJUST pick PREAGG or PASS_THROUGH
+            _auto_state = AggrAutoState::ADJUST;
+            _auto_context.selective_preagg_count = 0;
+            _auto_context.adjust_count = 0;
+            _auto_context.reset_continuous_limit();
+            VLOG_ROW << "auto agg: hit ratio " << _auto_context.hit_ratio << " "
+                     << _auto_context.get_auto_state_string(AggrAutoState::SELECTIVE_PREAGG) << " -> "
+                     << _auto_context.get_auto_state_string(_auto_state);
+        } else if (_auto_context.selective_preagg_count > continuous_limit) {
             _auto_state = AggrAutoState::ADJUST;
             _auto_context.selective_preagg_count = 0;
             _auto_context.adjust_count = 0;
@@ -31,6 +31,10 @@ Status SortedAggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
     _accumulator.set_max_size(state->chunk_size());
+    // Input is sorted on the group by keys, so a group emitted by the aggregator is complete and final.
+    if (_aggregator->limit() != -1 && _aggregator->conjunct_ctxs().empty() && _aggregator->needs_finalize()) {
+        _limit_of_completed_groups = _aggregator->limit();
+    }
     return _aggregator->open(state);
 }
 
@@ -48,6 +52,10 @@ bool SortedAggregateStreamingSinkOperator::is_finished() const {
 }
 
 Status SortedAggregateStreamingSinkOperator::set_finishing(RuntimeState* state) {
+    if (_is_finished) {
+        // already finished early by reaching the limit
+        return Status::OK();
+    }
     _is_finished = true;
     ASSIGN_OR_RETURN(auto res, _aggregator->pull_eos_chunk());
     DCHECK(_accumulator.need_input());
@@ -84,6 +92,7 @@ Status SortedAggregateStreamingSinkOperator::push_chunk(RuntimeState* state, con
     }
     DCHECK(_accumulator.need_input());
     if (res && !res->is_empty()) {
+        _num_completed_groups += res->num_rows();
         _accumulator.push(std::move(res));
     }
     if (_accumulator.has_output()) {
@@ -91,10 +100,27 @@ Status SortedAggregateStreamingSinkOperator::push_chunk(RuntimeState* state, con
         _aggregator->offer_chunk_to_buffer(accumulated);
     }
     DCHECK(_accumulator.need_input());
+    _finish_if_reached_limit();
 
     return Status::OK();
 }
 
+void SortedAggregateStreamingSinkOperator::_finish_if_reached_limit() {
+    if (_limit_of_completed_groups == -1 || _num_completed_groups < _limit_of_completed_groups) {
+        return;
+    }
+    // The remaining input can't change the groups already emitted, so stop here and drop the group
+    // still being aggregated, it is not needed to satisfy the limit.
+    _accumulator.finalize();
+    while (_accumulator.has_output()) {
+        auto accumulated = std::move(_accumulator.pull());
+        _aggregator->offer_chunk_to_buffer(accumulated);
+    }
+    _is_finished = true;
+    _aggregator->set_ht_eos();
+    _aggregator->sink_complete();
+}
+
 OperatorPtr SortedAggregateStreamingSinkOperatorFactory::create(int32_t degree_of_parallelism,
                                                                 int32_t driver_sequence) {
     return std::make_shared<SortedAggregateStreamingSinkOperator>(this, _id, _plan_node_id, driver_sequence,
@@ -41,7 +41,12 @@ public:
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
 private:
+    void _finish_if_reached_limit();
+
     bool _is_finished = false;
+    // LIMIT without HAVING can stop consuming input once this many completed groups have been emitted, -1 if it can't
+    int64_t _limit_of_completed_groups = -1;
+    int64_t _num_completed_groups = 0;
     ChunkPipelineAccumulator _accumulator;
     std::shared_ptr<SortedStreamingAggregator> _aggregator;
 };
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -59,9 +60,16 @@ public:
     // When the output operator is finished, the context can be finished regardless of other running operators.
     Status set_finished() {
         _is_finished.store(true, std::memory_order_release);
+        _observable.notify_observers();
         return Status::OK();
     }
 
+    // The dependent operators attach the observers of their drivers, which are notified
+    // when the context is ready for them or finished, and detach them when they are closed.
+    void attach_observer(PipelineObserver* observer) { _observable.add_observer(observer); }
+    void detach_observer(PipelineObserver* observer) { _observable.remove_observer(observer); }
+    void notify_observers() const { _observable.notify_observers(); }
+
     // Predicate whether the context is finished, which is used to notify
     // non-output operators to be finished early.
     bool is_finished() const { return _is_finished.load(std::memory_order_acquire); }
@@ -69,6 +77,7 @@ public:
 protected:
     std::atomic<int32_t> _num_running_operators = 0;
     std::atomic<bool> _is_finished = false;
+    Observable _observable;
 };
 
 } // namespace starrocks::pipeline
@@ -0,0 +1,180 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/pipeline/continuous_profiler.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+#include "common/config.h"
+
+namespace starrocks::pipeline {
+
+namespace {
+
+constexpr char kSeparator = ';';
+
+// The separator and spaces are not allowed in the fields of the folded format.
+void append_field(std::string* key, const std::string& field) {
+    size_t offset = key->size();
+    key->append(field);
+    std::replace_if(
+            key->begin() + offset, key->end(), [](char c) { return c == kSeparator || c == ' '; }, '_');
+}
+
+ContinuousProfiler::Sample parse_key(const std::string& key, int64_t time_ns) {
+    ContinuousProfiler::Sample sample;
+    size_t first = key.find(kSeparator);
+    size_t second = key.find(kSeparator, first + 1);
+    size_t third = key.find(kSeparator, second + 1);
+    sample.workgroup = key.substr(0, first);
+    sample.query_id = key.substr(first + 1, second - first - 1);
+    sample.fragment_id = key.substr(second + 1, third - second - 1);
+    sample.operator_name = key.substr(third + 1);
+    sample.time_ns = time_ns;
+    return sample;
+}
+
+} // namespace
+
+ContinuousProfiler* ContinuousProfiler::instance() {
+    static ContinuousProfiler profiler;
+    return &profiler;
+}
+
+std::string ContinuousProfiler::make_key(const Sample& sample) {
+    std::string key;
+    key.reserve(sample.workgroup.size() + sample.query_id.size() + sample.fragment_id.size() +
+                sample.operator_name.size() + 3);
+    append_field(&key, sample.workgroup);
+    key.push_back(kSeparator);
+    append_field(&key, sample.query_id);
+    key.push_back(kSeparator);
+    append_field(&key, sample.fragment_id);
+    key.push_back(kSeparator);
+    append_field(&key, sample.operator_name);
+    return key;
+}
+
+void ContinuousProfiler::add(const std::vector<Sample>& samples, int64_t now_s) {
+    std::vector<std::string> keys;
+    keys.reserve(samples.size());
+    std::vector<FoldedSample> folded_samples;
+    folded_samples.reserve(samples.size());
+    for (const auto& sample : samples) {
+        folded_samples.push_back({&keys.emplace_back(make_key(sample)), sample.time_ns});
+    }
+    add(folded_samples, now_s);
+}
+
+void ContinuousProfiler::add(const std::vector<FoldedSample>& samples, int64_t now_s) {
+    int64_t window_minutes = config::continuous_profiler_window_minutes;
+    if (window_minutes <= 0 || samples.empty()) {
+        return;
+    }
+    int64_t start_time = now_s - now_s % 60;
+    size_t max_keys = std::max<int64_t>(1, config::continuous_profiler_max_keys_per_minute / kNumShards);
+
+    auto& shard = _shards[std::hash<std::string>()(*samples[0].key) % kNumShards];
+    std::lock_guard l(shard.mutex);
+    _evict_unlocked(&shard, now_s, window_minutes);
+    if (shard.buckets.empty() || shard.buckets.back().start_time < start_time) {
+        shard.buckets.emplace_back().start_time = start_time;
+    }
+    auto& bucket = shard.buckets.back();
+    for (const auto& sample : samples) {
+        if (sample.time_ns <= 0) {
+            continue;
+        }
+        auto it = bucket.samples.find(*sample.key);
+        if (it != bucket.samples.end()) {
+            it->second += sample.time_ns;
+        } else if (bucket.samples.size() < max_keys) {
+            bucket.samples.emplace(*sample.key, sample.time_ns);
+        } else {
+            // Bound the memory under high QPS, the time is still attributed to the workgroup and operator.
+            auto others = parse_key(*sample.key, 0);
+            others.query_id = OTHERS_ID;
+            others.fragment_id = OTHERS_ID;
+            bucket.samples[make_key(others)] += sample.time_ns;
+        }
+    }
+}
+
+void ContinuousProfiler::_evict_unlocked(Shard* shard, int64_t now_s, int64_t window_minutes) {
+    int64_t min_start_time = now_s - now_s % 60 - (window_minutes - 1) * 60;
+    while (!shard->buckets.empty() && shard->buckets.front().start_time < min_start_time) {
+        shard->buckets.pop_front();
+    }
+}
+
+std::map<int64_t, std::unordered_map<std::string, int64_t>> ContinuousProfiler::_merge(int64_t minutes,
+                                                                                        int64_t now_s) const {
+    // Shards are only evicted on insertion, skip the buckets out of the window as well.
+    int64_t window_minutes = config::continuous_profiler_window_minutes;
+    if (window_minutes > 0) {
+        minutes = std::min(minutes, window_minutes);
+    }
+    int64_t min_start_time = now_s - now_s % 60 - (minutes - 1) * 60;
+    std::map<int64_t, std::unordered_map<std::string, int64_t>> merged;
+    for (const auto& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        for (const auto& bucket : shard.buckets) {
+            if (bucket.start_time < min_start_time) {
+                continue;
+            }
+            auto& merged_bucket = merged[bucket.start_time];
+            for (const auto& [key, time_ns] : bucket.samples) {
+                merged_bucket[key] += time_ns;
+            }
+        }
+    }
+    return merged;
+}
+
+std::vector<ContinuousProfiler::BucketSnapshot> ContinuousProfiler::snapshot(int64_t minutes, int64_t now_s) const {
+    std::vector<BucketSnapshot> snapshots;
+    for (const auto& [start_time, samples] : _merge(minutes, now_s)) {
+        auto& snapshot = snapshots.emplace_back();
+        snapshot.start_time = start_time;
+        snapshot.samples.reserve(samples.size());
+        for (const auto& [key, time_ns] : samples) {
+            snapshot.samples.emplace_back(parse_key(key, time_ns));
+        }
+    }
+    return snapshots;
+}
+
+std::string ContinuousProfiler::folded_stacks(int64_t minutes, int64_t now_s) const {
+    std::map<std::string, int64_t> merged;
+    for (const auto& [start_time, samples] : _merge(minutes, now_s)) {
+        for (const auto& [key, time_ns] : samples) {
+            merged[key] += time_ns;
+        }
+    }
+    std::stringstream ss;
+    for (const auto& [key, time_ns] : merged) {
+        ss << key << ' ' << time_ns << '\n';
+    }
+    return ss.str();
+}
+
+void ContinuousProfiler::clear() {
+    for (auto& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        shard.buckets.clear();
+    }
+}
+
+} // namespace starrocks::pipeline
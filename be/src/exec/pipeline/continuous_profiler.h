@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+// Attribution of the operator time of this BE to workgroups, queries, fragment instances and operators.
+// Drivers add the increase of the OperatorTotalTime of their operators on every runtime profile report and
+// when finalizing, so the time of a long query lands in the minutes it is spent. The time is kept in buckets
+// of one minute for the last `continuous_profiler_window_minutes` minutes, in shards to spread the lock.
+class ContinuousProfiler {
+public:
+    struct Sample {
+        std::string workgroup;
+        std::string query_id;
+        std::string fragment_id;
+        std::string operator_name;
+        int64_t time_ns = 0;
+    };
+
+    // Time of a key made by make_key.
+    struct FoldedSample {
+        const std::string* key = nullptr;
+        int64_t time_ns = 0;
+    };
+
+    struct BucketSnapshot {
+        // Unix timestamp of the start of the minute.
+        int64_t start_time = 0;
+        std::vector<Sample> samples;
+    };
+
+    // Query and fragment id of the samples merged after a shard has too many distinct keys in a minute.
+    static constexpr const char* OTHERS_ID = "others";
+
+    static ContinuousProfiler* instance();
+
+    // The folded key of the fields of |sample| except the time, which drivers make once per operator.
+    static std::string make_key(const Sample& sample);
+
+    void add(const std::vector<Sample>& samples, int64_t now_s);
+
+    // All the samples are from the same driver, so that they are added under the lock of a single shard.
+    void add(const std::vector<FoldedSample>& samples, int64_t now_s);
+
+    // Buckets of the last |minutes| minutes, the oldest first.
+    std::vector<BucketSnapshot> snapshot(int64_t minutes, int64_t now_s) const;
+
+    // The samples of the last |minutes| minutes in the folded stack format
+    // ("workgroup;query;fragment;operator time_ns" per line), which flamegraph.pl reads directly.
+    std::string folded_stacks(int64_t minutes, int64_t now_s) const;
+
+    void clear();
+
+private:
+    static constexpr size_t kNumShards = 16;
+
+    struct Bucket {
+        int64_t start_time = 0;
+        // folded key -> time
+        std::unordered_map<std::string, int64_t> samples;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::deque<Bucket> buckets;
+    };
+
+    static void _evict_unlocked(Shard* shard, int64_t now_s, int64_t window_minutes);
+
+    // Merged over the shards, ordered by the start time.
+    std::map<int64_t, std::unordered_map<std::string, int64_t>> _merge(int64_t minutes, int64_t now_s) const;
+
+    std::array<Shard, kNumShards> _shards;
+};
+
+} // namespace starrocks::pipeline
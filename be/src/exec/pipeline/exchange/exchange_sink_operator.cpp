@@ -396,6 +396,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _be_number = state->be_number();
     if (state->query_options().__isset.transmission_encode_level) {
         _encode_level = state->query_options().transmission_encode_level;
+        if (!config::enable_transmission_encode_null_map) {
+            _encode_level = serde::EncodeContext::disable_encode_null_map(_encode_level);
+        }
     }
     // Set compression type according to query options
     if (state->query_options().__isset.transmission_compression_type) {
@@ -441,6 +444,7 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _sender_input_bytes_counter = ADD_COUNTER(_unique_metrics, "SenderInputBytes", TUnit::BYTES);
     _serialized_bytes_counter = ADD_COUNTER(_unique_metrics, "SerializedBytes", TUnit::BYTES);
     _compressed_bytes_counter = ADD_COUNTER(_unique_metrics, "CompressedBytes", TUnit::BYTES);
+    _compress_skipped_chunks_counter = ADD_COUNTER(_unique_metrics, "CompressSkippedChunks", TUnit::UNIT);
 
     _serialize_chunk_timer = ADD_TIMER(_unique_metrics, "SerializeChunkTime");
     _shuffle_hash_timer = ADD_TIMER(_unique_metrics, "ShuffleHashTime");
@@ -700,6 +704,11 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
                                                          _compress_codec->max_input_size()));
     }
 
+    if (_compress_backoff.should_skip()) {
+        COUNTER_UPDATE(_compress_skipped_chunks_counter, 1);
+        return Status::OK();
+    }
+
     // try compress the ChunkPB data
     if (_compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
@@ -728,6 +737,8 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
             dst->set_compress_type(_compress_type);
+        } else {
+            _compress_backoff.on_reject(config::rpc_compress_skip_chunks_after_reject);
         }
         VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
     }
@@ -741,9 +752,17 @@ int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkPara
         auto chunk = chunk_request->mutable_chunks(i);
         chunk->set_data_size(chunk->data().size());
 
-        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
-        attachment.append(chunk->data());
-        attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+        if (chunk->data_size() >= kMinZeroCopyAttachmentBytes) {
+            // Hand the serialized buffer itself to the IOBuf instead of copying it into IOBuf blocks,
+            // it's released once brpc has sent the request.
+            auto* data = new std::string(std::move(*chunk->mutable_data()));
+            attachment_physical_bytes += data->capacity();
+            attachment.append_user_data(data->data(), data->size(), [data](void*) { delete data; });
+        } else {
+            int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+            attachment.append(chunk->data());
+            attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+        }
 
         chunk->clear_data();
         // If the request is too big, free the memory in order to avoid OOM
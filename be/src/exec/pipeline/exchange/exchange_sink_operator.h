@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -43,6 +44,28 @@ class ExprContext;
 
 namespace pipeline {
 class SinkBuffer;
+
+// After a chunk is not compressible enough, the following chunks are sent uncompressed for a while, so that
+// data which is not compressible stops paying the compression time.
+class CompressionBackoff {
+public:
+    // Whether the current chunk is sent without trying to compress it.
+    bool should_skip() {
+        if (_skip_remaining > 0) {
+            _skip_remaining--;
+            return true;
+        }
+        return false;
+    }
+
+    // Called when a compressed chunk doesn't reach the compression ratio threshold, the next |skip_chunks|
+    // chunks are skipped.
+    void on_reject(int32_t skip_chunks) { _skip_remaining = std::max(0, skip_chunks); }
+
+private:
+    int32_t _skip_remaining = 0;
+};
+
 class ExchangeSinkOperator final : public Operator {
 public:
     ExchangeSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
@@ -85,6 +108,9 @@ public:
     int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
 
 private:
+    // Serialized chunks smaller than an IOBuf block are cheaper to copy than to reference.
+    static constexpr size_t kMinZeroCopyAttachmentBytes = 8192;
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -171,6 +197,7 @@ private:
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
+    CompressionBackoff _compress_backoff;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
@@ -181,6 +208,7 @@ private:
     RuntimeProfile::Counter* _sender_input_bytes_counter = nullptr;
     RuntimeProfile::Counter* _serialized_bytes_counter = nullptr;
     RuntimeProfile::Counter* _compressed_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _compress_skipped_chunks_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _pass_through_buffer_peak_mem_usage = nullptr;
 
     std::atomic<bool> _is_finished = false;
@@ -26,9 +26,18 @@ Status ExchangeSourceOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(SourceOperator::prepare(state));
     _stream_recvr = static_cast<ExchangeSourceOperatorFactory*>(_factory)->create_stream_recvr(state);
     _stream_recvr->bind_profile(_driver_sequence, _unique_metrics);
+    _stream_recvr->attach_observer(observer());
     return Status::OK();
 }
 
+void ExchangeSourceOperator::close(RuntimeState* state) {
+    // The receiver is shared by the drivers of the factory, and may outlive the driver of this operator.
+    if (_stream_recvr != nullptr) {
+        _stream_recvr->detach_observer(observer());
+    }
+    SourceOperator::close(state);
+}
+
 bool ExchangeSourceOperator::has_output() const {
     return _stream_recvr->has_output_for_pipeline(_driver_sequence);
 }
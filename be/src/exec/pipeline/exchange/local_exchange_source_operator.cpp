@@ -22,12 +22,13 @@ namespace starrocks::pipeline {
 // Used for PassthroughExchanger.
 // The input chunk is most likely full, so we don't merge it to avoid copying chunk data.
 void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
+    // The sinks of all the drivers add chunks to this source, so only the queue is touched under the lock.
+    size_t memory_usage = chunk->memory_usage();
+    size_t num_rows = chunk->num_rows();
     std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return;
     }
-    size_t memory_usage = chunk->memory_usage();
-    size_t num_rows = chunk->num_rows();
     _local_memory_usage += memory_usage;
     _full_chunk_queue.emplace(std::move(chunk));
     _memory_manager->update_memory_usage(memory_usage, num_rows);
@@ -37,14 +38,14 @@ void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
 // Only enqueue the partition chunk information here, and merge chunk in pull_chunk().
 Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_ptr<std::vector<uint32_t>>& indexes,
                                               uint32_t from, uint32_t size, size_t memory_usage) {
+    // unpack chunk's const column, since Chunk#append_selective cannot be const column
+    chunk->unpack_and_duplicate_const_columns();
+
     std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
     }
 
-    // unpack chunk's const column, since Chunk#append_selective cannot be const column
-    chunk->unpack_and_duplicate_const_columns();
-
     _partition_chunk_queue.emplace(std::move(chunk), std::move(indexes), from, size, memory_usage);
     _partition_rows_num += size;
     _local_memory_usage += memory_usage;
@@ -55,16 +56,16 @@ Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_
 
 Status LocalExchangeSourceOperator::add_chunk(const std::vector<std::string>& partition_key,
                                               std::unique_ptr<Chunk> chunk) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-    if (_is_finished) {
-        return Status::OK();
-    }
-
     // unpack chunk's const column, since Chunk#append_selective cannot be const column
     chunk->unpack_and_duplicate_const_columns();
     auto memory_usage = chunk->memory_usage();
     auto num_rows = chunk->num_rows();
 
+    std::lock_guard<std::mutex> l(_chunk_lock);
+    if (_is_finished) {
+        return Status::OK();
+    }
+
     _partition_key2partial_chunks[partition_key].queue.push(std::move(chunk));
     _partition_key2partial_chunks[partition_key].num_rows += num_rows;
     _partition_key2partial_chunks[partition_key].memory_usage += memory_usage;
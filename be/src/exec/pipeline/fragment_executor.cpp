@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/fragment_executor.h"
 
+#include <limits>
 #include <optional>
 #include <unordered_map>
 
@@ -25,6 +26,7 @@
 #include "exec/hash_join_node.h"
 #include "exec/multi_olap_table_sink.h"
 #include "exec/olap_scan_node.h"
+#include "exec/pipeline/adaptive/collect_stats_source_operator.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -47,6 +49,7 @@
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/transaction_mgr.h"
 #include "util/debug/query_trace.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/runtime_profile.h"
 #include "util/time.h"
 #include "util/uid_util.h"
@@ -603,6 +606,22 @@ bool FragmentExecutor::_is_in_colocate_exec_group(PlanNodeId plan_node_id) {
     return false;
 }
 
+// Adaptive DOP can scale up the DOP of an adaptive group over the planned DOP, but some sinks can only run with as
+// many drivers as they have been prepared for, e.g. OlapTableSinkOperatorFactory creates its sinks up front.
+static void limit_adaptive_group_scaled_up_dop(const PipelineGroupMap& unready_pipeline_groups) {
+    for (const auto& [leader_source_op, pipelines] : unready_pipeline_groups) {
+        auto* collect_stats_source_op = dynamic_cast<CollectStatsSourceOperatorFactory*>(leader_source_op);
+        if (collect_stats_source_op == nullptr) {
+            continue;
+        }
+        size_t max_dop = std::numeric_limits<size_t>::max();
+        for (auto* pipeline : pipelines) {
+            max_dop = std::min(max_dop, pipeline->sink_operator_factory()->max_degree_of_parallelism());
+        }
+        collect_stats_source_op->set_max_scaled_up_dop(max_dop);
+    }
+}
+
 static void create_adaptive_group_initialize_events(RuntimeState* state, WorkGroup* wg,
                                                     PipelineGroupMap&& unready_pipeline_groups) {
     if (unready_pipeline_groups.empty()) {
@@ -687,6 +706,7 @@ Status FragmentExecutor::_prepare_pipeline_driver(ExecEnv* exec_env, const Unifi
     });
 
     if (!unready_pipeline_groups.empty()) {
+        limit_adaptive_group_scaled_up_dop(unready_pipeline_groups);
         create_adaptive_group_initialize_events(runtime_state, _wg.get(), std::move(unready_pipeline_groups));
     }
 
@@ -844,6 +864,36 @@ Status FragmentExecutor::execute(ExecEnv* exec_env) {
     return Status::OK();
 }
 
+Status FragmentExecutor::prepare_and_execute_async(ExecEnv* exec_env, const TExecPlanFragmentParams& common_request,
+                                                   const TExecPlanFragmentParams& unique_request) {
+    // Operator factories keep references to the plan nodes of the request (e.g. TableFunctionOperatorFactory::_tnode,
+    // HashJoiner::_hash_join_node) and read them again when the drivers are prepared, so the request must outlive
+    // execute(). The caller frees its request when the RPC returns, so prepare from copies owned by the task.
+    auto common = std::make_shared<TExecPlanFragmentParams>(common_request);
+    auto unique = &common_request == &unique_request ? common
+                                                     : std::make_shared<TExecPlanFragmentParams>(unique_request);
+    auto executor = std::make_shared<FragmentExecutor>();
+    RETURN_IF_ERROR(executor->prepare(exec_env, *common, *unique));
+
+    // Hold the query context and fragment context until the task is done, the fragment context is
+    // needed to report the failure to FE after execute() has cleaned it up.
+    auto query_ctx = executor->_query_ctx->get_shared_ptr();
+    auto fragment_ctx = executor->_fragment_ctx;
+    auto task = [executor, common, unique, query_ctx, fragment_ctx, exec_env]() {
+        auto status = executor->execute(exec_env);
+        if (!status.ok()) {
+            LOG(WARNING) << "async execute fragment failed, fragment_instance_id="
+                         << print_id(fragment_ctx->fragment_instance_id()) << ", status=" << status;
+            fragment_ctx->workgroup()->executors()->driver_executor()->report_exec_state(
+                    query_ctx.get(), fragment_ctx.get(), status, true, false);
+        }
+    };
+    if (exec_env->pipeline_prepare_pool()->try_offer(std::move(task))) {
+        return Status::OK();
+    }
+    return executor->execute(exec_env);
+}
+
 void FragmentExecutor::_fail_cleanup(bool fragment_has_registed) {
     if (_query_ctx) {
         if (_fragment_ctx) {
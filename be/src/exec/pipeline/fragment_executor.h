@@ -104,6 +104,11 @@ public:
     Status prepare(ExecEnv* exec_env, const TExecPlanFragmentParams& common_request,
                    const TExecPlanFragmentParams& unique_request);
     Status execute(ExecEnv* exec_env);
+    // prepare() the fragment, then execute() it on pipeline_prepare_pool so that the caller can return right
+    // after the fragment is registered. The requests are copied first and kept alive until execute() is done.
+    // Falls back to a synchronous execute() if the task cannot be offered to the pool.
+    static Status prepare_and_execute_async(ExecEnv* exec_env, const TExecPlanFragmentParams& common_request,
+                                            const TExecPlanFragmentParams& unique_request);
 
     static Status append_incremental_scan_ranges(ExecEnv* exec_env, const TExecPlanFragmentParams& request);
 
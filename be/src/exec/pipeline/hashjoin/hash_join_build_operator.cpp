@@ -17,6 +17,7 @@
 #include <numeric>
 #include <utility>
 
+#include "common/config.h"
 #include "exec/hash_joiner.h"
 #include "exec/pipeline/hashjoin/hash_joiner_factory.h"
 #include "exec/pipeline/query_context.h"
@@ -57,8 +58,14 @@ Status HashJoinBuildOperator::prepare(RuntimeState* state) {
     return Status::OK();
 }
 void HashJoinBuildOperator::close(RuntimeState* state) {
-    COUNTER_SET(_join_builder->build_metrics().hash_table_memory_usage,
-                _join_builder->hash_join_builder()->ht_mem_usage());
+    JoinHashTableMemUsage mem_usage;
+    _join_builder->hash_join_builder()->visitHt(
+            [&mem_usage](JoinHashTable* hash_table) { mem_usage += hash_table->mem_usage_breakdown(); });
+    auto& build_metrics = _join_builder->build_metrics();
+    COUNTER_SET(build_metrics.hash_table_memory_usage, mem_usage.total());
+    COUNTER_SET(build_metrics.build_chunk_memory_usage, mem_usage.build_chunk);
+    COUNTER_SET(build_metrics.hash_buckets_memory_usage, mem_usage.buckets);
+    COUNTER_SET(build_metrics.hash_keys_memory_usage, mem_usage.keys);
     _join_builder->unref(state);
 
     Operator::close(state);
@@ -82,20 +89,64 @@ size_t HashJoinBuildOperator::output_amplification_factor() const {
 
 Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
     ONCE_DETECT(_set_finishing_once);
+    if (config::pipeline_enable_operator_yield && !state->is_cancelled()) {
+        // Build the hash table and runtime filters in the pending work units.
+        _build_stage = BuildStage::BUILD_HT;
+        return Status::OK();
+    }
     DeferOp op([this]() { _is_finished = true; });
 
     if (state->is_cancelled()) {
         return Status::Cancelled("runtime state is cancelled");
     }
-    RETURN_IF_ERROR(_join_builder->build_ht(state));
+    RETURN_IF_ERROR(_build_ht(state));
+    RETURN_IF_ERROR(_build_runtime_filters(state));
+    return _publish_runtime_filters(state);
+}
+
+Status HashJoinBuildOperator::do_pending_work(RuntimeState* state) {
+    Status status;
+    BuildStage next_stage = BuildStage::NONE;
+    if (state->is_cancelled()) {
+        status = Status::Cancelled("runtime state is cancelled");
+    } else {
+        switch (_build_stage) {
+        case BuildStage::NONE:
+            break;
+        case BuildStage::BUILD_HT:
+            status = _build_ht(state);
+            next_stage = BuildStage::BUILD_RUNTIME_FILTER;
+            break;
+        case BuildStage::BUILD_RUNTIME_FILTER:
+            status = _build_runtime_filters(state);
+            next_stage = BuildStage::PUBLISH_RUNTIME_FILTER;
+            break;
+        case BuildStage::PUBLISH_RUNTIME_FILTER:
+            status = _publish_runtime_filters(state);
+            break;
+        }
+    }
 
+    _build_stage = status.ok() ? next_stage : BuildStage::NONE;
+    if (_build_stage == BuildStage::NONE) {
+        _is_finished = true;
+    }
+    return status;
+}
+
+Status HashJoinBuildOperator::_build_ht(RuntimeState* state) {
+    return _join_builder->build_ht(state);
+}
+
+Status HashJoinBuildOperator::_build_runtime_filters(RuntimeState* state) {
+    SCOPED_TIMER(_join_builder->build_metrics().build_runtime_filter_timer);
+    return _join_builder->create_runtime_filters(state);
+}
+
+Status HashJoinBuildOperator::_publish_runtime_filters(RuntimeState* state) {
     size_t merger_index = _driver_sequence;
     // Broadcast Join only has one build operator.
     DCHECK(_distribution_mode != TJoinDistributionMode::BROADCAST || _driver_sequence == 0);
-    {
-        SCOPED_TIMER(_join_builder->build_metrics().build_runtime_filter_timer);
-        RETURN_IF_ERROR(_join_builder->create_runtime_filters(state));
-    }
 
     auto ht_row_count = _join_builder->get_ht_row_count();
     auto& partial_in_filters = _join_builder->get_runtime_in_filters();
@@ -51,6 +51,9 @@ public:
     Status set_finishing(RuntimeState* state) override;
     bool is_finished() const override;
 
+    bool has_pending_work() const override { return _build_stage != BuildStage::NONE && !is_finished(); }
+    Status do_pending_work(RuntimeState* state) override;
+
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
@@ -62,10 +65,18 @@ public:
     void update_exec_stats(RuntimeState* state) override {}
 
 protected:
+    // Work units of set_finishing when config::pipeline_enable_operator_yield is on.
+    enum class BuildStage { NONE, BUILD_HT, BUILD_RUNTIME_FILTER, PUBLISH_RUNTIME_FILTER };
+
+    Status _build_ht(RuntimeState* state);
+    Status _build_runtime_filters(RuntimeState* state);
+    Status _publish_runtime_filters(RuntimeState* state);
+
     HashJoinerPtr _join_builder;
     PartialRuntimeFilterMerger* _partial_rf_merger;
     mutable size_t _avg_keys_per_bucket = 0;
     std::atomic<bool> _is_finished = false;
+    BuildStage _build_stage = BuildStage::NONE;
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 
     const TJoinDistributionMode::type _distribution_mode;
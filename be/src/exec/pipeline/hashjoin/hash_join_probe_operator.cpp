@@ -28,6 +28,8 @@ HashJoinProbeOperator::HashJoinProbeOperator(OperatorFactory* factory, int32_t i
           _join_builder(std::move(join_builder)) {}
 
 void HashJoinProbeOperator::close(RuntimeState* state) {
+    // The builder may outlive the driver of this operator.
+    _join_builder->detach_observer(observer());
     if (_join_prober != _join_builder) {
         _join_prober->unref(state);
     }
@@ -41,6 +43,7 @@ Status HashJoinProbeOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorWithDependency::prepare(state));
 
     _join_builder->incr_prober();
+    _join_builder->attach_observer(observer());
 
     if (_join_builder != _join_prober) {
         _join_prober->ref();
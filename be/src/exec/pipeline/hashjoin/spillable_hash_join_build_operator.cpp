@@ -19,6 +19,7 @@
 
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_components.h"
 #include "exec/hash_join_node.h"
@@ -179,6 +180,11 @@ Status SpillableHashJoinBuildOperator::init_spiller_partitions(RuntimeState* sta
         auto num_partitions =
                 builder->ht_mem_usage() * 2 / _join_builder->spiller()->options().spill_mem_table_bytes_size;
         _join_builder->spiller()->set_partition(state, num_partitions);
+        if (config::enable_hybrid_hash_join_spill) {
+            // The hash table held so far fitted in the memory of this operator. Keep half of it for the partitions
+            // staying in memory, because they are built into hash tables again on the probe side.
+            _join_builder->spiller()->set_max_in_mem_partition_bytes(builder->ht_mem_usage() / 2);
+        }
     }
     return Status::OK();
 }
@@ -219,7 +225,8 @@ Status SpillableHashJoinBuildOperator::push_chunk(RuntimeState* state, const Chu
 }
 
 void SpillableHashJoinBuildOperator::set_execute_mode(int performance_level) {
-    if (!_is_finished) {
+    // the hash table may be being built in the pending work units, which cannot be spilled any more.
+    if (!_is_finished && _build_stage == BuildStage::NONE) {
         _join_builder->set_spill_strategy(spill::SpillStrategy::SPILL_ALL);
     }
 }
@@ -87,6 +87,9 @@ public:
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
+    // The driver with sequence i uses the i-th sink of _sink0 and _sinks.
+    size_t max_degree_of_parallelism() const override { return _sinks.size() + 1; }
+
     Status prepare(RuntimeState* state) override;
 
     void close(RuntimeState* state) override;
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
@@ -81,6 +82,9 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+    if (config::pipeline_enable_hardware_perf_counters && state->query_ctx() && state->query_ctx()->enable_profile()) {
+        _hw_perf_counters.init(_common_metrics.get());
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
@@ -15,14 +15,17 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/spill/operator_mem_resource_manager.h"
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/hardware_perf_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -111,6 +114,15 @@ public:
     // Only source and sink operator may return true, and other operators always return false.
     virtual bool pending_finish() const { return false; }
 
+    // Some operators do heavy blocking work inside push_chunk or set_finishing (e.g. sorting the buffered rows,
+    // building the hash table), which may occupy the core for hundreds of milliseconds. Such an operator can split
+    // the work into several resumable work units instead: has_pending_work returns true if some work unit is not
+    // done yet, and the driver invokes do_pending_work to run one work unit at a time, so that it is able to yield
+    // between work units once its time slice is used up, just like the yield points of ScanTask.
+    // An operator with pending work should neither accept input nor be finished.
+    virtual bool has_pending_work() const { return false; }
+    virtual Status do_pending_work(RuntimeState* state) { return Status::OK(); }
+
     // Pull chunk from this operator
     // Use shared_ptr, because in some cases (local broadcast exchange),
     // the chunk need to be shared
@@ -269,6 +281,11 @@ public:
 
     virtual void update_exec_stats(RuntimeState* state);
 
+    // The observer of the driver which this operator belongs to, set by the driver before preparing the operator.
+    // The operator can attach it to the shared states, which notify it when the driver may be unblocked.
+    void set_observer(PipelineObserver* observer) { _observer = observer; }
+    PipelineObserver* observer() const { return _observer; }
+
 protected:
     OperatorFactory* _factory;
     const int32_t _id;
@@ -309,6 +326,8 @@ protected:
     RuntimeProfile::Counter* _push_row_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_chunk_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_row_num_counter = nullptr;
+    // Hardware counters of push_chunk and pull_chunk, only enabled by pipeline_enable_hardware_perf_counters.
+    HardwarePerfProfileCounters _hw_perf_counters;
     RuntimeProfile::Counter* _runtime_in_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _runtime_bloom_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
@@ -319,6 +338,8 @@ protected:
     // each operator should initialize it before use
     RuntimeProfile::HighWaterMarkCounter* _peak_revocable_mem_bytes = nullptr;
 
+    PipelineObserver* _observer = nullptr;
+
     // Some extra cpu cost of this operator that not accounted by pipeline driver,
     // such as OlapScanOperator( use separated IO thread to execute the IO task)
     std::atomic_int64_t _last_growth_cpu_time_ns = 0;
@@ -342,6 +363,9 @@ public:
     // Create the operator for the specific sequence driver
     // For some operators, when share some status, need to know the degree_of_parallelism
     virtual OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) = 0;
+    // The max number of drivers that operators can be created for, e.g. a sink which has created its sinks up front.
+    // Adaptive DOP doesn't scale up the DOP of the pipeline over it.
+    virtual size_t max_degree_of_parallelism() const { return std::numeric_limits<size_t>::max(); }
     virtual bool is_source() const { return false; }
     int32_t id() const { return _id; }
     int32_t plan_node_id() const { return _plan_node_id; }
@@ -406,8 +406,15 @@ OpFactories PipelineBuilderContext::maybe_interpolate_collect_stats(RuntimeState
 
     auto* pred_source_op = source_operator(pred_operators);
     size_t dop = pred_source_op->degree_of_parallelism();
-    CollectStatsContextPtr collect_stats_ctx =
-            std::make_shared<CollectStatsContext>(state, dop, _fragment_context->adaptive_dop_param());
+    AdaptiveDopParam adaptive_dop_param = _fragment_context->adaptive_dop_param();
+    // The DOP of the downstream pipeline can be only scaled up when it doesn't depend on other pipelines,
+    // whose DOP has been fixed.
+    if (_dependent_pipelines.empty() && config::pipeline_adaptive_dop_max_scale_up_factor > 1) {
+        const size_t max_dop = std::max<size_t>(dop, config::pipeline_adaptive_dop_max_dop);
+        adaptive_dop_param.max_scale_up_factor =
+                std::min<size_t>(config::pipeline_adaptive_dop_max_scale_up_factor, std::max<size_t>(1, max_dop / dop));
+    }
+    CollectStatsContextPtr collect_stats_ctx = std::make_shared<CollectStatsContext>(state, dop, adaptive_dop_param);
 
     auto last_plan_node_id = pred_operators[pred_operators.size() - 1]->plan_node_id();
     pred_operators.emplace_back(std::make_shared<CollectStatsSinkOperatorFactory>(next_operator_id(), last_plan_node_id,
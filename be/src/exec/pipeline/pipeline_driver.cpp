@@ -14,12 +14,14 @@
 
 #include "exec/pipeline/pipeline_driver.h"
 
+#include <algorithm>
 #include <random>
 #include <sstream>
 
 #include "column/chunk.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
+#include "exec/pipeline/continuous_profiler.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/scan/olap_scan_operator.h"
@@ -38,6 +40,7 @@
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -91,6 +94,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _yield_by_time_limit_counter = ADD_COUNTER(_runtime_profile, "YieldByTimeLimit", TUnit::UNIT);
     _yield_by_preempt_counter = ADD_COUNTER(_runtime_profile, "YieldByPreempt", TUnit::UNIT);
     _yield_by_local_wait_counter = ADD_COUNTER(_runtime_profile, "YieldByLocalWait", TUnit::UNIT);
+    _pending_work_unit_counter = ADD_COUNTER(_runtime_profile, "PendingWorkUnits", TUnit::UNIT);
     _block_by_precondition_counter = ADD_COUNTER(_runtime_profile, "BlockByPrecondition", TUnit::UNIT);
     _block_by_output_full_counter = ADD_COUNTER(_runtime_profile, "BlockByOutputFull", TUnit::UNIT);
     _block_by_input_empty_counter = ADD_COUNTER(_runtime_profile, "BlockByInputEmpty", TUnit::UNIT);
@@ -195,6 +199,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     }
 
     for (auto& op : _operators) {
+        op->set_observer(&_observer);
         int64_t time_spent = 0;
         {
             SCOPED_RAW_TIMER(&time_spent);
@@ -269,6 +274,17 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
         SCOPED_RAW_TIMER(&process_time_ns);
         auto query_mem_tracker = _query_ctx->mem_tracker();
 
+        // Heavy operators may leave resumable work units behind in push_chunk or set_finishing,
+        // run them before moving chunks, and yield between work units if the time slice is used up.
+        ASSIGN_OR_RETURN(bool yield_with_pending_work, _process_pending_work(runtime_state, &time_spent));
+        if (_check_fragment_is_canceled(runtime_state)) {
+            return _state;
+        }
+        if (yield_with_pending_work) {
+            set_driver_state(DriverState::READY);
+            return _state;
+        }
+
         for (size_t i = _first_unfinished; i < num_operators - 1; ++i) {
             {
                 SCOPED_RAW_TIMER(&time_spent);
@@ -309,6 +325,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 {
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    ScopedHardwarePerfCounters hw_perf_counters(&curr_op->_hw_perf_counters);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -342,6 +359,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         {
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
                             SCOPED_TIMER(next_op->_push_timer);
+                            ScopedHardwarePerfCounters hw_perf_counters(&next_op->_hw_perf_counters);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
@@ -390,18 +408,8 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
             }
             // yield when total chunks moved or time spent on-core for evaluation
             // exceed the designated thresholds.
-            if (time_spent >= YIELD_MAX_TIME_SPENT_NS ||
-                driver_acct().get_accumulated_local_wait_time_spent() >= YIELD_MAX_TIME_SPENT_NS) {
+            if (_should_yield(time_spent)) {
                 should_yield = true;
-                COUNTER_UPDATE(_yield_by_time_limit_counter, 1);
-                break;
-            }
-            if (_workgroup != nullptr &&
-                (time_spent >= YIELD_PREEMPT_MAX_TIME_SPENT_NS ||
-                 driver_acct().get_accumulated_local_wait_time_spent() > YIELD_PREEMPT_MAX_TIME_SPENT_NS) &&
-                _workgroup->driver_sched_entity()->in_queue()->should_yield(this, time_spent)) {
-                should_yield = true;
-                COUNTER_UPDATE(_yield_by_preempt_counter, 1);
                 break;
             }
         }
@@ -422,8 +430,14 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
         // should yield means that the CPU core is occupied the driver for a
         // very long time so that the driver should switch off the core and
         // give chance for another ready driver to run.
+        if (!should_yield && _has_pending_work()) {
+            // the pending work units left by operators in this round are processed in the next round.
+            continue;
+        }
         if (num_chunks_moved == 0 || should_yield) {
-            if (is_precondition_block()) {
+            if (_has_pending_work()) {
+                set_driver_state(DriverState::READY);
+            } else if (is_precondition_block()) {
                 set_driver_state(DriverState::PRECONDITION_BLOCK);
                 COUNTER_UPDATE(_block_by_precondition_counter, 1);
             } else if (!sink_operator()->is_finished() && !sink_operator()->need_input()) {
@@ -511,6 +525,7 @@ void PipelineDriver::runtime_report_action() {
                                               op->_close_timer->value());
         op->update_metrics(_fragment_ctx->runtime_state());
     }
+    _record_continuous_profile();
 }
 
 void PipelineDriver::mark_precondition_not_ready() {
@@ -684,6 +699,7 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state, in
     set_driver_state(state);
 
     _update_driver_level_timer();
+    _record_continuous_profile();
 
     // Acquire the pointer to avoid be released when removing query
     auto query_trace = _query_ctx->shared_query_trace();
@@ -758,6 +774,58 @@ void PipelineDriver::set_workgroup(workgroup::WorkGroupPtr wg) {
     _workgroup->incr_num_running_drivers();
 }
 
+bool PipelineDriver::_should_yield(int64_t time_spent) {
+    if (time_spent >= YIELD_MAX_TIME_SPENT_NS ||
+        driver_acct().get_accumulated_local_wait_time_spent() >= YIELD_MAX_TIME_SPENT_NS) {
+        COUNTER_UPDATE(_yield_by_time_limit_counter, 1);
+        return true;
+    }
+    if (_workgroup != nullptr &&
+        (time_spent >= YIELD_PREEMPT_MAX_TIME_SPENT_NS ||
+         driver_acct().get_accumulated_local_wait_time_spent() > YIELD_PREEMPT_MAX_TIME_SPENT_NS) &&
+        _workgroup->driver_sched_entity()->in_queue()->should_yield(this, time_spent)) {
+        COUNTER_UPDATE(_yield_by_preempt_counter, 1);
+        return true;
+    }
+    return false;
+}
+
+bool PipelineDriver::_has_pending_work() const {
+    for (size_t i = _first_unfinished; i < _operators.size(); ++i) {
+        if (_operators[i]->has_pending_work()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+StatusOr<bool> PipelineDriver::_process_pending_work(RuntimeState* runtime_state, int64_t* time_spent) {
+    for (size_t i = _first_unfinished; i < _operators.size(); ++i) {
+        auto& op = _operators[i];
+        while (op->has_pending_work()) {
+            if (_fragment_ctx->is_canceled()) {
+                return false;
+            }
+            {
+                SCOPED_RAW_TIMER(time_spent);
+                SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(op);
+                QUERY_TRACE_SCOPED(op->get_name(), "do_pending_work");
+                auto status = op->do_pending_work(runtime_state);
+                if (!status.ok()) {
+                    op->common_metrics()->add_info_string("ErrorMsg", std::string(status.message()));
+                    LOG(WARNING) << "do_pending_work returns not ok status " << status.to_string();
+                    return status;
+                }
+            }
+            COUNTER_UPDATE(_pending_work_unit_counter, 1);
+            if (op->has_pending_work() && _should_yield(*time_spent)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool PipelineDriver::_check_fragment_is_canceled(RuntimeState* runtime_state) {
     if (_fragment_ctx->is_canceled()) {
         cancel_operators(runtime_state);
@@ -905,4 +973,67 @@ void PipelineDriver::increment_schedule_times() {
     driver_acct().increment_schedule_times();
 }
 
+void PipelineDriver::set_in_ready_queue(bool v) {
+    // Each stay in a ready queue is recorded when the driver is taken out of it.
+    if (v) {
+        _ready_queue_enter_ns.store(MonotonicNanos(), std::memory_order_relaxed);
+    } else if (int64_t enter_ns = _ready_queue_enter_ns.exchange(0, std::memory_order_relaxed); enter_ns > 0) {
+        _record_wait(DriverWaitReason::READY_QUEUE, MonotonicNanos() - enter_ns);
+    }
+    _in_ready_queue.store(v, std::memory_order_release);
+}
+
+void PipelineDriver::_record_wait(DriverWaitReason reason, int64_t wait_ns) {
+    if (_query_ctx == nullptr) {
+        return;
+    }
+    if (_blocked_by_spill && reason != DriverWaitReason::PRECONDITION_NOT_READY &&
+        reason != DriverWaitReason::READY_QUEUE) {
+        reason = DriverWaitReason::SPILL_IO;
+        _blocked_by_spill = false;
+    }
+    _query_ctx->driver_wait_stats()->add(reason, wait_ns);
+    DriverWaitStats::instance()->add(reason, wait_ns);
+}
+
+void PipelineDriver::_record_continuous_profile() {
+    if (config::continuous_profiler_window_minutes <= 0 || _query_ctx == nullptr) {
+        return;
+    }
+    std::lock_guard l(_continuous_profile_mutex);
+    if (_continuous_profile_keys.empty()) {
+        ContinuousProfiler::Sample sample;
+        sample.workgroup = _workgroup != nullptr ? _workgroup->name() : "none";
+        sample.query_id = print_id(_query_ctx->query_id());
+        sample.fragment_id = print_id(_fragment_ctx->fragment_instance_id());
+        _continuous_profile_keys.reserve(_operators.size());
+        for (const auto& op : _operators) {
+            sample.operator_name = strings::Substitute("$0_$1", op->get_raw_name(), op->get_plan_node_id());
+            _continuous_profile_keys.emplace_back(ContinuousProfiler::make_key(sample));
+        }
+        _continuous_profile_recorded_ns.assign(_operators.size(), 0);
+    }
+    // Only the time spent since the last time is added, into the bucket of the current minute.
+    std::vector<ContinuousProfiler::FoldedSample> samples;
+    samples.reserve(_operators.size());
+    for (size_t i = 0; i < _operators.size(); i++) {
+        auto* total_timer = _operators[i]->common_metrics()->get_counter("OperatorTotalTime");
+        if (total_timer == nullptr) {
+            continue;
+        }
+        int64_t total_time = total_timer->value();
+        if (total_time > _continuous_profile_recorded_ns[i]) {
+            samples.push_back({&_continuous_profile_keys[i], total_time - _continuous_profile_recorded_ns[i]});
+            _continuous_profile_recorded_ns[i] = total_time;
+        }
+    }
+    ContinuousProfiler::instance()->add(samples, UnixSeconds());
+}
+
+bool PipelineDriver::_is_spilling() const {
+    return std::any_of(_operators.begin(), _operators.end(), [](const auto& op) {
+        return op->spillable() && op->mem_resource_manager().releaseable();
+    });
+}
+
 } // namespace starrocks::pipeline
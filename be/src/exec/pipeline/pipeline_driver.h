@@ -18,6 +18,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
@@ -25,6 +28,7 @@
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/pipeline_wait_stats.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/pipeline/scan/morsel.h"
@@ -247,17 +251,27 @@ public:
                 _followup_input_empty_timer->update(elapsed_time);
             }
             _input_empty_timer->update(elapsed_time);
+            _record_wait(DriverWaitReason::INPUT_EMPTY, elapsed_time);
             break;
         }
-        case DriverState::OUTPUT_FULL:
-            _output_full_timer->update(_output_full_timer_sw->elapsed_time());
+        case DriverState::OUTPUT_FULL: {
+            auto elapsed_time = _output_full_timer_sw->elapsed_time();
+            _output_full_timer->update(elapsed_time);
+            _record_wait(DriverWaitReason::OUTPUT_FULL, elapsed_time);
             break;
-        case DriverState::PRECONDITION_BLOCK:
-            _precondition_block_timer->update(_precondition_block_timer_sw->elapsed_time());
+        }
+        case DriverState::PRECONDITION_BLOCK: {
+            auto elapsed_time = _precondition_block_timer_sw->elapsed_time();
+            _precondition_block_timer->update(elapsed_time);
+            _record_wait(DriverWaitReason::PRECONDITION_NOT_READY, elapsed_time);
             break;
-        case DriverState::PENDING_FINISH:
-            _pending_finish_timer->update(_pending_finish_timer_sw->elapsed_time());
+        }
+        case DriverState::PENDING_FINISH: {
+            auto elapsed_time = _pending_finish_timer_sw->elapsed_time();
+            _pending_finish_timer->update(elapsed_time);
+            _record_wait(DriverWaitReason::PENDING_FINISH, elapsed_time);
             break;
+        }
         default:
             break;
         }
@@ -265,15 +279,18 @@ public:
         switch (state) {
         case DriverState::INPUT_EMPTY:
             _input_empty_timer_sw->reset();
+            _blocked_by_spill = _is_spilling();
             break;
         case DriverState::OUTPUT_FULL:
             _output_full_timer_sw->reset();
+            _blocked_by_spill = _is_spilling();
             break;
         case DriverState::PRECONDITION_BLOCK:
             _precondition_block_timer_sw->reset();
             break;
         case DriverState::PENDING_FINISH:
             _pending_finish_timer_sw->reset();
+            _blocked_by_spill = _is_spilling();
             break;
         default:
             break;
@@ -434,12 +451,14 @@ public:
     const workgroup::WorkGroup* workgroup() const;
     void set_workgroup(workgroup::WorkGroupPtr wg);
 
+    PipelineObserver* observer() { return &_observer; }
+
     void set_in_queue(DriverQueue* in_queue) { _in_queue = in_queue; }
     size_t get_driver_queue_level() const { return _driver_queue_level; }
     void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
 
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
-    void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
+    void set_in_ready_queue(bool v);
 
     inline std::string get_name() const { return strings::Substitute("PipelineDriver (id=$0)", _driver_id); }
 
@@ -480,6 +499,13 @@ protected:
     Status _mark_operator_closed(OperatorPtr& op, RuntimeState* runtime_state);
     void _close_operators(RuntimeState* runtime_state);
 
+    // Whether the driver should switch off the core after spending time_spent in current execution round.
+    bool _should_yield(int64_t time_spent);
+    bool _has_pending_work() const;
+    // Run the resumable work units of unfinished operators until all of them are done or the driver
+    // should yield. Returns true if the driver yields with pending work left.
+    StatusOr<bool> _process_pending_work(RuntimeState* runtime_state, int64_t* time_spent);
+
     void _adjust_memory_usage(RuntimeState* state, MemTracker* tracker, OperatorPtr& op, const ChunkPtr& chunk);
     void _try_to_release_buffer(RuntimeState* state, OperatorPtr& op);
 
@@ -488,6 +514,12 @@ protected:
     void _update_statistics(RuntimeState* state, size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
     void _update_scan_statistics(RuntimeState* state);
     void _update_driver_level_timer();
+    // Record the wait time into the wait stats of the query and the BE, the wait is accounted to SPILL_IO instead
+    // if the driver is blocked when some of its operators is spilling.
+    void _record_wait(DriverWaitReason reason, int64_t wait_ns);
+    // Add the time of the operators to ContinuousProfiler.
+    void _record_continuous_profile();
+    bool _is_spilling() const;
 
     RuntimeState* _runtime_state = nullptr;
     Operators _operators;
@@ -516,6 +548,13 @@ protected:
     MorselQueue* _morsel_queue = nullptr;
     // _state must be set by set_driver_state() to record state timer.
     DriverState _state{DriverState::NOT_READY};
+    // Whether some operator is spilling when the driver enters the current blocked state.
+    bool _blocked_by_spill = false;
+    // The folded keys of the operators and their OperatorTotalTime already added to ContinuousProfiler.
+    // The runtime report and finalize may race, so they are guarded by the mutex.
+    std::mutex _continuous_profile_mutex;
+    std::vector<std::string> _continuous_profile_keys;
+    std::vector<int64_t> _continuous_profile_recorded_ns;
     std::shared_ptr<RuntimeProfile> _runtime_profile = nullptr;
 
     phmap::flat_hash_map<int32_t, OperatorStage> _operator_stages;
@@ -525,9 +564,13 @@ protected:
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
+    // When the driver entered its ready queue, 0 if it's not in a ready queue.
+    std::atomic<int64_t> _ready_queue_enter_ns{0};
 
     std::atomic<bool> _has_log_cancelled{false};
 
+    PipelineObserver _observer;
+
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
     RuntimeProfile::Counter* _active_timer = nullptr;
@@ -540,6 +583,7 @@ protected:
     RuntimeProfile::Counter* _yield_by_time_limit_counter = nullptr;
     RuntimeProfile::Counter* _yield_by_preempt_counter = nullptr;
     RuntimeProfile::Counter* _yield_by_local_wait_counter = nullptr;
+    RuntimeProfile::Counter* _pending_work_unit_counter = nullptr;
     RuntimeProfile::Counter* _block_by_precondition_counter = nullptr;
     RuntimeProfile::Counter* _block_by_output_full_counter = nullptr;
     RuntimeProfile::Counter* _block_by_input_empty_counter = nullptr;
@@ -31,8 +31,7 @@ namespace starrocks::pipeline {
 GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_ptr<ThreadPool> thread_pool,
                                            bool enable_resource_group, const CpuUtil::CpuIds& cpuids)
         : Base("pip_exec_" + name),
-          _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(_create_driver_queue(enable_resource_group, thread_pool->max_threads())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(name, _driver_queue.get(), cpuids)),
           _exec_state_reporter(new ExecStateReporter(cpuids)),
@@ -44,6 +43,17 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
                                     [this] { return _blocked_driver_poller->num_drivers(); });
 }
 
+DriverQueuePtr GlobalDriverExecutor::_create_driver_queue(bool enable_resource_group, int num_threads) {
+    DriverQueuePtr shared_queue = enable_resource_group
+                                          ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
+                                          : std::make_unique<QuerySharedDriverQueue>();
+    if (!config::pipeline_enable_driver_queue_work_stealing) {
+        return shared_queue;
+    }
+    return std::make_unique<WorkStealingDriverQueue>(std::move(shared_queue), std::max(num_threads, 1),
+                                                     std::max<int32_t>(config::pipeline_driver_queue_local_capacity, 1));
+}
+
 void GlobalDriverExecutor::close() {
     _driver_queue->close();
     _thread_pool->wait();
@@ -78,9 +88,11 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    _driver_queue->bind_worker(worker_id);
     std::queue<DriverRawPtr> local_driver_queue;
     while (true) {
         if (local_driver_queue.empty() && _num_threads_setter.should_shrink()) {
+            _driver_queue->unbind_worker();
             break;
         }
         // Reset TLS state
@@ -94,6 +94,7 @@ public:
 
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
+    static DriverQueuePtr _create_driver_queue(bool enable_resource_group, int num_threads);
     void _worker_thread();
     StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
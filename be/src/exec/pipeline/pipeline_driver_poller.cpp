@@ -15,6 +15,9 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -48,7 +51,14 @@ void PipelineDriverPoller::run_internal() {
     DriverList tmp_blocked_drivers;
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
+    PollerFallbackTimer fallback_timer(MonotonicMicros());
     while (!_is_shutdown.load(std::memory_order_acquire)) {
+        const bool event_driven = config::enable_pipeline_event_driven_poller;
+        const int64_t fallback_interval_us = std::max<int64_t>(config::pipeline_poller_fallback_interval_us, 1);
+        const bool check_all_drivers =
+                fallback_timer.start_round(event_driven, fallback_interval_us, MonotonicMicros());
+        _has_pending_event.store(false, std::memory_order_release);
+
         {
             std::unique_lock<std::mutex> lock(_global_mutex);
             tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
@@ -78,6 +88,11 @@ void PipelineDriverPoller::run_internal() {
             while (driver_it != _local_blocked_drivers.end()) {
                 auto* driver = *driver_it;
 
+                if (!driver->observer()->fetch_event() && !check_all_drivers) {
+                    ++driver_it;
+                    continue;
+                }
+
                 if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
                     // there are not any drivers belonging to a query context can make progress for an expiration period
                     // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
@@ -158,6 +173,19 @@ void PipelineDriverPoller::run_internal() {
             ready_drivers.clear();
         }
 
+        if (event_driven) {
+            // Sleep until any observer is notified, new drivers are added, or the fallback interval elapses,
+            // instead of spinning over all the blocked drivers.
+            std::unique_lock<std::mutex> lock(_global_mutex);
+            const int64_t wait_us = fallback_timer.wait_us(fallback_interval_us, MonotonicMicros());
+            const bool notified = wait_us > 0 && _cond.wait_for(lock, std::chrono::microseconds(wait_us), [this] {
+                return _is_shutdown.load(std::memory_order_acquire) ||
+                       _has_pending_event.load(std::memory_order_acquire) || !_blocked_drivers.empty();
+            });
+            fallback_timer.end_wait(notified);
+            continue;
+        }
+
         if (spin_count != 0 && spin_count % 64 == 0) {
 #ifdef __x86_64__
             _mm_pause();
@@ -187,6 +215,19 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     _num_drivers++;
     driver->_pending_timer_sw->reset();
     driver->driver_acct().clean_local_queue_infos();
+    // The newly blocked driver is checked in the next polling round.
+    driver->observer()->attach_poller(this);
+    driver->observer()->mark_event();
+    _cond.notify_one();
+}
+
+void PipelineDriverPoller::notify_event() {
+    // The notifications are coalesced until the poller starts the next polling round.
+    if (_has_pending_event.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    // Acquire the lock to avoid missing the wakeup, when the poller is going to wait.
+    std::lock_guard<std::mutex> lock(_global_mutex);
     _cond.notify_one();
 }
 
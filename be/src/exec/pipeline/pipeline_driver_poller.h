@@ -29,6 +29,38 @@ namespace starrocks::pipeline {
 class PipelineDriverPoller;
 using PipelineDriverPollerPtr = std::unique_ptr<PipelineDriverPoller>;
 
+// In the event-driven mode, only the drivers whose observers are notified are checked in a polling round,
+// and all the blocked drivers are checked once every fallback interval, which covers the drivers
+// blocked by the operators not notifying observers and the expired or cancelled drivers.
+// PollerFallbackTimer decides which rounds check all the blocked drivers, and how long the poller sleeps between.
+class PollerFallbackTimer {
+public:
+    explicit PollerFallbackTimer(int64_t now_us) : _last_check_all_us(now_us) {}
+
+    // Called at the start of a polling round, return whether the round checks all the blocked drivers.
+    // All the rounds check all the blocked drivers, if not in the event-driven mode.
+    bool start_round(bool event_driven, int64_t interval_us, int64_t now_us) {
+        if (!event_driven || now_us - _last_check_all_us >= interval_us) {
+            _check_all = true;
+        }
+        if (_check_all) {
+            _last_check_all_us = now_us;
+        }
+        return _check_all;
+    }
+
+    // The longest time the poller sleeps after a round, it's not positive if the fallback interval has elapsed.
+    int64_t wait_us(int64_t interval_us, int64_t now_us) const { return interval_us - (now_us - _last_check_all_us); }
+
+    // Called after the sleep. The next round checks all the blocked drivers, if the sleep isn't ended by a
+    // notification, which means the fallback interval has elapsed.
+    void end_wait(bool notified) { _check_all = !notified; }
+
+private:
+    bool _check_all = true;
+    int64_t _last_check_all_us;
+};
+
 class PipelineDriverPoller {
 public:
     explicit PipelineDriverPoller(std::string name, DriverQueue* driver_queue, CpuUtil::CpuIds cpuids)
@@ -50,6 +82,9 @@ public:
     void shutdown();
 
     void add_blocked_driver(const DriverRawPtr driver);
+    // Wake up the poller to check the drivers whose observers are notified.
+    // It is called by PipelineObserver::notify().
+    void notify_event();
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
 
     void park_driver(const DriverRawPtr driver);
@@ -89,5 +124,8 @@ private:
     DriverList _parked_drivers;
 
     std::atomic<size_t> _num_drivers;
+
+    // Whether any observer is notified since the last polling round, only used in the event-driven mode.
+    std::atomic<bool> _has_pending_event = false;
 };
 } // namespace starrocks::pipeline
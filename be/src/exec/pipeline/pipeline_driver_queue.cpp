@@ -14,9 +14,12 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <algorithm>
+
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -252,7 +255,10 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
         // so `_pick_next_wg` will always return this workgroup.
         // TODO: In the future, we may implement different driver queues for exclusive workgroup and shared workgroup,
         // since exclusive workgroup does not need two-level queues about workgroup.
-        wg_entity = _pick_next_wg();
+        wg_entity = _pick_urgent_wg(MonotonicNanos());
+        if (wg_entity == nullptr) {
+            wg_entity = _pick_next_wg();
+        }
         if (wg_entity != nullptr &&
             !ExecEnv::GetInstance()->workgroup_manager()->should_yield(wg_entity->workgroup())) {
             break;
@@ -282,6 +288,9 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
     auto maybe_driver = wg_entity->queue()->take(block);
     if (maybe_driver.ok() && maybe_driver.value() != nullptr) {
         --_num_drivers;
+        if (wg_entity->workgroup()->has_latency_slo()) {
+            _remove_slo_query_begin_time(wg_entity, maybe_driver.value());
+        }
     }
     return maybe_driver;
 }
@@ -315,6 +324,10 @@ void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
     if (is_in_queue) {
         _wg_entities.emplace(wg_entity);
         _update_min_wg();
+    } else {
+        // The queries of latency-SLO workgroups become urgent as time goes by, even if no workgroup is
+        // enqueued or dequeued.
+        _update_urgent_wg();
     }
 
     wg_entity->queue()->update_statistics(driver);
@@ -330,8 +343,13 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
     if (ExecEnv::GetInstance()->workgroup_manager()->should_yield(driver->workgroup())) {
         return true;
     }
-    // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
+    // The workgroups without latency SLO yield to the urgent drivers of latency-SLO workgroups.
+    auto* urgent_entity = _urgent_wg_entity.load();
+    if (urgent_entity != nullptr && urgent_entity != wg_entity && !driver->workgroup()->has_latency_slo()) {
+        return true;
+    }
+    // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* min_entity = _min_wg_entity.load();
     return min_entity != wg_entity && min_entity &&
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_weight();
@@ -345,9 +363,14 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     wg_entity->set_in_queue(this);
     wg_entity->queue()->put_back(driver);
     driver->set_in_queue(this);
+    if (driver->workgroup()->has_latency_slo()) {
+        _slo_query_begin_times[wg_entity].emplace(driver->query_ctx()->query_begin_time());
+    }
 
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
         _enqueue_workgroup<from_executor>(wg_entity);
+    } else if (driver->workgroup()->has_latency_slo()) {
+        _update_urgent_wg();
     }
 
     ++_num_drivers;
@@ -362,6 +385,11 @@ void WorkGroupDriverQueue::_update_min_wg() {
     } else {
         _min_wg_entity = min_wg_entity;
     }
+    _update_urgent_wg();
+}
+
+void WorkGroupDriverQueue::_update_urgent_wg() {
+    _urgent_wg_entity = _pick_urgent_wg(MonotonicNanos());
 }
 
 workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_pick_next_wg() const {
@@ -371,6 +399,46 @@ workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_pick_next_wg() con
     return *_wg_entities.begin();
 }
 
+workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_pick_urgent_wg(int64_t now_ns) const {
+    if (_slo_query_begin_times.empty() || _wg_entities.empty()) {
+        return nullptr;
+    }
+
+    const int64_t min_vruntime_ns = (*_wg_entities.begin())->vruntime_ns();
+    workgroup::WorkGroupDriverSchedEntity* urgent_entity = nullptr;
+    int64_t earliest_deadline_ns = 0;
+    for (const auto& [wg_entity, begin_times] : _slo_query_begin_times) {
+        const auto* wg = wg_entity->workgroup();
+        const int64_t query_begin_time_ns = *begin_times.begin();
+        if (!wg->is_urgent_query(query_begin_time_ns, now_ns) ||
+            wg_entity->vruntime_ns() - min_vruntime_ns > workgroup::WorkGroup::SLO_MAX_VRUNTIME_LEAD_NS) {
+            continue;
+        }
+        const int64_t deadline_ns = query_begin_time_ns + wg->target_latency_ns();
+        if (urgent_entity == nullptr || deadline_ns < earliest_deadline_ns) {
+            urgent_entity = wg_entity;
+            earliest_deadline_ns = deadline_ns;
+        }
+    }
+    return urgent_entity;
+}
+
+void WorkGroupDriverQueue::_remove_slo_query_begin_time(workgroup::WorkGroupDriverSchedEntity* wg_entity,
+                                                        const DriverRawPtr driver) {
+    auto it = _slo_query_begin_times.find(wg_entity);
+    if (it == _slo_query_begin_times.end()) {
+        return;
+    }
+    auto& begin_times = it->second;
+    if (auto time_it = begin_times.find(driver->query_ctx()->query_begin_time()); time_it != begin_times.end()) {
+        begin_times.erase(time_it);
+    }
+    if (begin_times.empty()) {
+        _slo_query_begin_times.erase(it);
+    }
+    _update_urgent_wg();
+}
+
 template <bool from_executor>
 void WorkGroupDriverQueue::_enqueue_workgroup(workgroup::WorkGroupDriverSchedEntity* wg_entity) {
     _sum_cpu_weight += wg_entity->cpu_weight();
@@ -406,4 +474,238 @@ int64_t WorkGroupDriverQueue::_ideal_runtime_ns(workgroup::WorkGroupDriverSchedE
     return SCHEDULE_PERIOD_PER_WG_NS * _wg_entities.size() * wg_entity->cpu_weight() / _sum_cpu_weight;
 }
 
+/// WorkStealingDriverQueue.
+namespace {
+// The local queue bound to the current executor thread.
+struct WorkerBinding {
+    const WorkStealingDriverQueue* queue = nullptr;
+    int index = -1;
+    // The number of drivers taken from the local queue in a row, used to give the shared queue a chance.
+    int num_local_takes = 0;
+};
+thread_local WorkerBinding tls_worker_binding;
+
+// After taking so many drivers from the local queue in a row, the shared queue is tried first once.
+constexpr int MAX_LOCAL_TAKES_IN_ROW = 16;
+} // namespace
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(DriverQueuePtr shared_queue, size_t num_workers,
+                                                 size_t local_capacity)
+        : _shared_queue(std::move(shared_queue)), _local_capacity(local_capacity) {
+    DCHECK(_shared_queue != nullptr);
+    _local_queues.reserve(std::max<size_t>(num_workers, 1));
+    for (size_t i = 0; i < std::max<size_t>(num_workers, 1); ++i) {
+        _local_queues.emplace_back(std::make_unique<LocalQueue>());
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    _is_closed = true;
+    _shared_queue->close();
+}
+
+void WorkStealingDriverQueue::bind_worker(int worker_id) {
+    tls_worker_binding.queue = this;
+    tls_worker_binding.index = worker_id % _local_queues.size();
+    tls_worker_binding.num_local_takes = 0;
+}
+
+void WorkStealingDriverQueue::unbind_worker() {
+    const int index = _local_index();
+    if (index < 0) {
+        return;
+    }
+    tls_worker_binding = WorkerBinding();
+    // The drivers left in the local queue of the exiting thread are handed back to the shared queue,
+    // otherwise they would be only reachable by stealing.
+    std::vector<DriverRawPtr> drivers;
+    {
+        auto& local_queue = *_local_queues[index];
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        drivers.assign(local_queue.drivers.begin(), local_queue.drivers.end());
+        local_queue.drivers.clear();
+        for (auto* driver : drivers) {
+            driver->set_in_ready_queue(false);
+        }
+        _num_local_drivers.fetch_sub(drivers.size(), std::memory_order_release);
+    }
+    if (!drivers.empty()) {
+        _shared_queue->put_back(drivers);
+    }
+}
+
+int WorkStealingDriverQueue::_local_index() const {
+    return tls_worker_binding.queue == this ? tls_worker_binding.index : -1;
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _shared_queue->put_back(driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    _shared_queue->put_back(drivers);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    const int index = _local_index();
+    // Only the short drivers are kept in the local queue, the others are left to the multi-level
+    // priority of the shared queue.
+    const bool is_short = driver->driver_acct().get_accumulated_time_spent() <
+                          config::pipeline_driver_queue_level_time_slice_base_ns;
+    // An idle thread blocked on the shared queue is woken up only by the shared queue.
+    const bool has_idle_taker = _num_blocked_takers.load(std::memory_order_seq_cst) > 0;
+    if (index >= 0 && is_short && !has_idle_taker && driver->driver_state() != DriverState::CANCELED) {
+        auto& local_queue = *_local_queues[index];
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        if (local_queue.drivers.size() < _local_capacity) {
+            driver->update_peak_driver_queue_size_counter(size());
+            local_queue.drivers.emplace_back(driver);
+            driver->set_in_queue(this);
+            driver->set_in_ready_queue(true);
+            _num_local_drivers.fetch_add(1, std::memory_order_release);
+            return;
+        }
+    }
+    _shared_queue->put_back_from_executor(driver);
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    if (_is_closed) {
+        return Status::Cancelled("Shutdown");
+    }
+
+    const int index = _local_index();
+    const bool prefer_shared =
+            index >= 0 && tls_worker_binding.num_local_takes >= MAX_LOCAL_TAKES_IN_ROW && !_shared_queue->empty();
+    if (index >= 0 && !prefer_shared) {
+        if (auto* driver = _take_local(index); driver != nullptr) {
+            // Give up the local driver, if the shared queue has a workgroup that deserves the CPU more.
+            if (!_shared_queue->should_yield(driver, 0)) {
+                tls_worker_binding.num_local_takes++;
+                return driver;
+            }
+            _shared_queue->put_back_from_executor(driver);
+        }
+    }
+    if (index >= 0) {
+        tls_worker_binding.num_local_takes = 0;
+    }
+
+    ASSIGN_OR_RETURN(auto* driver, _shared_queue->take(false));
+    if (driver != nullptr) {
+        return driver;
+    }
+
+    driver = _steal(index);
+    if (driver != nullptr) {
+        return driver;
+    }
+
+    if (!block) {
+        return nullptr;
+    }
+    while (true) {
+        // Announce the blocking before checking the local queues, a driver put to a local queue after that
+        // goes to the shared queue instead, so it always wakes up this thread.
+        _num_blocked_takers.fetch_add(1, std::memory_order_seq_cst);
+        if (num_local_drivers() == 0) {
+            auto maybe_driver = _shared_queue->take(true);
+            _num_blocked_takers.fetch_sub(1, std::memory_order_seq_cst);
+            return maybe_driver;
+        }
+        _num_blocked_takers.fetch_sub(1, std::memory_order_seq_cst);
+
+        if (index >= 0) {
+            if (auto* local_driver = _take_local(index); local_driver != nullptr) {
+                return local_driver;
+            }
+        }
+        if (auto* stolen_driver = _steal(index); stolen_driver != nullptr) {
+            return stolen_driver;
+        }
+        ASSIGN_OR_RETURN(driver, _shared_queue->take(false));
+        if (driver != nullptr) {
+            return driver;
+        }
+    }
+}
+
+DriverRawPtr WorkStealingDriverQueue::_take_local(int index) {
+    auto& local_queue = *_local_queues[index];
+    std::lock_guard<std::mutex> lock(local_queue.mutex);
+    if (local_queue.drivers.empty()) {
+        return nullptr;
+    }
+    // Take the most recently yielded driver, whose data is most likely still in the cache.
+    auto* driver = local_queue.drivers.back();
+    local_queue.drivers.pop_back();
+    driver->set_in_ready_queue(false);
+    _num_local_drivers.fetch_sub(1, std::memory_order_release);
+    return driver;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_steal(int thief_index) {
+    if (num_local_drivers() == 0) {
+        return nullptr;
+    }
+    const size_t num_queues = _local_queues.size();
+    const size_t start = thief_index < 0 ? 0 : thief_index + 1;
+    for (size_t i = 0; i < num_queues; ++i) {
+        const size_t victim = (start + i) % num_queues;
+        if (static_cast<int>(victim) == thief_index) {
+            continue;
+        }
+        auto& local_queue = *_local_queues[victim];
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        if (local_queue.drivers.empty()) {
+            continue;
+        }
+        // Steal the oldest driver, which is the least likely to be still hot in the victim's cache.
+        auto* driver = local_queue.drivers.front();
+        local_queue.drivers.pop_front();
+        driver->set_in_ready_queue(false);
+        _num_local_drivers.fetch_sub(1, std::memory_order_release);
+        return driver;
+    }
+    return nullptr;
+}
+
+bool WorkStealingDriverQueue::_remove_local(const DriverRawPtr driver) {
+    for (auto& local_queue : _local_queues) {
+        std::lock_guard<std::mutex> lock(local_queue->mutex);
+        auto it = std::find(local_queue->drivers.begin(), local_queue->drivers.end(), driver);
+        if (it != local_queue->drivers.end()) {
+            local_queue->drivers.erase(it);
+            driver->set_in_ready_queue(false);
+            _num_local_drivers.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    if (_is_closed) {
+        return;
+    }
+    // The cancelled driver in a local queue is moved to the shared queue,
+    // which guarantees that the cancelled drivers are executed first.
+    if (num_local_drivers() > 0 && _remove_local(driver)) {
+        _shared_queue->put_back(driver);
+    }
+    _shared_queue->cancel(driver);
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _shared_queue->update_statistics(driver);
+}
+
+size_t WorkStealingDriverQueue::size() const {
+    return _shared_queue->size() + num_local_drivers();
+}
+
+bool WorkStealingDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
+    return _shared_queue->should_yield(driver, unaccounted_runtime_ns);
+}
+
 } // namespace starrocks::pipeline
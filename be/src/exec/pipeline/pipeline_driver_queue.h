@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <deque>
 #include <queue>
+#include <set>
+#include <unordered_map>
 
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
@@ -46,6 +49,12 @@ public:
     bool empty() const { return size() == 0; }
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
+
+    // Bind the calling executor thread to the queue as the worker with *worker_id*.
+    // It is only meaningful to the queues which keep per-worker state.
+    virtual void bind_worker(int worker_id) {}
+    // Unbind the calling executor thread before it exits, the per-worker state is handed back to the queue.
+    virtual void unbind_worker() {}
 };
 
 // SubQuerySharedDriverQueue is used to store the driver waiting to be executed.
@@ -161,7 +170,8 @@ public:
     void put_back_from_executor(const DriverRawPtr driver) override;
 
     // Return cancelled status, if the queue is closed.
-    // Firstly, select the work group with the minimum vruntime.
+    // Firstly, select the latency-SLO work group with the earliest deadline among the ones having urgent drivers,
+    // or the work group with the minimum vruntime if there is no urgent driver.
     // Secondly, select the proper driver from the driver queue of this work group.
     StatusOr<DriverRawPtr> take(const bool block) override;
 
@@ -178,8 +188,14 @@ private:
     template <bool from_executor>
     void _put_back(const DriverRawPtr driver);
     workgroup::WorkGroupDriverSchedEntity* _pick_next_wg() const;
+    // Return the latency-SLO workgroup whose urgent query has the earliest deadline, or nullptr if there is none.
+    workgroup::WorkGroupDriverSchedEntity* _pick_urgent_wg(int64_t now_ns) const;
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
+    // _update_urgent_wg is invoked whenever the ready drivers or the runtime of the workgroups change,
+    // since the queries of latency-SLO workgroups become urgent as time goes by.
+    void _update_urgent_wg();
+    void _remove_slo_query_begin_time(workgroup::WorkGroupDriverSchedEntity* wg_entity, const DriverRawPtr driver);
     template <bool from_executor>
     void _enqueue_workgroup(workgroup::WorkGroupDriverSchedEntity* wg_entity);
     void _dequeue_workgroup(workgroup::WorkGroupDriverSchedEntity* wg_entity);
@@ -213,6 +229,76 @@ private:
 
     // Cache the minimum entity, used to check should_yield() without lock.
     std::atomic<workgroup::WorkGroupDriverSchedEntity*> _min_wg_entity = nullptr;
+
+    // The begin time of the queries of the ready drivers, for each latency-SLO workgroup in the queue.
+    std::unordered_map<workgroup::WorkGroupDriverSchedEntity*, std::multiset<int64_t>> _slo_query_begin_times;
+    // Cache the urgent latency-SLO entity, used to check should_yield() without lock.
+    std::atomic<workgroup::WorkGroupDriverSchedEntity*> _urgent_wg_entity = nullptr;
+};
+
+// WorkStealingDriverQueue puts a bounded local deque of each executor thread in front of the shared queue.
+//
+// A driver is yielded by an executor thread and put back to the local deque of this thread, only if it is still
+// short (its accumulated time doesn't exceed the time slice of the first level of QuerySharedDriverQueue), so that
+// it is rescheduled on the same thread with warm cache and without contending for the lock of the shared queue.
+// The other drivers, including the ones from the poller, go through the shared queue, which still takes charge of
+// the multi-level priority and the workgroup vruntime accounting.
+//
+// When taking a driver, the executor thread tries the following sources in order:
+// 1. the back of its own local deque, unless the shared queue reports that the driver should yield
+//    to a workgroup with smaller vruntime, in which case the driver is moved to the shared queue.
+// 2. the shared queue without blocking.
+// 3. the front of the local deques of the other executor threads, i.e. work stealing.
+// 4. the shared queue with blocking, only when all the local deques are empty.
+//
+// While some executor thread is blocked on the shared queue, the yielded drivers go to the shared queue instead of
+// the local deque, so that they wake up the idle thread rather than waiting for their own thread.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    WorkStealingDriverQueue(DriverQueuePtr shared_queue, size_t num_workers, size_t local_capacity);
+    ~WorkStealingDriverQueue() override = default;
+
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    StatusOr<DriverRawPtr> take(const bool block) override;
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
+
+    void bind_worker(int worker_id) override;
+    void unbind_worker() override;
+
+    size_t num_local_drivers() const { return _num_local_drivers.load(std::memory_order_acquire); }
+
+private:
+    struct LocalQueue {
+        mutable std::mutex mutex;
+        std::deque<DriverRawPtr> drivers;
+    };
+
+    // Return the index of the local queue bound to the calling thread, or -1 for the non-executor threads.
+    int _local_index() const;
+    DriverRawPtr _take_local(int index);
+    DriverRawPtr _steal(int thief_index);
+    bool _remove_local(const DriverRawPtr driver);
+
+    DriverQueuePtr _shared_queue;
+    const size_t _local_capacity;
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+    std::atomic<size_t> _num_local_drivers = 0;
+    // The number of executor threads blocked or about to block on the shared queue.
+    std::atomic<int> _num_blocked_takers = 0;
+    std::atomic<bool> _is_closed = false;
 };
 
 } // namespace starrocks::pipeline
@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+class PipelineDriverPoller;
+
+// PipelineObserver is owned by a driver, and is notified when something happens that may unblock the driver,
+// such as new chunks arrive at its exchange source, or the hash table which it depends on is built.
+// When the driver is blocked, the notification wakes up the poller to check this driver at once,
+// instead of waiting for the poller to check all the blocked drivers in turn.
+class PipelineObserver {
+public:
+    PipelineObserver() = default;
+
+    // Called by the poller, when the driver is added to it.
+    void attach_poller(PipelineDriverPoller* poller) { _poller.store(poller, std::memory_order_release); }
+
+    // Mark an event happened, and wake up the poller if any.
+    void notify();
+    // Only mark an event happened.
+    void mark_event() { _has_event.store(true, std::memory_order_release); }
+
+    // Return whether any event happened since the last call, and reset it.
+    bool fetch_event() { return _has_event.exchange(false, std::memory_order_acq_rel); }
+
+private:
+    std::atomic<PipelineDriverPoller*> _poller = nullptr;
+    std::atomic<bool> _has_event = false;
+};
+
+// Observable is held by the state shared by multiple drivers, e.g. DataStreamRecvr and ContextWithDependency,
+// and notifies the observers of the drivers depending on the state, when the state changes.
+class Observable {
+public:
+    void add_observer(PipelineObserver* observer);
+    // The observer must be removed before its driver is destroyed, if the observable may outlive the driver.
+    void remove_observer(PipelineObserver* observer);
+    void notify_observers() const;
+    // All the observers must be cleared before the drivers are destroyed,
+    // if the observable may outlive the drivers.
+    void clear_observers();
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<PipelineObserver*> _observers;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_wait_stats.h"
+
+#include <algorithm>
+
+namespace starrocks::pipeline {
+
+const char* driver_wait_reason_to_string(DriverWaitReason reason) {
+    switch (reason) {
+    case DriverWaitReason::INPUT_EMPTY:
+        return "INPUT_EMPTY";
+    case DriverWaitReason::OUTPUT_FULL:
+        return "OUTPUT_FULL";
+    case DriverWaitReason::PRECONDITION_NOT_READY:
+        return "PRECONDITION_NOT_READY";
+    case DriverWaitReason::PENDING_FINISH:
+        return "PENDING_FINISH";
+    case DriverWaitReason::SPILL_IO:
+        return "SPILL_IO";
+    case DriverWaitReason::READY_QUEUE:
+        return "READY_QUEUE";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+DriverWaitStats* DriverWaitStats::instance() {
+    static DriverWaitStats stats;
+    return &stats;
+}
+
+void DriverWaitStats::add(DriverWaitReason reason, int64_t wait_ns) {
+    if (reason >= DriverWaitReason::NUM_REASONS || wait_ns < 0) {
+        return;
+    }
+    auto& stats = _stats[static_cast<size_t>(reason)];
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.total_time_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    auto it = std::upper_bound(BUCKET_UPPER_BOUNDS_NS.begin(), BUCKET_UPPER_BOUNDS_NS.end(), wait_ns);
+    stats.buckets[it - BUCKET_UPPER_BOUNDS_NS.begin()].fetch_add(1, std::memory_order_relaxed);
+}
+
+DriverWaitStats::Snapshot DriverWaitStats::snapshot() const {
+    Snapshot snapshot;
+    for (size_t i = 0; i < NUM_REASONS; ++i) {
+        snapshot[i].count = _stats[i].count.load(std::memory_order_relaxed);
+        snapshot[i].total_time_ns = _stats[i].total_time_ns.load(std::memory_order_relaxed);
+        for (size_t j = 0; j < NUM_BUCKETS; ++j) {
+            snapshot[i].buckets[j] = _stats[i].buckets[j].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+std::string DriverWaitStats::bucket_name(size_t bucket) {
+    static const std::array<std::string, NUM_BUCKETS> names{"lt_1ms", "lt_10ms", "lt_100ms", "lt_1s", "ge_1s"};
+    return bucket < NUM_BUCKETS ? names[bucket] : "unknown";
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace starrocks::pipeline {
+
+// The reasons why a driver is not running on an executor thread.
+enum class DriverWaitReason : uint8_t {
+    INPUT_EMPTY = 0,
+    OUTPUT_FULL,
+    // Waiting for the runtime filters or the hash table of the build side.
+    PRECONDITION_NOT_READY,
+    PENDING_FINISH,
+    // Blocked in INPUT_EMPTY/OUTPUT_FULL/PENDING_FINISH while some operator of the driver is spilling.
+    SPILL_IO,
+    // Ready but waiting in the driver queue for an executor thread.
+    READY_QUEUE,
+    NUM_REASONS
+};
+
+const char* driver_wait_reason_to_string(DriverWaitReason reason);
+
+// Histogram of the wait time of drivers, grouped by DriverWaitReason.
+// All the methods are thread-safe, and the counters are only updated with relaxed atomics.
+class DriverWaitStats {
+public:
+    static constexpr size_t NUM_REASONS = static_cast<size_t>(DriverWaitReason::NUM_REASONS);
+    // Upper bounds (exclusive) of the buckets, and the last bucket holds the waits no shorter than 1s.
+    static constexpr std::array<int64_t, 4> BUCKET_UPPER_BOUNDS_NS{1'000'000L, 10'000'000L, 100'000'000L,
+                                                                   1'000'000'000L};
+    static constexpr size_t NUM_BUCKETS = BUCKET_UPPER_BOUNDS_NS.size() + 1;
+
+    struct ReasonStats {
+        int64_t count = 0;
+        int64_t total_time_ns = 0;
+        std::array<int64_t, NUM_BUCKETS> buckets{};
+    };
+    using Snapshot = std::array<ReasonStats, NUM_REASONS>;
+
+    // The stats of all the drivers of this BE.
+    static DriverWaitStats* instance();
+
+    void add(DriverWaitReason reason, int64_t wait_ns);
+    Snapshot snapshot() const;
+
+    static std::string bucket_name(size_t bucket);
+
+private:
+    struct AtomicReasonStats {
+        std::atomic<int64_t> count{0};
+        std::atomic<int64_t> total_time_ns{0};
+        std::array<std::atomic<int64_t>, NUM_BUCKETS> buckets{};
+    };
+    std::array<AtomicReasonStats, NUM_REASONS> _stats;
+};
+
+} // namespace starrocks::pipeline
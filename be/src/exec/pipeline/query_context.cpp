@@ -558,6 +558,20 @@ void QueryContextManager::report_fragments_with_same_host(
     }
 }
 
+void QueryContextManager::for_each_query_ctx(const std::function<void(const QueryContextPtr&)>& func) {
+    std::vector<QueryContextPtr> query_ctxs;
+    for (int i = 0; i < _mutexes.size(); ++i) {
+        std::shared_lock<std::shared_mutex> read_lock(_mutexes[i]);
+        for (const auto& [_, query_ctx] : _context_maps[i]) {
+            query_ctxs.emplace_back(query_ctx);
+        }
+    }
+    // Call func out of the locks, in case of func is expensive.
+    for (const auto& query_ctx : query_ctxs) {
+        func(query_ctx);
+    }
+}
+
 void QueryContextManager::collect_query_statistics(const PCollectQueryStatisticsRequest* request,
                                                    PCollectQueryStatisticsResult* response) {
     for (int i = 0; i < request->query_ids_size(); i++) {
@@ -16,12 +16,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/pipeline_wait_stats.h"
 #include "exec/pipeline/stream_epoch_manager.h"
 #include "exec/spill/query_spill_manager.h"
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
@@ -247,6 +249,8 @@ public:
     std::atomic_int64_t* mutable_total_spill_bytes() { return &_total_spill_bytes; }
     int64_t get_spill_bytes() { return _total_spill_bytes; }
 
+    DriverWaitStats* driver_wait_stats() { return &_driver_wait_stats; }
+
     // Query start time, used to check how long the query has been running
     // To ensure that the minimum run time of the query will not be killed by the big query checking mechanism
     int64_t query_begin_time() const { return _query_begin_time; }
@@ -324,6 +328,8 @@ private:
     std::atomic<int64_t> _total_scan_rows_num = 0;
     std::atomic<int64_t> _total_scan_bytes = 0;
     std::atomic<int64_t> _total_spill_bytes = 0;
+
+    DriverWaitStats _driver_wait_stats;
     std::atomic<int64_t> _delta_cpu_cost_ns = 0;
     std::atomic<int64_t> _delta_scan_rows_num = 0;
     std::atomic<int64_t> _delta_scan_bytes = 0;
@@ -393,6 +399,9 @@ public:
     void collect_query_statistics(const PCollectQueryStatisticsRequest* request,
                                   PCollectQueryStatisticsResult* response);
 
+    // Iterate the query contexts which are still running, i.e. not in the second chance maps.
+    void for_each_query_ctx(const std::function<void(const QueryContextPtr&)>& func);
+
 private:
     static void _clean_func(QueryContextManager* manager);
     void _clean_query_contexts();
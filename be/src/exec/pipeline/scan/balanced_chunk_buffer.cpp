@@ -15,15 +15,53 @@
 #include "exec/pipeline/scan/balanced_chunk_buffer.h"
 
 #include "fmt/format.h"
-#include "util/blocking_queue.hpp"
 
 namespace starrocks::pipeline {
 
+bool BalancedChunkBuffer::ChunkQueue::put(ChunkWithToken&& item) {
+    std::lock_guard<std::mutex> l(_lock);
+    if (_shutdown) {
+        return false;
+    }
+    _items.emplace_back(std::move(item));
+    _size.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool BalancedChunkBuffer::ChunkQueue::try_get(ChunkWithToken* item) {
+    if (empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> l(_lock);
+    if (_items.empty()) {
+        return false;
+    }
+    *item = std::move(_items.front());
+    _items.pop_front();
+    _size.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void BalancedChunkBuffer::ChunkQueue::shutdown() {
+    std::lock_guard<std::mutex> l(_lock);
+    _shutdown = true;
+}
+
+void BalancedChunkBuffer::ChunkQueue::clear() {
+    std::deque<ChunkWithToken> items;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        items.swap(_items);
+        _size.store(0, std::memory_order_release);
+    }
+    // Release the chunks and tokens out of the lock.
+}
+
 BalancedChunkBuffer::BalancedChunkBuffer(BalanceStrategy strategy, int output_operators, ChunkBufferLimiterPtr limiter)
         : _output_operators(output_operators), _strategy(strategy), _limiter(std::move(limiter)) {
     DCHECK_GT(output_operators, 0);
     for (int i = 0; i < output_operators; i++) {
-        _sub_buffers.emplace_back(std::make_unique<QueueT>());
+        _sub_buffers.emplace_back(std::make_unique<ChunkQueue>());
     }
 }
 
@@ -40,7 +78,7 @@ BalancedChunkBuffer::SubBuffer& BalancedChunkBuffer::_get_sub_buffer(int index)
 }
 
 size_t BalancedChunkBuffer::size(int buffer_index) const {
-    return _get_sub_buffer(buffer_index)->get_size();
+    return _get_sub_buffer(buffer_index)->size();
 }
 
 bool BalancedChunkBuffer::all_empty() const {
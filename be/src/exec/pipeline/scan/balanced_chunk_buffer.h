@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <vector>
 
 #include "column/chunk.h"
 #include "exec/pipeline/scan/chunk_buffer_limiter.h"
-#include "util/blocking_queue.hpp"
 
 namespace starrocks::pipeline {
 
@@ -59,8 +61,29 @@ private:
     };
 
     using ChunkWithToken = std::pair<ChunkPtr, ChunkBufferTokenPtr>;
-    using QueueT = UnboundedBlockingQueue<ChunkWithToken>;
-    using SubBuffer = std::unique_ptr<QueueT>;
+
+    // FIFO queue of an output operator.
+    // The chunks of a tablet are put by different io threads and must be got in order, so pushing and popping
+    // still take a lock. But the emptiness checks, which the poller does for every blocked driver, and the gets
+    // from an empty queue only read an atomic counter and don't contend with the scan threads.
+    class ChunkQueue {
+    public:
+        // Return false iff this queue has been shutdown.
+        bool put(ChunkWithToken&& item);
+        bool try_get(ChunkWithToken* item);
+        void shutdown();
+        void clear();
+
+        size_t size() const { return _size.load(std::memory_order_acquire); }
+        bool empty() const { return size() == 0; }
+
+    private:
+        std::mutex _lock;
+        std::deque<ChunkWithToken> _items;
+        std::atomic<size_t> _size = 0;
+        bool _shutdown = false;
+    };
+    using SubBuffer = std::unique_ptr<ChunkQueue>;
 
     const SubBuffer& _get_sub_buffer(int index) const;
     SubBuffer& _get_sub_buffer(int index);
@@ -219,7 +219,9 @@ void OlapChunkSource::_decide_chunk_size(bool has_predicate) {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
     } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        // Wide rows are read in smaller chunks, so that a chunk doesn't take tens of MB.
+        _params.chunk_size = ChunkHelper::chunk_size_for_row_bytes(_scan_node->estimated_scan_row_bytes(),
+                                                                   _runtime_state->chunk_size());
     }
 }
 
@@ -541,7 +543,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
 }
 
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
-    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size()));
+    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _params.chunk_size));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
     return _read_chunk_from_storage(_runtime_state, (*chunk).get());
 }
@@ -388,6 +388,11 @@ void ScanOperator::_finish_chunk_source_task(RuntimeState* state, int chunk_sour
         }
         _is_io_task_running[chunk_source_index] = false;
     }
+
+    // The chunks produced by this io task are available now, or another io task can be triggered.
+    if (_observer != nullptr) {
+        _observer->notify();
+    }
 }
 
 Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_index) {
@@ -411,6 +416,9 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
     task.priority = OlapScanNode::compute_priority(_submit_task_counter->value());
     task.task_group = down_cast<const ScanOperatorFactory*>(_factory)->scan_task_group();
     task.peak_scan_task_queue_size_counter = _peak_scan_task_queue_size_counter;
+    if (auto query_ctx = _query_ctx.lock(); query_ctx != nullptr) {
+        task.query_begin_time_ns = query_ctx->query_begin_time();
+    }
     const auto io_task_start_nano = MonotonicNanos();
     task.work_function = [wp = _query_ctx, this, state, chunk_source_index, query_trace_ctx, driver_id,
                           io_task_start_nano](auto& ctx) {
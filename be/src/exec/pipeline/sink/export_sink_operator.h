@@ -84,6 +84,9 @@ public:
                                                     _num_sinkers);
     }
 
+    // The io buffer waits for exactly _total_num_sinkers sinkers.
+    size_t max_degree_of_parallelism() const override { return _total_num_sinkers; }
+
     Status prepare(RuntimeState* state) override;
 
     void close(RuntimeState* state) override;
@@ -72,6 +72,9 @@ public:
         return std::make_shared<FileSinkOperator>(this, _id, _plan_node_id, driver_sequence, _file_sink_buffer);
     }
 
+    // The io buffer waits for exactly _num_sinkers sinkers.
+    size_t max_degree_of_parallelism() const override { return _num_sinkers; }
+
     Status prepare(RuntimeState* state) override;
 
     void close(RuntimeState* state) override;
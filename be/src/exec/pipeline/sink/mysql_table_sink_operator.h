@@ -71,6 +71,9 @@ public:
                                                         _mysql_table_sink_buffer);
     }
 
+    // The io buffer waits for exactly _num_sinkers sinkers.
+    size_t max_degree_of_parallelism() const override { return _num_sinkers; }
+
     Status prepare(RuntimeState* state) override;
 
     void close(RuntimeState* state) override;
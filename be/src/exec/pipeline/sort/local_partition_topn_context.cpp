@@ -34,7 +34,13 @@ LocalPartitionTopnContext::LocalPartitionTopnContext(const std::vector<TExpr>& t
           _sort_keys(std::move(sort_keys)),
           _offset(offset),
           _partition_limit(partition_limit),
-          _topn_type(topn_type) {}
+          _topn_type(topn_type) {
+    if (_topn_type == TTopNType::ROW_NUMBER &&
+        _offset + _partition_limit <= PartitionTopnHeaps::MAX_ROWS_PER_PARTITION) {
+        _partition_heaps = std::make_unique<PartitionTopnHeaps>(&_sort_exprs, _is_asc_order, _is_null_first, _offset,
+                                                                _partition_limit);
+    }
+}
 
 Status LocalPartitionTopnContext::prepare(RuntimeState* state, RuntimeProfile* runtime_profile) {
     RETURN_IF_ERROR(Expr::create_expr_trees(state->obj_pool(), _t_partition_exprs, &_partition_exprs, state));
@@ -55,6 +61,7 @@ Status LocalPartitionTopnContext::prepare(RuntimeState* state, RuntimeProfile* r
         _has_nullable_key = _has_nullable_key || _partition_types[i].is_nullable;
     }
 
+    _chunk_size = state->chunk_size();
     _chunks_partitioner = std::make_unique<ChunksPartitioner>(_has_nullable_key, _partition_exprs, _partition_types);
     return _chunks_partitioner->prepare(state, runtime_profile);
 }
@@ -63,11 +70,19 @@ Status LocalPartitionTopnContext::push_one_chunk_to_partitioner(RuntimeState* st
     RETURN_IF_ERROR(_chunks_partitioner->offer<true>(
             chunk,
             [this, state](size_t partition_idx) {
+                if (_partition_heaps != nullptr) {
+                    _partition_heaps->add_partition();
+                    return;
+                }
                 _chunks_sorters.emplace_back(std::make_shared<ChunksSorterTopn>(
                         state, &_sort_exprs, &_is_asc_order, &_is_null_first, _sort_keys, _offset, _partition_limit,
                         _topn_type, ChunksSorterTopn::tunning_buffered_chunks(_partition_limit)));
             },
             [this, state](size_t partition_idx, const ChunkPtr& chunk) {
+                if (_partition_heaps != nullptr) {
+                    (void)_partition_heaps->update(partition_idx, chunk);
+                    return;
+                }
                 (void)_chunks_sorters[partition_idx]->update(state, chunk);
             }));
     if (_chunks_partitioner->is_passthrough()) {
@@ -88,10 +103,17 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
     _partition_num = _chunks_partitioner->num_partitions();
     RETURN_IF_ERROR(
             _chunks_partitioner->consume_from_hash_map([this, state](int32_t partition_idx, const ChunkPtr& chunk) {
-                (void)_chunks_sorters[partition_idx]->update(state, chunk);
+                if (_partition_heaps != nullptr) {
+                    (void)_partition_heaps->update(partition_idx, chunk);
+                } else {
+                    (void)_chunks_sorters[partition_idx]->update(state, chunk);
+                }
                 return true;
             }));
 
+    if (_partition_heaps != nullptr) {
+        _partition_heaps->done();
+    }
     for (auto& chunks_sorter : _chunks_sorters) {
         RETURN_IF_ERROR(chunks_sorter->done(state));
     }
@@ -100,11 +122,18 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
     return Status::OK();
 }
 
+bool LocalPartitionTopnContext::_has_sorter_output() const {
+    if (_partition_heaps != nullptr) {
+        return !_is_partition_heaps_eos;
+    }
+    return _sorter_index < _chunks_sorters.size();
+}
+
 bool LocalPartitionTopnContext::has_output() {
     if (_chunks_partitioner->is_passthrough() && _is_transfered) {
-        return _sorter_index < _chunks_sorters.size() || !_chunks_partitioner->is_passthrough_buffer_empty();
+        return _has_sorter_output() || !_chunks_partitioner->is_passthrough_buffer_empty();
     }
-    return _is_sink_complete && _sorter_index < _chunks_sorters.size();
+    return _is_sink_complete && _has_sorter_output();
 }
 
 bool LocalPartitionTopnContext::is_finished() {
@@ -116,7 +145,7 @@ bool LocalPartitionTopnContext::is_finished() {
 
 StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk() {
     ChunkPtr chunk = nullptr;
-    if (_sorter_index < _chunks_sorters.size()) {
+    if (_has_sorter_output()) {
         ASSIGN_OR_RETURN(chunk, pull_one_chunk_from_sorters());
         if (chunk != nullptr) {
             return chunk;
@@ -127,6 +156,11 @@ StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk() {
 }
 
 StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk_from_sorters() {
+    if (_partition_heaps != nullptr) {
+        auto chunk = _partition_heaps->get_next(_chunk_size);
+        _is_partition_heaps_eos = chunk == nullptr;
+        return chunk;
+    }
     auto& chunks_sorter = _chunks_sorters[_sorter_index];
     ChunkPtr chunk = nullptr;
     bool eos = false;
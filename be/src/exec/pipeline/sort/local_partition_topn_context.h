@@ -18,6 +18,7 @@
 
 #include "exec/chunks_sorter.h"
 #include "exec/partition/chunks_partitioner.h"
+#include "exec/pipeline/sort/partition_topn_heaps.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks {
@@ -77,6 +78,9 @@ public:
     size_t num_partitions() const { return _partition_num; }
 
 private:
+    // Return true if the sorters or the partition heaps have remaining data
+    bool _has_sorter_output() const;
+
     // Pull one chunk from one of the sorters
     // The output chunk stream is unordered
     StatusOr<ChunkPtr> pull_one_chunk_from_sorters();
@@ -93,8 +97,13 @@ private:
     bool _is_transfered = false;
     size_t _partition_num = 0;
 
-    // Every partition holds a chunks_sorter
+    // Every partition holds a chunks_sorter, unless the partitions are kept by _partition_heaps
     ChunksSorters _chunks_sorters;
+    // For ROW_NUMBER with offset + limit <= PartitionTopnHeaps::MAX_ROWS_PER_PARTITION, all the partitions share
+    // a PartitionTopnHeaps instead of a sorter per partition.
+    std::unique_ptr<PartitionTopnHeaps> _partition_heaps;
+    bool _is_partition_heaps_eos = false;
+    size_t _chunk_size = 0;
     const std::vector<ExprContext*>& _sort_exprs;
     std::vector<bool> _is_asc_order;
     std::vector<bool> _is_null_first;
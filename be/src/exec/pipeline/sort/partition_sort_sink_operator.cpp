@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "exec/chunks_sorter.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_heap_sort.h"
@@ -96,12 +97,32 @@ Status PartitionSortSinkOperator::set_finishing(RuntimeState* state) {
         return Status::Cancelled("runtime state is cancelled");
     }
     RETURN_IF_ERROR(_chunks_sorter->done(state));
+    _is_finishing = true;
 
+    // The sorted runs are merged in the pending work units of a yieldable sorter.
+    if (!_chunks_sorter->has_pending_work()) {
+        _finish_partition();
+    }
+    return Status::OK();
+}
+
+Status PartitionSortSinkOperator::do_pending_work(RuntimeState* state) {
+    if (state->is_cancelled()) {
+        _is_finished = true;
+        return Status::Cancelled("runtime state is cancelled");
+    }
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_chunks_sorter->do_pending_work(state)));
+    if (_is_finishing && !_chunks_sorter->has_pending_work()) {
+        _finish_partition();
+    }
+    return Status::OK();
+}
+
+void PartitionSortSinkOperator::_finish_partition() {
     // Current partition sort is ended, and
     // the last call will drive LocalMergeSortSourceOperator to work.
     _sort_context->finish_partition(_chunks_sorter->get_output_rows());
     _is_finished = true;
-    return Status::OK();
 }
 
 Status PartitionSortSinkOperatorFactory::prepare(RuntimeState* state) {
@@ -127,9 +148,11 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
                     _sort_keys, 0, _limit + _offset, _topn_type, max_buffered_chunks);
         }
     } else {
-        chunks_sorter = std::make_unique<ChunksSorterFullSort>(
+        auto full_sorter = std::make_unique<ChunksSorterFullSort>(
                 runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
                 _sort_keys, _max_buffered_rows, _max_buffered_bytes, _early_materialized_slots);
+        full_sorter->set_yieldable(config::pipeline_enable_operator_yield);
+        chunks_sorter = std::move(full_sorter);
     }
 
     auto sort_context = _sort_context_factory->create(driver_sequence);
@@ -65,10 +65,14 @@ public:
 
     bool has_output() const override { return false; }
 
-    bool need_input() const override { return !is_finished(); }
+    bool need_input() const override { return !is_finished() && !_chunks_sorter->has_pending_work(); }
 
     bool is_finished() const override { return _is_finished || _sort_context->is_finished(); }
 
+    bool has_pending_work() const override { return !is_finished() && _chunks_sorter->has_pending_work(); }
+
+    Status do_pending_work(RuntimeState* state) override;
+
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
@@ -76,7 +80,10 @@ public:
     Status set_finishing(RuntimeState* state) override;
 
 protected:
+    void _finish_partition();
+
     bool _is_finished = false;
+    bool _is_finishing = false;
 
     std::shared_ptr<ChunksSorter> _chunks_sorter;
 
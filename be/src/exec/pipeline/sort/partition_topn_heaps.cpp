@@ -0,0 +1,158 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/sort/partition_topn_heaps.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exec/sorting/sort_helper.h"
+
+namespace starrocks::pipeline {
+
+PartitionTopnHeaps::PartitionTopnHeaps(const std::vector<ExprContext*>* sort_exprs,
+                                       const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first,
+                                       int64_t offset, int64_t limit)
+        : _sort_exprs(sort_exprs),
+          _sort_desc(is_asc_order, is_null_first),
+          _offset(offset),
+          _rows_per_partition(offset + limit) {
+    DCHECK_LE(_rows_per_partition, MAX_ROWS_PER_PARTITION);
+}
+
+void PartitionTopnHeaps::add_partition() {
+    _heap_sizes.emplace_back(0);
+    _heap_rows.resize(_heap_sizes.size() * _rows_per_partition);
+}
+
+bool PartitionTopnHeaps::_less(uint32_t lhs, uint32_t rhs) const {
+    return compare_chunk_row(_sort_desc, _sort_columns, _sort_columns, lhs, rhs) < 0;
+}
+
+void PartitionTopnHeaps::_append_row(const Chunk& chunk, const Columns& sort_columns, size_t row) {
+    _rows->append_safe(chunk, row, 1);
+    for (size_t i = 0; i < sort_columns.size(); i++) {
+        _sort_columns[i]->append(*sort_columns[i], row, 1);
+    }
+}
+
+Status PartitionTopnHeaps::update(size_t partition_idx, const ChunkPtr& chunk) {
+    DCHECK_LT(partition_idx, _heap_sizes.size());
+    if (chunk->is_empty() || _rows_per_partition == 0) {
+        return Status::OK();
+    }
+
+    Columns sort_columns;
+    sort_columns.reserve(_sort_exprs->size());
+    for (auto* expr_ctx : *_sort_exprs) {
+        ASSIGN_OR_RETURN(auto column, expr_ctx->evaluate(chunk.get()));
+        sort_columns.emplace_back(ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(), column));
+    }
+    if (_rows == nullptr) {
+        _rows = chunk->clone_empty();
+        for (const auto& column : sort_columns) {
+            _sort_columns.emplace_back(NullableColumn::wrap_if_necessary(column->clone_empty()));
+        }
+    }
+
+    auto less = [this](uint32_t lhs, uint32_t rhs) { return _less(lhs, rhs); };
+    auto* heap = _heap_rows.data() + partition_idx * _rows_per_partition;
+    auto& heap_size = _heap_sizes[partition_idx];
+    for (size_t row = 0, num_rows = chunk->num_rows(); row < num_rows; row++) {
+        if (heap_size < _rows_per_partition) {
+            heap[heap_size++] = _rows->num_rows();
+            _append_row(*chunk, sort_columns, row);
+            std::push_heap(heap, heap + heap_size, less);
+            _num_heap_rows++;
+            continue;
+        }
+        // Only a row before the last retained one enters the heap, ties keep the earlier row as the heap sorter.
+        if (compare_chunk_row(_sort_desc, _sort_columns, sort_columns, heap[0], row) <= 0) {
+            continue;
+        }
+        std::pop_heap(heap, heap + heap_size, less);
+        heap[heap_size - 1] = _rows->num_rows();
+        _append_row(*chunk, sort_columns, row);
+        std::push_heap(heap, heap + heap_size, less);
+    }
+
+    // Keep the evicted rows fewer than the retained ones, but do not compact a small buffer over and over.
+    const size_t num_evicted_rows = _rows->num_rows() - _num_heap_rows;
+    if (num_evicted_rows > std::max(_num_heap_rows, MIN_EVICTED_ROWS_TO_COMPACT)) {
+        _compact();
+    }
+    return Status::OK();
+}
+
+void PartitionTopnHeaps::_compact() {
+    std::vector<uint32_t> selection;
+    selection.reserve(_num_heap_rows);
+    for (size_t partition_idx = 0; partition_idx < _heap_sizes.size(); partition_idx++) {
+        auto* heap = _heap_rows.data() + partition_idx * _rows_per_partition;
+        for (size_t i = 0; i < _heap_sizes[partition_idx]; i++) {
+            // The relative order of the rows in a heap does not change, so it is still a heap.
+            selection.emplace_back(heap[i]);
+            heap[i] = selection.size() - 1;
+        }
+    }
+
+    ChunkPtr rows = _rows->clone_empty(selection.size());
+    rows->append_selective(*_rows, selection.data(), 0, selection.size());
+    _rows = std::move(rows);
+    for (auto& column : _sort_columns) {
+        auto compacted = column->clone_empty();
+        compacted->append_selective(*column, selection.data(), 0, selection.size());
+        column = std::move(compacted);
+    }
+}
+
+void PartitionTopnHeaps::done() {
+    if (_rows != nullptr) {
+        auto less = [this](uint32_t lhs, uint32_t rhs) { return _less(lhs, rhs); };
+        std::vector<uint32_t> selection;
+        selection.reserve(_num_heap_rows);
+        for (size_t partition_idx = 0; partition_idx < _heap_sizes.size(); partition_idx++) {
+            auto* heap = _heap_rows.data() + partition_idx * _rows_per_partition;
+            const size_t heap_size = _heap_sizes[partition_idx];
+            std::sort_heap(heap, heap + heap_size, less);
+            for (size_t i = _offset; i < heap_size; i++) {
+                selection.emplace_back(heap[i]);
+            }
+        }
+        _output = _rows->clone_empty(selection.size());
+        _output->append_selective(*_rows, selection.data(), 0, selection.size());
+    }
+
+    _rows.reset();
+    _sort_columns.clear();
+    _heap_rows = {};
+    _heap_sizes = {};
+    _num_heap_rows = 0;
+}
+
+ChunkPtr PartitionTopnHeaps::get_next(size_t chunk_size) {
+    if (_output == nullptr || _next_output_row >= _output->num_rows()) {
+        _output.reset();
+        return nullptr;
+    }
+    const size_t count = std::min(chunk_size, _output->num_rows() - _next_output_row);
+    ChunkPtr chunk = _output->clone_empty(count);
+    chunk->append_safe(*_output, _next_output_row, count);
+    _next_output_row += count;
+    return chunk;
+}
+
+} // namespace starrocks::pipeline
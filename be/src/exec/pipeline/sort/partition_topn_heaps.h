@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/sorting/sorting.h"
+#include "exprs/expr_context.h"
+
+namespace starrocks::pipeline {
+
+// PartitionTopnHeaps keeps the first offset + limit rows of every partition of a ROW_NUMBER partition topn with a
+// small limit, in one structure shared by all the partitions instead of one ChunksSorter per partition.
+//
+// The candidate rows of all the partitions are copied into a single chunk, together with their sort keys. Every
+// partition only owns a fixed slot of offset + limit row indexes into it, kept as a max-heap whose top is the last
+// row in the sort order. So the memory is bounded by the number of candidate rows, and the input chunks are
+// released once they are pushed. The rows evicted from the heaps are dropped when they outnumber the retained ones.
+class PartitionTopnHeaps {
+public:
+    PartitionTopnHeaps(const std::vector<ExprContext*>* sort_exprs, const std::vector<bool>& is_asc_order,
+                       const std::vector<bool>& is_null_first, int64_t offset, int64_t limit);
+
+    // Called when a new partition is found, partitions are numbered by their order.
+    void add_partition();
+
+    // Push the rows of `chunk`, which all belong to the partition `partition_idx`.
+    Status update(size_t partition_idx, const ChunkPtr& chunk);
+
+    // Collect the retained rows of every partition but the first `offset` ones of each, and release the heaps.
+    void done();
+
+    // Return the next chunk of at most `chunk_size` output rows, or nullptr if there are no more rows.
+    // The rows of a partition are ordered, but the partitions are not.
+    ChunkPtr get_next(size_t chunk_size);
+
+    size_t num_partitions() const { return _heap_sizes.size(); }
+
+    // the number of rows copied into the shared chunk, including the evicted ones not compacted yet
+    size_t num_buffered_rows() const { return _rows == nullptr ? 0 : _rows->num_rows(); }
+
+    // There is an inline heap slot of this many rows for each partition
+    static constexpr int64_t MAX_ROWS_PER_PARTITION = 16;
+    // The evicted rows are dropped only once there are this many of them at least
+    static constexpr size_t MIN_EVICTED_ROWS_TO_COMPACT = 4096;
+
+private:
+    // Whether the buffered row `lhs` comes before the buffered row `rhs` in the sort order.
+    bool _less(uint32_t lhs, uint32_t rhs) const;
+    void _append_row(const Chunk& chunk, const Columns& sort_columns, size_t row);
+    // Drop the buffered rows which are not in any heap.
+    void _compact();
+
+    const std::vector<ExprContext*>* _sort_exprs;
+    const SortDescs _sort_desc;
+    const size_t _offset;
+    // offset + limit, the number of rows kept for each partition
+    const size_t _rows_per_partition;
+
+    // The candidate rows of all the partitions, and their sort keys. The sort key columns are always nullable, so
+    // that chunks whose keys differ in nullability can be appended to them.
+    ChunkPtr _rows;
+    Columns _sort_columns;
+    // The heap of the partition i is _heap_rows[i * _rows_per_partition, i * _rows_per_partition + _heap_sizes[i])
+    std::vector<uint32_t> _heap_rows;
+    std::vector<uint8_t> _heap_sizes;
+    size_t _num_heap_rows = 0;
+
+    ChunkPtr _output;
+    size_t _next_output_row = 0;
+};
+
+} // namespace starrocks::pipeline
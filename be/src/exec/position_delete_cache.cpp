@@ -0,0 +1,49 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/position_delete_cache.h"
+
+#include <vector>
+
+#include "runtime/exec_env.h"
+
+namespace starrocks {
+
+Status PositionDeleteCache::get_or_build(const std::string& key, const BuildFunc& build,
+                                         std::set<int64_t>* positions) {
+    LazyLRUCache* cache = GlobalEnv::GetInstance()->position_delete_cache();
+    if (!cache->enabled()) {
+        return build(positions);
+    }
+
+    Cache::Handle* handle = cache->lookup(CacheKey(key));
+    if (handle != nullptr) {
+        const auto* cached = reinterpret_cast<const std::vector<int64_t>*>(cache->value(handle));
+        positions->insert(cached->begin(), cached->end());
+        cache->release(handle);
+        return Status::OK();
+    }
+
+    std::set<int64_t> built;
+    RETURN_IF_ERROR(build(&built));
+    auto* cached = new std::vector<int64_t>(built.begin(), built.end());
+    int64_t mem_size = sizeof(std::vector<int64_t>) + cached->capacity() * sizeof(int64_t);
+    cache->release(cache->insert(
+            CacheKey(key), cached, key.size() + mem_size, mem_size,
+            [](const CacheKey& /*key*/, void* value) { delete reinterpret_cast<std::vector<int64_t>*>(value); }));
+    positions->insert(built.begin(), built.end());
+    return Status::OK();
+}
+
+} // namespace starrocks
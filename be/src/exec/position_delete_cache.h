@@ -0,0 +1,37 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <set>
+#include <string>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// The row positions a delete file removes from a data file, iceberg position delete files and paimon deletion
+// vectors, cached in GlobalEnv::position_delete_cache() and shared by all queries. Delete files are immutable,
+// so entries never need invalidation, they age out of the LRU.
+class PositionDeleteCache {
+public:
+    using BuildFunc = std::function<Status(std::set<int64_t>*)>;
+
+    // Adds the positions cached under |key| to |positions|. On a miss they are built by |build|, which reads
+    // the delete file, and cached.
+    static Status get_or_build(const std::string& key, const BuildFunc& build, std::set<int64_t>* positions);
+};
+
+} // namespace starrocks
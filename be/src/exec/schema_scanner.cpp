@@ -23,9 +23,11 @@
 #include "exec/schema_scanner/schema_be_cloud_native_compactions_scanner.h"
 #include "exec/schema_scanner/schema_be_compactions_scanner.h"
 #include "exec/schema_scanner/schema_be_configs_scanner.h"
+#include "exec/schema_scanner/schema_be_continuous_profile_scanner.h"
 #include "exec/schema_scanner/schema_be_datacache_metrics_scanner.h"
 #include "exec/schema_scanner/schema_be_logs_scanner.h"
 #include "exec/schema_scanner/schema_be_metrics_scanner.h"
+#include "exec/schema_scanner/schema_be_pipeline_wait_stats_scanner.h"
 #include "exec/schema_scanner/schema_be_tablets_scanner.h"
 #include "exec/schema_scanner/schema_be_threads_scanner.h"
 #include "exec/schema_scanner/schema_be_txns_scanner.h"
@@ -177,6 +179,10 @@ std::unique_ptr<SchemaScanner> SchemaScanner::create(TSchemaTableType::type type
         return std::make_unique<SchemaBeConfigsScanner>();
     case TSchemaTableType::SCH_BE_THREADS:
         return std::make_unique<SchemaBeThreadsScanner>();
+    case TSchemaTableType::SCH_BE_PIPELINE_WAIT_STATS:
+        return std::make_unique<SchemaBePipelineWaitStatsScanner>();
+    case TSchemaTableType::SCH_BE_CONTINUOUS_PROFILE:
+        return std::make_unique<SchemaBeContinuousProfileScanner>();
     case TSchemaTableType::SCH_BE_LOGS:
         return std::make_unique<SchemaBeLogsScanner>();
     case TSchemaTableType::SCH_FE_TABLET_SCHEDULES:
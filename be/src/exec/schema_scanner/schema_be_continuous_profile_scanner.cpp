@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/schema_scanner/schema_be_continuous_profile_scanner.h"
+
+#include "agent/master_info.h"
+#include "common/config.h"
+#include "runtime/string_value.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+using pipeline::ContinuousProfiler;
+
+SchemaScanner::ColumnDesc SchemaBeContinuousProfileScanner::_s_columns[] = {
+        {"BE_ID", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"START_TIME", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"WORKGROUP", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), false},
+        {"QUERY_ID", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), false},
+        {"FRAGMENT_INSTANCE_ID", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue),
+         false},
+        {"OPERATOR", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), false},
+        {"TIME_NS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+};
+
+SchemaBeContinuousProfileScanner::SchemaBeContinuousProfileScanner()
+        : SchemaScanner(_s_columns, sizeof(_s_columns) / sizeof(SchemaScanner::ColumnDesc)) {}
+
+Status SchemaBeContinuousProfileScanner::start(RuntimeState* state) {
+    RETURN_IF_ERROR(SchemaScanner::start(state));
+    auto o_id = get_backend_id();
+    _be_id = o_id.has_value() ? o_id.value() : -1;
+
+    _buckets = ContinuousProfiler::instance()->snapshot(config::continuous_profiler_window_minutes, UnixSeconds());
+    _rows.clear();
+    for (const auto& bucket : _buckets) {
+        for (const auto& sample : bucket.samples) {
+            DatumArray row;
+            row.emplace_back(_be_id);
+            row.emplace_back(bucket.start_time);
+            row.emplace_back(Slice(sample.workgroup));
+            row.emplace_back(Slice(sample.query_id));
+            row.emplace_back(Slice(sample.fragment_id));
+            row.emplace_back(Slice(sample.operator_name));
+            row.emplace_back(sample.time_ns);
+            _rows.emplace_back(std::move(row));
+        }
+    }
+    _cur_idx = 0;
+    return Status::OK();
+}
+
+Status SchemaBeContinuousProfileScanner::get_next(ChunkPtr* chunk, bool* eos) {
+    if (!_is_init) {
+        return Status::InternalError("call this before initial.");
+    }
+    if (nullptr == chunk || nullptr == eos) {
+        return Status::InternalError("invalid parameter.");
+    }
+    if (_cur_idx >= _rows.size()) {
+        *eos = true;
+        return Status::OK();
+    }
+
+    const size_t end = std::min(_cur_idx + _runtime_state->chunk_size(), _rows.size());
+    for (; _cur_idx < end; ++_cur_idx) {
+        const auto& row = _rows[_cur_idx];
+        for (const auto& [slot_id, index] : (*chunk)->get_slot_id_to_index_map()) {
+            const ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_id);
+            column->append_datum(row[slot_id - 1]);
+        }
+    }
+    *eos = false;
+    return Status::OK();
+}
+
+} // namespace starrocks
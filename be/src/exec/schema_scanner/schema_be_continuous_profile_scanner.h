@@ -0,0 +1,45 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <vector>
+
+#include "column/datum.h"
+#include "exec/pipeline/continuous_profiler.h"
+#include "exec/schema_scanner.h"
+
+namespace starrocks {
+
+// Scanner of information_schema.be_continuous_profile.
+// Each row is the operator time of one (workgroup, query, operator) in one minute recorded by
+// pipeline::ContinuousProfiler.
+class SchemaBeContinuousProfileScanner final : public SchemaScanner {
+public:
+    SchemaBeContinuousProfileScanner();
+    ~SchemaBeContinuousProfileScanner() override = default;
+
+    Status start(RuntimeState* state) override;
+    Status get_next(ChunkPtr* chunk, bool* eos) override;
+
+private:
+    static SchemaScanner::ColumnDesc _s_columns[];
+
+    int64_t _be_id{-1};
+    // The snapshot is kept here, since the rows only hold the Slices of its strings.
+    std::vector<pipeline::ContinuousProfiler::BucketSnapshot> _buckets;
+    std::vector<DatumArray> _rows;
+    size_t _cur_idx{0};
+};
+
+} // namespace starrocks
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/schema_scanner/schema_be_pipeline_wait_stats_scanner.h"
+
+#include "agent/master_info.h"
+#include "exec/pipeline/pipeline_wait_stats.h"
+#include "exec/pipeline/query_context.h"
+#include "runtime/exec_env.h"
+#include "runtime/string_value.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+using pipeline::DriverWaitReason;
+using pipeline::DriverWaitStats;
+
+SchemaScanner::ColumnDesc SchemaBePipelineWaitStatsScanner::_s_columns[] = {
+        {"BE_ID", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"QUERY_ID", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), true},
+        {"REASON", TypeDescriptor::create_varchar_type(sizeof(StringValue)), sizeof(StringValue), false},
+        {"COUNT", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"TOTAL_TIME_NS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"LT_1MS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"LT_10MS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"LT_100MS", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"LT_1S", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+        {"GE_1S", TypeDescriptor::from_logical_type(TYPE_BIGINT), sizeof(int64_t), false},
+};
+
+SchemaBePipelineWaitStatsScanner::SchemaBePipelineWaitStatsScanner()
+        : SchemaScanner(_s_columns, sizeof(_s_columns) / sizeof(SchemaScanner::ColumnDesc)) {}
+
+Status SchemaBePipelineWaitStatsScanner::start(RuntimeState* state) {
+    RETURN_IF_ERROR(SchemaScanner::start(state));
+    auto o_id = get_backend_id();
+    _be_id = o_id.has_value() ? o_id.value() : -1;
+
+    std::vector<std::pair<std::string, DriverWaitStats::Snapshot>> snapshots;
+    snapshots.emplace_back("", DriverWaitStats::instance()->snapshot());
+    ExecEnv::GetInstance()->query_context_mgr()->for_each_query_ctx([&](const pipeline::QueryContextPtr& query_ctx) {
+        snapshots.emplace_back(print_id(query_ctx->query_id()), query_ctx->driver_wait_stats()->snapshot());
+    });
+
+    _query_ids.clear();
+    _query_ids.reserve(snapshots.size());
+    _rows.clear();
+    _rows.reserve(snapshots.size() * DriverWaitStats::NUM_REASONS);
+    for (const auto& [query_id, snapshot] : snapshots) {
+        _query_ids.emplace_back(query_id);
+        const auto& stored_query_id = _query_ids.back();
+        for (size_t i = 0; i < DriverWaitStats::NUM_REASONS; ++i) {
+            const auto& stats = snapshot[i];
+            // Skip the empty reasons of queries, but always output all the reasons of the BE.
+            if (!stored_query_id.empty() && stats.count == 0) {
+                continue;
+            }
+            DatumArray row;
+            row.emplace_back(_be_id);
+            if (stored_query_id.empty()) {
+                row.emplace_back(kNullDatum);
+            } else {
+                row.emplace_back(Slice(stored_query_id));
+            }
+            row.emplace_back(Slice(pipeline::driver_wait_reason_to_string(static_cast<DriverWaitReason>(i))));
+            row.emplace_back(stats.count);
+            row.emplace_back(stats.total_time_ns);
+            for (int64_t bucket : stats.buckets) {
+                row.emplace_back(bucket);
+            }
+            _rows.emplace_back(std::move(row));
+        }
+    }
+    _cur_idx = 0;
+    return Status::OK();
+}
+
+Status SchemaBePipelineWaitStatsScanner::get_next(ChunkPtr* chunk, bool* eos) {
+    if (!_is_init) {
+        return Status::InternalError("call this before initial.");
+    }
+    if (nullptr == chunk || nullptr == eos) {
+        return Status::InternalError("invalid parameter.");
+    }
+    if (_cur_idx >= _rows.size()) {
+        *eos = true;
+        return Status::OK();
+    }
+
+    const size_t end = std::min(_cur_idx + _runtime_state->chunk_size(), _rows.size());
+    for (; _cur_idx < end; ++_cur_idx) {
+        const auto& row = _rows[_cur_idx];
+        for (const auto& [slot_id, index] : (*chunk)->get_slot_id_to_index_map()) {
+            const ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_id);
+            column->append_datum(row[slot_id - 1]);
+        }
+    }
+    *eos = false;
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,46 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "column/datum.h"
+#include "exec/schema_scanner.h"
+
+namespace starrocks {
+
+// Scanner of information_schema.be_pipeline_wait_stats.
+// Each row is the wait time histogram of one wait reason, either of the whole BE (QUERY_ID is NULL)
+// or of a running query.
+class SchemaBePipelineWaitStatsScanner final : public SchemaScanner {
+public:
+    SchemaBePipelineWaitStatsScanner();
+    ~SchemaBePipelineWaitStatsScanner() override = default;
+
+    Status start(RuntimeState* state) override;
+    Status get_next(ChunkPtr* chunk, bool* eos) override;
+
+private:
+    static SchemaScanner::ColumnDesc _s_columns[];
+
+    int64_t _be_id{-1};
+    // The query ids are kept here, since the rows only hold the Slices of them.
+    std::vector<std::string> _query_ids;
+    std::vector<DatumArray> _rows;
+    size_t _cur_idx{0};
+};
+
+} // namespace starrocks
@@ -30,7 +30,12 @@
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+#include "util/decimal_types.h"
 #include "util/orlp/pdqsort.h"
+#include "util/unaligned_access.h"
 
 namespace starrocks {
 
@@ -96,6 +101,51 @@ static Status sort_and_tie_helper_nullable(const std::atomic<bool>& cancel, cons
     return sort_and_tie_column(cancel, data_column.get(), sort_desc, permutation, tie, std::move(ranges), build_tie);
 }
 
+// A string sort key together with its first 8 bytes loaded as a big-endian integer, zero padded.
+// Comparing the prefixes as integers orders the same as memcmp of those bytes, so the string itself is
+// only touched when the prefixes are equal.
+struct PrefixedSlicePermuteItem {
+    uint64_t prefix;
+    Slice inline_value;
+    uint32_t index_in_chunk;
+};
+
+static inline uint64_t load_string_prefix(const Slice& value) {
+    uint64_t prefix = 0;
+    if (value.size >= sizeof(prefix)) {
+        prefix = unaligned_load<uint64_t>(value.data);
+    } else if (value.size > 0) {
+        memcpy(&prefix, value.data, value.size);
+    }
+    return BigEndian::FromHost64(prefix);
+}
+
+template <bool CheckBound>
+static std::vector<PrefixedSlicePermuteItem> create_prefixed_slice_permutation(const SmallPermutation& other,
+                                                                               const auto& container) {
+    std::vector<PrefixedSlicePermuteItem> inlined(other.size());
+    for (int i = 0; i < other.size(); i++) {
+        int index = other[i].index_in_chunk;
+        inlined[i].index_in_chunk = index;
+        if constexpr (CheckBound) {
+            if (index >= container.size()) {
+                inlined[i].prefix = 0;
+                continue;
+            }
+        }
+        inlined[i].inline_value = container[index];
+        inlined[i].prefix = load_string_prefix(inlined[i].inline_value);
+    }
+    return inlined;
+}
+
+static inline void restore_prefixed_slice_permutation(const std::vector<PrefixedSlicePermuteItem>& inlined,
+                                                      SmallPermutation& output) {
+    for (int i = 0; i < inlined.size(); i++) {
+        output[i].index_in_chunk = inlined[i].index_in_chunk;
+    }
+}
+
 // Sort a column by permtuation
 template <RangeOrRanges R>
 class ColumnSorter final : public ColumnVisitorAdapter<ColumnSorter<R>> {
@@ -170,15 +220,18 @@ public:
             DCHECK_GE(column.size(), _permutation.size());
         }
 
-        using ItemType = InlinePermuteItem<Slice>;
+        using ItemType = PrefixedSlicePermuteItem;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
+            if (lhs.prefix != rhs.prefix) {
+                return lhs.prefix < rhs.prefix ? -1 : 1;
+            }
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice, IS_RANGES>(_permutation, column.get_proxy_data());
+        auto inlined = create_prefixed_slice_permutation<IS_RANGES>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp,
                                             _range_or_ranges, _build_tie));
-        restore_inline_permutation(inlined, _permutation);
+        restore_prefixed_slice_permutation(inlined, _permutation);
 
         return Status::OK();
     }
@@ -496,6 +549,172 @@ static Status sort_and_tie_column(const std::atomic<bool>& cancel, Column* colum
     return column->accept(&column_sorter);
 }
 
+// Maps a fixed-length value to an unsigned integer of the same width which preserves its order.
+template <typename T>
+struct NormalizedKeyTraits {
+    static constexpr bool supported = false;
+};
+
+template <typename T>
+requires(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t)) struct NormalizedKeyTraits<T> {
+    static constexpr bool supported = true;
+    using Unsigned = std::conditional_t<
+            sizeof(T) == 1, uint8_t,
+            std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+    static Unsigned encode(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            return static_cast<Unsigned>(value) ^ (Unsigned(1) << (sizeof(T) * 8 - 1));
+        } else {
+            return static_cast<Unsigned>(value);
+        }
+    }
+};
+
+template <>
+struct NormalizedKeyTraits<DateValue> {
+    static constexpr bool supported = true;
+    using Unsigned = NormalizedKeyTraits<DateValue::type>::Unsigned;
+    static Unsigned encode(DateValue value) { return NormalizedKeyTraits<DateValue::type>::encode(value.julian()); }
+};
+
+template <>
+struct NormalizedKeyTraits<TimestampValue> {
+    static constexpr bool supported = true;
+    using Unsigned = NormalizedKeyTraits<TimestampValue::type>::Unsigned;
+    static Unsigned encode(TimestampValue value) {
+        return NormalizedKeyTraits<TimestampValue::type>::encode(value.timestamp());
+    }
+};
+
+// Visit a sort column twice: first to get the number of bits it needs in the normalized key (value width plus one
+// bit of null flag if nullable), then to append its encoded values to the keys of all rows. Columns other than
+// integer, decimal(32/64), date and datetime are not supported.
+template <typename KeyType>
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder<KeyType>> {
+public:
+    static constexpr size_t KEY_BITS = sizeof(KeyType) * 8;
+
+    NormalizedKeyEncoder(const SortDesc& sort_desc, std::vector<KeyType>* keys)
+            : ColumnVisitorAdapter<NormalizedKeyEncoder<KeyType>>(this), _sort_desc(sort_desc), _keys(keys) {}
+
+    size_t bits() const { return _bits; }
+
+    Status do_visit(const NullableColumn& column) {
+        _bits += 1;
+        if (_keys != nullptr) {
+            const NullData& null_data = column.immutable_null_column_data();
+            const KeyType null_flag = _sort_desc.is_null_first() ? 0 : 1;
+            for (size_t i = 0; i < _keys->size(); i++) {
+                (*_keys)[i] = ((*_keys)[i] << 1) | (null_data[i] ? null_flag : 1 - null_flag);
+            }
+            _null_data = null_data.data();
+        }
+        return column.data_column_ref().accept(this);
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        if constexpr (NormalizedKeyTraits<T>::supported) {
+            using Traits = NormalizedKeyTraits<T>;
+            constexpr size_t value_bits = sizeof(typename Traits::Unsigned) * 8;
+            _bits += value_bits;
+            if (_keys == nullptr) {
+                return Status::OK();
+            }
+            const auto& data = column.get_data();
+            const bool asc = _sort_desc.asc_order();
+            for (size_t i = 0; i < _keys->size(); i++) {
+                typename Traits::Unsigned value = 0;
+                // null rows only compare by the null flag
+                if (_null_data == nullptr || !_null_data[i]) {
+                    value = Traits::encode(data[i]);
+                    value = asc ? value : static_cast<typename Traits::Unsigned>(~value);
+                }
+                KeyType& key = (*_keys)[i];
+                if constexpr (value_bits >= KEY_BITS) {
+                    key = value;
+                } else {
+                    key = (key << value_bits) | value;
+                }
+            }
+            return Status::OK();
+        } else {
+            return Status::NotSupported("normalized key");
+        }
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        return Status::NotSupported("normalized key");
+    }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("normalized key");
+    }
+    Status do_visit(const JsonColumn& column) { return Status::NotSupported("normalized key"); }
+    Status do_visit(const ConstColumn& column) { return Status::NotSupported("normalized key"); }
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("normalized key"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("normalized key"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("normalized key"); }
+
+private:
+    const SortDesc& _sort_desc;
+    std::vector<KeyType>* _keys;
+    const uint8_t* _null_data = nullptr;
+    size_t _bits = 0;
+};
+
+template <typename KeyType>
+static Status sort_by_normalized_key(const std::atomic<bool>& cancel, const Columns& columns,
+                                     const SortDescs& sort_desc, SmallPermutation& perm) {
+    const size_t num_rows = columns[0]->size();
+    std::vector<KeyType> keys(num_rows, 0);
+    for (size_t i = 0; i < columns.size(); i++) {
+        NormalizedKeyEncoder<KeyType> encoder(sort_desc.get_column_desc(i), &keys);
+        RETURN_IF_ERROR(columns[i]->accept(&encoder));
+    }
+
+    InlinePermutation<KeyType> inlined(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        inlined[i].inline_value = keys[i];
+        inlined[i].index_in_chunk = i;
+    }
+    if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+        return Status::Cancelled("Sort cancelled");
+    }
+    ::pdqsort(inlined.begin(), inlined.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.inline_value < rhs.inline_value; });
+    restore_inline_permutation(inlined, perm);
+    return Status::OK();
+}
+
+// Sorting multiple fixed-length columns column by column needs a pass and a tie-break per column. If all the sort
+// keys of a row fit into 128 bits, pack them into one memcomparable integer and sort it in a single pass instead.
+// Returns false if the columns can't be packed.
+static StatusOr<bool> try_sort_by_normalized_key(const std::atomic<bool>& cancel, const Columns& columns,
+                                                 const SortDescs& sort_desc, SmallPermutation& perm) {
+    if (columns.size() < 2) {
+        return false;
+    }
+    size_t bits = 0;
+    for (size_t i = 0; i < columns.size(); i++) {
+        NormalizedKeyEncoder<uint64_t> width(sort_desc.get_column_desc(i), nullptr);
+        if (!columns[i]->accept(&width).ok()) {
+            return false;
+        }
+        bits += width.bits();
+    }
+    if (bits <= 64) {
+        RETURN_IF_ERROR(sort_by_normalized_key<uint64_t>(cancel, columns, sort_desc, perm));
+    } else if (bits <= 128) {
+        RETURN_IF_ERROR(sort_by_normalized_key<uint128_t>(cancel, columns, sort_desc, perm));
+    } else {
+        return false;
+    }
+    return true;
+}
+
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                             Permutation* permutation) {
     if (columns.size() < 1) {
@@ -506,6 +725,12 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
+    ASSIGN_OR_RETURN(bool sorted, try_sort_by_normalized_key(cancel, columns, sort_desc, small_perm));
+    if (sorted) {
+        restore_small_permutation(small_perm, *permutation);
+        return Status::OK();
+    }
+
     for (int col_index = 0; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool build_tie = col_index != columns.size() - 1;
@@ -18,6 +18,7 @@
 
 #include "common/status.h"
 #include "common/statusor.h"
+#include "exec/workgroup/work_group_fwd.h"
 #include "gen_cpp/Types_types.h"
 #include "io/input_stream.h"
 #include "util/runtime_profile.h"
@@ -69,12 +70,27 @@ using BlockPtr = std::shared_ptr<Block>;
 struct BlockReaderOptions {
     bool enable_buffer_read = false;
     size_t max_buffer_bytes = std::numeric_limits<size_t>::max();
+    // the buffer size of a remote block when buffer read is disabled, 0 disables it.
+    // see remote_block_read_buffer_bytes
+    size_t remote_buffer_bytes = 0;
 
     RuntimeProfile::Counter* read_io_timer = nullptr;
     RuntimeProfile::Counter* read_io_count = nullptr;
     RuntimeProfile::Counter* read_io_bytes = nullptr;
+
+    // the workgroup whose spill IO budget the reads are accounted to
+    workgroup::WorkGroup* workgroup = nullptr;
 };
 
+// The read buffer size of the remote blocks of each of `num_streams` streams which share the read buffer budget
+// `budget_bytes` of a driver, used when buffer read is disabled. Every deserialized chunk reads a small header
+// before its data, which costs a whole request on remote storage without a buffer.
+size_t remote_block_read_buffer_bytes(size_t budget_bytes, size_t num_streams);
+
+// Account `bytes` of spill IO to the budget of `workgroup`. It never waits, the spill IO tasks of a throttled
+// workgroup yield before doing more IO, see yield_if_spill_io_throttled.
+void account_spill_io(workgroup::WorkGroup* workgroup, int64_t bytes);
+
 class BlockReader {
 public:
     BlockReader(const Block* block, const BlockReaderOptions& options)
@@ -12,14 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/spill/block_manager.h"
+#include "exec/workgroup/work_group.h"
 #include "fmt/format.h"
 #include "io/input_stream.h"
 #include "util/slice.h"
 
 namespace starrocks::spill {
 
+void account_spill_io(workgroup::WorkGroup* workgroup, int64_t bytes) {
+    if (workgroup != nullptr) {
+        workgroup->account_spill_io(bytes);
+    }
+}
+
 // try to read `expected_length` bytes from file, return the actual length read or an error.
 // if at_least_length is set and the actual length read is less than it, an error will be returned.
 // if at_least_length is not set and the actual length read is not equal to expected_length, an error will be returned.
@@ -39,10 +49,22 @@ StatusOr<int64_t> try_to_read_from_file(io::InputStreamWrapper* readable, void*
     return read_len;
 }
 
+size_t remote_block_read_buffer_bytes(size_t budget_bytes, size_t num_streams) {
+    if (config::spill_remote_read_buffer_bytes <= 0 || num_streams == 0) {
+        return 0;
+    }
+    return std::min<size_t>(config::spill_remote_read_buffer_bytes, budget_bytes / num_streams);
+}
+
 Status BlockReader::read_fully(void* data, int64_t count) {
     if (_readable == nullptr) {
         ASSIGN_OR_RETURN(_readable, _block->get_readable());
         _length = _block->size();
+        // remote blocks are always read through a buffer, see remote_block_read_buffer_bytes
+        if (!_options.enable_buffer_read && _block->is_remote() && _options.remote_buffer_bytes > 0) {
+            _options.enable_buffer_read = true;
+            _options.max_buffer_bytes = _options.remote_buffer_bytes;
+        }
         // init buffer
         if (_options.enable_buffer_read) {
             _options.max_buffer_bytes = std::min(_options.max_buffer_bytes, _length);
@@ -71,6 +93,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
             int64_t length_need_read = count - length_in_buffer;
             if (length_need_read >= _options.max_buffer_bytes) {
                 // if res length is larger than max_buffer_bytes, read from file directly
+                account_spill_io(_options.workgroup, length_need_read);
                 SCOPED_TIMER(_options.read_io_timer);
                 COUNTER_UPDATE(_options.read_io_count, 1);
                 ASSIGN_OR_RETURN(auto read_len, try_to_read_from_file(_readable.get(), offset, length_need_read));
@@ -78,6 +101,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
                 COUNTER_UPDATE(_options.read_io_bytes, read_len);
             } else {
                 // refill buffer, then read res data from buffer
+                account_spill_io(_options.workgroup, _options.max_buffer_bytes);
                 SCOPED_TIMER(_options.read_io_timer);
                 COUNTER_UPDATE(_options.read_io_count, 1);
                 ASSIGN_OR_RETURN(auto read_len, try_to_read_from_file(_readable.get(), _buffer.get(),
@@ -89,6 +113,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
             }
         }
     } else {
+        account_spill_io(_options.workgroup, count);
         SCOPED_TIMER(_options.read_io_timer);
         COUNTER_UPDATE(_options.read_io_count, 1);
         ASSIGN_OR_RETURN(auto read_len, try_to_read_from_file(_readable.get(), data, count));
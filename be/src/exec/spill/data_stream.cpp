@@ -81,6 +81,7 @@ Status BlockSpillOutputDataStream::append(RuntimeState* state, const std::vector
     // acquire block if current block is nullptr or full
     RETURN_IF_ERROR(_prepare_block(state, total_write_size));
     _append_rows += write_num_rows;
+    account_spill_io(_spiller->options().wg.get(), total_write_size);
     {
         auto write_io_timer = GET_METRICS(_cur_block->is_remote(), _spiller->metrics(), write_io_timer);
         SCOPED_TIMER(write_io_timer);
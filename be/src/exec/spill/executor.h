@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/scan_task_queue.h"
+#include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "gen_cpp/Types_types.h"
 #include "runtime/current_thread.h"
@@ -124,6 +126,20 @@ private:
     }
 };
 
+// Make the IO task yield before doing any IO if the spill IO budget of `wg` is used up. The IO executor parks it
+// and requeues it once the budget is available again, instead of blocking an IO thread shared with the other
+// queries or picking it up again at once.
+inline bool yield_if_spill_io_throttled(workgroup::YieldContext& yield_ctx, const workgroup::WorkGroup* wg) {
+    if (wg == nullptr || !wg->is_spill_io_throttled()) {
+        return false;
+    }
+    // The task may not have set its yield points yet, keep it unfinished to be rescheduled.
+    yield_ctx.total_yield_point_cnt = std::max(yield_ctx.total_yield_point_cnt, yield_ctx.yield_point + 1);
+    yield_ctx.need_yield = true;
+    yield_ctx.resubmit_after_ns = wg->spill_io_next_free_ns();
+    return true;
+}
+
 struct SyncTaskExecutor {
     static Status submit(workgroup::ScanTask task) {
         do {
@@ -463,10 +463,12 @@ std::vector<BlockGroupPtr> BlockGroupSet::select_compaction_block_groups() {
 
 StatusOr<InputStreamPtr> BlockGroupSet::as_unordered_stream(const SerdePtr& serde, Spiller* spiller) {
     BlockReaderOptions read_options;
+    read_options.workgroup = spiller->options().wg.get();
     if (spiller->options().enable_buffer_read) {
         read_options.enable_buffer_read = true;
         read_options.max_buffer_bytes = spiller->options().max_read_buffer_bytes;
     }
+    read_options.remote_buffer_bytes = remote_block_read_buffer_bytes(spiller->options().max_read_buffer_bytes, 1);
     std::vector<BlockPtr> blocks;
     // collect block for each group
     for (const auto& group : _groups) {
@@ -487,6 +489,7 @@ StatusOr<InputStreamPtr> BlockGroupSet::build_ordered_stream(std::vector<BlockGr
                                                              Spiller* spiller, const SortExecExprs* sort_exprs,
                                                              const SortDescs* sort_descs) {
     BlockReaderOptions read_options;
+    read_options.workgroup = spiller->options().wg.get();
     if (spiller->options().enable_buffer_read && block_groups.size() > 0) {
         size_t max_buffer_bytes = spiller->options().max_read_buffer_bytes / block_groups.size();
         if (max_buffer_bytes > config::spill_read_buffer_min_bytes) {
@@ -494,6 +497,9 @@ StatusOr<InputStreamPtr> BlockGroupSet::build_ordered_stream(std::vector<BlockGr
             read_options.max_buffer_bytes = max_buffer_bytes;
         }
     }
+    // all the streams are read at the same time by the ordered stream, so they share the budget
+    read_options.remote_buffer_bytes =
+            remote_block_read_buffer_bytes(spiller->options().max_read_buffer_bytes, block_groups.size());
     std::vector<InputStreamPtr> streams;
     for (const auto& group : block_groups) {
         auto stream = std::make_shared<SequenceInputStream>(group->blocks(), serde, read_options);
@@ -87,6 +87,9 @@ struct SpilledOptions {
     size_t mem_table_pool_size{};
     // memory table peak mem usage
     size_t spill_mem_table_bytes_size{};
+    // for hybrid hash join: the partitions which have never been spilled are kept in memory up to this many bytes,
+    // instead of being flushed once their mem tables are full. 0 means that no partition is kept.
+    size_t max_in_mem_partition_bytes = 0;
     // spilled format type
     SpillFormaterType spill_type{};
 
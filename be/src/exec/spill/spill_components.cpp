@@ -356,6 +356,11 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
         }
     }
 
+    // the partitions never spilled are kept in memory as long as they fit in max_in_mem_partition_bytes,
+    // so that the hybrid hash join only pays spill IO for the partitions exceeding the budget.
+    const size_t max_in_mem_bytes = options().max_in_mem_partition_bytes;
+    const bool keep_in_mem_partitions = max_in_mem_bytes > 0;
+
     // if the mem table of a partition is full, we flush it directly,
     // otherwise, we treat it as a candidate
     std::vector<SpilledPartition*> partitions_can_flush;
@@ -364,7 +369,7 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
         if (partition->is_spliting) {
             continue;
         }
-        if (mem_table->is_full()) {
+        if (mem_table->is_full() && !(keep_in_mem_partitions && partition->in_mem)) {
             RETURN_IF_ERROR(mem_table->done());
             partition->in_mem = false;
             partition->mem_size = 0;
@@ -383,12 +388,24 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
         // for the final flush, we need to control the memory usage on hash join probe side,
         // so we should ensure the partitions loaded in memory under a certain threshold.
 
-        // order by bytes desc
+        // order by bytes desc, the never spilled partitions first when they are kept in memory, so that they
+        // aren't flushed to make room for the partitions already on disk.
         std::sort(partitions_can_flush.begin(), partitions_can_flush.end(),
-                  [](SpilledPartition* left, SpilledPartition* right) { return left->bytes > right->bytes; });
+                  [keep_in_mem_partitions](SpilledPartition* left, SpilledPartition* right) {
+                      if (keep_in_mem_partitions && left->in_mem != right->in_mem) {
+                          return left->in_mem;
+                      }
+                      return left->bytes > right->bytes;
+                  });
+        // the never spilled partitions have no bytes on disk, count their mem tables instead.
+        auto partition_bytes = [keep_in_mem_partitions](SpilledPartition* partition) {
+            return partition->bytes +
+                   (keep_in_mem_partitions ? partition->spill_writer->mem_table()->mem_usage() : 0);
+        };
+        const size_t in_mem_limit = std::max(options().spill_mem_table_bytes_size, max_in_mem_bytes);
         size_t in_mem_bytes = 0;
         for (auto partition : partitions_can_flush) {
-            if (in_mem_bytes + partition->bytes > options().spill_mem_table_bytes_size) {
+            if (in_mem_bytes + partition_bytes(partition) > in_mem_limit) {
                 const auto& mem_table = partition->spill_writer->mem_table();
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -396,7 +413,37 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
                 partitions_need_flush.emplace_back(partition);
                 continue;
             }
-            in_mem_bytes += partition->bytes;
+            in_mem_bytes += partition_bytes(partition);
+        }
+    } else if (keep_in_mem_partitions) {
+        // flush the partitions which already have data on disk first, and then the largest in-memory partitions
+        // until the rest of them fit in the budget.
+        std::sort(partitions_can_flush.begin(), partitions_can_flush.end(),
+                  [](SpilledPartition* left, SpilledPartition* right) {
+                      if (left->in_mem != right->in_mem) {
+                          return !left->in_mem;
+                      }
+                      return left->spill_writer->mem_table()->mem_usage() >
+                             right->spill_writer->mem_table()->mem_usage();
+                  });
+        size_t in_mem_bytes = 0;
+        for (auto partition : partitions_can_flush) {
+            if (partition->in_mem) {
+                in_mem_bytes += partition->spill_writer->mem_table()->mem_usage();
+            }
+        }
+        for (auto partition : partitions_can_flush) {
+            const auto& mem_table = partition->spill_writer->mem_table();
+            if (partition->in_mem) {
+                if (in_mem_bytes <= max_in_mem_bytes) {
+                    break;
+                }
+                in_mem_bytes -= mem_table->mem_usage();
+            }
+            RETURN_IF_ERROR(mem_table->done());
+            partition->in_mem = false;
+            partition->mem_size = 0;
+            partitions_need_flush.emplace_back(partition);
         }
     } else {
         // for the flush during hash join build process, our goal is to reduce memory usage,
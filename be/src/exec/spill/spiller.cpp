@@ -95,6 +95,7 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
     read_io_count = ADD_CHILD_COUNTER(profile, "ReadIOCount", TUnit::UNIT, parent);
     local_read_io_count = ADD_CHILD_COUNTER(profile, "LocalReadIOCount", TUnit::UNIT, "ReadIOCount");
     remote_read_io_count = ADD_CHILD_COUNTER(profile, "RemoteReadIOCount", TUnit::UNIT, "ReadIOCount");
+    io_throttle_yield_times = ADD_CHILD_COUNTER(profile, "IOThrottleYieldCount", TUnit::UNIT, parent);
 
     compact_count = ADD_CHILD_COUNTER(profile, "CompactCount", TUnit::UNIT, parent);
     compact_block_count = ADD_CHILD_COUNTER(profile, "CompactBlockCount", TUnit::UNIT, parent);
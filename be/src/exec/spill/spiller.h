@@ -118,6 +118,9 @@ public:
     RuntimeProfile::Counter* local_read_io_count = nullptr;
     RuntimeProfile::Counter* remote_read_io_count = nullptr;
 
+    // the number of times IO tasks yield because the spill IO budget of the workgroup is used up
+    RuntimeProfile::Counter* io_throttle_yield_times = nullptr;
+
     // the number of compact table
     RuntimeProfile::Counter* compact_count = nullptr;
     RuntimeProfile::Counter* compact_block_count = nullptr;
@@ -214,6 +217,8 @@ public:
 
     const auto& options() const { return _opts; }
 
+    void set_max_in_mem_partition_bytes(size_t bytes) { _opts.max_in_mem_partition_bytes = bytes; }
+
     void update_spilled_task_status(Status&& st);
 
     Status task_status() {
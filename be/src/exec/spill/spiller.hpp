@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 
 #include "column/chunk.h"
@@ -176,6 +177,13 @@ Status RawSpillerWriter::flush(RuntimeState* state, MemGuard&& guard) {
 
         yield_ctx.time_spent_ns = 0;
         yield_ctx.need_yield = false;
+        if constexpr (std::is_same_v<TaskExecutor, IOTaskExecutor>) {
+            if (yield_if_spill_io_throttled(yield_ctx, _spiller->options().wg.get())) {
+                COUNTER_UPDATE(_spiller->metrics().io_throttle_yield_times, 1);
+                defer.cancel();
+                return Status::OK();
+            }
+        }
 
         _spiller->update_spilled_task_status(yieldable_flush_task(yield_ctx, state, mem_table));
         if (yield_ctx.need_yield && !yield_ctx.is_finished()) {
@@ -236,6 +244,13 @@ Status SpillerReader::trigger_restore(RuntimeState* state, MemGuard&& guard) {
                 auto ctx = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
                 yield_ctx.time_spent_ns = 0;
                 yield_ctx.need_yield = false;
+                if constexpr (std::is_same_v<TaskExecutor, IOTaskExecutor>) {
+                    if (yield_if_spill_io_throttled(yield_ctx, _spiller->options().wg.get())) {
+                        COUNTER_UPDATE(_spiller->metrics().io_throttle_yield_times, 1);
+                        defer.cancel();
+                        return;
+                    }
+                }
 
                 YieldableRestoreTask task(_stream);
                 res = task.do_read(yield_ctx, serd_ctx);
@@ -294,7 +309,7 @@ Status PartitionedSpillerWriter::spill(RuntimeState* state, const ChunkPtr& chun
 
 template <class TaskExecutor, class MemGuard>
 Status PartitionedSpillerWriter::flush_if_full(RuntimeState* state, MemGuard&& guard) {
-    if (_mem_tracker->consumption() > options().spill_mem_table_bytes_size) {
+    if (_mem_tracker->consumption() > options().spill_mem_table_bytes_size + options().max_in_mem_partition_bytes) {
         return flush<TaskExecutor>(state, false, guard);
     }
     return Status::OK();
@@ -336,6 +351,13 @@ Status PartitionedSpillerWriter::flush(RuntimeState* state, bool is_final_flush,
         if (!yield_ctx.task_context_data.has_value()) {
             yield_ctx.task_context_data = SpillIOTaskContextPtr(std::make_shared<PartitionedFlushContext>());
         }
+        if constexpr (std::is_same_v<TaskExecutor, IOTaskExecutor>) {
+            if (yield_if_spill_io_throttled(yield_ctx, _spiller->options().wg.get())) {
+                COUNTER_UPDATE(_spiller->metrics().io_throttle_yield_times, 1);
+                defer.cancel();
+                return Status::OK();
+            }
+        }
         _spiller->update_spilled_task_status(
                 yieldable_flush_task(yield_ctx, splitting_partitions, spilling_partitions));
 
@@ -17,6 +17,7 @@
 #include <any>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/chunks_sorter.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_heap_sort.h"
@@ -296,7 +297,7 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> TopNNode::_decompose_to_
     auto spill_channel_factory = std::make_shared<SpillProcessChannelFactory>(degree_of_parallelism);
 
     // spill process operator
-    if (runtime_state()->enable_spill() && runtime_state()->enable_sort_spill() && _limit < 0 && !is_partition_topn) {
+    if (_can_spill_sort(runtime_state(), _tnode.sort_node, _limit, _offset, is_partition_topn)) {
         context->interpolate_spill_process(id(), spill_channel_factory, degree_of_parallelism);
     }
 
@@ -361,6 +362,21 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> TopNNode::_decompose_to_
     return operators_source_with_sort;
 }
 
+bool TopNNode::_can_spill_sort(const RuntimeState* state, const TSortNode& sort_node, int64_t limit, int64_t offset,
+                               bool is_partition_topn) {
+    if (!state->enable_spill() || !state->enable_sort_spill() || is_partition_topn) {
+        return false;
+    }
+    if (limit < 0) {
+        return true;
+    }
+    // The merge of the spilled runs stops after offset + limit rows, and the LimitOperator appended in
+    // decompose_to_pipeline trims the output, so the result is the same as the in-memory TopN.
+    bool is_row_number = !sort_node.__isset.topn_type || sort_node.topn_type == TTopNType::ROW_NUMBER;
+    int64_t threshold = config::spillable_topn_limit_threshold;
+    return is_row_number && threshold >= 0 && limit + offset > threshold;
+}
+
 pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
@@ -384,7 +400,7 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
                                        LocalPartitionTopnSourceOperatorFactory>(
                         context, is_partition_topn, is_partition_skewed, need_merge, enable_parallel_merge);
     } else {
-        if (runtime_state()->enable_spill() && runtime_state()->enable_sort_spill() && _limit < 0) {
+        if (_can_spill_sort(runtime_state(), _tnode.sort_node, _limit, _offset, is_partition_topn)) {
             if (enable_parallel_merge) {
                 operators_source_with_sort =
                         _decompose_to_pipeline<SortContextFactory, SpillablePartitionSortSinkOperatorFactory,
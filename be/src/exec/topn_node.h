@@ -47,6 +47,11 @@ private:
             pipeline::PipelineBuilderContext* context, bool is_partition_topn, bool is_partition_skewed,
             bool is_merging, bool enable_parallel_merge);
 
+    // Whether the sort can spill. Besides a full sort, a non-partition ROW_NUMBER TopN with a limit large enough that
+    // keeping it in memory is risky is executed by the spillable full sort.
+    static bool _can_spill_sort(const RuntimeState* state, const TSortNode& sort_node, int64_t limit, int64_t offset,
+                                bool is_partition_topn);
+
     Status _consume_chunks(RuntimeState* state, ExecNode* child);
     const TPlanNode& _tnode;
 
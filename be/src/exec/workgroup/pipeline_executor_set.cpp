@@ -94,6 +94,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_numa_aware(config::enable_pipeline_numa_aware)
                             .build(&driver_executor_thread_pool));
     _driver_executor = std::make_unique<pipeline::GlobalDriverExecutor>(_name, std::move(driver_executor_thread_pool),
                                                                         true, _cpuids);
@@ -107,6 +108,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_numa_aware(config::enable_pipeline_numa_aware)
                             .build(&scan_thread_pool));
     _scan_executor = std::make_unique<ScanExecutor>(
             std::move(scan_thread_pool), std::make_unique<WorkGroupScanTaskQueue>(ScanSchedEntityType::OLAP));
@@ -120,6 +122,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_numa_aware(config::enable_pipeline_numa_aware)
                             .build(&connector_scan_thread_pool));
     _connector_scan_executor =
             std::make_unique<ScanExecutor>(std::move(connector_scan_thread_pool),
@@ -14,8 +14,12 @@
 
 #include "exec/workgroup/scan_executor.h"
 
+#include <chrono>
+#include <utility>
+
 #include "exec/workgroup/scan_task_queue.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -27,7 +31,12 @@ ScanExecutor::ScanExecutor(std::unique_ptr<ThreadPool> thread_pool, std::unique_
     }
 }
 
+ScanExecutor::~ScanExecutor() {
+    _stop_delayed_resubmit_thread();
+}
+
 void ScanExecutor::close() {
+    _stop_delayed_resubmit_thread();
     _task_queue->close();
     _thread_pool->shutdown();
 }
@@ -82,9 +91,72 @@ void ScanExecutor::worker_thread() {
 
         // task
         if (!task.is_finished()) {
-            _task_queue->force_put(std::move(task));
+            const int64_t resubmit_after_ns = std::exchange(task.work_context.resubmit_after_ns, 0);
+            if (resubmit_after_ns > MonotonicNanos()) {
+                _delayed_resubmit(std::move(task), resubmit_after_ns);
+            } else {
+                _task_queue->force_put(std::move(task));
+            }
+        }
+    }
+}
+
+void ScanExecutor::_delayed_resubmit(ScanTask task, int64_t resubmit_after_ns) {
+    {
+        std::lock_guard<std::mutex> lock(_delayed_mutex);
+        if (!_delayed_shutdown && _delayed_thread == nullptr) {
+            auto st = Thread::create(
+                    "scan_executor", "scan_delay", [this]() { _delayed_resubmit_thread(); }, &_delayed_thread);
+            LOG_IF(WARNING, !st.ok()) << "failed to create the delayed resubmit thread of scan executor: " << st;
         }
+        if (_delayed_thread != nullptr) {
+            const bool is_earliest = _delayed_tasks.empty() || resubmit_after_ns < _delayed_tasks.begin()->first;
+            _delayed_tasks.emplace(resubmit_after_ns, std::move(task));
+            if (is_earliest) {
+                _delayed_cv.notify_one();
+            }
+            return;
+        }
+    }
+    // No thread to requeue it later, requeue it at once as if it had no delay.
+    _task_queue->force_put(std::move(task));
+}
+
+void ScanExecutor::_delayed_resubmit_thread() {
+    std::unique_lock<std::mutex> lock(_delayed_mutex);
+    while (!_delayed_shutdown) {
+        if (_delayed_tasks.empty()) {
+            _delayed_cv.wait(lock);
+            continue;
+        }
+        auto it = _delayed_tasks.begin();
+        const int64_t wait_ns = it->first - MonotonicNanos();
+        if (wait_ns > 0) {
+            _delayed_cv.wait_for(lock, std::chrono::nanoseconds(wait_ns));
+            continue;
+        }
+        auto task = std::move(it->second);
+        _delayed_tasks.erase(it);
+        lock.unlock();
+        _task_queue->force_put(std::move(task));
+        lock.lock();
+    }
+}
+
+void ScanExecutor::_stop_delayed_resubmit_thread() {
+    scoped_refptr<Thread> thread;
+    {
+        std::lock_guard<std::mutex> lock(_delayed_mutex);
+        _delayed_shutdown = true;
+        thread = std::move(_delayed_thread);
+        _delayed_cv.notify_one();
+    }
+    if (thread != nullptr) {
+        thread->join();
     }
+    // The queue is closing, the tasks still waiting are dropped as the ones in the queue.
+    std::lock_guard<std::mutex> lock(_delayed_mutex);
+    _delayed_tasks.clear();
 }
 
 bool ScanExecutor::submit(ScanTask task) {
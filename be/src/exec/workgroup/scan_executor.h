@@ -14,7 +14,13 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
+#include "exec/workgroup/scan_task_queue.h"
 #include "util/limit_setter.h"
+#include "util/thread.h"
 #include "util/threadpool.h"
 #include "work_group.h"
 
@@ -29,7 +35,7 @@ class ScanExecutor {
 public:
     explicit ScanExecutor(std::unique_ptr<ThreadPool> thread_pool, std::unique_ptr<ScanTaskQueue> task_queue,
                           bool add_metrics = true);
-    virtual ~ScanExecutor() = default;
+    virtual ~ScanExecutor();
 
     void initialize(int32_t num_threads);
     void close();
@@ -44,10 +50,24 @@ public:
 private:
     void worker_thread();
 
+    // Put `task` back to the queue when the monotonic time reaches `resubmit_after_ns`, so that it does not
+    // occupy a worker thread meanwhile.
+    void _delayed_resubmit(ScanTask task, int64_t resubmit_after_ns);
+    void _delayed_resubmit_thread();
+    void _stop_delayed_resubmit_thread();
+
     LimitSetter _num_threads_setter;
     std::unique_ptr<ScanTaskQueue> _task_queue;
     // _thread_pool must be placed after _task_queue, because worker threads in _thread_pool use _task_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
+
+    // The unfinished tasks waiting for their YieldContext::resubmit_after_ns, ordered by it. The thread requeuing
+    // them is only created by the first delayed task.
+    std::mutex _delayed_mutex;
+    std::condition_variable _delayed_cv;
+    std::multimap<int64_t, ScanTask> _delayed_tasks;
+    scoped_refptr<Thread> _delayed_thread;
+    bool _delayed_shutdown = false;
 };
 
 } // namespace starrocks::workgroup
@@ -17,6 +17,7 @@
 #include "common/status.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -107,7 +108,10 @@ StatusOr<ScanTask> WorkGroupScanTaskQueue::take() {
 
     _num_tasks--;
 
-    return wg_entity->queue()->take();
+    ASSIGN_OR_RETURN(auto task, wg_entity->queue()->take());
+    _remove_slo_query_begin_time(wg_entity, task.query_begin_time_ns);
+    _update_min_wg();
+    return task;
 }
 
 bool WorkGroupScanTaskQueue::try_offer(ScanTask task) {
@@ -119,10 +123,15 @@ bool WorkGroupScanTaskQueue::try_offer(ScanTask task) {
 
     auto* wg_entity = _sched_entity(task.workgroup.get());
     wg_entity->set_in_queue(this);
+    const int64_t query_begin_time_ns = task.query_begin_time_ns;
+    const bool has_latency_slo = task.workgroup->has_latency_slo();
     RETURN_IF_UNLIKELY(!wg_entity->queue()->try_offer(std::move(task)), false);
 
+    _add_slo_query_begin_time(wg_entity, query_begin_time_ns);
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
         _enqueue_workgroup(wg_entity);
+    } else if (has_latency_slo) {
+        _update_min_wg();
     }
 
     _num_tasks++;
@@ -139,10 +148,14 @@ void WorkGroupScanTaskQueue::force_put(ScanTask task) {
 
     auto* wg_entity = _sched_entity(task.workgroup.get());
     wg_entity->set_in_queue(this);
+    _add_slo_query_begin_time(wg_entity, task.query_begin_time_ns);
+    const bool has_latency_slo = task.workgroup->has_latency_slo();
     wg_entity->queue()->force_put(std::move(task));
 
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
         _enqueue_workgroup(wg_entity);
+    } else if (has_latency_slo) {
+        _update_min_wg();
     }
 
     _num_tasks++;
@@ -164,6 +177,8 @@ void WorkGroupScanTaskQueue::update_statistics(ScanTask& task, int64_t runtime_n
     wg_entity->incr_runtime_ns(runtime_ns);
     if (is_in_queue) {
         _wg_entities.emplace(wg_entity);
+    }
+    if (is_in_queue || !_slo_query_begin_times.empty()) {
         _update_min_wg();
     }
 }
@@ -175,28 +190,81 @@ bool WorkGroupScanTaskQueue::should_yield(const WorkGroup* wg, int64_t unaccount
 
     // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     const auto* wg_entity = _sched_entity(wg);
+    // The workgroups without latency SLO yield to the scan tasks of the urgent queries of latency-SLO workgroups.
+    auto* urgent_entity = _urgent_wg_entity.load();
+    if (urgent_entity != nullptr && urgent_entity != wg_entity && !wg->has_latency_slo()) {
+        return true;
+    }
     const auto* min_entity = _min_wg_entity.load();
     return min_entity != wg_entity && min_entity &&
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_weight();
 }
 
 void WorkGroupScanTaskQueue::_update_min_wg() {
-    auto* min_wg_entity = _pick_next_wg();
-    if (min_wg_entity == nullptr) {
-        _min_wg_entity = nullptr;
-    } else {
-        _min_wg_entity = min_wg_entity;
-    }
+    _urgent_wg_entity = _pick_urgent_wg(MonotonicNanos());
+    _min_wg_entity = _pick_next_wg();
 }
 
 WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_pick_next_wg() const {
     if (_wg_entities.empty()) {
         return nullptr;
     }
-
+    if (auto* urgent_wg_entity = _urgent_wg_entity.load(); urgent_wg_entity != nullptr) {
+        return urgent_wg_entity;
+    }
     return *_wg_entities.begin();
 }
 
+WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_pick_urgent_wg(int64_t now_ns) const {
+    if (_slo_query_begin_times.empty() || _wg_entities.empty()) {
+        return nullptr;
+    }
+
+    const int64_t min_vruntime_ns = (*_wg_entities.begin())->vruntime_ns();
+    WorkGroupScanSchedEntity* urgent_entity = nullptr;
+    int64_t earliest_deadline_ns = 0;
+    for (const auto& [wg_entity, begin_times] : _slo_query_begin_times) {
+        const auto* wg = wg_entity->workgroup();
+        const int64_t query_begin_time_ns = *begin_times.begin();
+        if (!wg->is_urgent_query(query_begin_time_ns, now_ns) ||
+            wg_entity->vruntime_ns() - min_vruntime_ns > WorkGroup::SLO_MAX_VRUNTIME_LEAD_NS ||
+            _wg_entities.find(wg_entity) == _wg_entities.end()) {
+            continue;
+        }
+        const int64_t deadline_ns = query_begin_time_ns + wg->target_latency_ns();
+        if (urgent_entity == nullptr || deadline_ns < earliest_deadline_ns) {
+            urgent_entity = wg_entity;
+            earliest_deadline_ns = deadline_ns;
+        }
+    }
+    return urgent_entity;
+}
+
+void WorkGroupScanTaskQueue::_add_slo_query_begin_time(WorkGroupScanSchedEntity* wg_entity,
+                                                       int64_t query_begin_time_ns) {
+    if (query_begin_time_ns > 0 && wg_entity->workgroup()->has_latency_slo()) {
+        _slo_query_begin_times[wg_entity].emplace(query_begin_time_ns);
+    }
+}
+
+void WorkGroupScanTaskQueue::_remove_slo_query_begin_time(WorkGroupScanSchedEntity* wg_entity,
+                                                          int64_t query_begin_time_ns) {
+    if (query_begin_time_ns <= 0 || !wg_entity->workgroup()->has_latency_slo()) {
+        return;
+    }
+    auto it = _slo_query_begin_times.find(wg_entity);
+    if (it == _slo_query_begin_times.end()) {
+        return;
+    }
+    auto& begin_times = it->second;
+    if (auto begin_time_it = begin_times.find(query_begin_time_ns); begin_time_it != begin_times.end()) {
+        begin_times.erase(begin_time_it);
+    }
+    if (begin_times.empty()) {
+        _slo_query_begin_times.erase(it);
+    }
+}
+
 void WorkGroupScanTaskQueue::_enqueue_workgroup(WorkGroupScanSchedEntity* wg_entity) {
     _sum_cpu_weight += wg_entity->cpu_weight();
 
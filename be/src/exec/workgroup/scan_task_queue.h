@@ -20,6 +20,7 @@
 #include <mutex>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -62,6 +63,9 @@ struct YieldContext {
     // It needs to be reset every time when the task is executed.
     int64_t time_spent_ns = 0;
     bool need_yield = false;
+    // If an unfinished task sets it to a monotonic time in nanoseconds, the executor puts the task back to the
+    // queue only when this time is reached, instead of right after it yields. It is reset on each requeue.
+    int64_t resubmit_after_ns = 0;
 };
 
 struct ScanTask {
@@ -111,6 +115,8 @@ public:
     int priority = 0;
     std::shared_ptr<ScanTaskGroup> task_group = nullptr;
     RuntimeProfile::HighWaterMarkCounter* peak_scan_task_queue_size_counter = nullptr;
+    // The begin time of the query, which tells whether a latency-SLO workgroup is behind its target, 0 if unknown.
+    int64_t query_begin_time_ns = 0;
 };
 
 /// There are two types of ScanTaskQueue:
@@ -174,9 +180,16 @@ public:
 
 private:
     /// These methods should be guarded by the outside _global_mutex.
+    // Select the urgent latency-SLO workgroup if any, otherwise the workgroup with the minimum vruntime.
     WorkGroupScanSchedEntity* _pick_next_wg() const;
-    // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
+    // Return the latency-SLO workgroup whose urgent query has the earliest deadline, among the ones whose vruntime
+    // doesn't lead the minimum by WorkGroup::SLO_MAX_VRUNTIME_LEAD_NS, or nullptr if there is none.
+    WorkGroupScanSchedEntity* _pick_urgent_wg(int64_t now_ns) const;
+    // _update_min_wg is invoked when the tasks or the runtime of the workgroups change, since the queries of
+    // latency-SLO workgroups become urgent as time goes by.
     void _update_min_wg();
+    void _add_slo_query_begin_time(WorkGroupScanSchedEntity* wg_entity, int64_t query_begin_time_ns);
+    void _remove_slo_query_begin_time(WorkGroupScanSchedEntity* wg_entity, int64_t query_begin_time_ns);
     void _enqueue_workgroup(WorkGroupScanSchedEntity* wg_entity);
     void _dequeue_workgroup(WorkGroupScanSchedEntity* wg_entity);
 
@@ -208,9 +221,13 @@ private:
     WorkgroupSet _wg_entities;
 
     size_t _sum_cpu_weight = 0;
+    // The query begin times of the queued tasks of each latency-SLO workgroup.
+    std::unordered_map<WorkGroupScanSchedEntity*, std::multiset<int64_t>> _slo_query_begin_times;
 
     // Cache the minimum entity, used to check should_yield() without lock.
     std::atomic<WorkGroupScanSchedEntity*> _min_wg_entity = nullptr;
+    // Cache the urgent latency-SLO entity, used to check should_yield() without lock.
+    std::atomic<WorkGroupScanSchedEntity*> _urgent_wg_entity = nullptr;
 
     std::atomic<size_t> _num_tasks = 0;
 };
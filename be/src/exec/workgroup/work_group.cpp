@@ -122,6 +122,10 @@ WorkGroup::WorkGroup(const TWorkGroup& twg)
         _exclusive_cpu_cores = twg.exclusive_cpu_cores;
     }
 
+    if (twg.__isset.target_latency_ms && twg.target_latency_ms > 0) {
+        _target_latency_ns = twg.target_latency_ms * (NANOS_PER_MICRO * MICROS_PER_MILLI);
+    }
+
     if (twg.__isset.mem_limit) {
         _memory_limit = twg.mem_limit;
     }
@@ -178,9 +182,38 @@ TWorkGroup WorkGroup::to_thrift_verbose() const {
     twg.__set_big_query_scan_rows_limit(_big_query_scan_rows_limit);
     twg.__set_big_query_cpu_second_limit(big_query_cpu_second_limit());
     twg.__set_spill_mem_limit_threshold(_spill_mem_limit_threshold);
+    twg.__set_target_latency_ms(_target_latency_ns / (NANOS_PER_MICRO * MICROS_PER_MILLI));
     return twg;
 }
 
+bool WorkGroup::is_urgent_query(int64_t query_begin_time_ns, int64_t now_ns) const {
+    if (!has_latency_slo()) {
+        return false;
+    }
+    return now_ns - query_begin_time_ns >= _target_latency_ns * config::workgroup_slo_urgent_ratio;
+}
+
+void WorkGroup::account_spill_io(int64_t bytes) {
+    const int64_t bytes_per_second = config::spill_io_bytes_per_second_per_workgroup;
+    if (bytes_per_second <= 0 || bytes <= 0) {
+        return;
+    }
+    const auto cost_ns = static_cast<int64_t>(static_cast<double>(bytes) * NANOS_PER_SEC / bytes_per_second);
+    const int64_t now = MonotonicNanos();
+    int64_t next_free = _spill_io_next_free_ns.load(std::memory_order_relaxed);
+    int64_t start;
+    do {
+        start = std::max(now, next_free);
+    } while (!_spill_io_next_free_ns.compare_exchange_weak(next_free, start + cost_ns, std::memory_order_relaxed));
+}
+
+bool WorkGroup::is_spill_io_throttled() const {
+    if (config::spill_io_bytes_per_second_per_workgroup <= 0) {
+        return false;
+    }
+    return _spill_io_next_free_ns.load(std::memory_order_relaxed) > MonotonicNanos();
+}
+
 void WorkGroup::init() {
     _memory_limit_bytes = _memory_limit == ABSENT_MEMORY_LIMIT
                                   ? GlobalEnv::GetInstance()->query_pool_mem_tracker()->limit()
@@ -204,10 +237,11 @@ std::string WorkGroup::to_string() const {
             "(id:{}, name:{}, version:{}, "
             "cpu_weight:{}, exclusive_cpu_cores:{}, mem_limit:{}, concurrency_limit:{}, "
             "bigquery: (cpu_second_limit:{}, mem_limit:{}, scan_rows_limit:{}), "
-            "spill_mem_limit_threshold:{}"
+            "spill_mem_limit_threshold:{}, target_latency_ns:{}"
             ")",
             _id, _name, _version, _cpu_weight, _exclusive_cpu_cores, _memory_limit_bytes, _concurrency_limit,
-            big_query_cpu_second_limit(), _big_query_mem_limit, _big_query_scan_rows_limit, _spill_mem_limit_threshold);
+            big_query_cpu_second_limit(), _big_query_mem_limit, _big_query_scan_rows_limit, _spill_mem_limit_threshold,
+            _target_latency_ns);
 }
 
 void WorkGroup::incr_num_running_drivers() {
@@ -135,6 +135,12 @@ public:
     const std::string& name() const { return _name; }
     size_t cpu_weight() const { return _cpu_weight; }
     size_t exclusive_cpu_cores() const { return _exclusive_cpu_cores; }
+    // The target latency of the queries in this workgroup, 0 means that it declares no latency SLO.
+    int64_t target_latency_ns() const { return _target_latency_ns; }
+    bool has_latency_slo() const { return _target_latency_ns > 0; }
+    // A query of the latency-SLO workgroup is urgent, when its elapsed time has used up
+    // config::workgroup_slo_urgent_ratio of the target latency.
+    bool is_urgent_query(int64_t query_begin_time_ns, int64_t now_ns) const;
     size_t mem_limit() const { return _memory_limit; }
     int64_t mem_limit_bytes() const { return _memory_limit_bytes; }
 
@@ -197,6 +203,15 @@ public:
     void incr_cpu_runtime_ns(int64_t delta_ns) { _cpu_runtime_ns += delta_ns; }
     int64_t cpu_runtime_ns() const { return _cpu_runtime_ns; }
 
+    // Account `bytes` of spill IO issued by this workgroup to its budget of
+    // config::spill_io_bytes_per_second_per_workgroup.
+    void account_spill_io(int64_t bytes);
+    // Whether the spill IO accounted so far is over the budget, then the spill IO tasks of this workgroup
+    // should yield and be rescheduled instead of issuing more IO.
+    bool is_spill_io_throttled() const;
+    // The monotonic time in nanoseconds when the spill IO accounted so far is within the budget again.
+    int64_t spill_io_next_free_ns() const { return _spill_io_next_free_ns.load(std::memory_order_relaxed); }
+
     void set_executors(PipelineExecutorSet* executors) { _executors = executors; }
     void set_exclusive_executors(std::unique_ptr<PipelineExecutorSet> executors) {
         _exclusive_executors = std::move(executors);
@@ -216,6 +231,9 @@ public:
     // Yield scan io task when maximum time in nano-seconds has spent in current execution round,
     // if it runs in the worker thread owned by other workgroup, which has running drivers.
     static constexpr int64_t YIELD_PREEMPT_MAX_TIME_SPENT = 5'000'000L;
+    // The latency-SLO workgroup with urgent queries is scheduled before the workgroups with smaller vruntime,
+    // only if its vruntime doesn't exceed the minimum vruntime by this value, to prevent the others from starving.
+    static constexpr int64_t SLO_MAX_VRUNTIME_LEAD_NS = 1'000'000'000L;
 
 private:
     static constexpr double ABSENT_MEMORY_LIMIT = -1;
@@ -229,6 +247,7 @@ private:
     // Specified limitations
     size_t _cpu_weight = 1;
     size_t _exclusive_cpu_cores = 0;
+    int64_t _target_latency_ns = 0;
     double _memory_limit = ABSENT_MEMORY_LIMIT;
     int64_t _memory_limit_bytes = -1;
     size_t _concurrency_limit = ABSENT_CONCURRENCY_LIMIT;
@@ -259,6 +278,8 @@ private:
     /// The total CPU runtime cost in nanos unit, including driver execution time, and the cpu execution time of
     /// other threads including Source and Sink threads.
     std::atomic<int64_t> _cpu_runtime_ns = 0;
+    // The monotonic time when the spill IO budget accounted so far is used up
+    std::atomic<int64_t> _spill_io_next_free_ns = 0;
 
     std::unique_ptr<PipelineExecutorSet> _exclusive_executors;
     PipelineExecutorSet* _executors = nullptr;
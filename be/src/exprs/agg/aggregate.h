@@ -42,6 +42,16 @@ enum AggStateTableKind { RESULT = 0, INTERMEDIATE = 1, DETAIL_RESULT = 2, DETAIL
 using AggDataPtr = uint8_t*;
 using ConstAggDataPtr = const uint8_t*;
 
+// The agg states of different groups are scattered in the agg mem pool, so batch updates prefetch the state
+// of the row which is AGG_STATE_PREFETCH_DISTANCE rows ahead to hide the cache miss of high-cardinality group by.
+static constexpr size_t AGG_STATE_PREFETCH_DISTANCE = 16;
+
+inline void prefetch_agg_state(AggDataPtr* states, size_t state_offset, size_t index, size_t chunk_size) {
+    if (index + AGG_STATE_PREFETCH_DISTANCE < chunk_size) {
+        __builtin_prefetch(states[index + AGG_STATE_PREFETCH_DISTANCE] + state_offset, 1);
+    }
+}
+
 // Aggregate function interface
 // Aggregate function instances don't contain aggregation state, the aggregation state is stored in
 // other objects
@@ -189,6 +199,8 @@ public:
     // the sum of (i-1)-th frame, i.e. "sum(i) = sum(i-1) - v[i-1+rows_start_offset] +  v[i+rows_end_offset]"
     // Ignore subtraction if ignore_subtraction is true
     // Ignore addition if ignore_addition is true
+    // When called from the nullable wrapper, columns[1] is the null column of the input (nullptr if there is no
+    // null), non-invertible functions like min/max use it to skip nulls when they have to rescan the frame.
     virtual void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state,
                                                      const Column** columns, int64_t current_row_position,
                                                      int64_t partition_start, int64_t partition_end,
@@ -355,6 +367,7 @@ public:
     void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                       AggDataPtr* states) const override {
         for (size_t i = 0; i < chunk_size; ++i) {
+            prefetch_agg_state(states, state_offset, i, chunk_size);
             static_cast<const Derived*>(this)->update(ctx, columns, states[i] + state_offset, i);
         }
     }
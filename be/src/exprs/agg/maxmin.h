@@ -17,6 +17,7 @@
 #include <limits>
 #include <type_traits>
 
+#include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
@@ -133,6 +134,37 @@ struct MinElement<LT, State, StringLTGuard<LT>> {
     }
 };
 
+// min/max is not invertible, so for sliding ROWS frames the row leaving the frame only matters when it may be the
+// current extreme (see `is_sync`), then the whole frame is rescanned. Otherwise the row entering the frame is simply
+// folded into the state, which makes a moving min/max linear for all but monotonic inputs.
+template <class OP, typename State, typename GetValue, typename MayBeExtreme>
+void update_max_min_removable_cumulatively(State& state, const Column* null_column, const GetValue& get_value,
+                                           const MayBeExtreme& may_be_extreme,
+                                           int64_t current_row_position, int64_t partition_start,
+                                           int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                           bool ignore_subtraction, bool ignore_addition) {
+    const int64_t previous_frame_first_position = current_row_position - 1 + rows_start_offset;
+    const int64_t current_frame_last_position = current_row_position + rows_end_offset;
+    if (!ignore_subtraction && previous_frame_first_position >= partition_start &&
+        previous_frame_first_position < partition_end && may_be_extreme(previous_frame_first_position)) {
+        const auto frame_start =
+                std::min(std::max(current_row_position + rows_start_offset, partition_start), partition_end);
+        const auto frame_end = std::max(std::min(current_frame_last_position + 1, partition_end), partition_start);
+        const uint8_t* nulls = null_column == nullptr ? nullptr : down_cast<const NullColumn*>(null_column)->raw_data();
+        state.reset();
+        for (int64_t i = frame_start; i < frame_end; ++i) {
+            if (nulls == nullptr || nulls[i] == 0) {
+                OP()(state, get_value(i));
+            }
+        }
+        return;
+    }
+    if (!ignore_addition && current_frame_last_position >= partition_start &&
+        current_frame_last_position < partition_end) {
+        OP()(state, get_value(current_frame_last_position));
+    }
+}
+
 template <LogicalType LT, typename State, class OP, typename T = RunTimeCppType<LT>, typename = guard::Guard>
 class MaxMinAggregateFunction final
         : public AggregateFunctionBatchHelper<State, MaxMinAggregateFunction<LT, State, OP, T>> {
@@ -159,6 +191,27 @@ public:
         }
     }
 
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        const auto& data = down_cast<const InputColumnType*>(columns[0])->get_data();
+        auto& state_data = this->data(state);
+        auto get_value = [&](int64_t i) -> T { return data[i]; };
+        // json values are not comparable with the state directly, always rescan for them
+        auto may_be_extreme = [&](int64_t i) {
+            if constexpr (lt_is_json<LT>) {
+                return true;
+            } else {
+                return OP::is_sync(state_data, data[i]);
+            }
+        };
+        update_max_min_removable_cumulatively<OP>(state_data, columns[1], get_value, may_be_extreme,
+                                                  current_row_position, partition_start, partition_end,
+                                                  rows_start_offset, rows_end_offset, ignore_subtraction,
+                                                  ignore_addition);
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(!column->is_nullable() && !column->is_binary());
         const auto* input_column = down_cast<const InputColumnType*>(column);
@@ -216,6 +269,21 @@ public:
         }
     }
 
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        DCHECK(columns[0]->is_binary());
+        const auto* column = down_cast<const BinaryColumn*>(columns[0]);
+        auto& state_data = this->data(state);
+        auto get_value = [&](int64_t i) { return column->get_slice(i); };
+        auto may_be_extreme = [&](int64_t i) { return OP::is_sync(state_data, column->get_slice(i)); };
+        update_max_min_removable_cumulatively<OP>(state_data, columns[1], get_value, may_be_extreme,
+                                                  current_row_position, partition_start, partition_end,
+                                                  rows_start_offset, rows_end_offset, ignore_subtraction,
+                                                  ignore_addition);
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_binary());
         Slice value = column->get(row_num).get_slice();
@@ -345,6 +345,7 @@ public:
             // all not null
             if (!columns[0]->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
+                    prefetch_agg_state(states, state_offset, i, chunk_size);
                     this->data(states[i] + state_offset).is_null = false;
                     this->nested_function->update(ctx, &data_column,
                                                   this->data(states[i] + state_offset).mutable_nest_state(), i);
@@ -404,6 +405,7 @@ public:
             }
         } else {
             for (size_t i = 0; i < chunk_size; ++i) {
+                prefetch_agg_state(states, state_offset, i, chunk_size);
                 this->data(states[i] + state_offset).is_null = false;
                 this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
                                               i);
@@ -653,8 +655,9 @@ public:
                     this->data(state).is_null = false;
                     if (this->data(state).is_frame_init) {
                         // Since frame has been evaluated, we only need to update the boundary
+                        const Column* nested_columns[2] = {data_column, nullptr};
                         this->nested_function->update_state_removable_cumulatively(
-                                ctx, this->data(state).mutable_nest_state(), &data_column, current_row_position,
+                                ctx, this->data(state).mutable_nest_state(), nested_columns, current_row_position,
                                 partition_start, partition_end, rows_start_offset, rows_end_offset, ignore_subtraction,
                                 ignore_addition);
                     } else {
@@ -684,8 +687,9 @@ public:
                         is_current_frame_end_null = true;
                         this->data(state).null_count++;
                     }
+                    const Column* nested_columns[2] = {data_column, column->null_column().get()};
                     this->nested_function->update_state_removable_cumulatively(
-                            ctx, this->data(state).mutable_nest_state(), &data_column, current_row_position,
+                            ctx, this->data(state).mutable_nest_state(), nested_columns, current_row_position,
                             partition_start, partition_end, rows_start_offset, rows_end_offset,
                             is_previous_frame_start_null, is_current_frame_end_null);
                     if (frame_size != this->data(state).null_count) {
@@ -706,9 +710,11 @@ public:
                 }
             } else {
                 this->data(state).is_null = false;
+                const Column* nested_columns[2] = {columns[0], nullptr};
                 this->nested_function->update_state_removable_cumulatively(
-                        ctx, this->data(state).mutable_nest_state(), columns, current_row_position, partition_start,
-                        partition_end, rows_start_offset, rows_end_offset, ignore_subtraction, ignore_addition);
+                        ctx, this->data(state).mutable_nest_state(), nested_columns, current_row_position,
+                        partition_start, partition_end, rows_start_offset, rows_end_offset, ignore_subtraction,
+                        ignore_addition);
             }
         }
     }
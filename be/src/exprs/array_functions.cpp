@@ -515,6 +515,38 @@ private:
             targets_col = down_cast<const ConstColumn*>(&targets)->data_column().get();
         }
 
+        // A constant target is compared with all the elements in one loop the compiler vectorizes, then each
+        // array only looks for its first match with memchr.
+        if constexpr (ConstTarget && !NullableTarget &&
+                      (std::is_integral_v<ValueType> || std::is_floating_point_v<ValueType>)) {
+            const auto* elements_ptr = (const ValueType*)(elements.raw_data());
+            const ValueType target = *(const ValueType*)(targets_col->raw_data());
+            const size_t elements_end = offsets_ptr[num_array];
+            Filter matches(elements_end);
+            auto* matches_ptr = matches.data();
+            for (size_t j = offsets_ptr[0]; j < elements_end; j++) {
+                matches_ptr[j] = elements_ptr[j] == target;
+            }
+            if constexpr (NullableElement) {
+                const auto* nulls_ptr = null_map_elements->data();
+                for (size_t j = offsets_ptr[0]; j < elements_end; j++) {
+                    matches_ptr[j] &= !nulls_ptr[j];
+                }
+            }
+            for (size_t i = 0; i < num_array; i++) {
+                size_t offset = offsets_ptr[i];
+                size_t array_size = offsets_ptr[i + 1] - offset;
+                size_t pos = SIMD::find_nonzero(matches, offset, array_size);
+                bool found = pos < offset + array_size;
+                if constexpr (PositionEnabled) {
+                    result_ptr[i] = found ? pos - offset + 1 : 0;
+                } else {
+                    result_ptr[i] = found;
+                }
+            }
+            return result;
+        }
+
         for (size_t i = 0; i < num_array; i++) {
             size_t offset = offsets_ptr[i];
             size_t array_size = offsets_ptr[i + 1] - offsets_ptr[i];
@@ -1252,16 +1252,30 @@ public:
 
             bool has_data = false;
             if (null_ptr[i] != 1) {
-                for (size_t j = 0; j < array_size; j++) {
-                    if constexpr (HasNull) {
+                if constexpr (!HasNull) {
+                    has_data = array_size > 0;
+                    for (size_t j = 0; j < array_size; j++) {
+                        sum += elements_data[offset + j];
+                    }
+                } else if constexpr (lt_is_arithmetic<ElementType>) {
+                    // null elements are added as zero without branches, so the loop can be vectorized
+                    int64_t num_nulls = 0;
+                    for (size_t j = 0; j < array_size; j++) {
+                        bool is_null = elements_nulls[offset + j] != 0;
+                        num_nulls += is_null;
+                        sum += is_null ? ResultCppType{} : static_cast<ResultCppType>(elements_data[offset + j]);
+                    }
+                    has_data = num_nulls < array_size;
+                } else {
+                    for (size_t j = 0; j < array_size; j++) {
                         if (elements_nulls[offset + j] != 0) {
                             continue;
                         }
-                    }
 
-                    has_data = true;
-                    auto& value = elements_data[offset + j];
-                    sum += value;
+                        has_data = true;
+                        auto& value = elements_data[offset + j];
+                        sum += value;
+                    }
                 }
             }
 
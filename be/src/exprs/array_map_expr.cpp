@@ -113,6 +113,12 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_checked(ExprContext* context, Chunk*
         // put captured columns into the new chunk aligning with the first array's offsets
         std::vector<SlotId> slot_ids;
         _children[0]->get_slot_ids(&slot_ids);
+        const auto& offsets = input_array->offsets_column()->get_data();
+        // if every array has exactly one element, the captured columns are already aligned with the elements
+        bool one_element_arrays = !slot_ids.empty() && offsets.back() == input_array->size();
+        for (size_t i = 0; one_element_arrays && i < input_array->size(); i++) {
+            one_element_arrays = offsets[i + 1] - offsets[i] == 1;
+        }
         for (auto id : slot_ids) {
             DCHECK(id > 0);
             auto captured = chunk->get_column_by_slot_id(id);
@@ -120,7 +126,11 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_checked(ExprContext* context, Chunk*
                 return Status::InternalError(fmt::format(
                         "The size of the captured column {} is less than array's size.", captured->get_name()));
             }
-            cur_chunk->append_column(captured->replicate(input_array->offsets_column()->get_data()), id);
+            if (one_element_arrays && captured->size() == input_array->size()) {
+                cur_chunk->append_column(captured, id);
+            } else {
+                cur_chunk->append_column(captured->replicate(offsets), id);
+            }
         }
         if (cur_chunk->num_rows() <= chunk->num_rows() * 8) {
             ASSIGN_OR_RETURN(column, context->evaluate(_children[0], cur_chunk.get()));
@@ -207,7 +207,8 @@ class UnionNullableColumnBinaryFunction {
 public:
     template <LogicalType LType, LogicalType RType, LogicalType ResultType>
     static ColumnPtr evaluate(const ColumnPtr& v1, const ColumnPtr& v2) {
-        if (v1->only_null() || v2->only_null()) {
+        // all the results are null, skip computing them
+        if (ColumnHelper::is_all_null(v1) || ColumnHelper::is_all_null(v2)) {
             return ColumnHelper::create_const_null_column(v1->size());
         }
 
@@ -341,6 +342,10 @@ public:
             }
         }
 
+        if (ColumnHelper::is_all_null(v1) || ColumnHelper::is_all_null(v2)) {
+            return ColumnHelper::create_const_null_column(v1->size());
+        }
+
         const ColumnPtr& data1 = FunctionHelper::get_data_column_of_nullable(v1);
         const ColumnPtr& data2 = FunctionHelper::get_data_column_of_nullable(v2);
 
@@ -14,8 +14,12 @@
 
 #include "exprs/compound_predicate.h"
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/like_predicate.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -128,7 +132,20 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status open(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        if (scope == FunctionContext::FRAGMENT_LOCAL && !_in_pattern_chain) {
+            _try_build_pattern_matcher();
+        }
+        return Expr::open(state, context, scope);
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_pattern_matcher != nullptr) {
+            ASSIGN_OR_RETURN(auto value, _pattern_value->evaluate_checked(context, ptr));
+            return _pattern_matcher->match(value);
+        }
+
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -189,6 +206,80 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // Collect the leaves of the OR chain rooted at this node, and the OR nodes inside of it.
+    void _collect_or_chain(std::vector<Expr*>* leaves, std::vector<VectorizedOrCompoundPredicate*>* inner_ors) {
+        for (auto child : _children) {
+            auto* or_child = dynamic_cast<VectorizedOrCompoundPredicate*>(child);
+            if (or_child != nullptr) {
+                inner_ors->emplace_back(or_child);
+                or_child->_collect_or_chain(leaves, inner_ors);
+            } else {
+                leaves->emplace_back(child);
+            }
+        }
+    }
+
+    // `col LIKE 'p1' OR col REGEXP 'p2' OR ...` is evaluated by one hyperscan database if all the leaves are
+    // LIKE/REGEXP predicates with constant patterns on the same column, and there are enough of them.
+    void _try_build_pattern_matcher() {
+        if (config::like_multi_pattern_min_num <= 0) {
+            return;
+        }
+        std::vector<Expr*> leaves;
+        std::vector<VectorizedOrCompoundPredicate*> inner_ors;
+        _collect_or_chain(&leaves, &inner_ors);
+        if (leaves.size() < static_cast<size_t>(config::like_multi_pattern_min_num)) {
+            return;
+        }
+
+        std::vector<MultiPatternMatcher::Pattern> patterns;
+        Expr* value = nullptr;
+        for (auto leaf : leaves) {
+            auto* fn_call = dynamic_cast<VectorizedFunctionCallExpr*>(leaf);
+            if (fn_call == nullptr || fn_call->get_function_desc() == nullptr || leaf->get_num_children() != 2) {
+                return;
+            }
+            const auto& fn_name = fn_call->get_function_desc()->name;
+            if (fn_name != "LIKE" && fn_name != "REGEXP") {
+                return;
+            }
+            auto* col = leaf->get_child(0);
+            if (!col->is_slotref() || (value != nullptr && down_cast<ColumnRef*>(col)->slot_id() !=
+                                                                   down_cast<ColumnRef*>(value)->slot_id())) {
+                return;
+            }
+            value = col;
+            auto* pattern = leaf->get_child(1);
+            if (pattern->node_type() != TExprNodeType::STRING_LITERAL) {
+                return;
+            }
+            auto pattern_column = pattern->evaluate_checked(nullptr, nullptr);
+            if (!pattern_column.ok() || pattern_column.value()->only_null()) {
+                return;
+            }
+            auto pattern_value = ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern_column.value());
+            patterns.push_back({pattern_value.to_string(), fn_name == "LIKE"});
+        }
+
+        auto matcher = std::make_shared<MultiPatternMatcher>();
+        auto st = matcher->compile(patterns);
+        if (!st.ok()) {
+            VLOG_QUERY << "can't evaluate or predicate with multi-pattern matching: " << st;
+            return;
+        }
+        _pattern_value = value;
+        _pattern_matcher = std::move(matcher);
+        for (auto* inner_or : inner_ors) {
+            inner_or->_in_pattern_chain = true;
+        }
+    }
+
+    // set if this node is inside an OR chain evaluated by the pattern matcher of its root.
+    bool _in_pattern_chain = false;
+    Expr* _pattern_value = nullptr;
+    std::shared_ptr<MultiPatternMatcher> _pattern_matcher;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -30,6 +30,11 @@
 #include "util/dispatch.h"
 #include "util/percentile_value.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 template <bool isConstC0, bool isConst1, LogicalType Type>
@@ -71,11 +76,78 @@ struct SelectIfOP {
                                                 \
     virtual Expr* clone(ObjectPool* pool) const override { return pool->add(new NAME(*this)); }
 
+#ifdef STARROCKS_JIT_ENABLE
+// The conditional functions only pick one of their children, they are compiled as selects so that the whole
+// expression tree around them can be compiled into one function. Like logical predicates they bring no benefit
+// of their own.
+static JitScore compute_children_jit_score(RuntimeState* state, const std::vector<Expr*>& children) {
+    JitScore jit_score = {0, 0};
+    for (auto child : children) {
+        auto tmp = child->compute_jit_score(state);
+        jit_score.score += tmp.score;
+        jit_score.num += tmp.num;
+    }
+    jit_score.num++;
+    return jit_score;
+}
+
+static llvm::Value* is_null_cond(llvm::IRBuilder<>& b, llvm::Value* null_flag) {
+    return b.CreateICmpNE(null_flag, llvm::ConstantInt::get(b.getInt8Ty(), 0));
+}
+
+static std::string conditional_jit_func_name(RuntimeState* state, const std::string& name, const Expr* expr) {
+    std::stringstream out;
+    out << "{" << name << "(";
+    for (int i = 0; i < expr->get_num_children(); i++) {
+        out << (i > 0 ? ", " : "") << expr->get_child(i)->jit_func_name(state);
+    }
+    out << ")}" << (expr->is_constant() ? "c:" : "") << (expr->is_nullable() ? "n:" : "")
+        << expr->type().debug_string();
+    return out.str();
+}
+
+#define DEFINE_CONDITIONAL_JIT_FN(NAME, COND_TYPE)                                                        \
+    bool is_compilable(RuntimeState* state) const override {                                              \
+        return state->can_jit_expr(CompilableExprType::CONDITION) && IRHelper::support_jit(COND_TYPE) &&   \
+               IRHelper::support_jit(Type);                                                               \
+    }                                                                                                     \
+                                                                                                          \
+    JitScore compute_jit_score(RuntimeState* state) const override {                                      \
+        if (!is_compilable(state)) {                                                                      \
+            return {0, 0};                                                                                \
+        }                                                                                                 \
+        return compute_children_jit_score(state, _children);                                              \
+    }                                                                                                     \
+                                                                                                          \
+    std::string jit_func_name_impl(RuntimeState* state) const override {                                  \
+        return conditional_jit_func_name(state, NAME, this);                                              \
+    }
+#endif
+
 template <LogicalType Type>
 class VectorizedIfNullExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfNullExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    DEFINE_CONDITIONAL_JIT_FN("ifnull", Type)
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (lt_is_number<Type>) {
+            ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx));
+            ASSIGN_OR_RETURN(auto rhs, _children[1]->generate_ir(context, jit_ctx));
+            auto& b = jit_ctx->builder;
+            auto* lhs_null = is_null_cond(b, lhs.null_flag);
+            LLVMDatum result(b);
+            result.value = b.CreateSelect(lhs_null, rhs.value, lhs.value);
+            result.null_flag = b.CreateSelect(lhs_null, rhs.null_flag, lhs.null_flag);
+            return result;
+        } else {
+            return Status::NotSupported("JIT of ifnull not support");
+        }
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto lhs, _children[0]->evaluate_checked(context, ptr));
 
@@ -146,6 +218,33 @@ class VectorizedNullIfExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedNullIfExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    DEFINE_CONDITIONAL_JIT_FN("nullif", Type)
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (lt_is_number<Type>) {
+            ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx));
+            ASSIGN_OR_RETURN(auto rhs, _children[1]->generate_ir(context, jit_ctx));
+            auto& b = jit_ctx->builder;
+            llvm::Value* equal = nullptr;
+            if constexpr (lt_is_float<Type>) {
+                equal = b.CreateFCmpOEQ(lhs.value, rhs.value);
+            } else {
+                equal = b.CreateICmpEQ(lhs.value, rhs.value);
+            }
+            // null if lhs is null or rhs is not null and equals lhs
+            auto* to_null = b.CreateOr(is_null_cond(b, lhs.null_flag),
+                                       b.CreateAnd(b.CreateNot(is_null_cond(b, rhs.null_flag)), equal));
+            LLVMDatum result(b);
+            result.value = lhs.value;
+            result.null_flag = b.CreateZExt(to_null, b.getInt8Ty());
+            return result;
+        } else {
+            return Status::NotSupported("JIT of nullif not support");
+        }
+    }
+#endif
+
     // NullIF: return null if lhs == rhs else return lhs
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto lhs, _children[0]->evaluate_checked(context, ptr));
@@ -221,6 +320,28 @@ class VectorizedIfExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    DEFINE_CONDITIONAL_JIT_FN("if", TYPE_BOOLEAN)
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (lt_is_number<Type>) {
+            ASSIGN_OR_RETURN(auto cond, _children[0]->generate_ir(context, jit_ctx));
+            ASSIGN_OR_RETURN(auto lhs, _children[1]->generate_ir(context, jit_ctx));
+            ASSIGN_OR_RETURN(auto rhs, _children[2]->generate_ir(context, jit_ctx));
+            auto& b = jit_ctx->builder;
+            // a null condition takes the else branch
+            auto* take_lhs = b.CreateAnd(b.CreateNot(is_null_cond(b, cond.null_flag)),
+                                         IRHelper::bool_to_cond(b, cond.value));
+            LLVMDatum result(b);
+            result.value = b.CreateSelect(take_lhs, lhs.value, rhs.value);
+            result.null_flag = b.CreateSelect(take_lhs, lhs.null_flag, rhs.null_flag);
+            return result;
+        } else {
+            return Status::NotSupported("JIT of if not support");
+        }
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto bhs, _children[0]->evaluate_checked(context, ptr));
         int true_count = ColumnHelper::count_true_with_notnull(bhs);
@@ -377,6 +498,32 @@ class VectorizedCoalesceExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedCoalesceExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    DEFINE_CONDITIONAL_JIT_FN("coalesce", Type)
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (lt_is_number<Type>) {
+            std::vector<LLVMDatum> datums;
+            datums.reserve(_children.size());
+            for (auto child : _children) {
+                ASSIGN_OR_RETURN(auto datum, child->generate_ir(context, jit_ctx));
+                datums.emplace_back(std::move(datum));
+            }
+            auto& b = jit_ctx->builder;
+            // fold from the last child, so the first not null child wins
+            LLVMDatum result = datums.back();
+            for (int i = static_cast<int>(datums.size()) - 2; i >= 0; i--) {
+                auto* is_null = is_null_cond(b, datums[i].null_flag);
+                result.value = b.CreateSelect(is_null, result.value, datums[i].value);
+                result.null_flag = b.CreateSelect(is_null, result.null_flag, datums[i].null_flag);
+            }
+            return result;
+        } else {
+            return Status::NotSupported("JIT of coalesce not support");
+        }
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         std::vector<ColumnPtr> columns;
         for (int i = 0; i < _children.size(); ++i) {
@@ -485,6 +632,9 @@ private:
 };
 
 #undef DEFINE_CLASS_CONSTRUCT_FN
+#ifdef STARROCKS_JIT_ENABLE
+#undef DEFINE_CONDITIONAL_JIT_FN
+#endif
 
 #define CASE_TYPE(TYPE, CLASS)        \
     case TYPE: {                      \
@@ -113,6 +113,25 @@ struct DecimalBinaryFunction {
         return false;
     }
 
+    // Upper bound of the bit width of |data[i]|, all the values satisfy |data[i]| <= 2^result.
+    // x ^ (x >> (N-1)) is x for non-negative x and |x|-1 for negative x, OR-ing them keeps the loop
+    // branch-free.
+    template <typename CppType>
+    static inline int abs_bit_width(const CppType* data, size_t num_rows) {
+        CppType acc = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            acc |= data[i] ^ (data[i] >> (sizeof(CppType) * 8 - 1));
+        }
+        if constexpr (sizeof(CppType) == sizeof(int128_t)) {
+            auto high = static_cast<uint64_t>(acc >> 64);
+            auto low = static_cast<uint64_t>(acc);
+            return high != 0 ? 128 - __builtin_clzll(high) : (low != 0 ? 64 - __builtin_clzll(low) : 0);
+        } else {
+            auto value = static_cast<uint64_t>(acc);
+            return value != 0 ? 64 - __builtin_clzll(value) : 0;
+        }
+    }
+
     template <bool lhs_is_const, bool rhs_is_const, LogicalType LhsType, LogicalType RhsType, LogicalType ResultType>
     static inline ColumnPtr evaluate(const ColumnPtr& lhs, const ColumnPtr& rhs) {
         using ResultCppType = RunTimeCppType<ResultType>;
@@ -124,6 +143,19 @@ struct DecimalBinaryFunction {
         auto rhs_data = &rhs_column->get_data().front();
 
         const auto num_rows = std::max(lhs->size(), rhs->size());
+
+        if constexpr (is_mul_op<Op> && check_overflow<overflow_mode>) {
+            // The result type of a multiplication is always widened to the max precision, so the declared
+            // precision of the operands says nothing about overflow. But the values are usually far from
+            // the limit (e.g. price * quantity): if |lhs| <= 2^a and |rhs| <= 2^b for all the rows and
+            // a + b < N - 1, no product can overflow and the per-row overflow check is skipped.
+            const int lhs_bits = abs_bit_width(lhs_data, lhs_is_const ? 1 : num_rows);
+            const int rhs_bits = abs_bit_width(rhs_data, rhs_is_const ? 1 : num_rows);
+            if (lhs_bits + rhs_bits < static_cast<int>(sizeof(ResultCppType) * 8) - 1) {
+                return DecimalBinaryFunction<OverflowMode::IGNORE, Op>::template evaluate<
+                        lhs_is_const, rhs_is_const, LhsType, RhsType, ResultType>(lhs, rhs);
+            }
+        }
         const auto lhs_scale = lhs_column->scale();
         const auto rhs_scale = rhs_column->scale();
         auto [precision, scale, adjust_scale] = compute_decimal_result_type<ResultCppType, Op>(lhs_scale, rhs_scale);
@@ -16,10 +16,14 @@
 
 #include <cstdint>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
+#include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/const_column.h"
+#include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/builtin_functions.h"
 #include "exprs/expr_context.h"
@@ -29,6 +33,7 @@
 #include "storage/rowset/bloom_filter.h"
 #include "types/logical_type.h"
 #include "util/failpoint/fail_point.h"
+#include "util/phmap/phmap.h"
 #include "util/slice.h"
 #include "util/utf8.h"
 
@@ -40,6 +45,32 @@ DEFINE_FAIL_POINT(expr_prepare_fragment_thread_local_call_failed);
 
 VectorizedFunctionCallExpr::VectorizedFunctionCallExpr(const TExprNode& node) : Expr(node) {}
 
+// The deterministic functions that cost much more per row than hashing the row, so evaluating them over
+// the distinct values of a repetitive string column pays off.
+static bool is_dict_evaluable_function(int64_t fid) {
+    switch (fid) {
+    case 30310:  /* split_part */
+    case 30320:  /* regexp_extract */
+    case 30321:  /* regexp_extract_all */
+    case 30330:  /* regexp_replace */
+    case 30333:  /* regexp_split */
+    case 30334:  /* regexp_split */
+    case 30410:  /* parse_url */
+    case 30411:  /* url_extract_parameter */
+    case 30412:  /* url_extract_host */
+    case 30422:  /* url_decode */
+    case 50240:  /* str_to_date */
+    case 110000: /* get_json_int */
+    case 110001: /* get_json_double */
+    case 110002: /* get_json_string */
+    case 110020: /* get_json_object */
+    case 110022: /* get_json_int returning bigint */
+        return true;
+    default:
+        return false;
+    }
+}
+
 const FunctionDescriptor* VectorizedFunctionCallExpr::_get_function_by_fid(const TFunction& fn) {
     // branch-3.0 is 150102~150104, branch-3.1 is 150103~150105
     // refs: https://github.com/StarRocks/starrocks/pull/17803
@@ -115,6 +146,7 @@ Status VectorizedFunctionCallExpr::prepare(starrocks::RuntimeState* state, starr
     _is_returning_random_value = _fn.fid == 10300 /* rand */ || _fn.fid == 10301 /* random */ ||
                                  _fn.fid == 10302 /* rand */ || _fn.fid == 10303 /* random */ ||
                                  _fn.fid == 100015 /* uuid */ || _fn.fid == 100016 /* uniq_id */;
+    _is_dict_evaluable = is_dict_evaluable_function(_fn.fid);
 
     return Status::OK();
 }
@@ -210,23 +242,128 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     }
 #endif
 
-    StatusOr<ColumnPtr> result;
-    if (_fn_desc->exception_safe) {
-        result = _fn_desc->scalar_function(fn_ctx, args);
-    } else {
-        SCOPED_SET_CATCHED(false);
-        result = _fn_desc->scalar_function(fn_ctx, args);
+    ColumnPtr result;
+    if (_is_dict_evaluable) {
+        ASSIGN_OR_RETURN(result, _evaluate_on_distinct_values(fn_ctx, args));
+    }
+    if (result == nullptr) {
+        ASSIGN_OR_RETURN(result, _call_function(fn_ctx, args));
     }
-    RETURN_IF_ERROR(result);
     if (_fn_desc->check_overflow) {
-        RETURN_IF_ERROR(result.value()->capacity_limit_reached());
+        RETURN_IF_ERROR(result->capacity_limit_reached());
     }
 
     // For no args function call (pi, e)
-    if (result.value()->is_constant() && ptr != nullptr) {
-        result.value()->resize(ptr->num_rows());
+    if (result->is_constant() && ptr != nullptr) {
+        result->resize(ptr->num_rows());
+    }
+    RETURN_IF_ERROR(result->unfold_const_children(_type));
+    return result;
+}
+
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::_call_function(FunctionContext* fn_ctx, const Columns& args) {
+    if (_fn_desc->exception_safe) {
+        return _fn_desc->scalar_function(fn_ctx, args);
+    }
+    SCOPED_SET_CATCHED(false);
+    return _fn_desc->scalar_function(fn_ctx, args);
+}
+
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::_evaluate_on_distinct_values(FunctionContext* fn_ctx,
+                                                                             const Columns& args) {
+    double max_distinct_ratio = config::function_dict_eval_max_distinct_ratio;
+    size_t num_rows = args.empty() ? 0 : args[0]->size();
+    if (max_distinct_ratio <= 0 || num_rows == 0 || num_rows < config::function_dict_eval_min_rows) {
+        return nullptr;
+    }
+    int input_idx = -1;
+    for (int i = 0; i < args.size(); i++) {
+        if (args[i]->is_constant()) {
+            continue;
+        }
+        if (input_idx >= 0) {
+            return nullptr;
+        }
+        input_idx = i;
+    }
+    if (input_idx < 0 || !ColumnHelper::get_data_column(args[input_idx].get())->is_binary()) {
+        return nullptr;
+    }
+    if (_dict_eval_backoff.skip_chunks.load(std::memory_order_relaxed) > 0) {
+        _dict_eval_backoff.skip_chunks.fetch_sub(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const auto* input = args[input_idx].get();
+    const auto* binary = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(input));
+    const NullData* nulls = nullptr;
+    if (input->is_nullable() && input->has_null()) {
+        nulls = &down_cast<const NullableColumn*>(input)->immutable_null_column_data();
+    }
+
+    // stop as soon as there are too many distinct values, so a high cardinality chunk only pays for
+    // hashing a part of its rows.
+    const auto max_distinct = static_cast<size_t>(num_rows * max_distinct_ratio);
+    phmap::flat_hash_map<Slice, uint32_t, SliceHashWithSeed<PhmapSeed1>, SliceEqual> dict;
+    auto distinct_values = BinaryColumn::create();
+    std::vector<uint32_t> codes(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        if (nulls != nullptr && (*nulls)[i]) {
+            continue;
+        }
+        Slice value = binary->get_slice(i);
+        auto [iter, inserted] = dict.emplace(value, distinct_values->size());
+        if (inserted) {
+            if (dict.size() > max_distinct) {
+                _dict_eval_backoff.on_fallback();
+                return nullptr;
+            }
+            distinct_values->append(value);
+        }
+        codes[i] = iter->second;
+    }
+
+    _dict_eval_backoff.fallbacks.store(0, std::memory_order_relaxed);
+
+    // null rows are mapped to a null value appended to the distinct values, the function decides what
+    // a null input results in. A nullable input stays nullable even without nulls, as the function may
+    // return a nullable result only for a nullable input.
+    size_t num_distinct = distinct_values->size();
+    ColumnPtr dict_column = std::move(distinct_values);
+    if (input->is_nullable()) {
+        dict_column = NullableColumn::create(dict_column, NullColumn::create(num_distinct, 0));
+    }
+    if (nulls != nullptr) {
+        dict_column->append_nulls(1);
+        for (size_t i = 0; i < num_rows; i++) {
+            if ((*nulls)[i]) {
+                codes[i] = num_distinct;
+            }
+        }
+        num_distinct++;
+    }
+
+    Columns dict_args;
+    dict_args.reserve(args.size());
+    for (int i = 0; i < args.size(); i++) {
+        if (i == input_idx) {
+            dict_args.emplace_back(dict_column);
+        } else {
+            dict_args.emplace_back(
+                    ConstColumn::create(down_cast<const ConstColumn*>(args[i].get())->data_column(), num_distinct));
+        }
+    }
+    ASSIGN_OR_RETURN(ColumnPtr dict_result, _call_function(fn_ctx, dict_args));
+    if (dict_result->is_constant()) {
+        dict_result->resize(num_rows);
+        return dict_result;
+    }
+    ColumnPtr result = dict_result->clone_empty();
+    result->reserve(num_rows);
+    result->append_selective(*dict_result, codes.data(), 0, num_rows);
+    if (input->is_nullable()) {
+        result = NullableColumn::wrap_if_necessary(std::move(result));
     }
-    RETURN_IF_ERROR(result.value()->unfold_const_children(_type));
     return result;
 }
 
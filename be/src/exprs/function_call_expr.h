@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+
 #include "common/object_pool.h"
 #include "exprs/agg_state_function.h"
 #include "exprs/builtin_functions.h"
@@ -59,10 +62,39 @@ private:
     const FunctionDescriptor* _get_function(const TFunction& fn, const std::vector<TypeDescriptor>& arg_types,
                                             const TypeDescriptor& result_type, std::vector<bool> arg_nullables);
 
+    StatusOr<ColumnPtr> _call_function(FunctionContext* fn_ctx, const Columns& args);
+
+    // Evaluate the function over the distinct values of its only non-constant argument and gather the
+    // results to the rows. Returns nullptr when the argument isn't a repetitive string column.
+    StatusOr<ColumnPtr> _evaluate_on_distinct_values(FunctionContext* fn_ctx, const Columns& args);
+
     const FunctionDescriptor* _fn_desc{nullptr};
 
     bool _is_returning_random_value = false;
 
+    // deterministic and expensive enough to be evaluated over the distinct values of its argument
+    bool _is_dict_evaluable = false;
+
+    // After the n-th high cardinality chunk in a row, the next 2^n chunks (at most 2^kMaxShift) are evaluated
+    // row by row without counting their distinct values. The drivers sharing the expr share the backoff, and a
+    // cloned expr starts over.
+    struct DictEvalBackoff {
+        static constexpr int32_t kMaxShift = 6;
+
+        DictEvalBackoff() = default;
+        DictEvalBackoff(const DictEvalBackoff& /*other*/) {}
+
+        void on_fallback() {
+            int32_t shift = std::min(fallbacks.load(std::memory_order_relaxed) + 1, kMaxShift);
+            fallbacks.store(shift, std::memory_order_relaxed);
+            skip_chunks.store(1 << shift, std::memory_order_relaxed);
+        }
+
+        std::atomic<int32_t> skip_chunks{0};
+        std::atomic<int32_t> fallbacks{0};
+    };
+    DictEvalBackoff _dict_eval_backoff;
+
     // only set when it's a agg state combinator function to track its lifecycle be with the expr
     std::shared_ptr<AggStateFunction> _agg_state_func = nullptr;
     // only set when it's a agg state combinator function to track its lifecycle be with the expr
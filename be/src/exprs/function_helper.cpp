@@ -28,11 +28,11 @@ NullColumnPtr FunctionHelper::union_nullable_column(const ColumnPtr& v1, const C
         const auto& n2 = ColumnHelper::as_raw_column<NullableColumn>(v2)->null_column();
         if (!v1->has_null()) {
             result = n2->clone();
-        }
-        if (!v2->has_null()) {
+        } else if (!v2->has_null()) {
             result = n1->clone();
+        } else {
+            return union_null_column(n1, n2);
         }
-        return union_null_column(n1, n2);
     } else if (v1->is_nullable()) {
         result = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column()->clone();
     } else if (v2->is_nullable()) {
@@ -81,6 +81,7 @@ enum CompilableExprType : int32_t {
     LOGICAL = 32,
     DIV = 64,
     MOD = 128,
+    CONDITION = 256, // if, ifnull, nullif, coalesce
 };
 
 class IRHelper {
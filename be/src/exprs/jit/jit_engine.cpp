@@ -66,6 +66,7 @@
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
 #include "util/mem_info.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -157,6 +158,13 @@ Status JITEngine::init() {
     llvm::InitializeNativeTargetAsmParser();
     llvm::InitializeNativeTargetDisassembler();
     llvm::sys::DynamicLibrary::LoadLibraryPermanently(nullptr);
+    if (config::jit_async_compile_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("jit_compile")
+                                .set_min_threads(1)
+                                .set_max_threads(config::jit_async_compile_thread_num)
+                                .set_max_queue_size(1024)
+                                .build(&_compile_pool));
+    }
     _initialized = true;
     _support_jit = true;
     return Status::OK();
@@ -189,6 +197,63 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     return Status::OK();
 }
 
+Status JITEngine::compile_scalar_function_async(ExprContext* context, JitObjectCache* obj, Expr* expr,
+                                                const std::vector<Expr*>& uncompilable_exprs) {
+    auto* instance = JITEngine::get_instance();
+    if (UNLIKELY(!instance->initialized())) {
+        return Status::JitCompileError("JIT engine is not initialized");
+    }
+    if (instance->_compile_pool == nullptr) {
+        return compile_scalar_function(context, obj, expr, uncompilable_exprs);
+    }
+    if (instance->lookup_function(obj)) {
+        return Status::OK();
+    }
+    const std::string& func_name = obj->get_func_name();
+    {
+        std::lock_guard<std::mutex> l(instance->_compiling_lock);
+        if (!instance->_compiling_funcs.insert(func_name).second) {
+            return Status::OK();
+        }
+    }
+    std::function<void()> finish = [instance, func_name]() {
+        std::lock_guard<std::mutex> l(instance->_compiling_lock);
+        instance->_compiling_funcs.erase(func_name);
+    };
+    DeferOp defer_finish([&]() {
+        if (finish) {
+            finish();
+        }
+    });
+
+    // the object cache of the task must outlive the engine, the one of the caller belongs to the query.
+    auto task_obj = std::make_shared<JitObjectCache>(func_name, instance->_func_cache);
+    ASSIGN_OR_RETURN(std::shared_ptr<Engine> engine, Engine::create(*task_obj))
+    RETURN_IF_ERROR(generate_scalar_function_ir(context, *engine->module(), expr, uncompilable_exprs, task_obj.get()));
+    RETURN_IF_ERROR(instance->_compile_pool->submit_func([engine, task_obj, finish]() mutable {
+        auto start = MonotonicNanos();
+        auto st = engine->optimize_and_finalize_module();
+        if (st.ok()) {
+            auto function = engine->get_compiled_func(task_obj->get_func_name());
+            st = function.ok() ? task_obj->register_func(function.value()) : function.status();
+        }
+        engine.reset();
+        if (!st.ok()) {
+            LOG(INFO) << "JIT: async JIT compile failed, time cost: " << (MonotonicNanos() - start) / 1000000.0
+                      << " ms, func: " << task_obj->get_func_name() << " Reason: " << st;
+        }
+        finish();
+    }));
+    // the task owns the compiling mark now
+    finish = nullptr;
+    return Status::OK();
+}
+
+bool JITEngine::is_compiling(const std::string& func_name) {
+    std::lock_guard<std::mutex> l(_compiling_lock);
+    return _compiling_funcs.count(func_name) > 0;
+}
+
 std::string JITEngine::dump_module_ir(const llvm::Module& module) {
     std::string ir;
     llvm::raw_string_ostream stream(ir);
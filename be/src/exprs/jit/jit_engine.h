@@ -25,12 +25,14 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
 #include "exprs/expr_context.h"
 #include "exprs/jit/ir_helper.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -90,6 +92,15 @@ public:
     static Status compile_scalar_function(ExprContext* context, JitObjectCache* obj, Expr* expr,
                                           const std::vector<Expr*>& uncompilable_exprs);
 
+    // Generate the IR of the expr in the caller and leave the optimization and code generation, which take most of
+    // the time, to the compile pool. The function is registered into the LRU cache when it's done, so |obj| is only
+    // filled if the function is already cached. Callers poll the cache with `lookup_function` until
+    // `is_compiling` turns false.
+    static Status compile_scalar_function_async(ExprContext* context, JitObjectCache* obj, Expr* expr,
+                                                const std::vector<Expr*>& uncompilable_exprs);
+
+    bool is_compiling(const std::string& func_name);
+
     bool lookup_function(JitObjectCache* const obj);
 
     Cache* get_func_cache() const { return _func_cache; }
@@ -137,6 +148,11 @@ private:
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
+
+    std::unique_ptr<ThreadPool> _compile_pool;
+    std::mutex _compiling_lock;
+    // functions being compiled in the compile pool, a function is compiled once no matter how many exprs wait for it.
+    std::unordered_set<std::string> _compiling_funcs;
 };
 
 } // namespace starrocks
@@ -22,6 +22,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exprs/anyval_util.h"
@@ -53,7 +54,10 @@ void JITExpr::set_uncompilable_children(RuntimeState* state) {
 Status JITExpr::prepare(RuntimeState* state, ExprContext* context) {
     RETURN_IF_ERROR(Expr::prepare(state, context));
     RETURN_IF_ERROR(prepare_impl(state, context));
-    if (_jit_function == nullptr) {
+    if (is_async_compiling()) {
+        // evaluate the original expr until the function is compiled, the uncompilable children are kept for it.
+        RETURN_IF_ERROR(_expr->prepare(state, context));
+    } else if (!is_jit_compiled()) {
         _children.clear();
         _children.push_back(_expr);
         // jitExpr becomes an empty node, fallback to original expr, which are prepared again in case of jit
@@ -80,7 +84,9 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
         auto expr_name = _expr->jit_func_name(state);
         _jit_obj_cache = std::make_unique<JitObjectCache>(expr_name, JITEngine::get_instance()->get_func_cache());
 
-        auto st = jit_engine->compile_scalar_function(context, _jit_obj_cache.get(), _expr, _children);
+        bool async = config::jit_async_compile;
+        auto st = async ? jit_engine->compile_scalar_function_async(context, _jit_obj_cache.get(), _expr, _children)
+                        : jit_engine->compile_scalar_function(context, _jit_obj_cache.get(), _expr, _children);
         auto elapsed = MonotonicNanos() - start;
         if (state->fragment_ctx() != nullptr) {
             state->fragment_ctx()->update_jit_profile(elapsed);
@@ -88,12 +94,16 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
         if (!st.ok()) {
             LOG(INFO) << "JIT: JIT compile failed, time cost: " << elapsed / 1000000.0 << " ms"
                       << " Reason: " << st;
+        } else if (async && _jit_obj_cache->get_func() == nullptr) {
+            VLOG_QUERY << "JIT: JIT compile in background, time cost: " << elapsed / 1000000.0
+                       << " ms :" << _jit_obj_cache->get_func_name();
+            _async_compiling.store(true, std::memory_order_release);
         } else {
             VLOG_QUERY << "JIT: JIT compile success, time cost: " << elapsed / 1000000.0
                        << " ms :" << _jit_obj_cache->get_func_name()
                        << " , mem cost: " << _jit_obj_cache->get_code_size();
-            _jit_function = _jit_obj_cache->get_func();
-            if (_jit_function == nullptr) {
+            _jit_function.store(_jit_obj_cache->get_func(), std::memory_order_release);
+            if (!is_jit_compiled()) {
                 return Status::RuntimeError("JIT func must be not null");
             }
         }
@@ -101,9 +111,32 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
     return Status::OK();
 }
 
+void JITExpr::_try_swap_in_async_function() {
+    // another driver is checking, just evaluate this chunk interpreted
+    std::unique_lock<std::mutex> l(_async_lock, std::try_to_lock);
+    if (!l.owns_lock() || !is_async_compiling()) {
+        return;
+    }
+    auto* jit_engine = JITEngine::get_instance();
+    // check the compiling mark first, the function is registered before the mark is cleared.
+    bool compiling = jit_engine->is_compiling(_jit_obj_cache->get_func_name());
+    if (jit_engine->lookup_function(_jit_obj_cache.get())) {
+        VLOG_QUERY << "JIT: swap in background compiled function: " << _jit_obj_cache->get_func_name();
+        _jit_function.store(_jit_obj_cache->get_func(), std::memory_order_release);
+        _async_compiling.store(false, std::memory_order_release);
+    } else if (!compiling) {
+        // the compilation failed or the function is evicted already, stay with the original expr.
+        _async_compiling.store(false, std::memory_order_release);
+    }
+}
+
 StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, Chunk* ptr) {
+    if (UNLIKELY(_async_compiling.load(std::memory_order_relaxed))) {
+        _try_swap_in_async_function();
+    }
+    auto jit_function = _jit_function.load(std::memory_order_acquire);
     // If the expr fails to compile, evaluate using the original expr.
-    if (UNLIKELY(_jit_function == nullptr)) {
+    if (UNLIKELY(jit_function == nullptr)) {
         return _expr->evaluate_checked(context, ptr);
     }
 
@@ -167,7 +200,7 @@ StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, C
 
     unfold_ptr(result_column);
     // inputs are not empty.
-    _jit_function(num_rows, jit_columns.data());
+    jit_function(num_rows, jit_columns.data());
     //TODO: _jit_function return has_null
     if (is_nullable()) {
         down_cast<NullableColumn*>(result_column.get())->update_has_null();
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
 
 #include "common/object_pool.h"
@@ -36,7 +38,9 @@ public:
 
     Expr* clone(ObjectPool* pool) const override { return JITExpr::create(pool, _expr); }
 
-    bool is_jit_compiled() { return _jit_function != nullptr; }
+    bool is_jit_compiled() { return _jit_function.load(std::memory_order_acquire) != nullptr; }
+
+    bool is_async_compiling() const { return _async_compiling.load(std::memory_order_acquire); }
 
     void set_uncompilable_children(RuntimeState* state);
 
@@ -51,10 +55,16 @@ protected:
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
 
 private:
+    // Swap in the function compiled in the background once it's ready, it's checked before each chunk.
+    void _try_swap_in_async_function();
+
     // The original expression.
     Expr* _expr;
     bool _is_prepared = false;
-    JITScalarFunction _jit_function = nullptr;
+    // The expr is shared by the contexts of all drivers, they may swap in the async compiled function concurrently.
+    std::atomic<JITScalarFunction> _jit_function = nullptr;
+    std::atomic<bool> _async_compiling = false;
+    std::mutex _async_lock;
     std::unique_ptr<JitObjectCache> _jit_obj_cache;
 };
 
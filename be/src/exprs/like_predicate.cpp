@@ -625,10 +625,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(pattern, state->escape_char);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(const Slice& pattern, char escape_char) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -641,7 +644,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -682,4 +685,85 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+Status MultiPatternMatcher::compile(const std::vector<Pattern>& patterns) {
+    DCHECK(_database == nullptr);
+    std::vector<std::string> expressions;
+    std::vector<const char*> expression_ptrs;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    expressions.reserve(patterns.size());
+    for (const auto& p : patterns) {
+        unsigned int flag = HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_SINGLEMATCH;
+        if (p.is_like) {
+            expressions.emplace_back(LikePredicate::convert_like_pattern<true>(Slice(p.pattern), '\\'));
+            // a like pattern without '_' matches bytes only, same as the constant fast paths of like.
+            if (p.pattern.find('_') != std::string::npos) {
+                flag |= HS_FLAG_UTF8;
+            }
+        } else {
+            expressions.emplace_back(p.pattern);
+            flag |= HS_FLAG_UTF8;
+        }
+        flags.emplace_back(flag);
+        ids.emplace_back(ids.size());
+    }
+    for (const auto& e : expressions) {
+        expression_ptrs.emplace_back(e.c_str());
+    }
+
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expression_ptrs.data(), flags.data(), ids.data(), expression_ptrs.size(), HS_MODE_BLOCK,
+                         nullptr, &_database, &compile_err) != HS_SUCCESS) {
+        auto st = Status::NotSupported(fmt::format("Invalid hyperscan expressions: {}", compile_err->message));
+        hs_free_compile_error(compile_err);
+        _database = nullptr;
+        return st;
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        return Status::InternalError("Unable to allocate hyperscan scratch space");
+    }
+    return Status::OK();
+}
+
+StatusOr<ColumnPtr> MultiPatternMatcher::match(const ColumnPtr& value_column) const {
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] { hs_free_scratch(scratch); });
+
+    static char dummy_string_for_empty_value = 'A';
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        bool v = false;
+        auto value = value_viewer.value(row);
+        [[maybe_unused]] auto st = hs_scan(
+                _database, value.size > 0 ? value.data : &dummy_string_for_empty_value, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(st == HS_SUCCESS || st == HS_SCAN_TERMINATED) << " status: " << st;
+        result.append(v);
+    }
+    return result.build(value_column->is_constant());
+}
+
 } // namespace starrocks
@@ -30,6 +30,8 @@ namespace starrocks {
 
 class LikePredicate {
 public:
+    friend class MultiPatternMatcher;
+
     // Like method
     static Status like_prepare(FunctionContext* context, FunctionContext::FunctionStateScope scope);
 
@@ -151,6 +153,9 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(const Slice& pattern, char escape_char);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
@@ -219,4 +224,31 @@ private:
         }
     };
 };
+
+// Matches a string column against several LIKE and REGEXP patterns with one hyperscan database, a value
+// matches if any of the patterns matches. It evaluates an OR chain of LIKE/REGEXP predicates with constant
+// patterns on the same column, scanning each value once instead of once per pattern.
+class MultiPatternMatcher {
+public:
+    struct Pattern {
+        std::string pattern;
+        bool is_like;
+    };
+
+    MultiPatternMatcher() = default;
+    ~MultiPatternMatcher();
+
+    MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+    MultiPatternMatcher& operator=(const MultiPatternMatcher&) = delete;
+
+    Status compile(const std::vector<Pattern>& patterns);
+
+    StatusOr<ColumnPtr> match(const ColumnPtr& value_column) const;
+
+private:
+    hs_database_t* _database = nullptr;
+    // Prototype of the scratch space, match() clones it as it can be called by several drivers at once.
+    hs_scratch_t* _scratch = nullptr;
+};
+
 } // namespace starrocks
@@ -1943,7 +1943,7 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
@@ -2026,6 +2026,27 @@ static inline void ascii_reverse_per_slice(const char* src_begin, const char* sr
 
 static inline void utf8_reverse_per_slice(const char* src_begin, const char* src_end, char* dst_curr) {
     auto src_curr = src_begin;
+#if defined(__SSSE3__) && defined(__SSE2__)
+    // the ascii chunks of a utf8 string are reversed as the ascii strings, only the chunks
+    // containing multi-byte chars are reversed char by char.
+    constexpr auto SSE2_SIZE = sizeof(__m128i);
+    const auto ctrl_masks = _mm_set_epi64((__m64)0x00'01'02'03'04'05'06'07ull, (__m64)0x08'09'0a'0b'0c'0d'0e'0full);
+    while (src_end - src_curr >= static_cast<ptrdiff_t>(SSE2_SIZE)) {
+        auto bytes = _mm_loadu_si128((const __m128i*)src_curr);
+        if (_mm_movemask_epi8(bytes) == 0) {
+            dst_curr -= SSE2_SIZE;
+            _mm_storeu_si128((__m128i*)dst_curr, _mm_shuffle_epi8(bytes, ctrl_masks));
+            src_curr += SSE2_SIZE;
+            continue;
+        }
+        for (const char* chunk_end = src_curr + SSE2_SIZE; src_curr < chunk_end;) {
+            size_t char_size = std::min<size_t>(src_end - src_curr, UTF8_BYTE_LENGTH_TABLE[(uint8_t)*src_curr]);
+            dst_curr -= char_size;
+            strings::memcpy_inlined(dst_curr, src_curr, char_size);
+            src_curr += char_size;
+        }
+    }
+#endif
     for (auto char_size = 0; src_curr < src_end; src_curr += char_size) {
         char_size = UTF8_BYTE_LENGTH_TABLE[(uint8_t)*src_curr];
         // utf8 chars are copied from src_curr to  dst_curr one by one reversely, an illegal utf8 char
@@ -182,7 +182,7 @@ public:
         if (v1->is_nullable()) {
             auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
 
-            if (v1->size() == ColumnHelper::count_nulls(v1)) {
+            if (ColumnHelper::is_all_null(v1)) {
                 auto data = RunTimeColumnType<ResultType>::create();
                 data->resize(v1->size());
                 auto nul = NullColumn::create();
@@ -608,6 +608,9 @@ void OrcChunkReader::lazy_filter_on_cvb(Filter* filter) {
     if (filter->size() != true_size) {
         _batch->filterOnFields(filter->data(), filter->size(), true_size, _lazy_load_ctx->lazy_load_orc_positions,
                                true);
+    } else {
+        // the lazy columns may have been read for a sub range of the rows of the active columns
+        _batch->numElements = true_size;
     }
 }
 
@@ -0,0 +1,200 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "column/column.h"
+#include "exprs/expr.h"
+#include "exprs/in_const_predicate.hpp"
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "gutil/strings/substitute.h"
+#include "util/thrift_util.h"
+#include "util/xxh3.h"
+
+namespace starrocks::parquet {
+
+namespace {
+
+constexpr uint32_t kSalt[8] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                               0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+
+// The thrift header in front of the bitset is a handful of bytes, read a bit more to get it in one IO.
+constexpr size_t kHeaderReadSize = 64;
+
+// Physical representation a predicate value has to be hashed in.
+enum class PlainType { UNSUPPORTED, INT32, INT64, BYTE_ARRAY };
+
+// Only the types whose values are read without any conversion are supported, otherwise the value in the
+// predicate isn't the value that was hashed when the file was written.
+PlainType plain_type_of(const ParquetField& field, LogicalType ltype) {
+    const auto& element = field.schema_element;
+    if (!field.children.empty()) {
+        return PlainType::UNSUPPORTED;
+    }
+    switch (field.physical_type) {
+    case tparquet::Type::INT32:
+    case tparquet::Type::INT64: {
+        bool is_int32 = field.physical_type == tparquet::Type::INT32;
+        auto converted_type = is_int32 ? tparquet::ConvertedType::INT_32 : tparquet::ConvertedType::INT_64;
+        if (element.__isset.converted_type && element.converted_type != converted_type) {
+            return PlainType::UNSUPPORTED;
+        }
+        if (element.__isset.logicalType &&
+            !(element.logicalType.__isset.INTEGER && element.logicalType.INTEGER.isSigned)) {
+            return PlainType::UNSUPPORTED;
+        }
+        if (is_int32) {
+            return ltype == TYPE_INT ? PlainType::INT32 : PlainType::UNSUPPORTED;
+        }
+        return ltype == TYPE_BIGINT ? PlainType::INT64 : PlainType::UNSUPPORTED;
+    }
+    case tparquet::Type::BYTE_ARRAY:
+        if (element.__isset.converted_type && element.converted_type != tparquet::ConvertedType::UTF8) {
+            return PlainType::UNSUPPORTED;
+        }
+        if (element.__isset.logicalType && !element.logicalType.__isset.STRING) {
+            return PlainType::UNSUPPORTED;
+        }
+        return ltype == TYPE_VARCHAR ? PlainType::BYTE_ARRAY : PlainType::UNSUPPORTED;
+    default:
+        return PlainType::UNSUPPORTED;
+    }
+}
+
+template <LogicalType LT>
+bool hash_in_values(const Expr* root, std::vector<uint64_t>* hashes) {
+    const auto* in_pred = dynamic_cast<const VectorizedInConstPredicate<LT>*>(root);
+    if (in_pred == nullptr || in_pred->is_not_in()) {
+        return false;
+    }
+    for (const auto& v : in_pred->hash_set()) {
+        if constexpr (LT == TYPE_VARCHAR) {
+            hashes->emplace_back(ParquetBloomFilter::hash(v.data, v.size));
+        } else {
+            hashes->emplace_back(ParquetBloomFilter::hash(&v, sizeof(v)));
+        }
+    }
+    return true;
+}
+
+bool hash_eq_value(ExprContext* ctx, LogicalType ltype, std::vector<uint64_t>* hashes) {
+    Expr* value_expr = ctx->root()->get_child(1);
+    if (!value_expr->is_constant() || value_expr->type().type != ltype) {
+        return false;
+    }
+    auto res = value_expr->evaluate_const(ctx);
+    if (!res.ok() || res.value()->size() != 1 || res.value()->is_null(0)) {
+        return false;
+    }
+    Datum datum = res.value()->get(0);
+    if (ltype == TYPE_INT) {
+        int32_t v = datum.get_int32();
+        hashes->emplace_back(ParquetBloomFilter::hash(&v, sizeof(v)));
+    } else if (ltype == TYPE_BIGINT) {
+        int64_t v = datum.get_int64();
+        hashes->emplace_back(ParquetBloomFilter::hash(&v, sizeof(v)));
+    } else {
+        const Slice& v = datum.get_slice();
+        hashes->emplace_back(ParquetBloomFilter::hash(v.data, v.size));
+    }
+    return true;
+}
+
+} // namespace
+
+StatusOr<std::unique_ptr<ParquetBloomFilter>> ParquetBloomFilter::read(RandomAccessFile* file, size_t file_size,
+                                                                       int64_t offset) {
+    if (offset < 0 || static_cast<size_t>(offset) >= file_size) {
+        return Status::Corruption(
+                strings::Substitute("invalid bloom filter offset $0, file size $1", offset, file_size));
+    }
+    size_t read_size = std::min(kHeaderReadSize, file_size - offset);
+    std::string buffer(read_size, '\0');
+    RETURN_IF_ERROR(file->read_at_fully(offset, buffer.data(), read_size));
+
+    tparquet::BloomFilterHeader header;
+    uint32_t header_length = read_size;
+    RETURN_IF_ERROR(deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(buffer.data()), &header_length,
+                                           TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("unsupported bloom filter algorithm, hash or compression");
+    }
+    if (header.numBytes <= 0 || header.numBytes > MAXIMUM_BYTES || header.numBytes % BYTES_PER_BLOCK != 0 ||
+        offset + header_length + header.numBytes > file_size) {
+        return Status::Corruption(strings::Substitute("invalid bloom filter size $0", header.numBytes));
+    }
+
+    std::string bitset(header.numBytes, '\0');
+    size_t buffered = std::min<size_t>(read_size - header_length, header.numBytes);
+    memcpy(bitset.data(), buffer.data() + header_length, buffered);
+    if (buffered < bitset.size()) {
+        RETURN_IF_ERROR(file->read_at_fully(offset + header_length + buffered, bitset.data() + buffered,
+                                            bitset.size() - buffered));
+    }
+    return std::make_unique<ParquetBloomFilter>(std::move(bitset));
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::hash_predicate_values(ExprContext* ctx, const ParquetField& field,
+                                               std::vector<uint64_t>* hashes) {
+    const Expr* root = ctx->root();
+    bool is_in = root->node_type() == TExprNodeType::IN_PRED && root->op() == TExprOpcode::FILTER_IN;
+    bool is_eq = root->node_type() == TExprNodeType::BINARY_PRED && root->op() == TExprOpcode::EQ;
+    if ((!is_in && !is_eq) || root->get_child(0)->node_type() != TExprNodeType::SLOT_REF) {
+        return false;
+    }
+    LogicalType ltype = root->get_child(0)->type().type;
+    switch (plain_type_of(field, ltype)) {
+    case PlainType::INT32:
+        return is_in ? hash_in_values<TYPE_INT>(root, hashes) : hash_eq_value(ctx, ltype, hashes);
+    case PlainType::INT64:
+        return is_in ? hash_in_values<TYPE_BIGINT>(root, hashes) : hash_eq_value(ctx, ltype, hashes);
+    case PlainType::BYTE_ARRAY:
+        return is_in ? hash_in_values<TYPE_VARCHAR>(root, hashes) : hash_eq_value(ctx, ltype, hashes);
+    default:
+        return false;
+    }
+}
+
+void ParquetBloomFilter::insert_hash(uint64_t hash) {
+    uint32_t num_blocks = _bitset.size() / BYTES_PER_BLOCK;
+    uint32_t block_index = static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+    auto key = static_cast<uint32_t>(hash);
+    auto* block = reinterpret_cast<uint32_t*>(_bitset.data() + BYTES_PER_BLOCK * block_index);
+    for (int i = 0; i < 8; ++i) {
+        block[i] |= 1U << ((key * kSalt[i]) >> 27);
+    }
+}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    uint32_t num_blocks = _bitset.size() / BYTES_PER_BLOCK;
+    uint32_t block_index = static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+    auto key = static_cast<uint32_t>(hash);
+    const auto* block = reinterpret_cast<const uint32_t*>(_bitset.data() + BYTES_PER_BLOCK * block_index);
+    for (int i = 0; i < 8; ++i) {
+        if ((block[i] & (1U << ((key * kSalt[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace starrocks::parquet
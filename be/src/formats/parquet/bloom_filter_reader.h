@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "common/statusor.h"
+#include "exprs/expr_context.h"
+#include "formats/parquet/schema.h"
+
+namespace starrocks {
+class RandomAccessFile;
+
+namespace parquet {
+
+// Split block bloom filter of a column chunk, as defined by the Parquet spec.
+// The bit layout is the same as `BlockSplitBloomFilter` in storage/rowset, but Parquet picks the block
+// by multiply-shift instead of masking and hashes the plain encoded value with XXH64 (seed 0), so the
+// storage implementation can't be used to probe it directly.
+class ParquetBloomFilter {
+public:
+    static constexpr uint32_t BYTES_PER_BLOCK = 32;
+    static constexpr uint32_t MAXIMUM_BYTES = 128 * 1024 * 1024;
+
+    explicit ParquetBloomFilter(std::string bitset) : _bitset(std::move(bitset)) {}
+
+    // Read the filter located at |offset| (`ColumnMetaData.bloom_filter_offset`).
+    static StatusOr<std::unique_ptr<ParquetBloomFilter>> read(RandomAccessFile* file, size_t file_size,
+                                                              int64_t offset);
+
+    // Hash of a plain encoded value.
+    static uint64_t hash(const void* data, size_t size);
+
+    // Hashes of the values an equality or IN predicate in |ctx| compares |field| with. Returns false when
+    // the predicate isn't one of them or its values can't be mapped to the physical type of |field|.
+    static bool hash_predicate_values(ExprContext* ctx, const ParquetField& field, std::vector<uint64_t>* hashes);
+
+    void insert_hash(uint64_t hash);
+
+    bool test_hash(uint64_t hash) const;
+
+    size_t num_bytes() const { return _bitset.size(); }
+
+    const std::string& bitset() const { return _bitset; }
+
+private:
+    std::string _bitset;
+};
+
+} // namespace parquet
+} // namespace starrocks
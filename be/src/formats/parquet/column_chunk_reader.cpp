@@ -30,7 +30,9 @@
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "util/coding.h"
 #include "util/compression/block_compression.h"
 
 namespace starrocks::parquet {
@@ -50,7 +52,11 @@ ColumnChunkReader::ColumnChunkReader(level_t max_def_level, level_t max_rep_leve
     }
 }
 
-ColumnChunkReader::~ColumnChunkReader() = default;
+ColumnChunkReader::~ColumnChunkReader() {
+    if (_page_cache_handle != nullptr) {
+        _page_cache->release(_page_cache_handle);
+    }
+}
 
 Status ColumnChunkReader::init(int chunk_size) {
     int64_t start_offset = 0;
@@ -167,6 +173,35 @@ Status ColumnChunkReader::_read_and_decompress_page_data(uint32_t compressed_siz
     _opts.stats->request_bytes_read += read_size;
     _opts.stats->request_bytes_read_uncompressed += uncompressed_size;
 
+    if (_page_cache_handle != nullptr) {
+        _page_cache->release(_page_cache_handle);
+        _page_cache_handle = nullptr;
+    }
+    // Only compressed pages are cached, an uncompressed page is read zero copy most of the time.
+    std::string cache_key;
+    LazyLRUCache* cache = nullptr;
+    if (is_compressed && !_opts.page_cache_key_prefix.empty() &&
+        GlobalEnv::GetInstance()->parquet_page_cache()->enabled()) {
+        cache = GlobalEnv::GetInstance()->parquet_page_cache();
+    }
+    if (cache != nullptr) {
+        cache_key = _opts.page_cache_key_prefix;
+        put_fixed64_le(&cache_key, _page_reader->get_offset());
+        Cache::Handle* handle = cache->lookup(CacheKey(cache_key));
+        if (handle != nullptr) {
+            const auto* page = reinterpret_cast<const std::string*>(cache->value(handle));
+            if (page->size() == uncompressed_size) {
+                RETURN_IF_ERROR(_page_reader->skip_bytes(read_size));
+                _opts.stats->page_cache_hit_count += 1;
+                _page_cache = cache;
+                _page_cache_handle = handle;
+                _data = Slice(page->data(), page->size());
+                return Status::OK();
+            }
+            cache->release(handle);
+        }
+    }
+
     // check if we can zero copy read.
     Slice read_data;
     auto ret = _page_reader->peek(read_size);
@@ -187,6 +222,13 @@ Status ColumnChunkReader::_read_and_decompress_page_data(uint32_t compressed_siz
         _uncompressed_buf.reserve(uncompressed_size);
         _data = Slice(_uncompressed_buf.data(), uncompressed_size);
         RETURN_IF_ERROR(_compress_codec->decompress(read_data, &_data));
+        if (cache != nullptr) {
+            auto* page = new std::string(_data.data, _data.size);
+            int64_t mem_size = sizeof(std::string) + page->capacity();
+            cache->release(cache->insert(
+                    CacheKey(cache_key), page, cache_key.size() + page->size(), mem_size,
+                    [](const CacheKey& /*key*/, void* value) { delete reinterpret_cast<std::string*>(value); }));
+        }
     } else {
         _data = read_data;
     }
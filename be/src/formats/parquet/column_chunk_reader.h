@@ -32,6 +32,7 @@
 #include "formats/parquet/utils.h"
 #include "fs/fs.h"
 #include "gen_cpp/parquet_types.h"
+#include "runtime/lazy_lru_cache.h"
 #include "util/compression/block_compression.h"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
@@ -87,21 +88,7 @@ public:
         if (_current_row_group_no_null || _current_page_no_null) {
             return _cur_decoder->next_batch(n, content_type, dst);
         }
-        size_t idx = 0;
-        while (idx < n) {
-            bool is_null = is_nulls[idx++];
-            size_t run = 1;
-            while (idx < n && is_nulls[idx] == is_null) {
-                idx++;
-                run++;
-            }
-            if (is_null) {
-                dst->append_nulls(run);
-            } else {
-                RETURN_IF_ERROR(_cur_decoder->next_batch(run, content_type, dst));
-            }
-        }
-        return Status::OK();
+        return _cur_decoder->next_batch_with_nulls(n, is_nulls, content_type, dst);
     }
 
     Status decode_values(size_t n, ColumnContentType content_type, Column* dst) {
@@ -172,6 +159,10 @@ private:
 
     std::vector<uint8_t> _compressed_buf;
     std::vector<uint8_t> _uncompressed_buf;
+    // pins the cached page `_data` points to
+    // GlobalEnv::parquet_page_cache(), caching decompressed pages keyed by file version and page offset
+    LazyLRUCache* _page_cache = nullptr;
+    Cache::Handle* _page_cache_handle = nullptr;
 
     PageParseState _page_parse_state = INITIALIZED;
     Slice _data;
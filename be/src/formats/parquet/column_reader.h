@@ -63,6 +63,8 @@ struct ColumnReaderOptions {
     RandomAccessFile* file = nullptr;
     const tparquet::RowGroup* row_group_meta = nullptr;
     uint64_t first_row_index = 0;
+    // identifies the file version in the decompressed page cache, empty if its pages are not cached
+    std::string page_cache_key_prefix;
 };
 
 class StoredColumnReader;
@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "column/column.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/types.h"
@@ -27,6 +28,25 @@
 
 namespace starrocks::parquet {
 
+Status Decoder::next_batch_with_nulls(size_t count, const uint16_t* is_nulls, ColumnContentType content_type,
+                                      Column* dst) {
+    size_t idx = 0;
+    while (idx < count) {
+        bool is_null = is_nulls[idx++];
+        size_t run = 1;
+        while (idx < count && is_nulls[idx] == is_null) {
+            idx++;
+            run++;
+        }
+        if (is_null) {
+            dst->append_nulls(run);
+        } else {
+            RETURN_IF_ERROR(next_batch(run, content_type, dst));
+        }
+    }
+    return Status::OK();
+}
+
 using TypeEncodingPair = std::pair<tparquet::Type::type, tparquet::Encoding::type>;
 
 struct EncodingMapHash {
@@ -76,6 +76,12 @@ public:
     // It will return ERROR if caller wants to read out-of-bound data.
     virtual Status next_batch(size_t count, ColumnContentType content_type, Column* dst) = 0;
 
+    // Decode |count| values into |dst|, the i-th of which is null if is_nulls[i] is non-zero. Null
+    // values are not stored in the page, so only the non-null ones are consumed from the decoder.
+    // The default implementation calls `next_batch` once per run of non-null values.
+    virtual Status next_batch_with_nulls(size_t count, const uint16_t* is_nulls, ColumnContentType content_type,
+                                         Column* dst);
+
     virtual Status skip(size_t values_to_skip) = 0;
 
     // Currently, this function is only used to read dictionary values.
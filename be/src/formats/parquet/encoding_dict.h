@@ -137,6 +137,52 @@ public:
         return Status::OK();
     }
 
+    // Gather all the non-null values of the batch in one call, then spread them to their rows, instead of
+    // decoding every run of non-null values separately.
+    Status next_batch_with_nulls(size_t count, const uint16_t* is_nulls, ColumnContentType content_type,
+                                 Column* dst) override {
+        if (!dst->is_nullable()) {
+            return Decoder::next_batch_with_nulls(count, is_nulls, content_type, dst);
+        }
+        auto nullable_column = down_cast<NullableColumn*>(dst);
+        auto data_column = down_cast<FixedLengthColumn<T>*>(nullable_column->data_column().get());
+        auto& null_data = nullable_column->null_column()->get_data();
+
+        size_t null_count = 0;
+        for (size_t i = 0; i < count; i++) {
+            null_count += (is_nulls[i] != 0);
+        }
+
+        size_t cur_size = data_column->size();
+        data_column->resize_uninitialized(cur_size + count);
+        T* __restrict__ data = data_column->get_data().data() + cur_size;
+        null_data.resize(cur_size + count);
+        uint8_t* __restrict__ nulls = null_data.data() + cur_size;
+        for (size_t i = 0; i < count; i++) {
+            nulls[i] = (is_nulls[i] != 0);
+        }
+
+        size_t not_null_count = count - null_count;
+        if (not_null_count > 0) {
+            // decode the non-null values into the tail of the batch and move them forward in place,
+            // the read position never falls behind the write position.
+            auto ret = _rle_batch_reader.GetBatchWithDict(_dict.data(), _dict.size(), data + null_count,
+                                                          not_null_count);
+            if (UNLIKELY(ret != not_null_count)) {
+                return Status::InternalError("DictDecoder GetBatchWithDict failed");
+            }
+        }
+        for (size_t i = 0, j = null_count; i < count && i < j; i++) {
+            if (nulls[i]) {
+                data[i] = T{};
+            } else {
+                data[i] = data[j++];
+            }
+        }
+        nullable_column->set_has_null(null_count > 0);
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
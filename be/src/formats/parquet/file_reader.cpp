@@ -44,6 +44,7 @@
 #include "exprs/expr_context.h"
 #include "exprs/runtime_filter.h"
 #include "exprs/runtime_filter_bank.h"
+#include "formats/parquet/bloom_filter_reader.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
@@ -123,15 +124,15 @@ FileReader::FileReader(int chunk_size, RandomAccessFile* file, size_t file_size,
 
 FileReader::~FileReader() = default;
 
-std::string FileReader::_build_metacache_key() {
+std::string FileReader::_build_metacache_key(const std::string& suffix) {
+    DCHECK_EQ(2, suffix.size());
     auto& filename = _file->filename();
     std::string metacache_key;
     metacache_key.resize(14);
     char* data = metacache_key.data();
-    const std::string footer_suffix = "ft";
     uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
     memcpy(data, &hash_value, sizeof(hash_value));
-    memcpy(data + 8, footer_suffix.data(), footer_suffix.length());
+    memcpy(data + 8, suffix.data(), suffix.length());
     // The modification time is more appropriate to indicate the different file versions.
     // While some data source, such as Hudi, have no modification time because their files
     // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
@@ -262,7 +263,7 @@ Status FileReader::_get_footer() {
 
     BlockCache* cache = _cache;
     DataCacheHandle cache_handle;
-    std::string metacache_key = _build_metacache_key();
+    std::string metacache_key = _build_metacache_key("ft");
     {
         SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_cache_read_ns);
         Status st = cache->read_object(metacache_key, &cache_handle);
@@ -519,6 +520,46 @@ bool FileReader::_filter_group_with_more_filter(const tparquet::RowGroup& row_gr
     return false;
 }
 
+bool FileReader::_filter_group_with_bloom_filter(const tparquet::RowGroup& row_group) {
+    const TupleDescriptor& tuple_desc = *(_scanner_ctx->tuple_desc);
+    std::vector<uint64_t> hashes;
+    for (const auto& kv : _scanner_ctx->conjunct_ctxs_by_slot) {
+        SlotDescriptor* slot = tuple_desc.get_slot_by_id(kv.first);
+        if (slot == nullptr) continue;
+        const ParquetField* field = _meta_helper->get_parquet_field(slot->col_name());
+        if (field == nullptr) continue;
+
+        std::unique_ptr<ParquetBloomFilter> bloom_filter;
+        for (auto ctx : kv.second) {
+            hashes.clear();
+            if (!ParquetBloomFilter::hash_predicate_values(ctx, *field, &hashes)) continue;
+            if (bloom_filter == nullptr) {
+                std::unordered_map<std::string, size_t> column_name_2_pos_in_meta{};
+                std::vector<SlotDescriptor*> slot_v{slot};
+                _meta_helper->build_column_name_2_pos_in_meta(column_name_2_pos_in_meta, row_group, slot_v);
+                const tparquet::ColumnMetaData* column_meta =
+                        _meta_helper->get_column_meta(column_name_2_pos_in_meta, row_group, slot->col_name());
+                if (column_meta == nullptr || !column_meta->__isset.bloom_filter_offset) break;
+
+                SCOPED_RAW_TIMER(&_scanner_ctx->stats->group_bloom_filter_read_ns);
+                auto res = ParquetBloomFilter::read(_file, _file_size, column_meta->bloom_filter_offset);
+                if (!res.ok()) {
+                    VLOG(2) << "failed to read bloom filter of " << slot->col_name() << ": " << res.status();
+                    break;
+                }
+                bloom_filter = std::move(res).value();
+            }
+            bool maybe_exist = std::any_of(hashes.begin(), hashes.end(),
+                                           [&](uint64_t hash) { return bloom_filter->test_hash(hash); });
+            if (!maybe_exist) {
+                _scanner_ctx->stats->group_bloom_filter_skip += 1;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 // when doing row group filter, there maybe some error, but we'd better just ignore it instead of returning the error
 // status and lead to the query failed.
 bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
@@ -534,6 +575,10 @@ bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         return true;
     }
 
+    if (config::parquet_reader_bloom_filter_enable && _filter_group_with_bloom_filter(row_group)) {
+        return true;
+    }
+
     return false;
 }
 
@@ -666,6 +711,9 @@ Status FileReader::_init_group_readers() {
     _group_reader_param.file_metadata = _file_metadata.get();
     _group_reader_param.case_sensitive = fd_scanner_ctx.case_sensitive;
     _group_reader_param.lazy_column_coalesce_counter = fd_scanner_ctx.lazy_column_coalesce_counter;
+    if (config::parquet_page_cache_capacity > 0) {
+        _group_reader_param.page_cache_key_prefix = _build_metacache_key("pg");
+    }
     // for pageIndex
     _group_reader_param.min_max_conjunct_ctxs = fd_scanner_ctx.min_max_conjunct_ctxs;
 
@@ -744,13 +792,7 @@ Status FileReader::get_next(ChunkPtr* chunk) {
                 _scan_row_count += (*chunk)->num_rows();
             }
             if (status.is_end_of_file()) {
-                _row_group_readers[_cur_row_group_idx]->close();
-                _cur_row_group_idx++;
-                if (_cur_row_group_idx < _row_group_size) {
-                    // prepare new group
-                    RETURN_IF_ERROR(_row_group_readers[_cur_row_group_idx]->prepare());
-                }
-
+                RETURN_IF_ERROR(_advance_row_group());
                 return Status::OK();
             }
         } else {
@@ -766,6 +808,22 @@ Status FileReader::get_next(ChunkPtr* chunk) {
     return Status::EndOfFile("");
 }
 
+Status FileReader::_advance_row_group() {
+    _row_group_readers[_cur_row_group_idx]->close();
+    _cur_row_group_idx++;
+    while (_cur_row_group_idx < _row_group_size) {
+        auto& reader = _row_group_readers[_cur_row_group_idx];
+        if (!_filter_group_with_bloom_filter_min_max_conjuncts(*reader->row_group_metadata())) {
+            // prepare new group
+            return reader->prepare();
+        }
+        // the skipped group is never prepared, so there is nothing to close, its buffered io is released
+        // by the next group read
+        _cur_row_group_idx++;
+    }
+    return Status::OK();
+}
+
 Status FileReader::_exec_no_materialized_column_scan(ChunkPtr* chunk) {
     if (_scan_row_count < _total_row_count) {
         size_t read_size = 0;
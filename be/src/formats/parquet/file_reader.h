@@ -85,7 +85,8 @@ private:
     // get footer of parquet file from cache or parquet file
     Status _get_footer();
 
-    std::string _build_metacache_key();
+    // Key of the cached metadata of this file version, |suffix| tells the kind of the metadata apart.
+    std::string _build_metacache_key(const std::string& suffix);
 
     std::shared_ptr<MetaHelper> _build_meta_helper();
 
@@ -104,6 +105,13 @@ private:
 
     bool _filter_group_with_more_filter(const tparquet::RowGroup& row_group);
 
+    // filter by the split block bloom filters of the column chunks with equality and IN predicates
+    bool _filter_group_with_bloom_filter(const tparquet::RowGroup& row_group);
+
+    // Runtime filters like the TopN filter keep tightening while scanning, so check them again before
+    // preparing a row group and skip the ones that can't match any more.
+    Status _advance_row_group();
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -286,6 +286,7 @@ Status GroupReader::_init_column_readers() {
     opts.file = _param.file;
     opts.row_group_meta = _row_group_metadata;
     opts.first_row_index = _row_group_first_row;
+    opts.page_cache_key_prefix = _param.page_cache_key_prefix;
     for (const auto& column : _param.read_cols) {
         RETURN_IF_ERROR(_create_column_reader(column));
     }
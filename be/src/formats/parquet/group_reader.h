@@ -101,6 +101,9 @@ struct GroupReaderParam {
 
     // used for pageIndex
     std::vector<ExprContext*> min_max_conjunct_ctxs;
+
+    // identifies this file version in the decompressed page cache, empty if its pages are not cached
+    std::string page_cache_key_prefix;
 };
 
 class PageIndexReader;
@@ -121,6 +124,7 @@ public:
     void close();
     void collect_io_ranges(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                            ColumnIOType type = ColumnIOType::PAGES);
+    const tparquet::RowGroup* row_group_metadata() const { return _row_group_metadata; }
 
 private:
     void _set_end_offset(int64_t value) { _end_offset = value; }
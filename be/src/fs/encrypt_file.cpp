@@ -23,6 +23,7 @@
 #include <bvar/bvar.h>
 
 #include "common/config.h"
+#include "common/statusor.h"
 #include "fmt/format.h"
 #include "fs/encrypt_file.h"
 #include "gutil/endian.h"
@@ -93,6 +94,47 @@ std::string get_openssl_errors() {
 
 const uint8_t kEncryptionBlockSize = 16;
 
+struct ThreadCipherContext {
+    EVP_CIPHER_CTX* ctx = nullptr;
+    const EVP_CIPHER* cipher = nullptr;
+    std::string key;
+
+    ~ThreadCipherContext() {
+        OPENSSL_cleanse(key.data(), key.size());
+        if (ctx != nullptr) {
+            EVP_CIPHER_CTX_free(ctx);
+        }
+    }
+};
+
+// Returns the cipher context of the calling thread for encryption or decryption, set up with the key of 'eh' and
+// 'iv'. Every read and write of an encrypted file goes through here, so the context is reused instead of allocated
+// per call, and the key schedule is only expanded again when the key differs from the previous one.
+StatusOr<EVP_CIPHER_CTX*> thread_cipher_ctx(const FileEncryptionInfo& eh, const EVP_CIPHER* cipher, const uint8_t* iv,
+                                            bool encrypt) {
+    static thread_local ThreadCipherContext contexts[2];
+    auto& c = contexts[encrypt ? 1 : 0];
+    if (c.ctx == nullptr) {
+        c.ctx = EVP_CIPHER_CTX_new();
+        if (!c.ctx) {
+            return Status::InternalError("failed to create cipher context");
+        }
+    }
+    if (c.cipher == cipher && c.key == eh.key) {
+        OPENSSL_RET_NOT_OK(EVP_CipherInit_ex(c.ctx, nullptr, nullptr, nullptr, iv, encrypt ? 1 : 0),
+                           "Failed to reset initialization vector");
+    } else {
+        c.cipher = nullptr;
+        OPENSSL_RET_NOT_OK(EVP_CipherInit_ex(c.ctx, cipher, nullptr, eh.key_bytes(), iv, encrypt ? 1 : 0),
+                           encrypt ? "Failed to initialize encryption" : "Failed to initialize decryption");
+        OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(c.ctx, 0), "failed to disable padding");
+        OPENSSL_cleanse(c.key.data(), c.key.size());
+        c.key = eh.key;
+        c.cipher = cipher;
+    }
+    return c.ctx;
+}
+
 // Encrypts the data in 'cleartext' and writes it to 'ciphertext'. It requires
 // 'offset' to be set in the file as it's used to set the initialization vector.
 Status DoEncryptV(const FileEncryptionInfo& eh, uint64_t offset, const Slice* cleartext, Slice* ciphertext, size_t n) {
@@ -106,13 +148,7 @@ Status DoEncryptV(const FileEncryptionInfo& eh, uint64_t offset, const Slice* cl
         return Status::InternalError(
                 fmt::format("get cipher for algorithm {} key_size: {} failed", eh.algorithm, eh.key.size()));
     }
-    auto ctx = EVP_CIPHER_CTX_new();
-    if (!ctx) {
-        return Status::InternalError("failed to create cipher context");
-    }
-    DeferOp cleanup_ctx([&ctx]() { EVP_CIPHER_CTX_free(ctx); });
-    OPENSSL_RET_NOT_OK(EVP_EncryptInit_ex(ctx, cipher, nullptr, eh.key_bytes(), iv), "Failed to initialize encryption");
-    OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(ctx, 0), "failed to disable padding");
+    ASSIGN_OR_RETURN(auto ctx, thread_cipher_ctx(eh, cipher, iv, true));
     const size_t offset_mod = offset % kEncryptionBlockSize;
     if (offset_mod) {
         unsigned char scratch_clear[kEncryptionBlockSize];
@@ -146,13 +182,7 @@ Status DoDecryptV(const FileEncryptionInfo& eh, uint64_t offset, Slice* data, si
         return Status::InternalError(
                 fmt::format("get cipher for algorithm {} key_size: {} failed", eh.algorithm, eh.key.size()));
     }
-    auto ctx = EVP_CIPHER_CTX_new();
-    if (!ctx) {
-        return Status::InternalError("failed to create cipher context");
-    }
-    DeferOp cleanup_ctx([&ctx]() { EVP_CIPHER_CTX_free(ctx); });
-    OPENSSL_RET_NOT_OK(EVP_DecryptInit_ex(ctx, cipher, nullptr, eh.key_bytes(), iv), "Failed to initialize decryption");
-    OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(ctx, 0), "failed to disable padding");
+    ASSIGN_OR_RETURN(auto ctx, thread_cipher_ctx(eh, cipher, iv, false));
     const size_t offset_mod = offset % kEncryptionBlockSize;
     if (offset_mod) {
         unsigned char scratch_clear[kEncryptionBlockSize];
@@ -99,6 +99,8 @@ struct RandomAccessFileOptions {
     // Specify different buffer size for different read scenarios
     int64_t buffer_size = -1;
     FileEncryptionInfo encryption_info;
+    // The modification time of the file if known, which tells apart the versions of a rewritten remote file.
+    int64_t modification_time = 0;
 };
 
 struct DirEntry {
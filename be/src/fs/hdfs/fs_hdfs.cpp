@@ -24,6 +24,7 @@
 #include "fs/fs_util.h"
 #include "fs/hdfs/hdfs_fs_cache.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/exec_env.h"
 #include "runtime/file_result_writer.h"
 #include "testutil/sync_point.h"
 #include "udf/java/utils.h"
@@ -34,10 +35,43 @@ using namespace fmt::literals;
 
 namespace starrocks {
 
+// A file opened for read, closed once neither the file handle cache nor a reader refers to it any more.
+// `hdfsPread` doesn't move the file position, so readers can share it.
+struct SharedHdfsFile {
+    std::shared_ptr<HdfsFsClient> client;
+    hdfsFile file = nullptr;
+
+    // The last reference may be dropped by a cache eviction on any thread, close it like ~HdfsInputStream does.
+    ~SharedHdfsFile() {
+        auto ret = call_hdfs_scan_function_in_pthread([this]() {
+            if (hdfsCloseFile(client->hdfs_fs, file) == -1) {
+                auto error_msg = fmt::format("Fail to close cached hdfs file: {}", get_hdfs_err_msg());
+                LOG(WARNING) << error_msg;
+                return Status::IOError(error_msg);
+            }
+            return Status::OK();
+        });
+        (void)ret->get_future().get();
+    }
+};
+
+// The charge of an entry is 1, the capacity is a number of files.
+static LazyLRUCache* hdfs_file_handle_cache() {
+    return GlobalEnv::GetInstance()->hdfs_file_handle_cache();
+}
+
+void close_hdfs_file_handle_cache() {
+    hdfs_file_handle_cache()->close();
+}
+
 class GetHdfsFileReadOnlyHandle {
 public:
-    GetHdfsFileReadOnlyHandle(const FSOptions options, std::string path, int buffer_size)
-            : _options(std::move(options)), _path(std::move(path)), _buffer_size(buffer_size) {}
+    GetHdfsFileReadOnlyHandle(const FSOptions options, std::string path, int buffer_size,
+                              int64_t modification_time = 0)
+            : _options(std::move(options)),
+              _path(std::move(path)),
+              _buffer_size(buffer_size),
+              _modification_time(modification_time) {}
 
     StatusOr<hdfsFS> getOrCreateFS() {
         if (_hdfs_client == nullptr) {
@@ -54,6 +88,9 @@ public:
             auto st = getOrCreateFS();
             SCOPED_RAW_TIMER(&_total_open_file_time_ns);
             if (!st.ok()) return st.status();
+            if (_lookup_cached_file()) {
+                return _file;
+            }
             _file = hdfsOpenFile(st.value(), _path.c_str(), O_RDONLY, _buffer_size, 0, 0);
             if (_file == nullptr) {
                 if (errno == ENOENT) {
@@ -63,16 +100,19 @@ public:
                             fmt::format("hdfsOpenFile failed, file={}. err_msg: {}", _path, get_hdfs_err_msg()));
                 }
             }
+            _insert_cached_file();
         }
         return _file;
     }
 
     hdfsFS getFS() { return _hdfs_client->hdfs_fs; }
     hdfsFile getFile() { return _file; }
+    bool isSharedFile() const { return _shared_file != nullptr; }
     int64_t getTotalOpenFSTimeNs() const { return _total_open_fs_time_ns; }
     int64_t getTotalOpenFileTimeNs() const { return _total_open_file_time_ns; }
     const std::string& getPath() const { return _path; }
     void setOffset(int64_t offset) { _offset = offset; }
+    void setFileSize(int64_t size) { _file_size = size; }
 
     Status seek(int64_t offset) {
         hdfsFS fs = getFS();
@@ -91,7 +131,11 @@ public:
 
     int close() {
         int r = 0;
-        if (_file != nullptr) {
+        if (_shared_file != nullptr) {
+            // closed by the last one sharing it
+            _shared_file.reset();
+            _file = nullptr;
+        } else if (_file != nullptr) {
             hdfsFS fs = getFS();
             r = hdfsCloseFile(fs, _file);
             _file = nullptr;
@@ -102,9 +146,14 @@ public:
     StatusOr<int64_t> pread(uint8_t* data, int64_t size, int retry = 0) {
         RETURN_IF_ERROR(ensureOpened());
         hdfsFS fs = getFS();
+        if (_shared_file != nullptr) {
+            // A cached file may have been replaced since it was opened, give the reopened one a try anyway.
+            retry++;
+        }
         for (int i = 0; i < (retry + 1); i++) {
             tSize r = hdfsPread(fs, _file, _offset, data, static_cast<tSize>(size));
             if (r == -1) {
+                _erase_cached_file();
                 (void)close();
                 RETURN_IF_ERROR(ensureOpened());
             } else {
@@ -156,11 +205,60 @@ public:
     }
 
 private:
+    // A file is only cached once its size is known. The modification time and the size tell apart
+    // the versions of a rewritten file, the size alone is used if the modification time is unknown.
+    std::string _cache_key() const {
+        return fmt::format("{}:{}:{}:{}", static_cast<const void*>(_hdfs_client->hdfs_fs), _path, _file_size,
+                           _modification_time);
+    }
+
+    bool _lookup_cached_file() {
+        LazyLRUCache* cache = hdfs_file_handle_cache();
+        if (_file_size <= 0 || !cache->enabled()) {
+            return false;
+        }
+        std::string key = _cache_key();
+        Cache::Handle* handle = cache->lookup(CacheKey(key));
+        if (handle == nullptr) {
+            return false;
+        }
+        _shared_file = *reinterpret_cast<std::shared_ptr<SharedHdfsFile>*>(cache->value(handle));
+        cache->release(handle);
+        _file = _shared_file->file;
+        return true;
+    }
+
+    void _insert_cached_file() {
+        LazyLRUCache* cache = hdfs_file_handle_cache();
+        if (_file_size <= 0 || !cache->enabled()) {
+            return;
+        }
+        _shared_file = std::make_shared<SharedHdfsFile>();
+        _shared_file->client = _hdfs_client;
+        _shared_file->file = _file;
+        std::string key = _cache_key();
+        auto* value = new std::shared_ptr<SharedHdfsFile>(_shared_file);
+        // the memory of the open file is held by libhdfs, out of the sight of the mem trackers
+        cache->release(cache->insert(CacheKey(key), value, 1, sizeof(std::shared_ptr<SharedHdfsFile>),
+                                     [](const CacheKey& /*key*/, void* value) {
+                                         delete reinterpret_cast<std::shared_ptr<SharedHdfsFile>*>(value);
+                                     }));
+    }
+
+    void _erase_cached_file() {
+        if (_shared_file != nullptr) {
+            hdfs_file_handle_cache()->erase(CacheKey(_cache_key()));
+        }
+    }
+
     const FSOptions _options;
     std::string _path;
     int _buffer_size;
+    const int64_t _modification_time;
+    int64_t _file_size = 0;
     std::shared_ptr<HdfsFsClient> _hdfs_client = nullptr;
     hdfsFile _file = nullptr;
+    std::shared_ptr<SharedHdfsFile> _shared_file;
     int64_t _total_open_fs_time_ns = 0;
     int64_t _total_open_file_time_ns = 0;
     int64_t _offset = 0;
@@ -233,6 +331,7 @@ StatusOr<int64_t> HdfsInputStream::get_size() {
 
 void HdfsInputStream::set_size(int64_t value) {
     _file_size = value;
+    _handle->setFileSize(value);
 }
 
 StatusOr<std::unique_ptr<io::NumericStatistics>> HdfsInputStream::get_numeric_statistics() {
@@ -250,6 +349,11 @@ StatusOr<std::unique_ptr<io::NumericStatistics>> HdfsInputStream::get_numeric_st
         }
         stats->append(HdfsReadMetricsKey::kTotalOpenFSTimeNs, _handle->getTotalOpenFSTimeNs());
         stats->append(HdfsReadMetricsKey::kTotalOpenFileTimeNs, _handle->getTotalOpenFileTimeNs());
+        // The read statistics of a file are accumulated over all the readers sharing it, possibly at the same time,
+        // so they can't be attributed to this stream.
+        if (_handle->isSharedFile()) {
+            return Status::OK();
+        }
 
         struct hdfsReadStatistics* hdfs_statistics = nullptr;
         auto r = hdfsFileGetReadStatistics(file, &hdfs_statistics);
@@ -638,7 +742,8 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsFileSystem::new_random_access_fi
     if (_options.download != nullptr && _options.download->__isset.hdfs_read_buffer_size_kb) {
         hdfs_read_buffer_size = _options.download->hdfs_read_buffer_size_kb;
     }
-    auto handle = std::make_unique<GetHdfsFileReadOnlyHandle>(_options, path, hdfs_read_buffer_size);
+    auto handle =
+            std::make_unique<GetHdfsFileReadOnlyHandle>(_options, path, hdfs_read_buffer_size, opts.modification_time);
     auto stream = std::make_unique<HdfsInputStream>(std::move(handle));
     return RandomAccessFile::from(std::move(stream), path, false, opts.encryption_info);
 }
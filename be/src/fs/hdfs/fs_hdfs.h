@@ -35,4 +35,8 @@ struct HdfsReadMetricsKey {
 
 std::unique_ptr<FileSystem> new_fs_hdfs(const FSOptions& options);
 
+// Close the cached hdfs files and stop caching new ones. It must be called before the JVM used by libhdfs
+// is gone, the files are closed by the static destructors otherwise.
+void close_hdfs_file_handle_cache();
+
 } // namespace starrocks
@@ -0,0 +1,45 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "http/action/continuous_profiler_action.h"
+
+#include "common/config.h"
+#include "exec/pipeline/continuous_profiler.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/string_parser.hpp"
+#include "util/time.h"
+
+namespace starrocks {
+
+static const char* const kParamMinutes = "minutes";
+
+void ContinuousProfilerAction::handle(HttpRequest* req) {
+    int64_t minutes = config::continuous_profiler_window_minutes;
+    const auto& minutes_str = req->param(kParamMinutes);
+    if (!minutes_str.empty()) {
+        StringParser::ParseResult result;
+        minutes = StringParser::string_to_int<int64_t>(minutes_str.data(), minutes_str.size(), &result);
+        if (result != StringParser::PARSE_SUCCESS || minutes <= 0) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid param minutes");
+            return;
+        }
+    }
+    auto folded_stacks = pipeline::ContinuousProfiler::instance()->folded_stacks(minutes, UnixSeconds());
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain");
+    HttpChannel::send_reply(req, HttpStatus::OK, folded_stacks);
+}
+
+} // namespace starrocks
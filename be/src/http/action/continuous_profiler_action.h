@@ -0,0 +1,32 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// GET /api/continuous_profiler?minutes=N
+// Returns the operator time recorded by pipeline::ContinuousProfiler in the last N minutes (the whole
+// window by default) in the folded stack format, e.g.
+//   curl http://be:8040/api/continuous_profiler?minutes=5 | flamegraph.pl > operators.svg
+class ContinuousProfilerAction : public HttpHandler {
+public:
+    ContinuousProfilerAction() = default;
+    ~ContinuousProfilerAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
@@ -189,6 +189,10 @@ void DataCacheAction::_handle_app_stat(HttpRequest* req) {
         root.AddMember("miss_bytes_last_minute", rapidjson::Value(hit_rate_counter->get_miss_bytes_last_minute()),
                        allocator);
         root.AddMember("hit_rate_last_minute", rapidjson::Value(hit_rate_counter->hit_rate_last_minute()), allocator);
+        root.AddMember("admission_reject_frequency_bytes",
+                       rapidjson::Value(hit_rate_counter->get_reject_frequency_bytes()), allocator);
+        root.AddMember("admission_reject_large_scan_bytes",
+                       rapidjson::Value(hit_rate_counter->get_reject_large_scan_bytes()), allocator);
 #endif
     });
 }
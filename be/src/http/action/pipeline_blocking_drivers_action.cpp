@@ -22,6 +22,8 @@
 
 #include "common/logging.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/pipeline/pipeline_wait_stats.h"
+#include "exec/pipeline/query_context.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "http/http_channel.h"
@@ -34,6 +36,7 @@ namespace starrocks {
 const static std::string HEADER_JSON = "application/json";
 const static std::string ACTION_KEY = "action";
 const static std::string ACTION_STAT = "stat";
+const static std::string ACTION_WAIT_STATS = "wait_stats";
 
 struct DriverInfo {
     int32_t driver_id;
@@ -57,6 +60,8 @@ void PipelineBlockingDriversAction::handle(HttpRequest* req) {
     if (req->method() == HttpMethod::GET) {
         if (action == ACTION_STAT) {
             _handle_stat(req);
+        } else if (action == ACTION_WAIT_STATS) {
+            _handle_wait_stats(req);
         } else {
             _handle_error(req, strings::Substitute("Not support GET method: '$0'", req->uri()));
         }
@@ -170,6 +175,57 @@ void PipelineBlockingDriversAction::_handle_stat(HttpRequest* req) {
     });
 }
 
+void PipelineBlockingDriversAction::_handle_wait_stats(HttpRequest* req) {
+    _handle(req, [=](rapidjson::Document& root) {
+        auto& allocator = root.GetAllocator();
+
+        using pipeline::DriverWaitStats;
+        auto snapshot_to_doc_func = [&allocator](const DriverWaitStats::Snapshot& snapshot) {
+            rapidjson::Document reasons_obj;
+            reasons_obj.SetArray();
+            for (size_t i = 0; i < DriverWaitStats::NUM_REASONS; ++i) {
+                const auto& stats = snapshot[i];
+                rapidjson::Document buckets_obj;
+                buckets_obj.SetObject();
+                for (size_t j = 0; j < DriverWaitStats::NUM_BUCKETS; ++j) {
+                    buckets_obj.AddMember(rapidjson::Value(DriverWaitStats::bucket_name(j).c_str(), allocator),
+                                          rapidjson::Value(stats.buckets[j]), allocator);
+                }
+
+                rapidjson::Document reason_obj;
+                reason_obj.SetObject();
+                reason_obj.AddMember(
+                        "reason",
+                        rapidjson::Value(driver_wait_reason_to_string(static_cast<pipeline::DriverWaitReason>(i)),
+                                         allocator),
+                        allocator);
+                reason_obj.AddMember("count", rapidjson::Value(stats.count), allocator);
+                reason_obj.AddMember("total_time_ns", rapidjson::Value(stats.total_time_ns), allocator);
+                reason_obj.AddMember("buckets", buckets_obj, allocator);
+                reasons_obj.PushBack(reason_obj, allocator);
+            }
+            return reasons_obj;
+        };
+
+        rapidjson::Document be_obj = snapshot_to_doc_func(DriverWaitStats::instance()->snapshot());
+
+        rapidjson::Document queries_obj;
+        queries_obj.SetArray();
+        _exec_env->query_context_mgr()->for_each_query_ctx([&](const pipeline::QueryContextPtr& query_ctx) {
+            rapidjson::Document query_obj;
+            query_obj.SetObject();
+            query_obj.AddMember("query_id", rapidjson::Value(print_id(query_ctx->query_id()).c_str(), allocator),
+                                allocator);
+            rapidjson::Document wait_stats_obj = snapshot_to_doc_func(query_ctx->driver_wait_stats()->snapshot());
+            query_obj.AddMember("wait_stats", wait_stats_obj, allocator);
+            queries_obj.PushBack(query_obj, allocator);
+        });
+
+        root.AddMember("be", be_obj, allocator);
+        root.AddMember("queries", queries_obj, allocator);
+    });
+}
+
 void PipelineBlockingDriversAction::_handle_error(HttpRequest* req, const std::string& err_msg) {
     _handle(req, [err_msg](rapidjson::Document& root) {
         auto& allocator = root.GetAllocator();
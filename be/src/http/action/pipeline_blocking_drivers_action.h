@@ -52,6 +52,20 @@ private:
     //      }]
     // }
     void _handle_stat(HttpRequest* req);
+    // Returns the wait time histograms of drivers of the BE and the running queries with the following format:
+    // {
+    //      "be": [{
+    //          "reason": "str",
+    //          "count": "int",
+    //          "total_time_ns": "int",
+    //          "buckets": {"lt_1ms": "int", "lt_10ms": "int", "lt_100ms": "int", "lt_1s": "int", "ge_1s": "int"}
+    //      }],
+    //      "queries": [{
+    //          "query_id": "str",
+    //          "wait_stats": [...]
+    //      }]
+    // }
+    void _handle_wait_stats(HttpRequest* req);
     void _handle_error(HttpRequest* req, const std::string& error_msg);
 
 private:
@@ -14,17 +14,25 @@
 
 #include "io/cache_input_stream.h"
 
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 
 #include <utility>
 
+#include "block_cache/block_cache_hit_rate_counter.hpp"
+#include "block_cache/cache_admission.h"
 #include "gutil/strings/fastmem.h"
 #include "util/hash_util.hpp"
+#include "util/raw_container.h"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
 
 namespace starrocks::io {
 
+// Latency of the block reads from the datacache in microseconds, by cache tier.
+static bvar::LatencyRecorder g_datacache_read_mem_latency("datacache", "read_mem_latency");
+static bvar::LatencyRecorder g_datacache_read_disk_latency("datacache", "read_disk_latency");
+
 // We use the `SharedBufferedInputStream` in `CacheInputStream` directly, because the we depend some functions of
 // `SharedBufferedInputStream`.
 // In fact, although the parameter is `SeekableInputStream` before, we only use `CacheInputStream` when using
@@ -154,6 +162,13 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         _stats.read_mem_cache_bytes += options.stats.read_mem_bytes;
         _stats.read_disk_cache_bytes += options.stats.read_disk_bytes;
         _stats.read_cache_ns += read_cache_ns;
+        if (options.stats.read_disk_bytes > 0) {
+            _stats.read_disk_cache_latency.add(read_cache_ns);
+            g_datacache_read_disk_latency << read_cache_ns / 1000;
+        } else {
+            _stats.read_mem_cache_latency.add(read_cache_ns);
+            g_datacache_read_mem_latency << read_cache_ns / 1000;
+        }
         if (_enable_cache_io_adaptor) {
             _cache->record_read_cache(read_size, read_cache_ns / 1000);
         }
@@ -200,8 +215,7 @@ Status CacheInputStream::_read_blocks_from_remote(const int64_t offset, const in
             RETURN_IF_ERROR(_sb_stream->get_bytes(&buffer, read_offset_cursor, read_size, sb));
             src = (char*)buffer;
         } else {
-            RETURN_IF_ERROR(_sb_stream->read_at_fully(read_offset_cursor, _buffer.data(), read_size));
-            src = _buffer.data();
+            ASSIGN_OR_RETURN(src, _read_from_remote(read_offset_cursor, read_size));
         }
 
         // write _buffer's data into `out`
@@ -229,6 +243,31 @@ Status CacheInputStream::_read_blocks_from_remote(const int64_t offset, const in
     return Status::OK();
 }
 
+StatusOr<char*> CacheInputStream::_read_from_remote(const int64_t offset, const int64_t size) {
+    const int64_t read_ahead_end = _read_ahead_offset + static_cast<int64_t>(_read_ahead_buffer.size());
+    if (offset >= _read_ahead_offset && offset + size <= read_ahead_end) {
+        _last_remote_read_end = offset + size;
+        return _read_ahead_buffer.data() + (offset - _read_ahead_offset);
+    }
+
+    const bool sequential = offset == _last_remote_read_end;
+    _last_remote_read_end = offset + size;
+    if (_read_ahead_size > 0 && sequential) {
+        const int64_t read_size = std::min(size + _read_ahead_size, _size - offset);
+        raw::stl_string_resize_uninitialized(&_read_ahead_buffer, read_size);
+        _read_ahead_offset = offset;
+        Status st = _sb_stream->read_at_fully(offset, _read_ahead_buffer.data(), read_size);
+        if (!st.ok()) {
+            _read_ahead_buffer.clear();
+            return st;
+        }
+        return _read_ahead_buffer.data();
+    }
+
+    RETURN_IF_ERROR(_sb_stream->read_at_fully(offset, _buffer.data(), size));
+    return _buffer.data();
+}
+
 Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t size, char* src,
                                             const SharedBufferPtr& sb) {
     SCOPED_RAW_TIMER(&_stats.write_cache_ns);
@@ -243,6 +282,11 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
         options.priority = _priority;
         options.ttl_seconds = _ttl_seconds;
         const int64_t write_size = std::min(_block_size, write_end_offset - write_offset_cursor);
+        if (!_admit_to_cache(write_offset_cursor, write_size)) {
+            src_cursor += write_size;
+            write_offset_cursor += write_size;
+            continue;
+        }
 
         if (options.async && sb) {
             auto cb = [sb](int code, const std::string& msg) {
@@ -427,6 +471,9 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
     p -= (offset - begin);
     auto f = [sb, this](const char* buf, size_t off, size_t size) {
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
+        if (!_admit_to_cache(off, size)) {
+            return;
+        }
         WriteCacheOptions options;
         options.async = _enable_async_populate_mode;
         options.evict_probability = _datacache_evict_probability;
@@ -462,6 +509,19 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
     return;
 }
 
+bool CacheInputStream::_admit_to_cache(const int64_t offset, const int64_t size) {
+    auto result = CacheAdmission::instance()->admit(_cache_key, offset, _size, _priority, _cache->capacity(),
+                                                    _block_size);
+    if (result == CacheAdmission::ADMIT) {
+        return true;
+    }
+    _stats.skip_write_cache_count += 1;
+    _stats.skip_write_cache_bytes += size;
+    bool by_frequency = result == CacheAdmission::REJECT_FREQUENCY;
+    BlockCacheHitRateCounter::instance()->update_admission_rejected(by_frequency ? size : 0, by_frequency ? 0 : size);
+    return false;
+}
+
 bool CacheInputStream::_can_ignore_populate_error(const Status& status) const {
     if (status.is_already_exist() || status.is_resource_busy() || status.is_mem_limit_exceeded() ||
         status.is_capacity_limit_exceeded()) {
@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "block_cache/block_cache.h"
 #include "block_cache/io_buffer.h"
+#include "io/io_latency_histogram.h"
 #include "io/shared_buffered_input_stream.h"
 
 namespace starrocks::io {
@@ -44,6 +46,9 @@ public:
         int64_t write_cache_fail_bytes = 0;
         int64_t read_block_buffer_bytes = 0;
         int64_t read_block_buffer_count = 0;
+        // Latency of the block reads served by the memory and the disk tier of the cache.
+        IOLatencyHistogram read_mem_cache_latency;
+        IOLatencyHistogram read_disk_cache_latency;
     };
 
     explicit CacheInputStream(const std::shared_ptr<SharedBufferedInputStream>& stream, const std::string& filename,
@@ -71,6 +76,8 @@ public:
 
     void set_enable_cache_io_adaptor(bool v) { _enable_cache_io_adaptor = v; }
 
+    void set_read_ahead_blocks(int64_t v) { _read_ahead_size = std::max<int64_t>(v, 0) * _block_size; }
+
     void set_datacache_evict_probability(int32_t v) { _datacache_evict_probability = v; }
 
     void set_priority(const int8_t priority) { _priority = priority; }
@@ -97,10 +104,14 @@ protected:
     virtual Status _read_block_from_local(const int64_t offset, const int64_t size, char* out);
     // Read multiple blocks from remote
     virtual Status _read_blocks_from_remote(const int64_t offset, const int64_t size, char* out);
+    // Read [offset, offset + size) that isn't in a SharedBuffer from remote, returns where the data is.
+    StatusOr<char*> _read_from_remote(const int64_t offset, const int64_t size);
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src, const SharedBufferPtr& sb);
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
     bool _can_ignore_populate_error(const Status& status) const;
+    // Whether the admission policy lets the block at |offset| into the cache.
+    bool _admit_to_cache(const int64_t offset, const int64_t size);
 
     std::string _cache_key;
     std::string _filename;
@@ -108,6 +119,12 @@ protected:
     int64_t _offset;
     int64_t _buffer_size;
     std::string _buffer;
+    // A remote read right after the previous one also fetches the next `_read_ahead_size` bytes into
+    // `_read_ahead_buffer`, the following reads are served from it.
+    int64_t _read_ahead_size = 0;
+    std::string _read_ahead_buffer;
+    int64_t _read_ahead_offset = 0;
+    int64_t _last_remote_read_end = -1;
     Stats _stats;
     int64_t _size;
     bool _enable_populate_cache = false;
@@ -0,0 +1,42 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace starrocks::io {
+
+// Number of IOs by latency, so that a profile tells a few slow IOs apart from uniformly slow ones.
+struct IOLatencyHistogram {
+    static constexpr int kNumBuckets = 5;
+    // Upper bounds of the buckets but the last one, in nanoseconds.
+    static constexpr int64_t kBucketBoundsNs[kNumBuckets - 1] = {1'000'000, 10'000'000, 100'000'000,
+                                                                  1'000'000'000};
+    // Profile counter name suffixes of the buckets.
+    static constexpr const char* kBucketNames[kNumBuckets] = {"Under1ms", "Under10ms", "Under100ms", "Under1s",
+                                                               "Over1s"};
+
+    void add(int64_t latency_ns) {
+        int i = 0;
+        while (i < kNumBuckets - 1 && latency_ns >= kBucketBoundsNs[i]) {
+            i++;
+        }
+        counts[i]++;
+    }
+
+    int64_t counts[kNumBuckets] = {0};
+};
+
+} // namespace starrocks::io
@@ -18,9 +18,19 @@
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "common/config.h"
 #include "io/s3_zero_copy_iostream.h"
+#include "runtime/exec_env.h"
+#include "util/raw_container.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
@@ -29,12 +39,27 @@
 
 namespace starrocks::io {
 
+// Latency of the ranged GETs in microseconds, its p95 is the delay after which a read is hedged.
+static bvar::LatencyRecorder g_s3_get_latency("s3_input_stream", "get_latency");
+static bvar::Adder<int64_t> g_s3_hedged_get_count("s3_input_stream", "hedged_get_count");
+static bvar::Adder<int64_t> g_s3_hedged_get_win_count("s3_input_stream", "hedged_get_win_count");
+
 inline Status make_error_status(const Aws::S3::S3Error& error) {
     return Status::IOError(fmt::format(
             "BE access S3 file failed, SdkResponseCode={}, SdkErrorType={}, SdkErrorMessage={}",
             static_cast<int>(error.GetResponseCode()), static_cast<int>(error.GetErrorType()), error.GetMessage()));
 }
 
+static Status check_get_outcome(const Aws::S3::Model::GetObjectOutcome& outcome, int64_t length) {
+    if (!outcome.IsSuccess()) {
+        return make_error_status(outcome.GetError());
+    }
+    if (UNLIKELY(outcome.GetResult().GetContentLength() != length)) {
+        return Status::InternalError("The response length is different from request length for io stream!");
+    }
+    return Status::OK();
+}
+
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
@@ -51,20 +76,101 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     request.SetBucket(_bucket);
     request.SetKey(_object);
     request.SetRange(std::move(range));
-    request.SetResponseStreamFactory([out, real_length]() {
-        return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, reinterpret_cast<char*>(out), real_length);
-    });
+    if (config::object_storage_hedge_read_enable) {
+        RETURN_IF_ERROR(_hedged_get_object(request, reinterpret_cast<char*>(out), real_length));
+    } else {
+        RETURN_IF_ERROR(_get_object(request, reinterpret_cast<char*>(out), real_length));
+    }
+    _offset += real_length;
+    return real_length;
+}
 
+Status S3InputStream::_get_object(Aws::S3::Model::GetObjectRequest& request, char* out, int64_t length) {
+    request.SetResponseStreamFactory(
+            [out, length]() { return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, out, length); });
+    MonotonicStopWatch watch;
+    watch.start();
     Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
-    if (outcome.IsSuccess()) {
-        if (UNLIKELY(outcome.GetResult().GetContentLength() != real_length)) {
-            return Status::InternalError("The response length is different from request length for io stream!");
+    RETURN_IF_ERROR(check_get_outcome(outcome, length));
+    g_s3_get_latency << watch.elapsed_time() / 1000;
+    return Status::OK();
+}
+
+// The GETs run in the hedge read pool, and the slower one keeps running after the read returns, so each GET
+// receives into a buffer it shares ownership of instead of into |out|. The read isn't hedged when the pool is
+// busy, the pool bounds the number of GETs in flight.
+Status S3InputStream::_hedged_get_object(Aws::S3::Model::GetObjectRequest& request, char* out, int64_t length) {
+    ThreadPool* pool = ExecEnv::GetInstance()->object_storage_hedge_read_pool();
+    if (pool == nullptr) {
+        return _get_object(request, out, length);
+    }
+
+    // Shared by the read and its GETs, which may outlive it.
+    struct HedgedGet {
+        std::mutex mutex;
+        std::condition_variable cv;
+        int pending = 0;
+        std::shared_ptr<std::string> result;
+        bool hedged_won = false;
+        Status first_error;
+
+        bool finished() const { return result != nullptr || pending == 0; }
+    };
+    auto state = std::make_shared<HedgedGet>();
+    auto send = [&](bool hedged) {
+        auto buffer = std::make_shared<std::string>();
+        raw::stl_string_resize_uninitialized(buffer.get(), length);
+        request.SetResponseStreamFactory([buffer, length]() {
+            return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), length);
+        });
+        {
+            std::lock_guard l(state->mutex);
+            state->pending++;
         }
-        _offset += real_length;
-        return real_length;
-    } else {
-        return make_error_status(outcome.GetError());
+        Status submit_st = pool->submit_func([client = _s3client, request, buffer, length, hedged, state]() {
+            Status st = check_get_outcome(client->GetObject(request), length);
+            std::lock_guard l(state->mutex);
+            state->pending--;
+            if (st.ok() && state->result == nullptr) {
+                state->result = buffer;
+                state->hedged_won = hedged;
+            } else if (!st.ok() && state->first_error.ok()) {
+                state->first_error = std::move(st);
+            }
+            state->cv.notify_all();
+        });
+        if (!submit_st.ok()) {
+            std::lock_guard l(state->mutex);
+            state->pending--;
+        }
+        return submit_st;
+    };
+
+    MonotonicStopWatch watch;
+    watch.start();
+    if (!send(false).ok()) {
+        return _get_object(request, out, length);
     }
+    int64_t delay_ms = std::max<int64_t>(config::object_storage_hedge_read_min_delay_ms,
+                                         g_s3_get_latency.latency_percentile(0.95) / 1000);
+    std::unique_lock l(state->mutex);
+    if (!state->cv.wait_for(l, std::chrono::milliseconds(delay_ms), [&]() { return state->finished(); })) {
+        l.unlock();
+        if (send(true).ok()) {
+            g_s3_hedged_get_count << 1;
+        }
+        l.lock();
+    }
+    state->cv.wait(l, [&]() { return state->finished(); });
+    if (state->result == nullptr) {
+        return state->first_error;
+    }
+    if (state->hedged_won) {
+        g_s3_hedged_get_win_count << 1;
+    }
+    g_s3_get_latency << watch.elapsed_time() / 1000;
+    memcpy(out, state->result->data(), length);
+    return Status::OK();
 }
 
 Status S3InputStream::seek(int64_t offset) {
@@ -97,6 +203,14 @@ void S3InputStream::set_size(int64_t value) {
 }
 
 StatusOr<std::string> S3InputStream::read_all() {
+    if (_size >= 0) {
+        // The size is known, receive the body straight into the result instead of copying it out of the
+        // response stream.
+        std::string ret;
+        raw::stl_string_resize_uninitialized(&ret, _size);
+        RETURN_IF_ERROR(read_at_fully(0, ret.data(), ret.size()));
+        return std::move(ret);
+    }
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
@@ -21,7 +21,10 @@
 
 namespace Aws::S3 {
 class S3Client;
+namespace Model {
+class GetObjectRequest;
 }
+} // namespace Aws::S3
 
 namespace starrocks::io {
 
@@ -53,6 +56,13 @@ public:
     StatusOr<std::string> read_all() override;
 
 private:
+    // Send |request| and receive the body into |out|.
+    Status _get_object(Aws::S3::Model::GetObjectRequest& request, char* out, int64_t length);
+
+    // Send |request| and a hedged copy of it if it's slow, the body of the first successful one is copied
+    // into |out|.
+    Status _hedged_get_object(Aws::S3::Model::GetObjectRequest& request, char* out, int64_t length);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
@@ -16,16 +16,87 @@
 
 #include <gutil/strings/substitute.h>
 
+#include <functional>
+#include <thread>
+#include <unordered_map>
+
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks::io {
 
+ReadCostModel* ReadCostModel::of(const std::string& filename) {
+    static std::mutex models_mutex;
+    static std::unordered_map<std::string, std::unique_ptr<ReadCostModel>> models;
+
+    auto pos = filename.find("://");
+    std::string scheme = pos == std::string::npos ? "file" : filename.substr(0, pos);
+    std::lock_guard l(models_mutex);
+    auto& model = models[scheme];
+    if (model == nullptr) {
+        model = std::make_unique<ReadCostModel>();
+    }
+    return model.get();
+}
+
+void ReadCostModel::update(int64_t bytes, int64_t elapsed_ns) {
+    if (bytes <= 0 || elapsed_ns <= 0) {
+        return;
+    }
+    auto x = static_cast<double>(bytes);
+    auto y = static_cast<double>(elapsed_ns);
+    Shard& shard = _shards[std::hash<std::thread::id>()(std::this_thread::get_id()) % kNumShards];
+    std::lock_guard l(shard.mutex);
+    shard.samples++;
+    shard.sum_w = shard.sum_w * kDecay + 1;
+    shard.sum_x = shard.sum_x * kDecay + x;
+    shard.sum_y = shard.sum_y * kDecay + y;
+    shard.sum_xx = shard.sum_xx * kDecay + x * x;
+    shard.sum_xy = shard.sum_xy * kDecay + x * y;
+}
+
+int64_t ReadCostModel::break_even_distance() const {
+    int64_t samples = 0;
+    double sum_w = 0;
+    double sum_x = 0;
+    double sum_y = 0;
+    double sum_xx = 0;
+    double sum_xy = 0;
+    for (const Shard& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        samples += shard.samples;
+        sum_w += shard.sum_w;
+        sum_x += shard.sum_x;
+        sum_y += shard.sum_y;
+        sum_xx += shard.sum_xx;
+        sum_xy += shard.sum_xy;
+    }
+    if (samples < kMinSamples) {
+        return -1;
+    }
+    double denominator = sum_w * sum_xx - sum_x * sum_x;
+    // all the reads have (almost) the same size, latency and bandwidth can't be told apart
+    if (denominator <= 1e-6 * sum_w * sum_xx) {
+        return -1;
+    }
+    // slope is ns per byte, intercept is the per request latency in ns
+    double slope = (sum_w * sum_xy - sum_x * sum_y) / denominator;
+    double intercept = (sum_y - slope * sum_x) / sum_w;
+    if (slope <= 0 || intercept <= 0) {
+        return -1;
+    }
+    return static_cast<int64_t>(intercept / slope);
+}
+
 SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename,
                                                      size_t file_size)
-        : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
+        : _stream(std::move(stream)),
+          _filename(std::move(filename)),
+          _cost_model(ReadCostModel::of(_filename)),
+          _file_size(file_size) {}
 
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
@@ -226,7 +297,12 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
+        MonotonicStopWatch watch;
+        watch.start();
         RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        if (config::io_coalesce_adaptive_distance_enable) {
+            _cost_model->update(sb.size, watch.elapsed_time());
+        }
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
@@ -247,7 +323,12 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        MonotonicStopWatch watch;
+        watch.start();
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        if (config::io_coalesce_adaptive_distance_enable) {
+            _cost_model->update(count, watch.elapsed_time());
+        }
         return Status::OK();
     }
     const uint8_t* buffer = nullptr;
@@ -17,12 +17,48 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
 namespace starrocks::io {
 
+// Fits `elapsed = latency + bytes / bandwidth` over the recent reads of one kind of storage, so the
+// coalescing distance can follow what the storage actually delivers instead of a static threshold.
+// Older samples decay, so the model follows changes of the network or the load.
+// Every remote read updates the model of its storage, so the samples are spread over shards picked by
+// the reading thread, and only the fit reads all of them.
+class ReadCostModel {
+public:
+    // The model shared by all files with the same scheme (s3://, hdfs://, ...) as |filename|.
+    static ReadCostModel* of(const std::string& filename);
+
+    void update(int64_t bytes, int64_t elapsed_ns);
+
+    // The gap size that takes as long to read as the latency of a separate request, i.e. the
+    // largest distance at which merging two ranges is still cheaper than reading them separately.
+    // Returns -1 until there are enough samples of different sizes to fit the model.
+    int64_t break_even_distance() const;
+
+private:
+    static constexpr double kDecay = 0.99;
+    static constexpr int64_t kMinSamples = 16;
+    static constexpr size_t kNumShards = 16;
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        int64_t samples = 0;
+        double sum_w = 0;
+        double sum_x = 0;
+        double sum_y = 0;
+        double sum_xx = 0;
+        double sum_xy = 0;
+    };
+    Shard _shards[kNumShards];
+};
+
 class SharedBufferedInputStream : public SeekableInputStream {
 public:
     struct IORange {
@@ -107,6 +143,7 @@ private:
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
     const std::string _filename;
+    ReadCostModel* _cost_model = nullptr;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
     int64_t _offset = 0;
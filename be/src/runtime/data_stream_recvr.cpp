@@ -247,23 +247,28 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     int use_sender_id = _is_merging ? request.sender_id() : 0;
     // Add all batches to the same queue if _is_merging is false.
 
+    Status status;
     if (_keep_order) {
         DCHECK(_is_pipeline);
-        return _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
+        status = _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
     } else {
-        return _sender_queues[use_sender_id]->add_chunks(request, metrics, done);
+        status = _sender_queues[use_sender_id]->add_chunks(request, metrics, done);
     }
+    _observable.notify_observers();
+    return status;
 }
 
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::close() {
@@ -274,6 +279,7 @@ void DataStreamRecvr::close() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->close();
     }
+    _observable.clear_observers();
     // Remove this receiver from the DataStreamMgr that created it.
     // TODO: log error msg
     _mgr->deregister_recvr(fragment_instance_id(), dest_node_id());
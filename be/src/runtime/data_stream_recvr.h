@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -132,6 +133,12 @@ public:
 
     bool get_encode_level() const { return _encode_level; }
 
+    // Attach the observer of a pipeline driver consuming this receiver, which is notified when chunks arrive
+    // or a sender is removed. The observers are cleared when the receiver is closed.
+    void attach_observer(pipeline::PipelineObserver* observer) { _observable.add_observer(observer); }
+    // Detach the observer, when the driver is closed before the receiver.
+    void detach_observer(pipeline::PipelineObserver* observer) { _observable.remove_observer(observer); }
+
 private:
     friend class DataStreamMgr;
     class SenderQueue;
@@ -248,6 +255,8 @@ private:
 
     int _encode_level;
     bool _closed = false;
+
+    pipeline::Observable _observable;
 };
 
 } // end namespace starrocks
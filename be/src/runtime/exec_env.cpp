@@ -53,6 +53,7 @@
 #include "exec/workgroup/scan_task_queue.h"
 #include "exec/workgroup/work_group.h"
 #include "fs/fs_s3.h"
+#include "fs/hdfs/fs_hdfs.h"
 #include "gen_cpp/BackendService.h"
 #include "gen_cpp/TFileBrokerService.h"
 #include "gutil/strings/join.h"
@@ -69,6 +70,7 @@
 #include "runtime/load_channel_mgr.h"
 #include "runtime/load_path_mgr.h"
 #include "runtime/mem_tracker.h"
+#include "runtime/memory/column_allocator.h"
 #include "runtime/memory/mem_chunk_allocator.h"
 #include "runtime/profile_report_worker.h"
 #include "runtime/result_buffer_mgr.h"
@@ -238,6 +240,13 @@ Status GlobalEnv::_init_mem_tracker() {
     int32_t update_mem_percent = std::max(std::min(100, config::update_memory_limit_percent), 0);
     _update_mem_tracker = regist_tracker(bytes_limit * update_mem_percent / 100, "update", nullptr);
     _chunk_allocator_mem_tracker = regist_tracker(-1, "chunk_allocator", _process_mem_tracker.get());
+    _column_buffer_cache_mem_tracker = regist_tracker(-1, "column_buffer_cache", _process_mem_tracker.get());
+    _position_delete_cache_mem_tracker = regist_tracker(-1, "position_delete_cache", _process_mem_tracker.get());
+    _parquet_page_cache_mem_tracker = regist_tracker(-1, "parquet_page_cache", _process_mem_tracker.get());
+    _short_circuit_row_cache_mem_tracker = regist_tracker(-1, "short_circuit_row_cache", _process_mem_tracker.get());
+    _hdfs_file_handle_cache_mem_tracker = regist_tracker(-1, "hdfs_file_handle_cache", _process_mem_tracker.get());
+    _inverted_index_query_cache_mem_tracker =
+            regist_tracker(-1, "inverted_index_query_cache", _process_mem_tracker.get());
     _clone_mem_tracker = regist_tracker(-1, "clone", _process_mem_tracker.get());
     int64_t consistency_mem_limit = calc_max_consistency_memory(_process_mem_tracker->limit());
     _consistency_mem_tracker = regist_tracker(consistency_mem_limit, "consistency", _process_mem_tracker.get());
@@ -245,12 +254,30 @@ Status GlobalEnv::_init_mem_tracker() {
     _replication_mem_tracker = regist_tracker(-1, "replication", _process_mem_tracker.get());
 
     MemChunkAllocator::init_instance(_chunk_allocator_mem_tracker.get(), config::chunk_reserved_bytes_limit);
+    CachedColumnAllocator::set_mem_tracker(_column_buffer_cache_mem_tracker.get());
+
+    _parquet_page_cache.open([]() { return config::parquet_page_cache_capacity; },
+                             _parquet_page_cache_mem_tracker.get());
+    _short_circuit_row_cache.open([]() { return config::short_circuit_row_cache_capacity; },
+                                  _short_circuit_row_cache_mem_tracker.get());
+    _position_delete_cache.open([]() { return config::position_delete_cache_capacity; },
+                                _position_delete_cache_mem_tracker.get());
+    _hdfs_file_handle_cache.open([]() { return static_cast<int64_t>(config::hdfs_file_handle_cache_capacity); },
+                                 _hdfs_file_handle_cache_mem_tracker.get());
+    _inverted_index_query_cache.open([]() { return config::inverted_index_query_cache_capacity; },
+                                     _inverted_index_query_cache_mem_tracker.get());
 
     _init_storage_page_cache(); // TODO: move to StorageEngine
     return Status::OK();
 }
 
 void GlobalEnv::_reset_tracker() {
+    CachedColumnAllocator::set_mem_tracker(nullptr);
+    _parquet_page_cache.reset();
+    _short_circuit_row_cache.reset();
+    _position_delete_cache.reset();
+    _hdfs_file_handle_cache.reset();
+    _inverted_index_query_cache.reset();
     for (auto iter = _mem_trackers.rbegin(); iter != _mem_trackers.rend(); ++iter) {
         iter->reset();
     }
@@ -355,6 +382,25 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_automatic_partition_pool));
 
+    int lake_schema_change_threads = config::lake_schema_change_convert_thread_num;
+    if (lake_schema_change_threads <= 0) {
+        lake_schema_change_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("lake_sc_convert") // converting rowsets of lake schema changes
+                            .set_min_threads(0)
+                            .set_max_threads(lake_schema_change_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_lake_schema_change_pool));
+
+    int hedge_read_threads = std::max(1, config::object_storage_hedge_read_thread_num);
+    RETURN_IF_ERROR(ThreadPoolBuilder("hedge_read") // GETs of hedged object storage reads
+                            .set_min_threads(0)
+                            .set_max_threads(hedge_read_threads)
+                            .set_max_queue_size(0)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_object_storage_hedge_read_pool));
+
     int num_prepare_threads = config::pipeline_prepare_thread_pool_thread_num;
     if (num_prepare_threads == 0) {
         num_prepare_threads = CpuInfo::num_cores();
@@ -403,6 +449,17 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    int segment_writer_threads = config::segment_writer_parallel_append_thread_num;
+    if (segment_writer_threads <= 0) {
+        segment_writer_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("segment_writer") // thread pool for appending columns of a segment
+                            .set_min_threads(0)
+                            .set_max_threads(segment_writer_threads)
+                            .set_max_queue_size(INT32_MAX) // unlimit queue size
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_segment_writer_pool));
+
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
         _max_executor_threads = config::pipeline_exec_thread_pool_thread_num;
@@ -613,6 +670,14 @@ void ExecEnv::stop() {
         _automatic_partition_pool->shutdown();
     }
 
+    if (_lake_schema_change_pool) {
+        _lake_schema_change_pool->shutdown();
+    }
+
+    if (_object_storage_hedge_read_pool) {
+        _object_storage_hedge_read_pool->shutdown();
+    }
+
     if (_query_rpc_pool) {
         _query_rpc_pool->shutdown();
     }
@@ -649,6 +714,10 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_segment_writer_pool) {
+        _segment_writer_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -678,6 +747,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_pipeline_sink_io_pool);
     SAFE_DELETE(_query_rpc_pool);
     _load_rpc_pool.reset();
+    close_hdfs_file_handle_cache();
     _workgroup_manager->destroy();
     _workgroup_manager.reset();
     SAFE_DELETE(_thread_pool);
@@ -706,7 +776,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
+    _segment_writer_pool.reset();
     _automatic_partition_pool.reset();
+    _lake_schema_change_pool.reset();
+    _object_storage_hedge_read_pool.reset();
     _metrics = nullptr;
 }
 
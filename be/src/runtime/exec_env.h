@@ -42,6 +42,7 @@
 #include "exec/query_cache/cache_manager.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "runtime/base_load_path_mgr.h"
+#include "runtime/lazy_lru_cache.h"
 #include "storage/options.h"
 #include "util/threadpool.h"
 // NOTE: Be careful about adding includes here. This file is included by many files.
@@ -143,12 +144,29 @@ public:
     MemTracker* jit_cache_mem_tracker() { return _jit_cache_mem_tracker.get(); }
     MemTracker* update_mem_tracker() { return _update_mem_tracker.get(); }
     MemTracker* chunk_allocator_mem_tracker() { return _chunk_allocator_mem_tracker.get(); }
+    MemTracker* column_buffer_cache_mem_tracker() { return _column_buffer_cache_mem_tracker.get(); }
+    MemTracker* position_delete_cache_mem_tracker() { return _position_delete_cache_mem_tracker.get(); }
+    MemTracker* parquet_page_cache_mem_tracker() { return _parquet_page_cache_mem_tracker.get(); }
+    MemTracker* short_circuit_row_cache_mem_tracker() { return _short_circuit_row_cache_mem_tracker.get(); }
+    MemTracker* hdfs_file_handle_cache_mem_tracker() { return _hdfs_file_handle_cache_mem_tracker.get(); }
+    MemTracker* inverted_index_query_cache_mem_tracker() { return _inverted_index_query_cache_mem_tracker.get(); }
     MemTracker* clone_mem_tracker() { return _clone_mem_tracker.get(); }
     MemTracker* consistency_mem_tracker() { return _consistency_mem_tracker.get(); }
     MemTracker* replication_mem_tracker() { return _replication_mem_tracker.get(); }
     MemTracker* datacache_mem_tracker() { return _datacache_mem_tracker.get(); }
     std::vector<std::shared_ptr<MemTracker>>& mem_trackers() { return _mem_trackers; }
 
+    // Decompressed pages of the parquet files of external tables, see ColumnChunkReader.
+    LazyLRUCache* parquet_page_cache() { return &_parquet_page_cache; }
+    // Encoded rows of the point lookups of primary key tablets, see LocalTabletReader.
+    LazyLRUCache* short_circuit_row_cache() { return &_short_circuit_row_cache; }
+    // Row positions removed by delete files of iceberg and paimon, see PositionDeleteCache.
+    LazyLRUCache* position_delete_cache() { return &_position_delete_cache; }
+    // Open hdfs files shared by readers, see fs_hdfs.cpp.
+    LazyLRUCache* hdfs_file_handle_cache() { return &_hdfs_file_handle_cache; }
+    // Rowid bitmaps of inverted index queries, see InvertedIndexQueryCache.
+    LazyLRUCache* inverted_index_query_cache() { return &_inverted_index_query_cache; }
+
     int64_t get_storage_page_cache_size();
     int64_t check_storage_page_cache_size(int64_t storage_cache_limit);
     static int64_t calc_max_query_memory(int64_t process_mem_limit, int64_t percent);
@@ -209,6 +227,16 @@ private:
 
     std::shared_ptr<MemTracker> _chunk_allocator_mem_tracker;
 
+    // The memory of the column buffers cached by CachedColumnAllocator
+    std::shared_ptr<MemTracker> _column_buffer_cache_mem_tracker;
+
+    // The memory of the entries of the LazyLRUCaches below
+    std::shared_ptr<MemTracker> _position_delete_cache_mem_tracker;
+    std::shared_ptr<MemTracker> _parquet_page_cache_mem_tracker;
+    std::shared_ptr<MemTracker> _short_circuit_row_cache_mem_tracker;
+    std::shared_ptr<MemTracker> _hdfs_file_handle_cache_mem_tracker;
+    std::shared_ptr<MemTracker> _inverted_index_query_cache_mem_tracker;
+
     std::shared_ptr<MemTracker> _clone_mem_tracker;
 
     std::shared_ptr<MemTracker> _consistency_mem_tracker;
@@ -219,6 +247,13 @@ private:
     std::shared_ptr<MemTracker> _datacache_mem_tracker;
 
     std::vector<std::shared_ptr<MemTracker>> _mem_trackers;
+
+    // Declared after the mem trackers, so that they are destroyed before the trackers.
+    LazyLRUCache _parquet_page_cache;
+    LazyLRUCache _short_circuit_row_cache;
+    LazyLRUCache _position_delete_cache;
+    LazyLRUCache _hdfs_file_handle_cache;
+    LazyLRUCache _inverted_index_query_cache;
 };
 
 // Execution environment for queries/plan fragments.
@@ -275,6 +310,7 @@ public:
     PriorityThreadPool* query_rpc_pool() { return _query_rpc_pool; }
     ThreadPool* load_rpc_pool() { return _load_rpc_pool.get(); }
     ThreadPool* dictionary_cache_pool() { return _dictionary_cache_pool.get(); }
+    ThreadPool* segment_writer_pool() { return _segment_writer_pool.get(); }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     BaseLoadPathMgr* load_path_mgr() { return _load_path_mgr; }
     BfdParser* bfd_parser() const { return _bfd_parser; }
@@ -294,6 +330,10 @@ public:
 
     ThreadPool* automatic_partition_pool() { return _automatic_partition_pool.get(); }
 
+    ThreadPool* lake_schema_change_pool() { return _lake_schema_change_pool.get(); }
+
+    ThreadPool* object_storage_hedge_read_pool() { return _object_storage_hedge_read_pool.get(); }
+
     RuntimeFilterWorker* runtime_filter_worker() { return _runtime_filter_worker; }
 
     RuntimeFilterCache* runtime_filter_cache() { return _runtime_filter_cache; }
@@ -358,6 +398,7 @@ private:
     PriorityThreadPool* _query_rpc_pool = nullptr;
     std::unique_ptr<ThreadPool> _load_rpc_pool;
     std::unique_ptr<ThreadPool> _dictionary_cache_pool;
+    std::unique_ptr<ThreadPool> _segment_writer_pool;
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::QueryContextManager* _query_context_mgr = nullptr;
     std::unique_ptr<workgroup::WorkGroupManager> _workgroup_manager;
@@ -383,6 +424,10 @@ private:
 
     std::unique_ptr<ThreadPool> _automatic_partition_pool;
 
+    std::unique_ptr<ThreadPool> _lake_schema_change_pool;
+
+    std::unique_ptr<ThreadPool> _object_storage_hedge_read_pool;
+
     RuntimeFilterWorker* _runtime_filter_worker = nullptr;
     RuntimeFilterCache* _runtime_filter_cache = nullptr;
 
@@ -29,10 +29,12 @@
 namespace starrocks {
 
 HttpResultWriter::HttpResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
-                                   RuntimeProfile* parent_profile, TResultSinkFormatType::type format_type)
+                                   RuntimeProfile* parent_profile, TResultSinkFormatType::type format_type,
+                                   size_t max_row_buffer_size)
         : _sinker(sinker),
           _output_expr_ctxs(output_expr_ctxs),
           _parent_profile(parent_profile),
+          _max_row_buffer_size(max_row_buffer_size),
           _format_type(format_type) {}
 
 Status HttpResultWriter::init(RuntimeState* state) {
@@ -103,8 +105,9 @@ StatusOr<TFetchDataResultPtrs> HttpResultWriter::process_chunk(Chunk* chunk) {
         int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
         auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        // Points to the rows of the batch being filled, it moves to a new batch when the current one is full.
+        auto* result_rows = &result->result_batch.rows;
+        result_rows->resize(num_rows);
 
         for (int i = 0; i < num_rows; ++i) {
             switch (_format_type) {
@@ -117,19 +120,19 @@ StatusOr<TFetchDataResultPtrs> HttpResultWriter::process_chunk(Chunk* chunk) {
             size_t len = _row_str.size();
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+                result_rows->resize(current_rows);
                 results.emplace_back(std::move(result));
 
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
+                result_rows = &result->result_batch.rows;
+                result_rows->resize(num_rows - i);
 
                 current_bytes = 0;
                 current_rows = 0;
             }
 
             // VLOG_ROW << "written row:" << row_str;
-            result_rows[current_rows] = std::move(_row_str);
+            (*result_rows)[current_rows] = std::move(_row_str);
             _row_str.clear();
 
             _row_str.reserve(len * 1.1);
@@ -138,7 +141,7 @@ StatusOr<TFetchDataResultPtrs> HttpResultWriter::process_chunk(Chunk* chunk) {
             current_rows += 1;
         }
         if (current_rows > 0) {
-            result_rows.resize(current_rows);
+            result_rows->resize(current_rows);
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
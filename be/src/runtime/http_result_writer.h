@@ -49,8 +49,11 @@ using TFetchDataResultPtrs = std::vector<TFetchDataResultPtr>;
 // convert the row batch to mysql protocol row
 class HttpResultWriter final : public ResultWriter {
 public:
+    static constexpr size_t DEFAULT_MAX_ROW_BUFFER_SIZE = 1024 * 1024 * 1024;
+
     HttpResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
-                     RuntimeProfile* parent_profile, TResultSinkFormatType::type format_type);
+                     RuntimeProfile* parent_profile, TResultSinkFormatType::type format_type,
+                     size_t max_row_buffer_size = DEFAULT_MAX_ROW_BUFFER_SIZE);
 
     Status init(RuntimeState* state) override;
 
@@ -81,7 +84,8 @@ private:
     // number of sent rows
     RuntimeProfile::Counter* _sent_rows_counter = nullptr;
 
-    const size_t _max_row_buffer_size = 1024 * 1024 * 1024;
+    // the bytes of the rows in one TFetchDataResult
+    const size_t _max_row_buffer_size;
 
     // result's format, right now just support json format
     TResultSinkFormatType::type _format_type;
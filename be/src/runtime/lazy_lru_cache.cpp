@@ -0,0 +1,147 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/lazy_lru_cache.h"
+
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+namespace {
+
+// Keep the mem trackers consistent with the mem hook, which doesn't track the allocations in BE_TEST.
+void current_thread_mem_consume(int64_t size) {
+#ifndef BE_TEST
+    if (LIKELY(tls_is_thread_status_init)) {
+        tls_thread_status.mem_consume(size);
+    } else {
+        CurrentThread::mem_consume_without_cache(size);
+    }
+#endif
+}
+
+void current_thread_mem_release(int64_t size) {
+#ifndef BE_TEST
+    if (LIKELY(tls_is_thread_status_init)) {
+        tls_thread_status.mem_release(size);
+    } else {
+        CurrentThread::mem_release_without_cache(size);
+    }
+#endif
+}
+
+} // namespace
+
+void LazyLRUCache::open(std::function<int64_t()> capacity, MemTracker* mem_tracker) {
+    std::lock_guard l(_mutex);
+    _capacity = std::move(capacity);
+    _mem_tracker.store(mem_tracker, std::memory_order_relaxed);
+    _closed.store(false, std::memory_order_release);
+}
+
+void LazyLRUCache::close() {
+    _closed.store(true, std::memory_order_release);
+    std::lock_guard l(_mutex);
+    if (_cache != nullptr) {
+        _cache->prune();
+    }
+}
+
+void LazyLRUCache::reset() {
+    std::lock_guard l(_mutex);
+    _closed.store(true, std::memory_order_release);
+    _cache_ptr.store(nullptr, std::memory_order_release);
+    _cache.reset();
+    _applied_capacity = 0;
+}
+
+Cache* LazyLRUCache::_get() {
+    if (_closed.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    int64_t capacity = _capacity();
+    Cache* cache = _cache_ptr.load(std::memory_order_acquire);
+    if (capacity <= 0) {
+        // the entries are freed at once when the cache is disabled at runtime
+        if (cache != nullptr && _applied_capacity.exchange(0) != 0) {
+            cache->set_capacity(0);
+        }
+        return nullptr;
+    }
+    if (cache == nullptr) {
+        std::lock_guard l(_mutex);
+        if (_closed.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        if (_cache == nullptr) {
+            _cache.reset(new_lru_cache(capacity));
+            _applied_capacity = capacity;
+            _cache_ptr.store(_cache.get(), std::memory_order_release);
+        }
+        cache = _cache.get();
+    }
+    if (_applied_capacity.exchange(capacity) != capacity) {
+        cache->set_capacity(capacity);
+    }
+    return cache;
+}
+
+Cache::Handle* LazyLRUCache::lookup(const CacheKey& key) {
+    Cache* cache = _get();
+    return cache != nullptr ? cache->lookup(key) : nullptr;
+}
+
+void* LazyLRUCache::value(Cache::Handle* handle) {
+    return reinterpret_cast<Entry*>(_cache_ptr.load(std::memory_order_acquire)->value(handle))->value;
+}
+
+void LazyLRUCache::release(Cache::Handle* handle) {
+    if (handle != nullptr) {
+        _cache_ptr.load(std::memory_order_acquire)->release(handle);
+    }
+}
+
+void LazyLRUCache::erase(const CacheKey& key) {
+    if (Cache* cache = _cache_ptr.load(std::memory_order_acquire); cache != nullptr) {
+        cache->erase(key);
+    }
+}
+
+Cache::Handle* LazyLRUCache::insert(const CacheKey& key, void* value, size_t charge, int64_t mem_size,
+                                    Deleter deleter, CachePriority priority) {
+    Cache* cache = _get();
+    if (cache == nullptr) {
+        deleter(key, value);
+        return nullptr;
+    }
+    auto* entry = new Entry{value, deleter, mem_tracker(), mem_size + static_cast<int64_t>(sizeof(Entry))};
+    if (entry->mem_tracker != nullptr) {
+        current_thread_mem_release(entry->mem_size);
+        entry->mem_tracker->consume(entry->mem_size);
+    }
+    return cache->insert(key, entry, charge, _delete_entry, priority, charge);
+}
+
+void LazyLRUCache::_delete_entry(const CacheKey& key, void* value) {
+    auto* entry = reinterpret_cast<Entry*>(value);
+    if (entry->mem_tracker != nullptr) {
+        entry->mem_tracker->release(entry->mem_size);
+        current_thread_mem_consume(entry->mem_size);
+    }
+    entry->deleter(key, entry->value);
+    delete entry;
+}
+
+} // namespace starrocks
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// A process wide LRU cache sized by a mutable config, owned by GlobalEnv. The cache is created on the first
+// use after a positive capacity is configured and is resized when the config changes. A capacity of 0 frees
+// the entries not in use and disables the cache.
+//
+// The memory of an entry is moved from the mem tracker of the thread inserting it to the mem tracker of the
+// cache, and back to the thread that deletes it, so cached entries are not charged to the query that happened
+// to insert them.
+class LazyLRUCache {
+public:
+    using Deleter = void (*)(const CacheKey& key, void* value);
+
+    LazyLRUCache() = default;
+    ~LazyLRUCache() { reset(); }
+
+    LazyLRUCache(const LazyLRUCache&) = delete;
+    void operator=(const LazyLRUCache&) = delete;
+
+    // Starts caching. |capacity| returns the latest capacity in bytes, or in entries for caches whose
+    // charge is an entry count, the memory of the entries is charged to |mem_tracker|.
+    void open(std::function<int64_t()> capacity, MemTracker* mem_tracker);
+
+    // Stops caching and frees the entries not in use, the others are freed when they are released.
+    void close();
+
+    // Closes the cache and frees it. All the handles must have been released.
+    void reset();
+
+    // Returns false if the cache is closed or disabled by its capacity.
+    bool enabled() { return _get() != nullptr; }
+
+    // Same as Cache::lookup, returns nullptr if the cache is not enabled.
+    Cache::Handle* lookup(const CacheKey& key);
+
+    void* value(Cache::Handle* handle);
+
+    // Does nothing if |handle| is nullptr.
+    void release(Cache::Handle* handle);
+
+    void erase(const CacheKey& key);
+
+    // Same as Cache::insert. |mem_size| is the memory allocated for |value|. If the cache is not enabled,
+    // |value| is deleted at once and nullptr is returned.
+    Cache::Handle* insert(const CacheKey& key, void* value, size_t charge, int64_t mem_size, Deleter deleter,
+                          CachePriority priority = CachePriority::NORMAL);
+
+    MemTracker* mem_tracker() const { return _mem_tracker.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry {
+        void* value;
+        Deleter deleter;
+        MemTracker* mem_tracker;
+        int64_t mem_size;
+    };
+
+    static void _delete_entry(const CacheKey& key, void* value);
+
+    Cache* _get();
+
+    std::function<int64_t()> _capacity;
+    std::atomic<MemTracker*> _mem_tracker{nullptr};
+    std::atomic<bool> _closed{true};
+
+    std::mutex _mutex;
+    // created under |_mutex|, read without it through |_cache_ptr|
+    std::unique_ptr<Cache> _cache;
+    std::atomic<Cache*> _cache_ptr{nullptr};
+    std::atomic<int64_t> _applied_capacity{0};
+};
+
+} // namespace starrocks
@@ -16,9 +16,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <unordered_map>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -452,6 +454,16 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
     }
 }
 
+size_t LocalTabletsChannel::num_memtables_to_reclaim(const std::vector<int64_t>& memtable_sizes,
+                                                     int64_t bytes_to_reclaim, int64_t flushing_bytes) {
+    size_t num = 0;
+    int64_t reclaimed_bytes = flushing_bytes;
+    while (num < memtable_sizes.size() && reclaimed_bytes < bytes_to_reclaim) {
+        reclaimed_bytes += memtable_sizes[num++];
+    }
+    return num;
+}
+
 void LocalTabletsChannel::_flush_stale_memtables() {
     if (_immutable_partition_ids.empty() && config::stale_memtable_flush_time_sec <= 0) {
         return;
@@ -472,10 +484,15 @@ void LocalTabletsChannel::_flush_stale_memtables() {
     int64_t total_flush_bytes = 0;
     int64_t total_flush_writer = 0;
     int64_t total_active_writer = 0;
+    // memory of the memtables that were queued or being flushed before this check
+    int64_t pending_flush_bytes = 0;
+    // memtables that may be flushed to relieve full mem usage, picked by size after the stale ones are flushed
+    std::vector<std::tuple<int64_t, int64_t, AsyncDeltaWriter*>> flush_candidates;
     for (auto& [tablet_id, writer] : _delta_writers) {
         bool need_flush = false;
         auto last_write_ts = writer->last_write_ts();
         if (last_write_ts > 0) {
+            pending_flush_bytes += writer->get_flush_stats().pending_flush_bytes;
             if (_immutable_partition_ids.count(writer->partition_id()) > 0) {
                 if (high_mem_usage) {
                     // immutable tablet flush stale memtable immediately when high mem usage
@@ -491,9 +508,13 @@ void LocalTabletsChannel::_flush_stale_memtables() {
                 if (high_mem_usage && now - last_write_ts > config::stale_memtable_flush_time_sec) {
                     need_flush = true;
                 }
-                // when full mem usage, flush all memtable which size is larger than 1/4 of write_buffer_size
-                if (full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
-                    need_flush = true;
+                // when full mem usage, flush memtables which size is larger than 1/4 of write_buffer_size
+                if (!need_flush && full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
+                    if (config::enable_flush_largest_memtables_first) {
+                        flush_candidates.emplace_back(writer->write_buffer_size(), tablet_id, writer.get());
+                    } else {
+                        need_flush = true;
+                    }
                 }
             }
             // has write means active writer
@@ -513,6 +534,36 @@ void LocalTabletsChannel::_flush_stale_memtables() {
         }
     }
 
+    if (!flush_candidates.empty()) {
+        // only reclaim what brings the usage back under the high watermark, the largest memtables first
+        auto bytes_above_high_watermark = [](MemTracker* tracker) {
+            return tracker->limit() < 0 ? 0 : tracker->consumption() - tracker->limit() * 70 / 100;
+        };
+        int64_t bytes_to_reclaim = bytes_above_high_watermark(_mem_tracker);
+        if (_mem_tracker->parent() != nullptr) {
+            bytes_to_reclaim = std::max(bytes_to_reclaim, bytes_above_high_watermark(_mem_tracker->parent()));
+        }
+        std::sort(flush_candidates.begin(), flush_candidates.end(),
+                  [](const auto& lhs, const auto& rhs) { return std::get<0>(lhs) > std::get<0>(rhs); });
+        std::vector<int64_t> candidate_sizes;
+        candidate_sizes.reserve(flush_candidates.size());
+        for (const auto& candidate : flush_candidates) {
+            candidate_sizes.push_back(std::get<0>(candidate));
+        }
+        // the stale memtables flushed above are freed as well
+        size_t num_to_flush =
+                num_memtables_to_reclaim(candidate_sizes, bytes_to_reclaim, pending_flush_bytes + total_flush_bytes);
+        for (size_t i = 0; i < num_to_flush; i++) {
+            auto& [buffer_size, tablet_id, writer] = flush_candidates[i];
+            VLOG(1) << "Flush large memtable tablet_id: " << tablet_id << " txn_id: " << _txn_id
+                    << " partition_id: " << writer->partition_id() << " write_buffer_size: " << buffer_size
+                    << " bytes_to_reclaim: " << bytes_to_reclaim << " pending_flush_bytes: " << pending_flush_bytes;
+            total_flush_bytes += buffer_size;
+            ++total_flush_writer;
+            writer->flush();
+        }
+    }
+
     if (total_flush_bytes > 0 || total_flush_writer > 0) {
         LOG(INFO) << "Flush stale memtable txn_id: " << _txn_id << " total_flush_bytes: " << total_flush_bytes
                   << " total_flush_writer: " << total_flush_writer << " total_active_writer: " << total_active_writer
@@ -66,6 +66,11 @@ public:
 
     MemTracker* mem_tracker() { return _mem_tracker; }
 
+    // Returns how many of the memtables, sorted by size in descending order, have to be flushed to reclaim
+    // |bytes_to_reclaim|, given |flushing_bytes| that will already be freed by the memtables submitted before.
+    static size_t num_memtables_to_reclaim(const std::vector<int64_t>& memtable_sizes, int64_t bytes_to_reclaim,
+                                           int64_t flushing_bytes);
+
 private:
     using BThreadCountDownLatch = GenericCountDownLatch<bthread::Mutex, bthread::ConditionVariable>;
 
@@ -14,8 +14,156 @@
 
 #include "runtime/memory/column_allocator.h"
 
+#include <malloc.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+
 namespace starrocks {
 
-MemHookAllocator kDefaultColumnAllocator = MemHookAllocator{};
+namespace {
+
+constexpr int kMinSizeClass = 12; // 4KB
+constexpr int kMaxSizeClass = 20; // 1MB
+constexpr int kMaxBuffersPerSizeClass = 8;
+
+// Keep the mem trackers consistent with the mem hook, which doesn't track them in BE_TEST.
+#ifndef BE_TEST
+void mem_consume(int64_t size) {
+    if (LIKELY(tls_is_thread_status_init)) {
+        tls_thread_status.mem_consume(size);
+    } else {
+        CurrentThread::mem_consume_without_cache(size);
+    }
+}
+
+bool try_mem_consume(int64_t size) {
+    if (LIKELY(tls_is_thread_status_init)) {
+        return tls_thread_status.try_mem_consume(size);
+    } else {
+        return CurrentThread::try_mem_consume_without_cache(size);
+    }
+}
+
+void mem_release(int64_t size) {
+    if (LIKELY(tls_is_thread_status_init)) {
+        tls_thread_status.mem_release(size);
+    } else {
+        CurrentThread::mem_release_without_cache(size);
+    }
+}
+#else
+void mem_consume(int64_t size) {}
+bool try_mem_consume(int64_t size) {
+    return true;
+}
+void mem_release(int64_t size) {}
+#endif
+
+// The cached buffers are charged to it, instead of the trackers of the queries which freed them.
+std::atomic<MemTracker*> g_column_buffer_cache_mem_tracker = nullptr;
+
+void cache_tracker_consume(int64_t size) {
+    if (auto* tracker = g_column_buffer_cache_mem_tracker.load(std::memory_order_relaxed); tracker != nullptr) {
+        tracker->consume(size);
+    }
+}
+
+void cache_tracker_release(int64_t size) {
+    if (auto* tracker = g_column_buffer_cache_mem_tracker.load(std::memory_order_relaxed); tracker != nullptr) {
+        tracker->release(size);
+    }
+}
+
+// Buffers of size class c have a usable size in [2^c, 2^(c+1)).
+struct ColumnBufferCache {
+    struct SizeClass {
+        void* buffers[kMaxBuffersPerSizeClass];
+        int num_buffers = 0;
+    };
+
+    ~ColumnBufferCache();
+
+    SizeClass size_classes[kMaxSizeClass - kMinSizeClass + 1];
+    size_t cached_bytes = 0;
+};
+
+// Buffers freed by the destructors of other thread locals after the cache is gone go to free(3).
+thread_local bool tls_column_buffer_cache_destroyed = false;
+thread_local ColumnBufferCache tls_column_buffer_cache;
+
+ColumnBufferCache::~ColumnBufferCache() {
+    tls_column_buffer_cache_destroyed = true;
+    for (auto& size_class : size_classes) {
+        for (int i = 0; i < size_class.num_buffers; i++) {
+            // consumed first as the mem hook releases it again
+            size_t usable_size = malloc_usable_size(size_class.buffers[i]);
+            cache_tracker_release(usable_size);
+            mem_consume(usable_size);
+            ::free(size_class.buffers[i]);
+        }
+        size_class.num_buffers = 0;
+    }
+    cached_bytes = 0;
+}
+
+} // namespace
+
+void* CachedColumnAllocator::alloc(size_t size) {
+    // small allocations aren't served from the cache, a buffer is at most twice as large as requested
+    if (size > (1UL << (kMinSizeClass - 1)) && size <= (1UL << kMaxSizeClass) && !tls_column_buffer_cache_destroyed) {
+        // the smallest size class whose buffers are all large enough
+        int size_class = std::max(64 - __builtin_clzll(size - 1), kMinSizeClass);
+        auto& cache = tls_column_buffer_cache;
+        auto& buffers = cache.size_classes[size_class - kMinSizeClass];
+        if (buffers.num_buffers > 0) {
+            void* ptr = buffers.buffers[buffers.num_buffers - 1];
+            size_t usable_size = malloc_usable_size(ptr);
+            // otherwise the allocation goes to malloc(3), which reports the exceeded limit
+            if (try_mem_consume(usable_size)) {
+                cache_tracker_release(usable_size);
+                buffers.num_buffers--;
+                cache.cached_bytes -= usable_size;
+                return ptr;
+            }
+        }
+    }
+    return ::malloc(size);
+}
+
+void CachedColumnAllocator::free(void* ptr) {
+    if (ptr != nullptr && !tls_column_buffer_cache_destroyed) {
+        size_t usable_size = malloc_usable_size(ptr);
+        int size_class = 63 - __builtin_clzll(usable_size);
+        auto& cache = tls_column_buffer_cache;
+        int64_t cached_bytes = cache.cached_bytes + usable_size;
+        if (size_class >= kMinSizeClass && size_class <= kMaxSizeClass &&
+            cached_bytes <= config::column_buffer_cache_max_bytes_per_thread) {
+            auto& buffers = cache.size_classes[size_class - kMinSizeClass];
+            if (buffers.num_buffers < kMaxBuffersPerSizeClass) {
+                mem_release(usable_size);
+                cache_tracker_consume(usable_size);
+                buffers.buffers[buffers.num_buffers++] = ptr;
+                cache.cached_bytes += usable_size;
+                return;
+            }
+        }
+    }
+    ::free(ptr);
+}
+
+void CachedColumnAllocator::set_mem_tracker(MemTracker* mem_tracker) {
+    g_column_buffer_cache_mem_tracker.store(mem_tracker, std::memory_order_relaxed);
+}
+
+size_t CachedColumnAllocator::thread_cached_bytes() {
+    return tls_column_buffer_cache_destroyed ? 0 : tls_column_buffer_cache.cached_bytes;
+}
+
+CachedColumnAllocator kDefaultColumnAllocator = CachedColumnAllocator{};
 
-}
\ No newline at end of file
+} // namespace starrocks
@@ -22,7 +22,28 @@
 
 namespace starrocks {
 
-extern MemHookAllocator kDefaultColumnAllocator;
+class MemTracker;
+
+// Column buffers are allocated and freed again for every chunk, e.g. each operator fills a new
+// 4096-row chunk with buffers of the same sizes as the previous one. Freed buffers of 4KB to 1MB are
+// kept in a small thread local cache and handed to the next allocation of the same size class.
+// A cached buffer is moved from the current mem tracker to the column_buffer_cache mem tracker and
+// consumed by the current mem tracker again when reused, so buffers can be reused across queries.
+// The cached bytes per thread are bounded by config::column_buffer_cache_max_bytes_per_thread.
+class CachedColumnAllocator final : public MemHookAllocator {
+public:
+    void* alloc(size_t size) override;
+
+    void free(void* ptr) override;
+
+    // The mem tracker charged with the buffers cached by all threads, nullptr to not track them.
+    static void set_mem_tracker(MemTracker* mem_tracker);
+
+    // Bytes cached by the current thread.
+    static size_t thread_cached_bytes();
+};
+
+extern CachedColumnAllocator kDefaultColumnAllocator;
 inline thread_local Allocator* tls_column_allocator = &kDefaultColumnAllocator;
 
 template <class T>
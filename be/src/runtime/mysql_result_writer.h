@@ -49,8 +49,11 @@ using TFetchDataResultPtrs = std::vector<TFetchDataResultPtr>;
 // convert the row batch to mysql protocol row
 class MysqlResultWriter final : public ResultWriter {
 public:
+    static constexpr size_t DEFAULT_MAX_ROW_BUFFER_SIZE = 1024 * 1024 * 1024;
+
     MysqlResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
-                      bool is_binary_format, RuntimeProfile* parent_profile);
+                      bool is_binary_format, RuntimeProfile* parent_profile,
+                      size_t max_row_buffer_size = DEFAULT_MAX_ROW_BUFFER_SIZE);
 
     ~MysqlResultWriter() override;
 
@@ -84,7 +87,8 @@ private:
     // number of sent rows
     RuntimeProfile::Counter* _sent_rows_counter = nullptr;
 
-    const size_t _max_row_buffer_size = 1024 * 1024 * 1024;
+    // the bytes of the rows in one TFetchDataResult
+    const size_t _max_row_buffer_size;
 };
 
 } // namespace starrocks
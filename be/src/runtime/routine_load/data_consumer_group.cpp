@@ -137,6 +137,17 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
         }
     }
 
+    // Messages are taken from the queue in batches, so that this thread doesn't lock it for every message.
+    // The ones not processed when the group is done are deleted here, as they are no longer in the queue.
+    std::vector<RdKafka::Message*> msgs;
+    msgs.reserve(kMaxMessagesPerGet);
+    size_t next_msg = 0;
+    DeferOp delete_unprocessed_msgs([&] {
+        for (size_t i = next_msg; i < msgs.size(); ++i) {
+            delete msgs[i];
+        }
+    });
+
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
@@ -192,9 +203,13 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
-        if (res) {
+        if (next_msg == msgs.size()) {
+            msgs.clear();
+            next_msg = 0;
+            _queue.blocking_get_batch(&msgs, kMaxMessagesPerGet);
+        }
+        if (next_msg < msgs.size()) {
+            RdKafka::Message* msg = msgs[next_msg++];
             VLOG(3) << "get kafka message"
                     << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
             DeferOp msgDeleter([&] { delete msg; });
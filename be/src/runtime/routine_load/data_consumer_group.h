@@ -94,6 +94,9 @@ private:
                         int64_t max_running_time_ms, const ConsumeFinishCallback& cb);
 
 private:
+    // Max number of messages start_all() takes from |_queue| at once.
+    static constexpr size_t kMaxMessagesPerGet = 64;
+
     // blocking queue to receive msgs from all consumers
     TimedBlockingQueue<RdKafka::Message*> _queue;
 };
@@ -14,6 +14,7 @@
 
 #include "runtime/time_types.h"
 
+#include <cstring>
 #include <string>
 
 #include "gutil/strings/substitute.h"
@@ -423,6 +424,60 @@ bool date::from_string_to_datetime_internal(const char* ptr_date, const char* pt
 
     return true;
 }
+// Whether each byte of |v| at the positions set in |digit_mask| is a digit.
+static inline bool swar_is_digits(uint64_t v, uint64_t digit_mask) {
+    constexpr uint64_t ZEROS = 0x3030303030303030ULL;
+    constexpr uint64_t HIGH_NIBBLES = 0xF0F0F0F0F0F0F0F0ULL;
+    // the other bytes are replaced by '0', a byte is a digit if its high nibble is 3 and it's still 3 after adding 6
+    uint64_t x = (v & digit_mask) | (ZEROS & ~digit_mask);
+    return (x & HIGH_NIBBLES) == ZEROS && ((x + 0x0606060606060606ULL) & HIGH_NIBBLES) == ZEROS;
+}
+
+static inline int two_digits(const char* p) {
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+bool date::from_standard_datetime_string(const char* date_str, size_t len, ToDatetimeResult* res) {
+    // "YYYY-MM-DD HH:MM:SS" and at most 6 digits of fraction after a '.'
+    if ((len != 19 && (len < 21 || len > 26)) || date_str[4] != '-' || date_str[7] != '-' ||
+        (date_str[10] != ' ' && date_str[10] != 'T') || date_str[13] != ':' || date_str[16] != ':') {
+        return false;
+    }
+    uint64_t word0;
+    uint64_t word1;
+    memcpy(&word0, date_str, sizeof(word0));
+    memcpy(&word1, date_str + 8, sizeof(word1));
+    // "YYYY-MM-" and "DD HH:MM", in little endian the first char is the lowest byte
+    if (!swar_is_digits(word0, 0x00FFFF00FFFFFFFFULL) || !swar_is_digits(word1, 0xFFFF00FFFF00FFFFULL) ||
+        !isdigit(date_str[17]) || !isdigit(date_str[18])) {
+        return false;
+    }
+
+    int microsecond = 0;
+    if (len > 19) {
+        if (date_str[19] != '.') {
+            return false;
+        }
+        for (size_t i = 20; i < len; i++) {
+            if (!isdigit(date_str[i])) {
+                return false;
+            }
+            microsecond = microsecond * 10 + (date_str[i] - '0');
+        }
+        microsecond *= LOG_10_INT[26 - len];
+    }
+
+    res->year = two_digits(date_str) * 100 + two_digits(date_str + 2);
+    res->month = two_digits(date_str + 5);
+    res->day = two_digits(date_str + 8);
+    res->hour = two_digits(date_str + 11);
+    res->minute = two_digits(date_str + 14);
+    res->second = two_digits(date_str + 17);
+    res->microsecond = microsecond;
+    return res->month <= 12 && res->day <= DAYS_IN_MONTH[is_leap(res->year)][res->month] && res->hour <= 23 &&
+           res->minute <= 59 && res->second <= 59;
+}
+
 // if string content is 10 chars try to process based on "%Y-%m-%d",
 //    if successful return result;
 //    else failed use uncommon approach.
@@ -438,6 +493,10 @@ bool date::from_string_to_datetime_internal(const char* ptr_date, const char* pt
 std::pair<bool, bool> date::from_string_to_datetime(const char* date_str, size_t len, ToDatetimeResult* res) {
     auto& [year, month, day, hour, minute, second, microsecond] = *res;
 
+    if (from_standard_datetime_string(date_str, len, res)) {
+        return {true, false};
+    }
+
     const char* ptr = date_str;
     const char* end = date_str + len;
     // Skip space character
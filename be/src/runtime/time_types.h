@@ -169,6 +169,11 @@ public:
 
     static std::pair<bool, bool> from_string_to_datetime(const char* date_str, size_t len, ToDatetimeResult* res);
 
+    // Parse a string exactly in "%Y-%m-%d %H:%i:%s" or "%Y-%m-%d %H:%i:%s.%f" ('T' is also allowed between
+    // the date and the time), the digits are validated 8 at a time instead of char by char.
+    // Returns false if it isn't exactly in these formats or out of range, use from_string_to_datetime then.
+    static bool from_standard_datetime_string(const char* date_str, size_t len, ToDatetimeResult* res);
+
 public:
     // from_date(1970, 1, 1)
     static constexpr JulianDate UNIX_EPOCH_JULIAN = 2440588;
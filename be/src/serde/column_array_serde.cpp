@@ -381,19 +381,37 @@ public:
 class NullableColumnSerde {
 public:
     static int64_t max_serialized_size(const NullableColumn& column, const int encode_level) {
-        return serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
+        int64_t size = EncodeContext::enable_encode_null_map(encode_level) ? sizeof(uint8_t) : 0;
+        return size + serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
                serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
     }
 
     static uint8_t* serialize(const NullableColumn& column, uint8_t* buff, const int encode_level) {
-        buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        if (EncodeContext::enable_encode_null_map(encode_level)) {
+            uint8_t has_null = column.has_null();
+            buff = write_raw(&has_null, sizeof(has_null), buff);
+            if (has_null) {
+                buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+            }
+        } else {
+            buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        }
         buff = serde::ColumnArraySerde::serialize(*column.data_column(), buff, false, encode_level);
         return buff;
     }
 
     static const uint8_t* deserialize(const uint8_t* buff, NullableColumn* column, const int encode_level) {
-        buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        uint8_t has_null = 1;
+        if (EncodeContext::enable_encode_null_map(encode_level)) {
+            buff = read_raw(buff, &has_null, sizeof(has_null));
+        }
+        if (has_null) {
+            buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        }
         buff = serde::ColumnArraySerde::deserialize(buff, column->data_column().get(), false, encode_level);
+        if (!has_null) {
+            column->null_column_data().assign(column->data_column()->size(), 0);
+        }
         column->update_has_null();
         return buff;
     }
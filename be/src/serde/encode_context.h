@@ -61,9 +61,21 @@ public:
 
     static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
 
+    // the null map of a nullable column without nulls is replaced by a single flag byte.
+    // Negative levels disable it, as they are not a combination of encoding bits.
+    static bool enable_encode_null_map(const int encode_level) {
+        return encode_level > 0 && (encode_level & ENCODE_NULL_MAP);
+    }
+
+    // clear the null map encoding bit, for the senders whose receivers may not be able to decode it.
+    static int disable_encode_null_map(const int encode_level) {
+        return encode_level > 0 ? encode_level & ~ENCODE_NULL_MAP : encode_level;
+    }
+
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
+    static constexpr int ENCODE_NULL_MAP = 8;
 
     // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
     void _adjust(const int col_id);
@@ -460,6 +460,11 @@ Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl,
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_plan_fragment_by_pipeline(const TExecPlanFragmentParams& t_common_param,
                                                                     const TExecPlanFragmentParams& t_unique_request) {
+    if (config::enable_pipeline_async_fragment_execute) {
+        auto status =
+                pipeline::FragmentExecutor::prepare_and_execute_async(_exec_env, t_common_param, t_unique_request);
+        return status.is_duplicate_rpc_invocation() ? Status::OK() : status;
+    }
     pipeline::FragmentExecutor fragment_executor;
     auto status = fragment_executor.prepare(_exec_env, t_common_param, t_unique_request);
     if (status.ok()) {
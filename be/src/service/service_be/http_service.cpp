@@ -39,6 +39,7 @@
 #include "http/action/checksum_action.h"
 #include "http/action/compact_rocksdb_meta_action.h"
 #include "http/action/compaction_action.h"
+#include "http/action/continuous_profiler_action.h"
 #include "http/action/datacache_action.h"
 #include "http/action/greplog_action.h"
 #include "http/action/health_action.h"
@@ -271,6 +272,10 @@ Status HttpServiceBE::start() {
                                       pipeline_driver_poller_action);
     _http_handlers.emplace_back(pipeline_driver_poller_action);
 
+    auto* continuous_profiler_action = new ContinuousProfilerAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/continuous_profiler", continuous_profiler_action);
+    _http_handlers.emplace_back(continuous_profiler_action);
+
     auto* greplog_action = new GrepLogAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/greplog", greplog_action);
     _http_handlers.emplace_back(greplog_action);
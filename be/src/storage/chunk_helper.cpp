@@ -22,6 +22,7 @@
 #include "column/schema.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -463,6 +464,16 @@ ChunkPtr ChunkHelper::createDummyChunk() {
     return dummyChunk;
 }
 
+size_t ChunkHelper::chunk_size_for_row_bytes(size_t row_bytes, size_t chunk_size) {
+    // Fewer rows than this don't amortize the per chunk cost of the operators.
+    constexpr size_t kMinChunkSize = 64;
+    int64_t target_bytes = config::chunk_target_bytes;
+    if (target_bytes <= 0 || row_bytes == 0 || row_bytes * chunk_size <= static_cast<size_t>(target_bytes)) {
+        return chunk_size;
+    }
+    return std::max(static_cast<size_t>(target_bytes) / row_bytes, std::min(kMinChunkSize, chunk_size));
+}
+
 ChunkAccumulator::ChunkAccumulator(size_t desired_size) : _desired_size(desired_size) {}
 
 void ChunkAccumulator::set_desired_size(size_t desired_size) {
@@ -569,12 +580,17 @@ void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     }
 
     if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
-                                  _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
+                                  _mem_usage >= _max_bytes() || _in_chunk->owner_info().is_last_chunk())) {
         _out_chunk = std::move(_in_chunk);
         _mem_usage = 0;
     }
 }
 
+size_t ChunkPipelineAccumulator::_max_bytes() {
+    int64_t max_bytes = config::chunk_accumulator_max_bytes;
+    return max_bytes > 0 ? std::min<size_t>(LOW_WATERMARK_BYTES, max_bytes) : LOW_WATERMARK_BYTES;
+}
+
 void ChunkPipelineAccumulator::reset() {
     _in_chunk.reset();
     _out_chunk.reset();
@@ -71,6 +71,10 @@ public:
 
     static Chunk* new_chunk_pooled(const Schema& schema, size_t n);
 
+    // Rows per chunk not exceeding |chunk_size| that keep a chunk whose rows take |row_bytes|
+    // within `config::chunk_target_bytes`.
+    static size_t chunk_size_for_row_bytes(size_t row_bytes, size_t chunk_size);
+
     // Create a vectorized column from field .
     // REQUIRE: |type| must be scalar type.
     static std::shared_ptr<Column> column_from_field_type(LogicalType type, bool nullable);
@@ -140,6 +144,8 @@ private:
 #else
     static constexpr size_t LOW_WATERMARK_BYTES = 256 * 1024 * 1024; // 256MB.
 #endif
+    static size_t _max_bytes();
+
     ChunkPtr _in_chunk = nullptr;
     ChunkPtr _out_chunk = nullptr;
     size_t _max_size = 4096;
@@ -52,7 +52,7 @@ struct ColumnMapping {
     int32_t ref_column{-1};
 
     // materialized view function.
-    ExprContext* mv_expr_ctx;
+    ExprContext* mv_expr_ctx{nullptr};
 
     // the following data is used by default_value_datum, because default_value_datum only
     // have the reference. We need to keep the content has the same life cycle as the
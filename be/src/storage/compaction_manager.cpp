@@ -14,7 +14,9 @@
 
 #include "storage/compaction_manager.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <thread>
 
 #include "storage/data_dir.h"
@@ -275,17 +277,14 @@ bool CompactionManager::pick_candidate(CompactionCandidate* candidate) {
         return false;
     }
 
+    if (config::compaction_query_scan_score_weight > 0) {
+        return _pick_weighted_candidate(config::compaction_query_scan_score_weight, candidate);
+    }
+
     auto iter = _compaction_candidates.begin();
     while (iter != _compaction_candidates.end()) {
         if (_check_precondition(*iter)) {
-            *candidate = *iter;
-            _compaction_candidates.erase(iter);
-            _last_score = candidate->score;
-            if (candidate->type == CompactionType::BASE_COMPACTION) {
-                StarRocksMetrics::instance()->wait_base_compaction_task_num.increment(-1);
-            } else {
-                StarRocksMetrics::instance()->wait_cumulative_compaction_task_num.increment(-1);
-            }
+            _take_candidate(iter, candidate);
             return true;
         }
         iter++;
@@ -294,6 +293,55 @@ bool CompactionManager::pick_candidate(CompactionCandidate* candidate) {
     return false;
 }
 
+double CompactionManager::weighted_score(double score, int64_t recent_query_scan_count, double weight) {
+    return score * (1 + weight * std::log2(1 + recent_query_scan_count));
+}
+
+bool CompactionManager::_pick_weighted_candidate(double weight, CompactionCandidate* candidate) {
+    // The query scans of a tablet keep changing while it waits in the candidates, so the weight is computed
+    // when picking rather than stored in the score, which stays the raw compaction score reported by metrics.
+    struct WeightedCandidate {
+        double score;
+        // position in _compaction_candidates, which breaks ties between equal weighted scores
+        size_t order;
+        CandidateSet::iterator iter;
+    };
+    std::vector<WeightedCandidate> weighted_candidates;
+    weighted_candidates.reserve(_compaction_candidates.size());
+    size_t order = 0;
+    for (auto iter = _compaction_candidates.begin(); iter != _compaction_candidates.end(); ++iter) {
+        weighted_candidates.push_back(
+                {weighted_score(iter->score, iter->tablet->recent_query_scan_count(), weight), order++, iter});
+    }
+    // The pick holds _candidates_mutex and usually takes one of the first candidates, so rather than sorting all
+    // of them, build a max-heap in linear time and pop only until an eligible candidate is found.
+    auto lower_priority = [](const WeightedCandidate& lhs, const WeightedCandidate& rhs) {
+        return lhs.score < rhs.score || (lhs.score == rhs.score && lhs.order > rhs.order);
+    };
+    std::make_heap(weighted_candidates.begin(), weighted_candidates.end(), lower_priority);
+    while (!weighted_candidates.empty()) {
+        std::pop_heap(weighted_candidates.begin(), weighted_candidates.end(), lower_priority);
+        auto iter = weighted_candidates.back().iter;
+        weighted_candidates.pop_back();
+        if (_check_precondition(*iter)) {
+            _take_candidate(iter, candidate);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompactionManager::_take_candidate(CandidateSet::iterator iter, CompactionCandidate* candidate) {
+    *candidate = *iter;
+    _compaction_candidates.erase(iter);
+    _last_score = candidate->score;
+    if (candidate->type == CompactionType::BASE_COMPACTION) {
+        StarRocksMetrics::instance()->wait_base_compaction_task_num.increment(-1);
+    } else {
+        StarRocksMetrics::instance()->wait_cumulative_compaction_task_num.increment(-1);
+    }
+}
+
 void CompactionManager::_dispatch_worker() {
     while (!_stop.load(std::memory_order_consume)) {
         {
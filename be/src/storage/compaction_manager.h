@@ -53,8 +53,13 @@ public:
 
     void remove_candidate(int64_t tablet_id);
 
+    // Pick the candidate with the highest compaction score, or the highest weighted score if
+    // config::compaction_query_scan_score_weight is positive.
     bool pick_candidate(CompactionCandidate* candidate);
 
+    // The compaction score scaled by 1 + weight * log2(1 + recent query scans of the tablet).
+    static double weighted_score(double score, int64_t recent_query_scan_count, double weight);
+
     void update_tablet_async(const TabletSharedPtr& tablet);
 
     void update_tablet(const TabletSharedPtr& tablet);
@@ -129,6 +134,8 @@ public:
     int get_waiting_task_num();
 
 private:
+    using CandidateSet = std::set<CompactionCandidate, CompactionCandidateComparator>;
+
     CompactionManager(const CompactionManager& compaction_manager) = delete;
     CompactionManager(CompactionManager&& compaction_manager) = delete;
     CompactionManager& operator=(const CompactionManager& compaction_manager) = delete;
@@ -136,6 +143,9 @@ private:
 
     void _dispatch_worker();
     bool _check_precondition(const CompactionCandidate& candidate);
+    // Should be called with _candidates_mutex held.
+    bool _pick_weighted_candidate(double weight, CompactionCandidate* candidate);
+    void _take_candidate(CandidateSet::iterator iter, CompactionCandidate* candidate);
     void _schedule();
     void _notify();
     // wait until current running tasks are below max_concurrent_num
@@ -145,7 +155,7 @@ private:
 
     std::mutex _candidates_mutex;
     // protect by _mutex
-    std::set<CompactionCandidate, CompactionCandidateComparator> _compaction_candidates;
+    CandidateSet _compaction_candidates;
 
     std::mutex _tasks_mutex;
     std::atomic<uint64_t> _next_task_id;
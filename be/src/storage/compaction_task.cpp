@@ -14,6 +14,9 @@
 
 #include "storage/compaction_task.h"
 
+#include <sys/syscall.h>
+#include <unistd.h>
+
 #include <sstream>
 
 #include "runtime/current_thread.h"
@@ -29,6 +32,31 @@
 
 namespace starrocks {
 
+// ioprio_set(2) has no glibc wrapper, these mirror the definitions in linux/ioprio.h
+static constexpr int kIoprioWhoProcess = 1;
+static constexpr int kIoprioClassShift = 13;
+static constexpr int kIoprioClassBestEffort = 2;
+
+// Lower the IO priority of the calling thread according to config::compaction_io_priority_level.
+// Returns true if the priority has been changed and should be reset after the compaction.
+static bool set_compaction_io_priority() {
+    int level = config::compaction_io_priority_level;
+    if (level < 0 || level > 7) {
+        return false;
+    }
+    int ioprio = (kIoprioClassBestEffort << kIoprioClassShift) | level;
+    if (syscall(SYS_ioprio_set, kIoprioWhoProcess, 0, ioprio) != 0) {
+        LOG_EVERY_N(WARNING, 100) << "fail to set compaction io priority, errno: " << errno;
+        return false;
+    }
+    return true;
+}
+
+static void reset_compaction_io_priority() {
+    // class none: the priority is derived from the cpu nice value again
+    (void)syscall(SYS_ioprio_set, kIoprioWhoProcess, 0, 0);
+}
+
 CompactionTask::~CompactionTask() {
     if (_mem_tracker) {
         delete _mem_tracker;
@@ -76,6 +104,12 @@ void CompactionTask::run() {
     TRACE_COUNTER_INCREMENT("input_row_num", _task_info.input_rows_num);
     TRACE_COUNTER_INCREMENT("input_segments_num", _task_info.input_segments_num);
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    bool io_priority_changed = set_compaction_io_priority();
+    DeferOp reset_io_priority([&] {
+        if (io_priority_changed) {
+            reset_compaction_io_priority();
+        }
+    });
 
     bool is_finished = false;
     DeferOp op([&] {
@@ -34,6 +34,7 @@
 
 #include "storage/data_dir.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <set>
 #include <sstream>
@@ -59,6 +60,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -277,10 +279,11 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_tablet = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -294,10 +297,60 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Deserializing the meta and initializing the tablet (e.g. the primary key index meta of updatable
+    // tablets) costs much more than iterating rocksdb, so hand them over to a pool. Tablets are locked by
+    // their shard in TabletManager, loading different tablets concurrently is safe.
+    // The queue is bounded, since each queued task holds a copy of its tablet meta. When it's full, the tablet is
+    // loaded by the iterating thread instead, which also slows the iteration down to the speed of the pool.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_threads_per_data_dir > 1) {
+        Status st = ThreadPoolBuilder("load_tablet")
+                            .set_min_threads(1)
+                            .set_max_threads(config::load_tablet_threads_per_data_dir)
+                            .set_max_queue_size(config::load_tablet_threads_per_data_dir * 4)
+                            .build(&load_tablet_pool);
+        LOG_IF(WARNING, !st.ok()) << "create load tablet pool failed, load tablets serially. path: " << _path
+                                  << " error: " << st;
+    }
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        if (load_tablet_pool != nullptr) {
+            // |value| is only valid during this call
+            auto st = load_tablet_pool->submit_func([&, tablet_id, schema_hash, meta = std::string(value)]() {
+                load_tablet(tablet_id, schema_hash, meta);
+            });
+            if (st.ok()) {
+                return true;
+            }
+        }
+        load_tablet(tablet_id, schema_hash, value);
         return true;
     };
+    // The tablets still loading in the pool count into the timeout of the walk, then wait for all of them anyway,
+    // since they refer to the states of this function.
+    auto wait_load_tablet_pool = [&](int64_t walk_start_ms, int64_t timeout_sec) -> Status {
+        if (load_tablet_pool == nullptr) {
+            return Status::OK();
+        }
+        bool timeout = false;
+        if (timeout_sec > 0) {
+            int64_t remaining_ms = std::max<int64_t>(timeout_sec * 1000 - (MonotonicMillis() - walk_start_ms), 0);
+            timeout = !load_tablet_pool->wait_for(MonoDelta::FromMilliseconds(remaining_ms));
+        }
+        load_tablet_pool->wait();
+        if (timeout) {
+            LOG(WARNING) << "load tablets in the pool timeout, limit: " << timeout_sec * 1000 << "ms";
+            return Status::TimedOut("load tablets timeout");
+        }
+        return Status::OK();
+    };
+    int64_t walk_start = MonotonicMillis();
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    Status wait_status = wait_load_tablet_pool(walk_start, config::load_tablet_timeout_seconds);
+    if (load_tablet_status.ok()) {
+        load_tablet_status = wait_status;
+    }
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -316,7 +369,9 @@ Status DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        (void)wait_load_tablet_pool(MonotonicMillis(), -1);
     }
+    load_tablet_pool.reset();
 
     if (failed_tablet_ids.size() != 0) {
         LOG(ERROR) << "load tablets from header failed"
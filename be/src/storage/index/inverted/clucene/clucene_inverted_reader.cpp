@@ -21,6 +21,7 @@
 
 #include "storage/index/index_descriptor.h"
 #include "storage/index/inverted/clucene/match_operator.h"
+#include "storage/index/inverted/inverted_index_query_cache.h"
 #include "types/logical_type.h"
 #include "util/defer_op.h"
 #include "util/faststring.h"
@@ -57,6 +58,11 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
             << ", column_name: " << column_name << ", search_str: " << search_str;
     std::wstring column_name_ws = std::wstring(column_name.begin(), column_name.end());
 
+    const std::string cache_key = InvertedIndexQueryCache::key(_index_path, column_name, query_type, search_str);
+    if (InvertedIndexQueryCache::lookup(cache_key, bit_map)) {
+        return Status::OK();
+    }
+
     if (!index_exists(_index_path)) {
         LOG(WARNING) << "inverted index path: " << _index_path << " not exist.";
         return Status::NotFound(fmt::format("Not exists index_file {}", _index_path.c_str()));
@@ -112,6 +118,7 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
         LOG(WARNING) << "CLuceneError occured, error msg: " << e.what();
         return Status::InternalError(fmt::format("CLuceneError occured, error msg: {}", e.what()));
     }
+    InvertedIndexQueryCache::insert(cache_key, result);
     bit_map->swap(result);
     return Status::OK();
 }
@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "storage/index/inverted/inverted_index_query_cache.h"
+
+#include "runtime/exec_env.h"
+
+namespace starrocks {
+
+std::string InvertedIndexQueryCache::key(const std::string& index_path, const std::string& column_name,
+                                         InvertedIndexQueryType query_type, const std::string& search_str) {
+    std::string key;
+    key.reserve(index_path.size() + column_name.size() + search_str.size() + 3);
+    key.append(index_path).push_back('\0');
+    key.append(column_name).push_back('\0');
+    key.push_back(static_cast<char>(query_type));
+    key.append(search_str);
+    return key;
+}
+
+bool InvertedIndexQueryCache::lookup(const std::string& key, roaring::Roaring* bit_map) {
+    LazyLRUCache* cache = GlobalEnv::GetInstance()->inverted_index_query_cache();
+    if (!cache->enabled()) {
+        return false;
+    }
+    Cache::Handle* handle = cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return false;
+    }
+    *bit_map = *reinterpret_cast<const roaring::Roaring*>(cache->value(handle));
+    cache->release(handle);
+    return true;
+}
+
+void InvertedIndexQueryCache::insert(const std::string& key, const roaring::Roaring& bit_map) {
+    LazyLRUCache* cache = GlobalEnv::GetInstance()->inverted_index_query_cache();
+    if (!cache->enabled()) {
+        return;
+    }
+    auto* cached = new roaring::Roaring(bit_map);
+    cached->shrinkToFit();
+    int64_t mem_size = sizeof(roaring::Roaring) + cached->getSizeInBytes();
+    cache->release(cache->insert(
+            CacheKey(key), cached, key.size() + mem_size, mem_size,
+            [](const CacheKey& /*key*/, void* value) { delete reinterpret_cast<roaring::Roaring*>(value); }));
+}
+
+} // namespace starrocks
@@ -0,0 +1,37 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <string>
+
+#include "roaring/roaring.hh"
+#include "storage/index/inverted/inverted_index_common.h"
+
+namespace starrocks {
+
+// Results of inverted index queries, the rowid bitmap of a segment, cached in
+// GlobalEnv::inverted_index_query_cache() and shared by all queries. Index files are immutable, so entries never
+// need invalidation, they age out of the LRU.
+class InvertedIndexQueryCache {
+public:
+    static std::string key(const std::string& index_path, const std::string& column_name,
+                           InvertedIndexQueryType query_type, const std::string& search_str);
+
+    // Copies the bitmap cached under |key| to |bit_map|, returns false on a miss or if the cache is disabled.
+    static bool lookup(const std::string& key, roaring::Roaring* bit_map);
+
+    static void insert(const std::string& key, const roaring::Roaring& bit_map);
+};
+
+} // namespace starrocks
@@ -15,7 +15,9 @@
 #include "storage/lake/metacache.h"
 
 #include <bvar/bvar.h>
+#include <type_traits>
 
+#include "common/config.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/del_vector.h"
 #include "storage/lake/tablet_manager.h"
@@ -64,6 +66,27 @@ static bvar::Adder<uint64_t> g_segment_cache_miss;
 static bvar::Window<bvar::Adder<uint64_t>> g_segment_cache_miss_minute("lake", "segment_cache_miss_minute",
                                                                        &g_segment_cache_miss, 60);
 
+// Number of entries dropped from the cache by type, either evicted, replaced or erased
+static bvar::Adder<uint64_t> g_metadata_cache_drop;
+static bvar::Window<bvar::Adder<uint64_t>> g_metadata_cache_drop_minute("lake", "metadata_cache_drop_minute",
+                                                                        &g_metadata_cache_drop, 60);
+
+static bvar::Adder<uint64_t> g_txnlog_cache_drop;
+static bvar::Window<bvar::Adder<uint64_t>> g_txnlog_cache_drop_minute("lake", "txn_log_cache_drop_minute",
+                                                                      &g_txnlog_cache_drop, 60);
+
+static bvar::Adder<uint64_t> g_schema_cache_drop;
+static bvar::Window<bvar::Adder<uint64_t>> g_schema_cache_drop_minute("lake", "schema_cache_drop_minute",
+                                                                      &g_schema_cache_drop, 60);
+
+static bvar::Adder<uint64_t> g_dv_cache_drop;
+static bvar::Window<bvar::Adder<uint64_t>> g_dv_cache_drop_minute("lake", "delvec_cache_drop_minute", &g_dv_cache_drop,
+                                                                  60);
+
+static bvar::Adder<uint64_t> g_segment_cache_drop;
+static bvar::Window<bvar::Adder<uint64_t>> g_segment_cache_drop_minute("lake", "segment_cache_drop_minute",
+                                                                       &g_segment_cache_drop, 60);
+
 #ifndef BE_TEST
 static Metacache* get_metacache() {
     auto mgr = ExecEnv::GetInstance()->lake_tablet_manager();
@@ -88,11 +111,41 @@ Metacache::Metacache(int64_t cache_capacity) : _cache(new_lru_cache(cache_capaci
 
 Metacache::~Metacache() = default;
 
+void Metacache::cache_value_deleter(const CacheKey& /*key*/, void* value) {
+    auto cache_value = static_cast<CacheValue*>(value);
+    std::visit(
+            [](const auto& ptr) {
+                using T = std::decay_t<decltype(ptr)>;
+                if constexpr (std::is_same_v<T, std::shared_ptr<const TabletMetadataPB>>) {
+                    g_metadata_cache_drop << 1;
+                } else if constexpr (std::is_same_v<T, std::shared_ptr<const TxnLogPB>> ||
+                                     std::is_same_v<T, std::shared_ptr<const CombinedTxnLogPB>>) {
+                    g_txnlog_cache_drop << 1;
+                } else if constexpr (std::is_same_v<T, std::shared_ptr<const TabletSchema>>) {
+                    g_schema_cache_drop << 1;
+                } else if constexpr (std::is_same_v<T, std::shared_ptr<const DelVector>>) {
+                    g_dv_cache_drop << 1;
+                } else {
+                    g_segment_cache_drop << 1;
+                }
+            },
+            *cache_value);
+    delete cache_value;
+}
+
 void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size) {
-    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter);
+    insert(key, ptr, size, CachePriority::NORMAL);
+}
+
+void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size, CachePriority priority) {
+    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter, priority);
     _cache->release(handle);
 }
 
+static CachePriority metadata_cache_priority() {
+    return config::lake_metacache_durable_metadata ? CachePriority::DURABLE : CachePriority::NORMAL;
+}
+
 std::shared_ptr<const TabletMetadataPB> Metacache::lookup_tablet_metadata(std::string_view key) {
     auto handle = _cache->lookup(CacheKey(key));
     if (handle == nullptr) {
@@ -240,6 +293,12 @@ void Metacache::cache_tablet_metadata(std::string_view key, std::shared_ptr<cons
     insert(key, value_ptr.release(), metadata->SpaceUsedLong());
 }
 
+void Metacache::cache_latest_tablet_metadata(std::string_view key,
+                                             std::shared_ptr<const TabletMetadataPB> metadata) {
+    auto value_ptr = std::make_unique<CacheValue>(metadata);
+    insert(key, value_ptr.release(), metadata->SpaceUsedLong(), metadata_cache_priority());
+}
+
 void Metacache::cache_txn_log(std::string_view key, std::shared_ptr<const TxnLogPB> log) {
     auto value_ptr = std::make_unique<CacheValue>(log);
     insert(key, value_ptr.release(), log->SpaceUsedLong());
@@ -252,7 +311,7 @@ void Metacache::cache_combined_txn_log(std::string_view key, std::shared_ptr<con
 
 void Metacache::cache_tablet_schema(std::string_view key, std::shared_ptr<const TabletSchema> schema, size_t size) {
     auto cache_value = std::make_unique<CacheValue>(schema);
-    insert(key, cache_value.release(), size);
+    insert(key, cache_value.release(), size, metadata_cache_priority());
 }
 
 void Metacache::erase(std::string_view key) {
@@ -24,6 +24,7 @@
 namespace starrocks {
 class Cache;
 class CacheKey;
+enum class CachePriority;
 class DelVector;
 class Segment;
 class TabletSchema;
@@ -60,6 +61,10 @@ public:
 
     void cache_tablet_metadata(std::string_view key, std::shared_ptr<const TabletMetadataPB> metadata);
 
+    // Cache the latest metadata of a tablet, there is at most one such entry per tablet, so it
+    // is inserted with durable priority if config::lake_metacache_durable_metadata is true.
+    void cache_latest_tablet_metadata(std::string_view key, std::shared_ptr<const TabletMetadataPB> metadata);
+
     void cache_tablet_schema(std::string_view key, std::shared_ptr<const TabletSchema> schema, size_t size);
 
     void cache_txn_log(std::string_view key, std::shared_ptr<const TxnLogPB> log);
@@ -84,12 +89,13 @@ public:
     size_t capacity() const;
 
 private:
-    static void cache_value_deleter(const CacheKey& /*key*/, void* value) { delete static_cast<CacheValue*>(value); }
+    static void cache_value_deleter(const CacheKey& /*key*/, void* value);
 
     std::shared_ptr<Segment> _lookup_segment_no_lock(std::string_view key);
     void _cache_segment_no_lock(std::string_view key, std::shared_ptr<Segment> segment);
 
     void insert(std::string_view key, CacheValue* ptr, size_t size);
+    void insert(std::string_view key, CacheValue* ptr, size_t size, CachePriority priority);
 
     std::unique_ptr<Cache> _cache;
 
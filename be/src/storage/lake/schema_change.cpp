@@ -16,9 +16,11 @@
 
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <atomic>
 #include <memory>
 
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/delta_writer.h"
 #include "storage/lake/join_path.h"
@@ -30,6 +32,7 @@
 #include "storage/schema_change_utils.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_reader_params.h"
+#include "util/threadpool.h"
 
 namespace starrocks::lake {
 
@@ -113,6 +116,20 @@ public:
     DISALLOW_COPY_AND_MOVE(DirectSchemaChange);
 
     Status process(RowsetPtr rowset, RowsetMetadata* new_rowset_metadata) override;
+
+    // Convert |rowsets| in |pool| with up to |parallelism| rowsets in flight. The output rowsets are appended to
+    // |op_schema_change| in the same order as |rowsets|.
+    Status process_parallel(const std::vector<RowsetPtr>& rowsets, TxnLogPB_OpSchemaChange* op_schema_change,
+                            ThreadPool* pool, int parallelism);
+
+    // Whether the chunk changer can be shared by several conversion threads. Expression contexts
+    // (where predicate, materialized view and generated column expressions) are not thread safe.
+    static bool support_parallel(ChunkChanger* chunk_changer);
+
+private:
+    // Rewrite |rowset| into new segments without assigning the rowset id. Only touches local state,
+    // so it can be called concurrently.
+    Status convert(const RowsetPtr& rowset, RowsetMetadata* new_rowset_metadata);
 };
 
 class SortedSchemaChange final : public ConvertedSchemaChange {
@@ -163,7 +180,79 @@ Status ConvertedSchemaChange::init() {
     return Status::OK();
 }
 
+bool DirectSchemaChange::support_parallel(ChunkChanger* chunk_changer) {
+    if (chunk_changer->get_where_expr() != nullptr || !chunk_changer->get_gc_exprs()->empty()) {
+        return false;
+    }
+    for (const auto& column_mapping : chunk_changer->get_schema_mapping()) {
+        if (column_mapping.mv_expr_ctx != nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status DirectSchemaChange::process(RowsetPtr rowset, RowsetMetadata* new_rowset_metadata) {
+    RETURN_IF_ERROR(convert(rowset, new_rowset_metadata));
+    new_rowset_metadata->set_id(_next_rowset_id);
+    _next_rowset_id += std::max(1, new_rowset_metadata->segments_size());
+    return Status::OK();
+}
+
+Status DirectSchemaChange::process_parallel(const std::vector<RowsetPtr>& rowsets,
+                                            TxnLogPB_OpSchemaChange* op_schema_change, ThreadPool* pool,
+                                            int parallelism) {
+    std::vector<RowsetMetadata*> outputs;
+    outputs.reserve(rowsets.size());
+    for (size_t i = 0; i < rowsets.size(); i++) {
+        outputs.emplace_back(op_schema_change->add_rowsets());
+    }
+    std::vector<Status> results(rowsets.size());
+
+    // The pool is shared by all the schema changes, so this one submits only |parallelism| workers,
+    // which take the rowsets one by one.
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    std::atomic<size_t> next_rowset{0};
+    std::atomic<bool> failed{false};
+    auto mem_tracker = CurrentThread::mem_tracker();
+    Status submit_st;
+    for (int i = 0; i < parallelism; i++) {
+        submit_st = token->submit_func([&]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            for (size_t idx = next_rowset++; idx < rowsets.size() && !failed.load(); idx = next_rowset++) {
+                results[idx] = convert(rowsets[idx], outputs[idx]);
+                if (!results[idx].ok()) {
+                    failed.store(true);
+                }
+            }
+        });
+        if (!submit_st.ok()) {
+            break;
+        }
+    }
+    token->wait();
+    RETURN_IF_ERROR(submit_st);
+
+    for (size_t i = 0; i < rowsets.size(); i++) {
+        if (!results[i].ok()) {
+            LOG(WARNING) << "failed to convert rowset. base tablet: " << _base_tablet.id()
+                         << ", new tablet: " << _new_tablet.id() << ", index: " << rowsets[i]->index()
+                         << ", status: " << results[i];
+            return results[i];
+        }
+        // Ids are assigned in rowset order once all conversions are done, so the result is the same as
+        // converting the rowsets one by one.
+        outputs[i]->set_id(_next_rowset_id);
+        _next_rowset_id += std::max(1, outputs[i]->segments_size());
+    }
+    return Status::OK();
+}
+
+Status DirectSchemaChange::convert(const RowsetPtr& rowset, RowsetMetadata* new_rowset_metadata) {
+    ChunkPtr base_chunk = ChunkHelper::new_chunk(_base_schema, config::vector_chunk_size);
+    ChunkPtr new_chunk = ChunkHelper::new_chunk(_new_schema, config::vector_chunk_size);
+    auto mem_pool = std::make_unique<MemPool>();
+
     // create reader
     auto reader = std::make_unique<TabletReader>(_base_tablet.tablet_manager(), _base_tablet.metadata(), _base_schema,
                                                  std::vector<RowsetPtr>{rowset}, _base_tablet.get_schema());
@@ -184,22 +273,22 @@ Status DirectSchemaChange::process(RowsetPtr rowset, RowsetMetadata* new_rowset_
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("DirectSchemaChange"));
 #endif
 
-        _base_chunk->reset();
-        _new_chunk->reset();
-        _mem_pool->clear();
+        base_chunk->reset();
+        new_chunk->reset();
+        mem_pool->clear();
 
-        if (auto st = reader->get_next(_base_chunk.get()); st.is_end_of_file()) {
+        if (auto st = reader->get_next(base_chunk.get()); st.is_end_of_file()) {
             break;
         } else if (!st.ok()) {
             return st;
         }
 
-        if (!_chunk_changer->change_chunk_v2(_base_chunk, _new_chunk, _base_schema, _new_schema, _mem_pool.get())) {
+        if (!_chunk_changer->change_chunk_v2(base_chunk, new_chunk, _base_schema, _new_schema, mem_pool.get())) {
             return Status::InternalError("failed to convert chunk data");
         }
 
-        ChunkHelper::padding_char_columns(_char_field_indexes, _new_schema, _new_tablet_schema, _new_chunk.get());
-        RETURN_IF_ERROR(writer->write(*_new_chunk));
+        ChunkHelper::padding_char_columns(_char_field_indexes, _new_schema, _new_tablet_schema, new_chunk.get());
+        RETURN_IF_ERROR(writer->write(*new_chunk));
     }
 
     RETURN_IF_ERROR(writer->finish());
@@ -211,11 +300,9 @@ Status DirectSchemaChange::process(RowsetPtr rowset, RowsetMetadata* new_rowset_
         new_rowset_metadata->add_segment_encryption_metas(f.encryption_meta);
     }
 
-    new_rowset_metadata->set_id(_next_rowset_id);
     new_rowset_metadata->set_num_rows(writer->num_rows());
     new_rowset_metadata->set_data_size(writer->data_size());
     new_rowset_metadata->set_overlapped(rowset->is_overlapped());
-    _next_rowset_id += std::max(1, new_rowset_metadata->segments_size());
     return Status::OK();
 }
 
@@ -415,6 +502,7 @@ Status SchemaChangeHandler::convert_historical_rowsets(const SchemaChangeParams&
 
     // create schema change procedure
     std::unique_ptr<SchemaChange> sc_procedure;
+    DirectSchemaChange* direct_sc_procedure = nullptr;
     auto chunk_changer = sc_params.chunk_changer.get();
     if (sc_params.sc_sorting) {
         LOG(INFO) << "doing sorted schema change for base tablet: " << base_tablet.id();
@@ -428,14 +516,25 @@ Status SchemaChangeHandler::convert_historical_rowsets(const SchemaChangeParams&
         // so disable linked schema change and will support it in the later version.
         LOG(INFO) << "doing direct schema change for base tablet: " << base_tablet.id()
                   << ", params directly: " << sc_params.sc_directly;
-        sc_procedure = std::make_unique<DirectSchemaChange>(_tablet_manager, sc_params.txn_id, base_tablet, new_tablet,
-                                                            chunk_changer);
+        auto procedure = std::make_unique<DirectSchemaChange>(_tablet_manager, sc_params.txn_id, base_tablet,
+                                                              new_tablet, chunk_changer);
+        direct_sc_procedure = procedure.get();
+        sc_procedure = std::move(procedure);
         op_schema_change->set_linked_segment(false);
     }
     RETURN_IF_ERROR(sc_procedure->init());
 
     // convert rowsets
     auto rowsets = base_tablet.get_rowsets();
+    auto parallelism = std::min<int64_t>(config::lake_schema_change_max_parallel_rowsets, rowsets.size());
+    auto* convert_pool = ExecEnv::GetInstance()->lake_schema_change_pool();
+    if (direct_sc_procedure != nullptr && convert_pool != nullptr && parallelism > 1 &&
+        DirectSchemaChange::support_parallel(chunk_changer)) {
+        LOG(INFO) << "converting " << rowsets.size() << " rowsets of base tablet " << base_tablet.id()
+                  << " with parallelism " << parallelism;
+        RETURN_IF_ERROR(direct_sc_procedure->process_parallel(rowsets, op_schema_change, convert_pool, parallelism));
+        rowsets.clear();
+    }
     for (const auto& rowset : rowsets) {
         auto st = sc_procedure->process(rowset, op_schema_change->add_rowsets());
         if (!st.ok()) {
@@ -214,7 +214,7 @@ Status TabletManager::put_tablet_metadata(const TabletMetadataPtr& metadata, con
     if (skip_cache_latest_metadata) {
         return Status::OK();
     }
-    _metacache->cache_tablet_metadata(tablet_latest_metadata_cache_key(metadata->id()), metadata);
+    _metacache->cache_latest_tablet_metadata(tablet_latest_metadata_cache_key(metadata->id()), metadata);
 
     auto t1 = butil::gettimeofday_us();
     g_put_tablet_metadata_latency << (t1 - t0);
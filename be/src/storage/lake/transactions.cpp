@@ -122,12 +122,26 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
             return ptr;
         }
         auto log_path = tablet_mgr->combined_txn_log_location(tablet_id, txn_info.txn_id());
-        ASSIGN_OR_RETURN(auto combined_log, tablet_mgr->get_combined_txn_log(log_path, true));
+        // Split the combined log into per-tablet cache entries instead of caching it as a whole, so that
+        // publishing the other tablets of the same combined log is a cache lookup rather than a scan and
+        // copy of the whole log list for every tablet.
+        ASSIGN_OR_RETURN(auto combined_log, tablet_mgr->get_combined_txn_log(log_path, false));
+        if (ptr = tablet_mgr->metacache()->lookup_txn_log(cache_key); ptr) {
+            // split by a concurrent publish of another tablet
+            return ptr;
+        }
+        TxnLogPtr txn_log;
         for (const auto& log : combined_log->txn_logs()) {
+            auto log_ptr = std::make_shared<const TxnLogPB>(log);
+            tablet_mgr->metacache()->cache_txn_log(tablet_mgr->txn_log_location(log.tablet_id(), txn_info.txn_id()),
+                                                   log_ptr);
             if (log.tablet_id() == tablet_id) {
-                return std::make_shared<TxnLogPB>(log);
+                txn_log = std::move(log_ptr);
             }
         }
+        if (txn_log != nullptr) {
+            return txn_log;
+        }
         return Status::InternalError(fmt::format("txn log list does not contain txn log of tablet {}", tablet_id));
     }
 }
@@ -143,6 +157,15 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
                             tablet_id));
     }
     DeferOp remove_tablet_txn([&] { remove_tablet(tablet_id); });
+    // The entries split from a combined txn log are only read by the publish of this tablet, drop them
+    // whatever the result, otherwise an early return leaves them cached until the LRU evicts them.
+    DeferOp erase_split_txn_logs([&] {
+        for (const auto& txn : txns) {
+            if (txn.combined_txn_log()) {
+                tablet_mgr->metacache()->erase(tablet_mgr->txn_log_location(tablet_id, txn.txn_id()));
+            }
+        }
+    });
 
     if (txns.size() > 1) {
         CHECK_EQ(new_version, base_version + txns.size());
@@ -411,6 +434,7 @@ Status publish_log_version(TabletManager* tablet_mgr, int64_t tablet_id, std::sp
             ASSIGN_OR_RETURN(auto txn_log, load_txn_log(tablet_mgr, tablet_id, txn_infos[i]));
             auto log_version = log_versions[i];
             RETURN_IF_ERROR(tablet_mgr->put_txn_vlog(txn_log, log_version));
+            tablet_mgr->metacache()->erase(tablet_mgr->txn_log_location(tablet_id, txn_infos[i].txn_id()));
         }
     }
     delete_files_async(std::move(files_to_delete));
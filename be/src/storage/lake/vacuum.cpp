@@ -17,6 +17,7 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <deque>
 #include <set>
 #include <string_view>
 #include <unordered_map>
@@ -181,36 +182,49 @@ public:
     int64_t delete_count() const { return _delete_count; }
 
 private:
-    // Wait for all submitted deletion tasks to finish and return task execution results.
+    // Wait for all submitted deletion tasks to finish and return the first failure, if any.
     Status wait() {
-        if (_prev_task_status.valid()) {
-            try {
-                return _prev_task_status.get();
-            } catch (const std::exception& e) {
-                return Status::InternalError(e.what());
+        Status ret;
+        while (!_pending_tasks.empty()) {
+            auto st = wait_oldest();
+            if (ret.ok()) {
+                ret = std::move(st);
             }
-        } else {
-            return Status::OK();
+        }
+        return ret;
+    }
+
+    Status wait_oldest() {
+        auto task_status = std::move(_pending_tasks.front());
+        _pending_tasks.pop_front();
+        try {
+            return task_status.get();
+        } catch (const std::exception& e) {
+            return Status::InternalError(e.what());
         }
     }
 
     Status submit(std::vector<std::string>* files_to_delete) {
-        // Await previous task completion before submitting a new deletion.
-        RETURN_IF_ERROR(wait());
+        // Keep at most lake_vacuum_max_inflight_delete_batches deletions running, await the oldest ones
+        // before submitting a new deletion.
+        auto max_inflight = static_cast<size_t>(std::max<int64_t>(1, config::lake_vacuum_max_inflight_delete_batches));
+        while (_pending_tasks.size() >= max_inflight) {
+            RETURN_IF_ERROR(wait_oldest());
+        }
         _delete_count += files_to_delete->size();
         if (_cb) {
             _cb(*files_to_delete);
         }
-        _prev_task_status = delete_files_callable(std::move(*files_to_delete));
+        _pending_tasks.emplace_back(delete_files_callable(std::move(*files_to_delete)));
         files_to_delete->clear();
-        DCHECK(_prev_task_status.valid());
+        DCHECK(_pending_tasks.back().valid());
         return Status::OK();
     }
 
     int64_t _batch_size;
     int64_t _delete_count = 0;
     std::vector<std::string> _batch;
-    std::future<Status> _prev_task_status;
+    std::deque<std::future<Status>> _pending_tasks;
     DeleteCallback _cb;
 };
 
@@ -537,7 +551,12 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
         return true;
     })));
 
+    // The data file batches run concurrently, so the txn logs and the tablet metadata that reference the data files
+    // are only submitted after all data files are deleted, otherwise a failed data file batch would leave orphan
+    // files that no remaining log or metadata points to. They are buffered and deleted in this order by finish().
     AsyncFileDeleter deleter(config::lake_vacuum_min_batch_delete_size);
+    AsyncFileDeleter txn_log_deleter(INT64_MAX);
+    AsyncFileDeleter metafile_deleter(INT64_MAX);
     for (const auto& log_name : txn_logs) {
         auto res = tablet_mgr->get_txn_log(join_path(log_dir, log_name), false);
         if (res.status().is_not_found()) {
@@ -569,7 +588,7 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                     }
                 }
             }
-            RETURN_IF_ERROR(deleter.delete_file(join_path(log_dir, log_name)));
+            RETURN_IF_ERROR(txn_log_deleter.delete_file(join_path(log_dir, log_name)));
         }
     }
 
@@ -630,11 +649,13 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
 
         for (auto version : versions) {
             auto path = join_path(meta_dir, tablet_metadata_filename(tablet_id, version));
-            RETURN_IF_ERROR(deleter.delete_file(std::move(path)));
+            RETURN_IF_ERROR(metafile_deleter.delete_file(std::move(path)));
         }
     }
 
-    return deleter.finish();
+    RETURN_IF_ERROR(deleter.finish());
+    RETURN_IF_ERROR(txn_log_deleter.finish());
+    return metafile_deleter.finish();
 }
 
 void delete_tablets(TabletManager* tablet_mgr, const DeleteTabletRequest& request, DeleteTabletResponse* response) {
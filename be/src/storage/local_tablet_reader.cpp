@@ -14,16 +14,23 @@
 
 #include "storage/local_tablet_reader.h"
 
+#include <algorithm>
+
+#include "column/binary_column.h"
 #include "gen_cpp/internal_service.pb.h"
+#include "runtime/exec_env.h"
 #include "serde/protobuf_serde.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_index.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/projection_iterator.h"
+#include "storage/row_store_encoder_factory.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_updates.h"
+#include "util/coding.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -42,6 +49,48 @@ Status LocalTabletReader::close() {
     return Status::OK();
 }
 
+namespace {
+
+// A row in the short-circuit row cache, keyed by (tablet id, encoded primary key). The row is read at `version`
+// and stays the same in the later versions until an apply changes its key and erases it, see erase_cached_rows().
+struct CachedRow {
+    int64_t version;
+    // TabletUpdates::row_cache_epoch() when the row is read
+    int64_t epoch;
+    // the schema id, the schema version and the unique ids of the value columns in `row`
+    std::string layout;
+    // the key columns followed by the value columns, encoded with RowStoreEncoder
+    std::string row;
+};
+
+Slice encoded_pk_at(const Column& pk_column, size_t i) {
+    if (pk_column.is_binary()) {
+        return down_cast<const BinaryColumn&>(pk_column).get_slice(i);
+    }
+    size_t key_size = pk_column.type_size();
+    return {reinterpret_cast<const char*>(pk_column.continuous_data()) + i * key_size, key_size};
+}
+
+void build_row_cache_key(int64_t tablet_id, const Slice& pk, std::string* key) {
+    key->clear();
+    put_fixed64_le(key, tablet_id);
+    key->append(pk.data, pk.size);
+}
+
+} // namespace
+
+void LocalTabletReader::erase_cached_rows(int64_t tablet_id, const Column& pk_column) {
+    LazyLRUCache* row_cache = GlobalEnv::GetInstance()->short_circuit_row_cache();
+    if (!row_cache->enabled()) {
+        return;
+    }
+    std::string cache_key;
+    for (size_t i = 0; i < pk_column.size(); i++) {
+        build_row_cache_key(tablet_id, encoded_pk_at(pk_column, i), &cache_key);
+        row_cache->erase(CacheKey(cache_key));
+    }
+}
+
 static void plan_read_by_rssid(const vector<uint64_t>& rowids, vector<bool>& found,
                                std::map<uint32_t, std::vector<uint32_t>>& rowids_by_rssid, vector<uint32_t>& idxes) {
     struct RowidSortEntry {
@@ -101,7 +150,6 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<std::st
 
 Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_t>& value_column_ids,
                                     std::vector<bool>& found, Chunk& values) {
-    int64_t t_start = MonotonicMillis();
     size_t n = keys.num_rows();
     if (n > UINT32_MAX) {
         return Status::InvalidArgument(
@@ -110,18 +158,178 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
 
     // convert keys to pk single column format
     const auto& tablet_schema = _tablet->tablet_schema();
-    vector<uint32_t> pk_columns;
-    for (size_t i = 0; i < tablet_schema->num_key_columns(); i++) {
-        pk_columns.push_back((uint32_t)i);
-    }
     std::unique_ptr<Column> pk_column;
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), keys, 0, keys.num_rows(), pk_column.get());
 
+    // Hot rows served by point lookups, encoded with RowStoreEncoder. The rows are keyed by primary key only, the
+    // applies erase the keys they change, so a cached row serves all the versions since it's read.
+    LazyLRUCache* row_cache = GlobalEnv::GetInstance()->short_circuit_row_cache();
+    if (!row_cache->enabled() || value_column_ids.empty()) {
+        return _multi_get_by_index(*pk_column, value_column_ids, found, values);
+    }
+
+    // rows are cached in value column id order, encoded against a schema of all key columns
+    // followed by the requested value columns
+    size_t num_key_columns = tablet_schema->num_key_columns();
+    vector<std::pair<uint32_t, uint32_t>> cids_with_orig_idx;
+    for (uint32_t i = 0; i < value_column_ids.size(); ++i) {
+        cids_with_orig_idx.emplace_back(value_column_ids[i], i);
+    }
+    std::sort(cids_with_orig_idx.begin(), cids_with_orig_idx.end());
+    vector<uint32_t> encode_cids;
+    for (uint32_t i = 0; i < num_key_columns; i++) {
+        encode_cids.push_back(i);
+    }
+    for (size_t i = 0; i < cids_with_orig_idx.size(); i++) {
+        uint32_t cid = cids_with_orig_idx[i].first;
+        if (cid < num_key_columns || (i > 0 && cid == cids_with_orig_idx[i - 1].first)) {
+            // key columns and duplicated columns are not worth the extra bookkeeping
+            return _multi_get_by_index(*pk_column, value_column_ids, found, values);
+        }
+        encode_cids.push_back(cid);
+    }
+    Schema encode_schema(tablet_schema->schema(), encode_cids);
+    auto encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
+    if (!encoder->is_supported(encode_schema).ok()) {
+        return _multi_get_by_index(*pk_column, value_column_ids, found, values);
+    }
+
+    // A schema change without a new data version, e.g. a light add/drop column, may map a column index to another
+    // column, so the columns are identified by unique ids and the encoded row layout by the schema version.
+    std::string layout;
+    put_fixed64_le(&layout, tablet_schema->id());
+    put_fixed32_le(&layout, static_cast<uint32_t>(tablet_schema->schema_version()));
+    put_fixed32_le(&layout, static_cast<uint32_t>(cids_with_orig_idx.size()));
+    for (const auto& p : cids_with_orig_idx) {
+        put_fixed32_le(&layout, static_cast<uint32_t>(tablet_schema->column(p.first).unique_id()));
+    }
+    const int64_t tablet_id = _tablet->tablet_id();
+    const int64_t epoch = _tablet->updates()->row_cache_epoch();
+    auto is_latest_version = [&]() {
+        EditVersion latest_applied_version;
+        return _tablet->updates()->get_latest_applied_version(&latest_applied_version).ok() &&
+               latest_applied_version.major_number() == _version;
+    };
+
+    // probe the cache
+    std::vector<Cache::Handle*> handles(n, nullptr);
+    DeferOp release_handles([&]() {
+        for (auto* handle : handles) {
+            row_cache->release(handle);
+        }
+    });
+    std::string cache_key;
+    vector<uint32_t> miss_idxes;
+    auto hit_rows = BinaryColumn::create();
+    for (uint32_t i = 0; i < n; i++) {
+        build_row_cache_key(tablet_id, encoded_pk_at(*pk_column, i), &cache_key);
+        handles[i] = row_cache->lookup(CacheKey(cache_key));
+        if (handles[i] != nullptr) {
+            const auto* cached = reinterpret_cast<const CachedRow*>(row_cache->value(handles[i]));
+            // a row read after this version may be changed since this version
+            if (cached->epoch == epoch && cached->version <= _version && cached->layout == layout) {
+                hit_rows->append(Slice(cached->row));
+                continue;
+            }
+            row_cache->release(handles[i]);
+            handles[i] = nullptr;
+        }
+        miss_idxes.push_back(i);
+    }
+
+    // read missed keys through the primary index, and put the found rows into the cache
+    std::vector<bool> miss_found;
+    auto miss_values = values.clone_empty();
+    if (!miss_idxes.empty()) {
+        auto miss_pk_column = pk_column->clone_empty();
+        miss_pk_column->append_selective(*pk_column, miss_idxes.data(), 0, miss_idxes.size());
+        // Only the rows of the latest version are cached, those of an older version may have been changed since.
+        const bool fill_cache = is_latest_version();
+        RETURN_IF_ERROR(_multi_get_by_index(*miss_pk_column, value_column_ids, miss_found, *miss_values));
+        if (fill_cache && miss_values->num_rows() > 0) {
+            Columns encode_columns;
+            for (const auto& p : cids_with_orig_idx) {
+                encode_columns.push_back(miss_values->get_column_by_index(p.second));
+            }
+            auto miss_rows = BinaryColumn::create();
+            RETURN_IF_ERROR(encoder->encode_columns_to_full_row_column(encode_schema, encode_columns, *miss_rows));
+            size_t row = 0;
+            for (size_t j = 0; j < miss_idxes.size(); j++) {
+                if (!miss_found[j]) {
+                    continue;
+                }
+                build_row_cache_key(tablet_id, encoded_pk_at(*pk_column, miss_idxes[j]), &cache_key);
+                auto* cached = new CachedRow{_version, epoch, layout, miss_rows->get_slice(row++).to_string()};
+                int64_t mem_size = sizeof(CachedRow) + cached->layout.capacity() + cached->row.capacity();
+                row_cache->release(row_cache->insert(
+                        CacheKey(cache_key), cached, cache_key.size() + layout.size() + cached->row.size(), mem_size,
+                        [](const CacheKey& /*key*/, void* value) { delete reinterpret_cast<CachedRow*>(value); }));
+            }
+            // An apply that is published during the read may have erased its keys before the rows are inserted,
+            // so drop the rows again if a new version is applied meanwhile.
+            if (!is_latest_version() || _tablet->updates()->row_cache_epoch() != epoch) {
+                for (size_t j = 0; j < miss_idxes.size(); j++) {
+                    if (miss_found[j]) {
+                        build_row_cache_key(tablet_id, encoded_pk_at(*pk_column, miss_idxes[j]), &cache_key);
+                        row_cache->erase(CacheKey(cache_key));
+                    }
+                }
+            }
+        }
+    }
+
+    // decode cached rows
+    std::vector<std::unique_ptr<Column>> hit_columns(cids_with_orig_idx.size());
+    if (hit_rows->size() > 0) {
+        vector<uint32_t> read_column_ids;
+        for (uint32_t i = 0; i < hit_columns.size(); i++) {
+            hit_columns[i] = values.get_column_by_index(cids_with_orig_idx[i].second)->clone_empty();
+            read_column_ids.push_back(num_key_columns + i);
+        }
+        RETURN_IF_ERROR(
+                encoder->decode_columns_from_full_row_column(encode_schema, *hit_rows, read_column_ids, &hit_columns));
+    }
+
+    // merge cached and read rows back into input keys' order
+    values.reset();
+    found.assign(n, false);
+    size_t hit_row = 0;
+    size_t miss_pos = 0;
+    size_t miss_row = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (handles[i] != nullptr) {
+            found[i] = true;
+            for (size_t col_idx = 0; col_idx < cids_with_orig_idx.size(); col_idx++) {
+                values.get_column_by_index(cids_with_orig_idx[col_idx].second)
+                        ->append(*hit_columns[col_idx], hit_row, 1);
+            }
+            hit_row++;
+        } else {
+            if (miss_found[miss_pos]) {
+                found[i] = true;
+                for (size_t col_idx = 0; col_idx < values.num_columns(); col_idx++) {
+                    values.get_column_by_index(col_idx)->append(*miss_values->get_column_by_index(col_idx), miss_row,
+                                                                1);
+                }
+                miss_row++;
+            }
+            miss_pos++;
+        }
+    }
+    return Status::OK();
+}
+
+Status LocalTabletReader::_multi_get_by_index(const Column& pk_column, const std::vector<uint32_t>& value_column_ids,
+                                             std::vector<bool>& found, Chunk& values) {
+    int64_t t_start = MonotonicMillis();
+    size_t n = pk_column.size();
+    const auto& tablet_schema = _tablet->tablet_schema();
+
     // search pks in pk index to get rowids
     EditVersion edit_version;
     std::vector<uint64_t> rowids(n);
-    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
+    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), pk_column, &edit_version, &rowids));
     if (edit_version.major_number() != _version) {
         return Status::InternalError(
                 strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
@@ -45,7 +45,15 @@ public:
     StatusOr<ChunkIteratorPtr> scan(const std::vector<std::string>& value_columns,
                                     const std::vector<const ColumnPredicate*>& predicates);
 
+    // Erase the rows of the encoded primary keys |pk_column| from the short-circuit row cache, called by the apply
+    // of a new version of the tablet that changes these keys.
+    static void erase_cached_rows(int64_t tablet_id, const Column& pk_column);
+
 private:
+    // look up |pk_column| in the primary index and read value columns from segments
+    Status _multi_get_by_index(const Column& pk_column, const std::vector<uint32_t>& value_column_ids,
+                               std::vector<bool>& found, Chunk& values);
+
     TabletSharedPtr _tablet;
     int64_t _version{0};
 };
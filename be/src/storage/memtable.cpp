@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -410,8 +411,18 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     if (_keys_type != KeysType::PRIMARY_KEYS) {
         by_sort_key = true;
     }
-    RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
-    if (is_final) {
+    bool presorted = false;
+    RETURN_IF_ERROR(_sort_column_inc(by_sort_key, &presorted));
+    if (presorted) {
+        // Rows arrived in sort key order (e.g. time-ordered stream loads), the permutation is the identity,
+        // so hand over the chunk instead of copying it row by row.
+        if (is_final) {
+            _result_chunk = std::move(_chunk);
+        } else {
+            _result_chunk = _chunk;
+            _chunk = _chunk->clone_empty_with_schema();
+        }
+    } else if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
         // Otherwise it will use more peak memory
         _result_chunk = _chunk->clone_empty_with_schema(0);
@@ -485,7 +496,7 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
+Status MemTable::_sort_column_inc(bool by_sort_key, bool* presorted) {
     Columns columns;
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
@@ -530,6 +541,11 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
+    // The stable sort of already ordered rows is the identity permutation, which `_permutations` already holds.
+    *presorted = SortedRun(_chunk, columns).is_sorted(sort_descs);
+    if (*presorted) {
+        return Status::OK();
+    }
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
@@ -75,7 +75,8 @@ private:
     Status _merge();
 
     Status _sort(bool is_final, bool by_sort_key = false);
-    Status _sort_column_inc(bool by_sort_key = false);
+    // Set `presorted` when the rows are already in sort key order and no sorting was needed.
+    Status _sort_column_inc(bool by_sort_key, bool* presorted);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
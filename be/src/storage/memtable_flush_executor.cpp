@@ -46,9 +46,16 @@ class MemtableFlushTask final : public Runnable {
 public:
     MemtableFlushTask(FlushToken* flush_token, std::unique_ptr<MemTable> memtable, bool eos,
                       std::function<void(std::unique_ptr<SegmentPB>, bool)> cb)
-            : _flush_token(flush_token), _memtable(std::move(memtable)), _eos(eos), _cb(std::move(cb)) {}
+            : _flush_token(flush_token),
+              _memtable(std::move(memtable)),
+              _pending_bytes(_memtable != nullptr ? _memtable->memory_usage() : 0),
+              _eos(eos),
+              _cb(std::move(cb)) {
+        _flush_token->_stats.pending_flush_bytes += _pending_bytes;
+    }
 
-    ~MemtableFlushTask() override = default;
+    // the task may be dropped without running when the token is shut down
+    ~MemtableFlushTask() override { _release_pending_bytes(); }
 
     void run() override {
         _flush_token->_stats.queueing_memtable_num--;
@@ -61,6 +68,7 @@ public:
             _flush_token->_flush_memtable(_memtable.get(), segment.get());
             _flush_token->_stats.cur_flush_count--;
             _memtable.reset();
+            _release_pending_bytes();
 
             // memtable flush fail, skip sync segment
             if (!_flush_token->status().ok()) {
@@ -79,8 +87,14 @@ public:
     }
 
 private:
+    void _release_pending_bytes() {
+        _flush_token->_stats.pending_flush_bytes -= _pending_bytes;
+        _pending_bytes = 0;
+    }
+
     FlushToken* _flush_token;
     std::unique_ptr<MemTable> _memtable;
+    int64_t _pending_bytes;
     bool _eos;
     std::function<void(std::unique_ptr<SegmentPB>, bool)> _cb;
 };
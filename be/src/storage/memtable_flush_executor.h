@@ -58,6 +58,8 @@ struct FlushStatistic {
     int64_t flush_size_bytes = 0;
     int64_t cur_flush_count = 0;
     std::atomic<int64_t> queueing_memtable_num = 0;
+    // memory of the memtables submitted but not flushed yet, queueing or flushing
+    std::atomic<int64_t> pending_flush_bytes = 0;
 };
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
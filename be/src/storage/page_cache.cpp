@@ -36,9 +36,11 @@
 
 #include <malloc.h>
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
+#include "util/hash_util.hpp"
 #include "util/lru_cache.h"
 #include "util/metrics.h"
 #include "util/starrocks_metrics.h"
@@ -86,7 +88,12 @@ static void init_metrics() {
 }
 
 StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
+        : _mem_tracker(mem_tracker),
+          _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)),
+          _admission_filter(new std::atomic<uint64_t>[kAdmissionFilterWords]) {
+    for (size_t i = 0; i < kAdmissionFilterWords; ++i) {
+        _admission_filter[i].store(0, std::memory_order_relaxed);
+    }
     init_metrics();
 }
 
@@ -127,6 +134,36 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
     return true;
 }
 
+bool StoragePageCache::admit(const CacheKey& key) {
+    if (!config::enable_storage_page_cache_admission_filter) {
+        return true;
+    }
+    const uint64_t hash = HashUtil::hash64(key.fname.data(), key.fname.size(), key.offset);
+    const size_t bit = hash % (kAdmissionFilterWords * kAdmissionFilterBitsPerWord);
+    auto& word = _admission_filter[bit / kAdmissionFilterBitsPerWord];
+    const uint64_t mask = uint64_t(1) << (bit % kAdmissionFilterBitsPerWord);
+    const uint64_t epoch = _admission_filter_epoch.load(std::memory_order_relaxed);
+
+    // The bits of a word written in an earlier window are stale, they are dropped by the first write of the
+    // current window instead of clearing the whole filter when the window ends.
+    uint64_t old_word = word.load(std::memory_order_relaxed);
+    uint64_t new_word;
+    do {
+        uint64_t bits = (old_word >> kAdmissionFilterBitsPerWord) == epoch ? old_word & kAdmissionFilterBitsMask : 0;
+        if (bits & mask) {
+            return true;
+        }
+        new_word = (epoch << kAdmissionFilterBitsPerWord) | bits | mask;
+    } while (!word.compare_exchange_weak(old_word, new_word, std::memory_order_relaxed));
+
+    if (_admission_filter_keys.fetch_add(1, std::memory_order_relaxed) + 1 >=
+        kAdmissionFilterWords * kAdmissionFilterBitsPerWord / 4) {
+        _admission_filter_keys.store(0, std::memory_order_relaxed);
+        _admission_filter_epoch.store((epoch + 1) & kAdmissionFilterEpochMask, std::memory_order_relaxed);
+    }
+    return false;
+}
+
 void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
     // mem size should equals to data size when running UT
     int64_t mem_size = data.size;
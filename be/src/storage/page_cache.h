@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -104,6 +105,11 @@ public:
     // The in_memory page will have higher priority.
     void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false);
 
+    // Return whether a page that missed the cache should be inserted.
+    // When enable_storage_page_cache_admission_filter is on, the first miss of a key in the current window
+    // is only remembered and rejected, and a second miss admits it. Always true when the filter is off.
+    bool admit(const CacheKey& key);
+
     size_t memory_usage() const { return _cache->get_memory_usage(); }
 
     void set_capacity(size_t capacity);
@@ -123,6 +129,18 @@ private:
 
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+
+    // One bit per hashed key that has missed once in the current window. A window ends when a quarter of the
+    // bits have been set, to keep the false admission rate low. The high byte of each word is the epoch of the
+    // window it was written in, so ending a window is just bumping the epoch. After 256 windows an untouched
+    // word can look current again, which only admits a few pages early.
+    static constexpr size_t kAdmissionFilterWords = 1 << 14;
+    static constexpr size_t kAdmissionFilterBitsPerWord = 56;
+    static constexpr uint64_t kAdmissionFilterBitsMask = (uint64_t(1) << kAdmissionFilterBitsPerWord) - 1;
+    static constexpr uint64_t kAdmissionFilterEpochMask = 0xff;
+    std::unique_ptr<std::atomic<uint64_t>[]> _admission_filter;
+    std::atomic<size_t> _admission_filter_keys{0};
+    std::atomic<uint64_t> _admission_filter_epoch{0};
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
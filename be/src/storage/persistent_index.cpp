@@ -57,6 +57,10 @@ constexpr size_t kRecordPerBucket = 8;
 constexpr size_t kShardMax = 1 << 16;
 constexpr uint64_t kPageMaxNum = 1ULL << 16;
 constexpr size_t kPackSize = 16;
+// pages to probe in one shard that are at most kMaxCoalescePageGap pages apart are read with one IO,
+// up to kMaxCoalesceReadBytes per IO
+constexpr size_t kMaxCoalescePageGap = 1;
+constexpr size_t kMaxCoalesceReadBytes = 1 << 20;
 constexpr size_t kBucketSizeMax = 256;
 constexpr size_t kFixedMaxKeySize = 128;
 constexpr size_t kBatchBloomFilterReadSize = 4ULL << 20;
@@ -2535,6 +2539,50 @@ Status ImmutableIndex::_read_page(size_t shard_idx, size_t pageid, LargeIndexPag
     return Status::OK();
 }
 
+Status ImmutableIndex::_read_pages(size_t shard_idx, const std::vector<size_t>& pageids,
+                                   std::map<size_t, LargeIndexPage>* pages, IOStat* stat) const {
+    DCHECK(!pageids.empty());
+    const auto& shard_info = _shards[shard_idx];
+    if (pageids.size() == 1) {
+        LargeIndexPage page(shard_info.page_size / kPageSize);
+        RETURN_IF_ERROR(_read_page(shard_idx, pageids[0], &page, stat));
+        (*pages)[pageids[0]] = std::move(page);
+        return Status::OK();
+    }
+
+    const bool compressed = _compression_type != CompressionTypePB::NO_COMPRESSION;
+    auto page_begin = [&](size_t pageid) {
+        return compressed ? shard_info.page_off[pageid] : shard_info.page_size * pageid;
+    };
+    const size_t range_begin = page_begin(pageids.front());
+    const size_t range_size = page_begin(pageids.back() + 1) - range_begin;
+    std::string buff;
+    raw::stl_string_resize_uninitialized(&buff, range_size);
+    RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + range_begin, buff.data(), range_size));
+
+    const BlockCompressionCodec* codec = nullptr;
+    if (compressed) {
+        RETURN_IF_ERROR(get_block_compression_codec(_compression_type, &codec));
+    }
+    for (auto pageid : pageids) {
+        LargeIndexPage page(shard_info.page_size / kPageSize);
+        const char* page_data = buff.data() + page_begin(pageid) - range_begin;
+        if (compressed) {
+            Slice compressed_body(page_data, page_begin(pageid + 1) - page_begin(pageid));
+            Slice decompressed_body((uint8_t*)page.data(), shard_info.page_size);
+            RETURN_IF_ERROR(codec->decompress(compressed_body, &decompressed_body));
+        } else {
+            memcpy(page.data(), page_data, shard_info.page_size);
+        }
+        (*pages)[pageid] = std::move(page);
+    }
+    if (stat != nullptr) {
+        stat->read_iops++;
+        stat->read_io_bytes += range_size;
+    }
+    return Status::OK();
+}
+
 Status ImmutableIndex::_get_in_fixlen_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                                     KeysInfo* found_keys_info,
                                                     std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
@@ -2639,11 +2687,25 @@ Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const S
                                              std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
+    const bool compressed = _compression_type != CompressionTypePB::NO_COMPRESSION;
+    auto range_bytes = [&](size_t first_pageid, size_t last_pageid) {
+        return compressed ? shard_info.page_off[last_pageid + 1] - shard_info.page_off[first_pageid]
+                          : shard_info.page_size * (last_pageid + 1 - first_pageid);
+    };
+    // keys_info_by_page is ordered by pageid, so pages close to each other are adjacent here and
+    // each group of them costs one read instead of one read per page
     std::map<size_t, LargeIndexPage> pages;
-    for (auto [pageid, keys_info] : keys_info_by_page) {
-        LargeIndexPage page(shard_info.page_size / kPageSize);
-        RETURN_IF_ERROR(_read_page(shard_idx, pageid, &page, stat));
-        pages[pageid] = std::move(page);
+    std::vector<size_t> pageids;
+    for (const auto& [pageid, keys_info] : keys_info_by_page) {
+        if (!pageids.empty() && (pageid - pageids.back() > kMaxCoalescePageGap + 1 ||
+                                 range_bytes(pageids.front(), pageid) > kMaxCoalesceReadBytes)) {
+            RETURN_IF_ERROR(_read_pages(shard_idx, pageids, &pages, stat));
+            pageids.clear();
+        }
+        pageids.push_back(pageid);
+    }
+    if (!pageids.empty()) {
+        RETURN_IF_ERROR(_read_pages(shard_idx, pageids, &pages, stat));
     }
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard_by_page(shard_idx, n, keys, values, found_keys_info, keys_info_by_page, pages);
@@ -4059,6 +4121,47 @@ Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
     return st;
 }
 
+Status PersistentIndex::_reload_l2(const PersistentIndexMetaPB& index_meta, const EditVersion& new_l2_version,
+                                   std::unique_ptr<ImmutableIndex> new_l2_index) {
+    DCHECK(index_meta.l2_versions_size() == index_meta.l2_version_merged_size());
+    std::vector<EditVersionWithMerge> l2_versions;
+    std::vector<std::unique_ptr<ImmutableIndex>> l2_vec;
+    // position in _l2_vec of each l2 that is kept, -1 for the ones taken elsewhere
+    std::vector<int> reuse_idxes;
+    for (int i = 0; i < index_meta.l2_versions_size(); i++) {
+        EditVersion version = index_meta.l2_versions(i);
+        bool merged = index_meta.l2_version_merged(i);
+        l2_versions.emplace_back(version, merged);
+        l2_vec.emplace_back(nullptr);
+        reuse_idxes.push_back(-1);
+        if (new_l2_index != nullptr && merged && version == new_l2_version) {
+            l2_vec.back() = std::move(new_l2_index);
+            continue;
+        }
+        for (int j = 0; j < _l2_versions.size(); j++) {
+            if (_l2_versions[j].version == version && _l2_versions[j].merged == merged) {
+                reuse_idxes.back() = j;
+                break;
+            }
+        }
+        if (reuse_idxes.back() < 0) {
+            auto l2_block_path = strings::Substitute("$0/index.l2.$1.$2$3", _path, version.major_number(),
+                                                     version.minor_number(), merged ? MergeSuffix : "");
+            ASSIGN_OR_RETURN(auto l2_rfile, _fs->new_random_access_file(l2_block_path));
+            ASSIGN_OR_RETURN(l2_vec.back(), ImmutableIndex::load(std::move(l2_rfile), load_bf_or_not()));
+        }
+    }
+    // nothing can fail from here, so the loaded l2 files are only moved after all of them are resolved
+    for (int i = 0; i < l2_vec.size(); i++) {
+        if (reuse_idxes[i] >= 0) {
+            l2_vec[i] = std::move(_l2_vec[reuse_idxes[i]]);
+        }
+    }
+    _l2_versions.swap(l2_versions);
+    _l2_vec.swap(l2_vec);
+    return Status::OK();
+}
+
 size_t PersistentIndex::_dump_bound() {
     return (_l0 == nullptr) ? 0 : _l0->dump_bound();
 }
@@ -4942,9 +5045,13 @@ Status PersistentIndex::TEST_major_compaction(PersistentIndexMetaPB& index_meta)
     }
     // 2. merge l2 files to new l2 file
     ASSIGN_OR_RETURN(EditVersion new_l2_version, _major_compaction_impl(l2_versions, l2_vec));
+    auto new_l2_block_path = strings::Substitute("$0/index.l2.$1.$2$3", _path, new_l2_version.major_number(),
+                                                 new_l2_version.minor_number(), MergeSuffix);
+    ASSIGN_OR_RETURN(auto new_l2_rfile, _fs->new_random_access_file(new_l2_block_path));
+    ASSIGN_OR_RETURN(auto new_l2_index, ImmutableIndex::load(std::move(new_l2_rfile), load_bf_or_not()));
     RETURN_IF_ERROR(modify_l2_versions(l2_versions, new_l2_version, index_meta));
-    // delete useless files
-    RETURN_IF_ERROR(_reload(index_meta));
+    // swap l2 files the same way as major_compaction, then delete useless files
+    RETURN_IF_ERROR(_reload_l2(index_meta, new_l2_version, std::move(new_l2_index)));
     RETURN_IF_ERROR(_delete_expired_index_file(
             _version, _l1_version,
             _l2_versions.size() > 0 ? _l2_versions[0] : EditVersionWithMerge(INT64_MAX, INT64_MAX, true)));
@@ -4996,6 +5103,11 @@ Status PersistentIndex::major_compaction(DataDir* data_dir, int64_t tablet_id, s
     }
     // 2. merge l2 files to new l2 file
     ASSIGN_OR_RETURN(EditVersion new_l2_version, _major_compaction_impl(l2_versions, l2_vec));
+    // load the new l2 file before taking the index lock, so that apply is only blocked by the swap
+    auto new_l2_block_path = strings::Substitute("$0/index.l2.$1.$2$3", _path, new_l2_version.major_number(),
+                                                 new_l2_version.minor_number(), MergeSuffix);
+    ASSIGN_OR_RETURN(auto new_l2_rfile, fs->new_random_access_file(new_l2_block_path));
+    ASSIGN_OR_RETURN(auto new_l2_index, ImmutableIndex::load(std::move(new_l2_rfile), load_bf_or_not()));
     // 3. modify PersistentIndexMetaPB and reload index, protected by index lock
     {
         std::lock_guard lg(*mutex);
@@ -5006,8 +5118,9 @@ Status PersistentIndex::major_compaction(DataDir* data_dir, int64_t tablet_id, s
         RETURN_IF_ERROR(TabletMetaManager::get_persistent_index_meta(data_dir, tablet_id, &index_meta));
         RETURN_IF_ERROR(modify_l2_versions(l2_versions, new_l2_version, index_meta));
         RETURN_IF_ERROR(TabletMetaManager::write_persistent_index_meta(data_dir, tablet_id, index_meta));
-        // reload new l2 versions
-        RETURN_IF_ERROR(_reload(index_meta));
+        // reload new l2 versions, l0 and l1 in memory are the same as the ones in index_meta because
+        // apply holds the index lock for its whole commit, so there is no need to reload them
+        RETURN_IF_ERROR(_reload_l2(index_meta, new_l2_version, std::move(new_l2_index)));
         // delete useless files
         const MutableIndexMetaPB& l0_meta = index_meta.l0_meta();
         EditVersion l0_version = l0_meta.snapshot().version();
@@ -552,6 +552,10 @@ private:
 
     Status _read_page(size_t shard_idx, size_t pageid, LargeIndexPage* page, IOStat* stat) const;
 
+    // read the pages in |pageids|, which are sorted and lie in one small range of the shard, with a single IO
+    Status _read_pages(size_t shard_idx, const std::vector<size_t>& pageids, std::map<size_t, LargeIndexPage>* pages,
+                       IOStat* stat) const;
+
     Status _get_in_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                  KeysInfo* found_keys_info, std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                  IOStat* stat) const;
@@ -850,6 +854,10 @@ private:
 
     Status _load(const PersistentIndexMetaPB& index_meta, bool reload = false);
     Status _reload(const PersistentIndexMetaPB& index_meta);
+    // Only replace l2 files by |index_meta| after major compaction, l0 and l1 are untouched by it.
+    // |new_l2_index| is the already loaded output of the compaction.
+    Status _reload_l2(const PersistentIndexMetaPB& index_meta, const EditVersion& new_l2_version,
+                      std::unique_ptr<ImmutableIndex> new_l2_index);
 
     // commit index meta
     Status _build_commit(TabletLoader* loader, PersistentIndexMetaPB& index_meta);
@@ -14,6 +14,9 @@
 
 #include "storage/predicate_tree/predicate_tree.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 #include "gutil/strings/substitute.h"
 #include "simd/simd.h"
 
@@ -130,6 +133,48 @@ Status PredicateCompoundNode<CompoundNodeType::OR>::evaluate_or(CompoundNodeCont
 // PredicateAndNode
 // ------------------------------------------------------------------------------------
 
+namespace {
+
+// How many evaluations of an AND node happen between two reorderings of its children.
+constexpr size_t AND_CHILDREN_REORDER_INTERVAL = 32;
+
+// Stable-sorts `children` by the fraction of input rows each one kept, so that the most selective children
+// run first and the following ones see fewer rows. Children that never received any rows keep their relative
+// position behind the measured ones. The statistics are halved afterwards so that the order follows changes
+// of the data distribution.
+template <typename Child>
+void reorder_by_selectivity(std::vector<Child>& children,
+                            std::vector<CompoundNodeContext::CompoundAndContext::ChildSelectivity>& selectivities) {
+    DCHECK_EQ(children.size(), selectivities.size());
+    if (children.size() <= 1) {
+        return;
+    }
+
+    std::vector<size_t> order(children.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto pass_ratio = [&](size_t i) {
+        const auto& s = selectivities[i];
+        return s.input_rows == 0 ? 1.0 : static_cast<double>(s.output_rows) / s.input_rows;
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t lhs, size_t rhs) { return pass_ratio(lhs) < pass_ratio(rhs); });
+
+    std::vector<Child> sorted_children;
+    std::vector<CompoundNodeContext::CompoundAndContext::ChildSelectivity> sorted_selectivities;
+    sorted_children.reserve(children.size());
+    sorted_selectivities.reserve(children.size());
+    for (const auto i : order) {
+        sorted_children.emplace_back(children[i]);
+        auto& s = sorted_selectivities.emplace_back(selectivities[i]);
+        s.input_rows /= 2;
+        s.output_rows /= 2;
+    }
+    children = std::move(sorted_children);
+    selectivities = std::move(sorted_selectivities);
+}
+
+} // namespace
+
 template <>
 Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContexts& contexts, const Chunk* chunk,
                                                               uint8_t* selection, uint16_t from, uint16_t to) const {
@@ -159,13 +204,22 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
         for (const auto& child : _compound_children) {
             ctx.vec_children.emplace_back(&child);
         }
+        ctx.vec_selectivities.resize(ctx.vec_children.size());
+        ctx.non_vec_selectivities.resize(ctx.non_vec_children.size());
     }
     auto& ctx = node_ctx.and_context.value();
 
+    if (++ctx.num_evaluations % AND_CHILDREN_REORDER_INTERVAL == 0) {
+        reorder_by_selectivity(ctx.vec_children, ctx.vec_selectivities);
+        reorder_by_selectivity(ctx.non_vec_children, ctx.non_vec_selectivities);
+    }
+
     // Evaluate vectorized predicates first.
     bool first = true;
     bool contains_true = true;
-    for (const auto& child : ctx.vec_children) {
+    size_t num_selected = num_rows;
+    for (size_t i = 0; i < ctx.vec_children.size(); ++i) {
+        const auto& child = ctx.vec_children[i];
         if (first) {
             first = false;
             RETURN_IF_ERROR(
@@ -175,7 +229,11 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
                     [&](const auto& pred) { return pred.evaluate_and(contexts, chunk, selection, from, to); }));
         }
 
-        contains_true = SIMD::count_nonzero(selection + from, num_rows);
+        auto& selectivity = ctx.vec_selectivities[i];
+        selectivity.input_rows += num_selected;
+        num_selected = SIMD::count_nonzero(selection + from, num_rows);
+        selectivity.output_rows += num_selected;
+        contains_true = num_selected > 0;
         if (!contains_true) {
             break;
         }
@@ -203,8 +261,12 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
             }
         }
 
-        for (const auto& col_pred : ctx.non_vec_children) {
-            ASSIGN_OR_RETURN(selected_size, col_pred->evaluate_branchless(chunk, selected_idx, selected_size));
+        for (size_t i = 0; i < ctx.non_vec_children.size(); ++i) {
+            auto& selectivity = ctx.non_vec_selectivities[i];
+            selectivity.input_rows += selected_size;
+            ASSIGN_OR_RETURN(selected_size,
+                             ctx.non_vec_children[i]->evaluate_branchless(chunk, selected_idx, selected_size));
+            selectivity.output_rows += selected_size;
             if (selected_size == 0) {
                 break;
             }
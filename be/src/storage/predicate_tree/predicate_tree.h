@@ -289,6 +289,16 @@ struct CompoundNodeContext {
     struct CompoundAndContext {
         std::vector<const PredicateColumnNode*> non_vec_children;
         std::vector<ConstPredicateNodePtr> vec_children;
+
+        // Rows fed into and kept by each child, aligned with `vec_children` and `non_vec_children`.
+        // They are used to periodically move the children that filter out the most rows to the front.
+        struct ChildSelectivity {
+            uint64_t input_rows = 0;
+            uint64_t output_rows = 0;
+        };
+        std::vector<ChildSelectivity> vec_selectivities;
+        std::vector<ChildSelectivity> non_vec_selectivities;
+        size_t num_evaluations = 0;
     };
     std::optional<CompoundAndContext> and_context;
 
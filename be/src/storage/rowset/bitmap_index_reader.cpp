@@ -36,7 +36,9 @@
 
 #include <bthread/sys_futex.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
@@ -123,10 +125,29 @@ Status BitmapIndexIterator::read_bitmap(rowid_t ordinal, Roaring* result) {
 Status BitmapIndexIterator::read_union_bitmap(rowid_t from, rowid_t to, Roaring* result) {
     DCHECK(0 <= from && from <= to && to <= _reader->bitmap_nums());
 
-    for (rowid_t pos = from; pos < to; pos++) {
-        Roaring bitmap;
-        RETURN_IF_ERROR(read_bitmap(pos, &bitmap));
-        *result |= bitmap;
+    // Union the bitmaps in batches with Roaring::fastunion, which merges all containers of a batch lazily
+    // instead of materializing one intermediate result per bitmap as repeated `|=` does.
+    constexpr rowid_t kUnionBatchSize = 64;
+    std::vector<Roaring> bitmaps;
+    std::vector<const Roaring*> inputs;
+    bitmaps.reserve(std::min(kUnionBatchSize, to - from));
+    inputs.reserve(std::min(kUnionBatchSize, to - from) + 1);
+    for (rowid_t batch_start = from; batch_start < to; batch_start += kUnionBatchSize) {
+        const rowid_t batch_end = std::min(to, batch_start + kUnionBatchSize);
+        bitmaps.resize(batch_end - batch_start);
+        for (rowid_t pos = batch_start; pos < batch_end; pos++) {
+            RETURN_IF_ERROR(read_bitmap(pos, &bitmaps[pos - batch_start]));
+        }
+        if (bitmaps.size() == 1) {
+            *result |= bitmaps[0];
+            continue;
+        }
+        inputs.clear();
+        inputs.emplace_back(result);
+        for (const auto& bitmap : bitmaps) {
+            inputs.emplace_back(&bitmap);
+        }
+        *result = Roaring::fastunion(inputs.size(), inputs.data());
     }
     return Status::OK();
 }
@@ -73,6 +73,7 @@
 #include "storage/types.h"
 #include "types/logical_type.h"
 #include "util/compression/block_compression.h"
+#include "util/json_flattener.h"
 #include "util/rle_encoding.h"
 
 namespace starrocks {
@@ -794,6 +795,11 @@ StatusOr<std::unique_ptr<ColumnIterator>> ColumnReader::_new_json_iterator(Colum
             target_paths.emplace_back(p->absolute_path().substr(field_name.size() + 1));
             target_types.emplace_back(p->value_type().type);
         }
+        // the tablets without a schema id share the invalid id, their accesses can't be told apart
+        if (_segment != nullptr && _segment->tablet_schema().id() != TabletSchema::invalid_id() &&
+            !path->is_from_compaction() && path->mark_json_access_recorded()) {
+            JsonPathAccessStats::instance()->record(_segment->tablet_schema().id(), _column_unique_id, target_paths);
+        }
     }
 
     if (!_is_flat_json) {
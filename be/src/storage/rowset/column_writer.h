@@ -87,6 +87,8 @@ struct ColumnWriterOptions {
 
     bool need_flat = false;
     bool is_compaction = false;
+    // id of the tablet schema, to look up the json paths read by queries, TabletSchema::invalid_id() if unknown.
+    int64_t schema_id = 0;
 
     std::string field_name;
 };
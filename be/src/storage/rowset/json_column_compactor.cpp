@@ -28,6 +28,7 @@
 #include "gen_cpp/segment.pb.h"
 #include "gutil/casts.h"
 #include "storage/rowset/column_writer.h"
+#include "storage/tablet_schema.h"
 #include "types/constexpr.h"
 #include "util/json_flattener.h"
 
@@ -48,6 +49,9 @@ Status FlatJsonColumnCompactor::_compact_columns(std::vector<ColumnPtr>& json_da
         vc.emplace_back(js.get());
     }
     deriver.set_generate_filter(true);
+    if (_schema_id != TabletSchema::invalid_id()) {
+        deriver.set_hot_paths(JsonPathAccessStats::instance()->hot_paths(_schema_id, _json_meta->unique_id()));
+    }
     deriver.derived(vc);
 
     _flat_paths = deriver.flat_paths();
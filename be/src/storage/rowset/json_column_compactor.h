@@ -22,7 +22,8 @@ class FlatJsonColumnCompactor final : public FlatJsonColumnWriter {
 public:
     FlatJsonColumnCompactor(const ColumnWriterOptions& opts, TypeInfoPtr type_info, WritableFile* wfile,
                             std::unique_ptr<ScalarColumnWriter> json_writer)
-            : FlatJsonColumnWriter(opts, std::move(type_info), wfile, std::move(json_writer)) {}
+            : FlatJsonColumnWriter(opts, std::move(type_info), wfile, std::move(json_writer)),
+              _schema_id(opts.schema_id) {}
 
     Status append(const Column& column) override;
 
@@ -34,6 +35,8 @@ private:
     Status _merge_columns(std::vector<ColumnPtr>& json_datas);
 
     Status _flatten_columns(std::vector<ColumnPtr>& json_datas);
+
+    int64_t _schema_id;
 };
 
 class JsonColumnCompactor final : public ColumnWriter {
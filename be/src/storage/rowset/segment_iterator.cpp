@@ -791,8 +791,10 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
             opts.encryption_info = *encryption_info;
         }
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        const bool io_coalesce_enable = _segment->lake_tablet_manager() != nullptr
+                                                ? config::io_coalesce_lake_read_enable
+                                                : config::io_coalesce_local_read_enable;
+        if (io_coalesce_enable && !_segment->is_default_column(col)) {
             ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
             auto shared_buffered_input_stream =
                     std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
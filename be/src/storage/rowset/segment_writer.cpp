@@ -34,6 +34,7 @@
 
 #include "storage/rowset/segment_writer.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -45,6 +46,8 @@
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "storage/index/index_descriptor.h"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
@@ -52,9 +55,11 @@
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
 #include "types/logical_type.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -209,6 +214,7 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
 
         opts.need_flat = config::enable_json_flat;
         opts.is_compaction = _opts.is_compaction;
+        opts.schema_id = _tablet_schema->id();
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
         _column_writers.push_back(std::move(writer));
@@ -383,13 +389,57 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
     return Status::OK();
 }
 
+// Column writers only buffer encoded pages in memory until finalize, so appending different columns touches
+// disjoint state and can be spread over the segment writer pool. The caller encodes one share itself and
+// falls back to a serial append when the pool is unavailable.
+Status SegmentWriter::_append_columns(const Chunk& chunk) {
+    size_t num_columns = chunk.num_columns();
+    auto min_columns = config::segment_writer_parallel_append_min_columns;
+    ThreadPool* pool = ExecEnv::GetInstance()->segment_writer_pool();
+    if (min_columns <= 0 || num_columns < static_cast<size_t>(min_columns) || pool == nullptr) {
+        for (size_t i = 0; i < num_columns; ++i) {
+            RETURN_IF_ERROR(_column_writers[i]->append(*chunk.get_column_by_index(i)));
+        }
+        return Status::OK();
+    }
+
+    size_t num_tasks = std::min<size_t>(num_columns, std::max(1, pool->max_threads()) + 1);
+    std::vector<Status> statuses(num_tasks);
+    auto append_task = [&](size_t task_id) {
+        for (size_t i = task_id; i < num_columns; i += num_tasks) {
+            statuses[task_id] = _column_writers[i]->append(*chunk.get_column_by_index(i));
+            if (!statuses[task_id].ok()) {
+                return;
+            }
+        }
+    };
+
+    CountDownLatch latch(num_tasks - 1);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t task_id = 1; task_id < num_tasks; ++task_id) {
+        auto st = pool->submit_func([&, task_id]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            append_task(task_id);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            append_task(task_id);
+            latch.count_down();
+        }
+    }
+    append_task(0);
+    latch.wait();
+
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status SegmentWriter::append_chunk(const Chunk& chunk) {
     size_t chunk_num_rows = chunk.num_rows();
     size_t chunk_num_columns = chunk.num_columns();
-    for (size_t i = 0; i < chunk_num_columns; ++i) {
-        const Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
-    }
+    RETURN_IF_ERROR(_append_columns(chunk));
 
     // TODO(cbl): put the fill full row column logic here is a bit hacky, this segment writer is used in many other
     //            situations(compaction etc.), so better to put it into somewhere early in the write pipeline
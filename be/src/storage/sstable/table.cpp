@@ -254,23 +254,26 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
 
     int64_t continue_block_read_cnt = 0;
     int64_t sst_bloom_filter_rows = 0;
+    int64_t same_block_skip_cnt = 0;
     int64_t multiget_t1_us = 0;
     int64_t multiget_t2_us = 0;
     int64_t multiget_t3_us = 0;
+    // offset of the data block `current_block_itr_ptr` points to
+    uint64_t current_block_offset = 0;
     size_t i = 0;
     bool founded = false;
     for (auto it = begin; it != end; ++it, ++i) {
         auto& k = keys[*it];
         int64_t t0 = butil::gettimeofday_us();
-        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
+        bool searched_current_block = false;
+        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->status().ok()) {
             // keep searching current block
             ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
             if (founded) {
                 continue_block_read_cnt++;
                 continue;
-            } else {
-                current_block_itr_ptr.reset(nullptr);
             }
+            searched_current_block = true;
         }
         int64_t t1 = butil::gettimeofday_us();
         iiter->Seek(k);
@@ -279,12 +282,16 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
             Slice handle_value = iiter->value();
             FilterBlockReader* filter = rep_->filter;
             BlockHandle handle;
-            if (filter != nullptr && handle.DecodeFrom(&handle_value).ok() &&
-                !filter->KeyMayMatch(handle.offset(), k)) {
+            bool handle_decoded = handle.DecodeFrom(&handle_value).ok();
+            if (filter != nullptr && handle_decoded && !filter->KeyMayMatch(handle.offset(), k)) {
                 // Not found
                 sst_bloom_filter_rows++;
+            } else if (searched_current_block && handle_decoded && handle.offset() == current_block_offset) {
+                // k belongs to the block we just searched, no need to read it again
+                same_block_skip_cnt++;
             } else {
                 current_block_itr_ptr.reset(BlockReader(this, options, iiter->value()));
+                current_block_offset = handle_decoded ? handle.offset() : 0;
                 ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
             }
         }
@@ -299,6 +306,7 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
     delete iiter;
     TRACE_COUNTER_INCREMENT("continue_block_read_cnt", continue_block_read_cnt);
     TRACE_COUNTER_INCREMENT("sst_bloom_filter_rows", sst_bloom_filter_rows);
+    TRACE_COUNTER_INCREMENT("same_block_skip_cnt", same_block_skip_cnt);
     TRACE_COUNTER_INCREMENT("multiget_t1_us", multiget_t1_us);
     TRACE_COUNTER_INCREMENT("multiget_t2_us", multiget_t2_us);
     TRACE_COUNTER_INCREMENT("multiget_t3_us", multiget_t3_us);
@@ -951,6 +951,27 @@ const uint32_t Tablet::calc_cumulative_compaction_score() const {
     return base_rowset_exist ? score : 0;
 }
 
+void Tablet::increase_query_scan_count() {
+    _decay_query_scan_count(MonotonicSeconds());
+    _recent_query_scan_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t Tablet::recent_query_scan_count() {
+    _decay_query_scan_count(MonotonicSeconds());
+    return _recent_query_scan_count.load(std::memory_order_relaxed);
+}
+
+void Tablet::_decay_query_scan_count(int64_t now_sec) {
+    int64_t last_decay_sec = _last_query_scan_decay_sec.load(std::memory_order_relaxed);
+    int64_t periods = (now_sec - last_decay_sec) / kQueryScanDecayIntervalSec;
+    if (periods <= 0 || !_last_query_scan_decay_sec.compare_exchange_strong(last_decay_sec, now_sec)) {
+        return;
+    }
+    // concurrent increments racing with the decay may be lost, which is fine for a scheduling hint
+    int64_t count = _recent_query_scan_count.load(std::memory_order_relaxed);
+    _recent_query_scan_count.store(periods >= 63 ? 0 : count >> periods, std::memory_order_relaxed);
+}
+
 const uint32_t Tablet::calc_base_compaction_score() const {
     uint32_t score = 0;
     const int64_t point = cumulative_layer_point();
@@ -228,6 +228,11 @@ public:
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) { _last_base_compaction_success_millis = millis; }
 
+    // Record a query scan of this tablet, used to prioritize compaction of frequently scanned tablets.
+    void increase_query_scan_count();
+    // Number of query scans, halved every kQueryScanDecayIntervalSec so that it reflects recent scans.
+    int64_t recent_query_scan_count();
+
     void delete_all_files();
 
     bool check_rowset_id(const RowsetId& rowset_id);
@@ -440,6 +445,11 @@ private:
     // timestamp of last base compaction success
     std::atomic<int64_t> _last_base_compaction_success_millis{0};
 
+    static constexpr int64_t kQueryScanDecayIntervalSec = 60;
+    void _decay_query_scan_count(int64_t now_sec);
+    std::atomic<int64_t> _recent_query_scan_count{0};
+    std::atomic<int64_t> _last_query_scan_decay_sec{0};
+
     std::atomic<TStatusCode::type> _last_cumu_compaction_failure_status = TStatusCode::OK;
 
     std::atomic<int64_t> _cumulative_point{0};
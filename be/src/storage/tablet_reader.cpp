@@ -129,6 +129,10 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
         read_params.reader_type != ReaderType::READER_ALTER_TABLE && !is_compaction(read_params.reader_type)) {
         return Status::NotSupported("reader type not supported now");
     }
+    if (read_params.reader_type == ReaderType::READER_QUERY) {
+        _tablet->increase_query_scan_count();
+    }
+
     if (read_params.use_pk_index) {
         // defer init collector to IO scanner thread when calling do_get_next()
         _reader_params = &read_params;
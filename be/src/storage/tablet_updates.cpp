@@ -42,6 +42,7 @@
 #include "storage/empty_iterator.h"
 #include "storage/local_primary_key_compaction_conflict_resolver.h"
 #include "storage/local_primary_key_recover.h"
+#include "storage/local_tablet_reader.h"
 #include "storage/merge_iterator.h"
 #include "storage/persistent_index.h"
 #include "storage/primary_key_dump.h"
@@ -1143,6 +1144,7 @@ Status TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo&
         }
         // 5. apply memory
         _next_log_id++;
+        _row_cache_epoch.fetch_add(1, std::memory_order_acq_rel);
         _apply_version_idx++;
         _apply_version_changed.notify_all();
     }
@@ -1375,6 +1377,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                     failure_handler(msg, st.code(), true);
                     return apply_st;
                 }
+                LocalTabletReader::erase_cached_rows(tablet_id, *upserts[i]);
                 manager->index_cache().update_object_size(index_entry, index.memory_usage());
                 if (delete_pks != nullptr) {
                     st = index.erase(*delete_pks, &new_deletes);
@@ -1384,6 +1387,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                         failure_handler(msg, st.code(), true);
                         return apply_st;
                     }
+                    LocalTabletReader::erase_cached_rows(tablet_id, *delete_pks);
                 }
             }
             state.release_upserts(i);
@@ -1409,6 +1413,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                 failure_handler(msg, st.code(), true);
                 return apply_st;
             }
+            LocalTabletReader::erase_cached_rows(tablet_id, *deletes[i]);
             state.release_deletes(i);
         }
     } else {
@@ -1463,6 +1468,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                         failure_handler(msg, st.code(), true);
                         return apply_st;
                     }
+                    LocalTabletReader::erase_cached_rows(tablet_id, *upserts[loaded_upsert]);
                     manager->index_cache().update_object_size(index_entry, index.memory_usage());
                     if (delete_pks != nullptr) {
                         st = index.erase(*delete_pks, &new_deletes);
@@ -1473,6 +1479,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                             failure_handler(msg, st.code(), true);
                             return apply_st;
                         }
+                        LocalTabletReader::erase_cached_rows(tablet_id, *delete_pks);
                     }
                 }
                 i++;
@@ -1501,6 +1508,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                     failure_handler(msg, st.code(), true);
                     return apply_st;
                 }
+                LocalTabletReader::erase_cached_rows(tablet_id, *deletes[loaded_delfile]);
                 state.release_deletes(loaded_delfile);
                 i++;
                 loaded_delfile++;
@@ -4900,6 +4908,7 @@ Status TabletUpdates::load_snapshot(const SnapshotMeta& snapshot_meta, bool rest
         STLClearObject(&_rowset_stats);
 
         _apply_version_idx = 0;
+        _row_cache_epoch.fetch_add(1, std::memory_order_acq_rel);
         _rowsets = std::move(new_rowsets);
 
         auto& new_version = _edit_version_infos.emplace_back(std::make_unique<EditVersionInfo>());
@@ -142,6 +142,10 @@ public:
 
     int64_t max_readable_version() const;
 
+    // Bumped by the changes whose primary keys are not erased one by one from the short-circuit row cache, e.g. a
+    // partial update by column or a snapshot load, so that all the cached rows of the tablet become stale.
+    int64_t row_cache_epoch() const { return _row_cache_epoch.load(std::memory_order_acquire); }
+
     // get total number of committed and pending rowsets
     size_t version_count() const;
 
@@ -552,6 +556,7 @@ private:
 
     // used to stop apply thread when shutting-down this tablet
     std::atomic<bool> _apply_stopped = false;
+    std::atomic<int64_t> _row_cache_epoch{0};
     std::condition_variable _apply_stopped_cond;
 
     BlockingQueue<RowsetSharedPtr> _unused_rowsets;
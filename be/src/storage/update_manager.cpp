@@ -185,6 +185,12 @@ Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, in
                 *pdelvec = itr->second;
                 return Status::OK();
             }
+            auto prev_itr = _prev_del_vec_cache.find(tsid);
+            if (prev_itr != _prev_del_vec_cache.end() && version >= prev_itr->second.first->version() &&
+                version < prev_itr->second.second) {
+                *pdelvec = prev_itr->second.first;
+                return Status::OK();
+            }
         }
     }
     (*pdelvec).reset(new DelVector());
@@ -221,6 +227,7 @@ void UpdateManager::clear_cache() {
     {
         std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
         _del_vec_cache.clear();
+        _prev_del_vec_cache.clear();
         if (_del_vec_cache_mem_tracker) {
             _del_vec_cache_mem_tracker->release(_del_vec_cache_mem_tracker->consumption());
         }
@@ -244,6 +251,15 @@ void UpdateManager::clear_cached_del_vec(const std::vector<TabletSegmentId>& tsi
             _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
             _del_vec_cache.erase(itr);
         }
+        _erase_prev_del_vec_unlocked(tsid);
+    }
+}
+
+void UpdateManager::_erase_prev_del_vec_unlocked(const TabletSegmentId& tsid) {
+    auto itr = _prev_del_vec_cache.find(tsid);
+    if (itr != _prev_del_vec_cache.end()) {
+        _del_vec_cache_mem_tracker->release(itr->second.first->memory_usage());
+        _prev_del_vec_cache.erase(itr);
     }
 }
 
@@ -371,10 +387,16 @@ void UpdateManager::expire_cache() {
     StarRocksMetrics::instance()->update_primary_index_bytes_total.set_value(_index_cache.size());
     {
         std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
-        StarRocksMetrics::instance()->update_del_vector_num.set_value(_del_vec_cache.size());
-        StarRocksMetrics::instance()->update_del_vector_bytes_total.set_value(std::accumulate(
-                _del_vec_cache.cbegin(), _del_vec_cache.cend(), 0,
-                [](const int& accumulated, const auto& p) { return accumulated + p.second->memory_usage(); }));
+        // the replaced delvecs kept for readers of older versions are cached as well
+        StarRocksMetrics::instance()->update_del_vector_num.set_value(_del_vec_cache.size() +
+                                                                      _prev_del_vec_cache.size());
+        size_t del_vec_bytes = std::accumulate(
+                _del_vec_cache.cbegin(), _del_vec_cache.cend(), size_t(0),
+                [](const size_t& accumulated, const auto& p) { return accumulated + p.second->memory_usage(); });
+        del_vec_bytes += std::accumulate(
+                _prev_del_vec_cache.cbegin(), _prev_del_vec_cache.cend(), size_t(0),
+                [](const size_t& accumulated, const auto& p) { return accumulated + p.second.first->memory_usage(); });
+        StarRocksMetrics::instance()->update_del_vector_bytes_total.set_value(del_vec_bytes);
     }
     if (MonotonicMillis() - _last_clear_expired_cache_millis > _cache_expire_ms) {
         _update_state_cache.clear_expired();
@@ -487,7 +509,13 @@ Status UpdateManager::set_cached_del_vec(const TabletSegmentId& tsid, const DelV
             LOG(ERROR) << msg;
             return Status::InternalError(msg);
         } else {
-            _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
+            _erase_prev_del_vec_unlocked(tsid);
+            if (config::enable_pk_previous_del_vec_cache) {
+                // the replaced delvec stays valid for the versions before the new one
+                _prev_del_vec_cache[tsid] = std::make_pair(itr->second, delvec->version());
+            } else {
+                _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
+            }
             itr->second = delvec;
             _del_vec_cache_mem_tracker->consume(itr->second->memory_usage());
         }
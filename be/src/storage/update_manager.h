@@ -151,6 +151,8 @@ public:
 
 private:
     void* _schedule_apply_thread_callback(void* arg);
+    // requires _del_vec_cache_lock
+    void _erase_prev_del_vec_unlocked(const TabletSegmentId& tsid);
 
 private:
     // default 6min
@@ -172,6 +174,8 @@ private:
     // DelVector related states
     std::mutex _del_vec_cache_lock;
     std::unordered_map<TabletSegmentId, DelVectorPtr> _del_vec_cache;
+    // the delvec replaced by the one in _del_vec_cache, and the version from which it is no longer valid
+    std::unordered_map<TabletSegmentId, std::pair<DelVectorPtr, int64_t>> _prev_del_vec_cache;
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
     // Delta Column Group cache, dcg is short for `Delta Column Group`
@@ -42,8 +42,10 @@
 #include "runtime/mem_pool.h"
 #include "runtime/string_value.h"
 #include "simd/multi_version.h"
+#include "simd/simd.h"
 #include "util/coding.h"
 #include "util/phmap/phmap.h"
+#include "util/unaligned_access.h"
 
 using std::map;
 using std::nothrow;
@@ -317,10 +319,7 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
     }
     case HLL_DATA_SPARSE:
     case HLL_DATA_FULL: {
-        uint32_t num_non_zero_registers = 0;
-        for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
-            num_non_zero_registers += (_registers.data[i] != 0);
-        }
+        uint32_t num_non_zero_registers = SIMD::count_nonzero(_registers.data, HLL_REGISTERS_COUNT);
         // each register in sparse format will occupy 3bytes, 2 for index and
         // 1 for register value. So if num_non_zero_registers is greater than
         // 4K we use full encode format.
@@ -334,15 +333,21 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
             encode_fixed32_le(ptr, num_non_zero_registers);
             ptr += 4;
 
-            for (uint32_t i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-                if (_registers.data[i] == 0) {
+            // sparse registers are mostly zero, so skip them 8 at a time
+            for (uint32_t i = 0; i < HLL_REGISTERS_COUNT; i += sizeof(uint64_t)) {
+                if (unaligned_load<uint64_t>(_registers.data + i) == 0) {
                     continue;
                 }
-                // 2 bytes: register index
-                // 1 byte: register value
-                encode_fixed16_le(ptr, i);
-                ptr += 2;
-                *ptr++ = _registers.data[i];
+                for (uint32_t j = i; j < i + sizeof(uint64_t); ++j) {
+                    if (_registers.data[j] == 0) {
+                        continue;
+                    }
+                    // 2 bytes: register index
+                    // 1 byte: register value
+                    encode_fixed16_le(ptr, j);
+                    ptr += 2;
+                    *ptr++ = _registers.data[j];
+                }
             }
         }
         break;
@@ -550,14 +555,11 @@ int64_t HyperLogLog::estimate_cardinality() const {
     }
 
     float harmonic_mean = 0;
-    int num_zero_registers = 0;
+    int num_zero_registers = SIMD::count_zero(_registers.data, HLL_REGISTERS_COUNT);
 
+    // keep the summation order, the estimate must not depend on the instruction set
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
         harmonic_mean += harmomic_tables[_registers.data[i]];
-
-        if (_registers.data[i] == 0) {
-            ++num_zero_registers;
-        }
     }
 
     harmonic_mean = 1.0f / harmonic_mean;
@@ -40,6 +40,7 @@
 #include <deque>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "util/stopwatch.hpp"
 
@@ -143,6 +144,22 @@ public:
         return false;
     }
 
+    // Append up to |max_items| items to |out| at once.
+    // Return the number of items got, 0 iff empty *AND* has been shutdown.
+    size_t blocking_get_batch(std::vector<T>* out, size_t max_items) {
+        std::unique_lock<Lock> l(_lock);
+        _not_empty.wait(l, [this]() { return !_items.empty() || _shutdown; });
+        size_t num_items = std::min(max_items, _items.size());
+        for (size_t i = 0; i < num_items; ++i) {
+            out->emplace_back(std::move(_items.front()));
+            _items.pop_front();
+        }
+        if (num_items > 0) {
+            _not_full.notify_all();
+        }
+        return num_items;
+    }
+
     // Return 1 on success;
     // Return 0 on queue empty;
     // Return -1 on shutdown;
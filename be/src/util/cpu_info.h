@@ -96,6 +96,21 @@ public:
 
     static std::vector<size_t> get_core_ids();
 
+    /// Returns the maximum possible number of NUMA nodes.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core. Always in range [0, get_max_num_numa_nodes()).
+    static int get_numa_node_of_core(int core) {
+        DCHECK(core >= 0 && core < max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the cores belonging to the NUMA node.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK(node >= 0 && node < max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
     static bool is_cgroup_with_cpuset() { return is_cgroup_with_cpuset_; }
     static bool is_cgroup_with_cpu_quota() { return is_cgroup_with_cpu_quota_; }
 
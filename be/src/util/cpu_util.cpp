@@ -16,7 +16,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 #include "common/config.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 
 namespace starrocks {
@@ -50,6 +53,26 @@ void CpuUtil::bind_cpus(Thread* thread, const std::vector<size_t>& cpuids) {
     thread->set_first_bound_cpuid(cpuids[0]);
 }
 
+std::vector<CpuUtil::CpuIds> CpuUtil::group_by_numa_node(const CpuIds& cpuids) {
+    std::vector<CpuIds> node_cpuids(std::max(CpuInfo::get_max_num_numa_nodes(), 1));
+    for (const auto cpu_id : cpuids) {
+        const int node = cpu_id < CpuInfo::get_max_num_cores() ? CpuInfo::get_numa_node_of_core(cpu_id) : 0;
+        node_cpuids[node].emplace_back(cpu_id);
+    }
+    node_cpuids.erase(std::remove_if(node_cpuids.begin(), node_cpuids.end(),
+                                     [](const CpuIds& ids) { return ids.empty(); }),
+                      node_cpuids.end());
+    return node_cpuids;
+}
+
+CpuUtil::CpuIds CpuUtil::numa_local_cpuids(const CpuIds& cpuids, size_t thread_index) {
+    auto node_cpuids = group_by_numa_node(cpuids);
+    if (node_cpuids.size() <= 1) {
+        return cpuids;
+    }
+    return std::move(node_cpuids[thread_index % node_cpuids.size()]);
+}
+
 std::string CpuUtil::to_string(const CpuIds& cpuids) {
     std::string result = "(";
     for (size_t i = 0; i < cpuids.size(); i++) {
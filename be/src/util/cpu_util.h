@@ -29,6 +29,13 @@ public:
 
     static void bind_cpus(Thread* thread, const std::vector<size_t>& cpuids);
 
+    // Group the cpuids by NUMA node, and the nodes containing none of the cpuids are skipped.
+    static std::vector<CpuIds> group_by_numa_node(const CpuIds& cpuids);
+
+    // Return the cpuids of a single NUMA node, which is chosen from the nodes covered by *cpuids*
+    // in a round-robin manner based on *thread_index*. Return *cpuids* itself, if it covers only one node.
+    static CpuIds numa_local_cpuids(const CpuIds& cpuids, size_t thread_index);
+
     static std::string to_string(const CpuIds& cpuids);
 };
 
@@ -0,0 +1,142 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/hardware_perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+#ifdef __linux__
+static long perf_event_open(struct perf_event_attr* attr, pid_t pid, int cpu, int group_fd, unsigned long flags) {
+    return syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags);
+}
+#endif
+
+HardwarePerfCounters::~HardwarePerfCounters() {
+#ifdef __linux__
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+HardwarePerfCounters* HardwarePerfCounters::current() {
+    static thread_local HardwarePerfCounters counters;
+    return &counters;
+}
+
+bool HardwarePerfCounters::_open() {
+#ifdef __linux__
+    static constexpr std::array<std::pair<uint32_t, uint64_t>, NUM_EVENTS> events{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = events[i].first;
+        attr.config = events[i].second;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // The leader starts disabled, and the whole group is enabled once all the members are opened.
+        attr.disabled = i == 0 ? 1 : 0;
+
+        int group_fd = i == 0 ? -1 : _fds[0];
+        long fd = perf_event_open(&attr, 0, -1, group_fd, 0);
+        if (fd < 0) {
+            LOG_FIRST_N(WARNING, 1) << "perf_event_open is unavailable, hardware counters are disabled: "
+                                    << std::strerror(errno);
+            return false;
+        }
+        _fds[i] = static_cast<int>(fd);
+    }
+    ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool HardwarePerfCounters::read(Values* values) {
+    if (!_tried_open) {
+        _tried_open = true;
+        _available = _open();
+    }
+    if (!_available) {
+        return false;
+    }
+#ifdef __linux__
+    // Layout of PERF_FORMAT_GROUP: { u64 nr; u64 values[nr]; }
+    uint64_t buf[NUM_EVENTS + 1];
+    if (::read(_fds[0], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[0] != NUM_EVENTS) {
+        return false;
+    }
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        (*values)[i] = buf[i + 1];
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HardwarePerfProfileCounters::init(RuntimeProfile* profile) {
+    cycles = ADD_COUNTER(profile, "HWCycles", TUnit::UNIT);
+    instructions = ADD_COUNTER(profile, "HWInstructions", TUnit::UNIT);
+    llc_misses = ADD_COUNTER(profile, "HWLLCMisses", TUnit::UNIT);
+    branch_misses = ADD_COUNTER(profile, "HWBranchMisses", TUnit::UNIT);
+}
+
+ScopedHardwarePerfCounters::ScopedHardwarePerfCounters(HardwarePerfProfileCounters* counters) {
+    if (counters != nullptr && counters->enabled() && HardwarePerfCounters::current()->read(&_start)) {
+        _counters = counters;
+    }
+}
+
+ScopedHardwarePerfCounters::~ScopedHardwarePerfCounters() {
+    if (_counters == nullptr) {
+        return;
+    }
+    HardwarePerfCounters::Values end;
+    if (!HardwarePerfCounters::current()->read(&end)) {
+        return;
+    }
+    COUNTER_UPDATE(_counters->cycles, end[HardwarePerfCounters::CYCLES] - _start[HardwarePerfCounters::CYCLES]);
+    COUNTER_UPDATE(_counters->instructions,
+                   end[HardwarePerfCounters::INSTRUCTIONS] - _start[HardwarePerfCounters::INSTRUCTIONS]);
+    COUNTER_UPDATE(_counters->llc_misses,
+                   end[HardwarePerfCounters::LLC_MISSES] - _start[HardwarePerfCounters::LLC_MISSES]);
+    COUNTER_UPDATE(_counters->branch_misses,
+                   end[HardwarePerfCounters::BRANCH_MISSES] - _start[HardwarePerfCounters::BRANCH_MISSES]);
+}
+
+} // namespace starrocks
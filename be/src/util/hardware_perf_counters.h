@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// Per-thread hardware counters read via perf_event_open(2).
+// The counters of a thread are opened lazily as one event group, and only count user space events.
+// If perf_event is not available (non-Linux, perf_event_paranoid, seccomp), the counters of the thread are
+// marked unavailable and every read returns false.
+class HardwarePerfCounters {
+public:
+    enum Event { CYCLES = 0, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+    using Values = std::array<uint64_t, NUM_EVENTS>;
+
+    ~HardwarePerfCounters();
+
+    // Return the counters of the current thread.
+    static HardwarePerfCounters* current();
+
+    // Read the current values of all the events, return false if they are unavailable.
+    bool read(Values* values);
+
+private:
+    HardwarePerfCounters() = default;
+    bool _open();
+
+    bool _tried_open = false;
+    bool _available = false;
+    std::array<int, NUM_EVENTS> _fds{-1, -1, -1, -1};
+};
+
+// The profile counters which the hardware events are accumulated into.
+struct HardwarePerfProfileCounters {
+    RuntimeProfile::Counter* cycles = nullptr;
+    RuntimeProfile::Counter* instructions = nullptr;
+    RuntimeProfile::Counter* llc_misses = nullptr;
+    RuntimeProfile::Counter* branch_misses = nullptr;
+
+    bool enabled() const { return cycles != nullptr; }
+    void init(RuntimeProfile* profile);
+};
+
+// Accumulate the hardware events of the current thread during the scope into *counters*.
+// Do nothing if *counters* is null or not enabled.
+class ScopedHardwarePerfCounters {
+public:
+    explicit ScopedHardwarePerfCounters(HardwarePerfProfileCounters* counters);
+    ~ScopedHardwarePerfCounters();
+
+private:
+    HardwarePerfProfileCounters* _counters = nullptr;
+    HardwarePerfCounters::Values _start{};
+};
+
+} // namespace starrocks
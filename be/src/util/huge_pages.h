@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+static constexpr size_t kHugePageSize = 2UL << 20;
+
+// Asks the kernel to back the 2MB aligned part of [ptr, ptr + size) by transparent huge pages, which
+// cuts the TLB misses of large and randomly accessed structures such as hash tables. Takes effect when
+// config::madvise_huge_pages is enabled and THP is in "madvise" or "always" mode. The advice has to be
+// given before the memory is touched, so that the first page faults map huge pages.
+inline void madvise_huge_pages(void* ptr, size_t size) {
+#ifdef MADV_HUGEPAGE
+    if (!config::madvise_huge_pages || size < kHugePageSize) {
+        return;
+    }
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(kHugePageSize - 1);
+    if (begin < end) {
+        // it's only an advice, failures (e.g. THP is disabled) are ignored
+        (void)madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+// std::allocator which advises huge pages for large allocations, for the buckets of hash tables.
+// The memory still comes from malloc, so it's tracked by the mem hook as usual.
+template <class T>
+class HugePageAllocator : public std::allocator<T> {
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = HugePageAllocator<U>;
+    };
+
+    HugePageAllocator() = default;
+    template <class U>
+    HugePageAllocator(const HugePageAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        T* ptr = std::allocator<T>::allocate(n);
+        madvise_huge_pages(ptr, n * sizeof(T));
+        return ptr;
+    }
+
+    template <class U>
+    bool operator==(const HugePageAllocator<U>&) const {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const HugePageAllocator<U>&) const {
+        return false;
+    }
+};
+
+} // namespace starrocks
@@ -528,7 +528,11 @@ uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const std::string& a
         // leaf node or all children is remain
         // check sparsity, same key may appear many times in json, so we need avoid duplicate compute hits
         auto desc = _derived_maps[node];
-        if (desc.multi_times <= 0 && desc.hits >= _total_rows * _min_json_sparsity_factory) {
+        double sparsity_factor = _min_json_sparsity_factory;
+        if (_hot_paths.count(absolute_path.substr(1)) > 0) {
+            sparsity_factor = std::min(config::json_flat_hot_path_sparsity_factor, sparsity_factor);
+        }
+        if (desc.multi_times <= 0 && desc.hits >= _total_rows * sparsity_factor) {
             hit_leaf->emplace_back(node, absolute_path);
             node->type = flat_json::JSON_BITS_TO_LOGICAL_TYPE.at(desc.type);
             node->remain = false;
@@ -569,7 +573,13 @@ void JsonPathDeriver::_finalize() {
     _dfs_finalize(_path_root.get(), "", &hit_leaf);
 
     // sort by name, just for stable order
+    // paths read by queries go first, so they are kept when there are more paths than json_flat_column_max
     std::sort(hit_leaf.begin(), hit_leaf.end(), [&](const auto& a, const auto& b) {
+        bool hot_a = _hot_paths.count(a.second.substr(1)) > 0;
+        bool hot_b = _hot_paths.count(b.second.substr(1)) > 0;
+        if (hot_a != hot_b) {
+            return hot_a;
+        }
         auto desc_a = _derived_maps[a.first];
         auto desc_b = _derived_maps[b.first];
         return desc_a.hits > desc_b.hits;
@@ -613,6 +623,99 @@ void JsonPathDeriver::_finalize() {
     }
 }
 
+JsonPathAccessStats* JsonPathAccessStats::instance() {
+    static JsonPathAccessStats stats;
+    return &stats;
+}
+
+JsonPathAccessStats::Shard& JsonPathAccessStats::_shard(const ColumnKey& key) {
+    size_t hash = std::hash<int64_t>()(key.first) * 31 + std::hash<int32_t>()(key.second);
+    return _shards[hash % kNumShards];
+}
+
+void JsonPathAccessStats::_decay(ColumnStats* stats, int64_t now_sec) {
+    int64_t interval_sec = config::json_flat_hot_path_access_decay_sec;
+    if (interval_sec <= 0) {
+        return;
+    }
+    int64_t periods = (now_sec - stats->last_decay_sec) / interval_sec;
+    if (periods <= 0) {
+        return;
+    }
+    stats->last_decay_sec += periods * interval_sec;
+    auto& counts = stats->access_counts;
+    for (auto iter = counts.begin(); iter != counts.end();) {
+        iter->second = periods >= 64 ? 0 : iter->second >> periods;
+        if (iter->second == 0) {
+            iter = counts.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+bool JsonPathAccessStats::_evict(Shard* shard, int64_t now_sec) {
+    for (auto iter = shard->columns.begin(); iter != shard->columns.end();) {
+        _decay(&iter->second, now_sec);
+        if (iter->second.access_counts.empty()) {
+            iter = shard->columns.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    return shard->columns.size() < kMaxColumnsPerShard;
+}
+
+void JsonPathAccessStats::record(int64_t schema_id, int32_t column_uid, const std::vector<std::string>& paths,
+                                 int64_t now_sec) {
+    if (config::json_flat_hot_path_min_access <= 0 || paths.empty()) {
+        return;
+    }
+    auto key = std::make_pair(schema_id, column_uid);
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> l(shard.lock);
+    auto iter = shard.columns.find(key);
+    if (iter == shard.columns.end()) {
+        if (shard.columns.size() >= kMaxColumnsPerShard && !_evict(&shard, now_sec)) {
+            return;
+        }
+        iter = shard.columns.emplace(key, ColumnStats()).first;
+        iter->second.last_decay_sec = now_sec;
+    }
+    auto& stats = iter->second;
+    _decay(&stats, now_sec);
+    for (const auto& path : paths) {
+        auto count_iter = stats.access_counts.find(path);
+        if (count_iter != stats.access_counts.end()) {
+            count_iter->second++;
+        } else if (stats.access_counts.size() < kMaxPathsPerColumn) {
+            stats.access_counts.emplace(path, 1);
+        }
+    }
+}
+
+std::vector<std::string> JsonPathAccessStats::hot_paths(int64_t schema_id, int32_t column_uid, int64_t now_sec) {
+    std::vector<std::string> paths;
+    int32_t min_access = config::json_flat_hot_path_min_access;
+    if (min_access <= 0) {
+        return paths;
+    }
+    auto key = std::make_pair(schema_id, column_uid);
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> l(shard.lock);
+    auto iter = shard.columns.find(key);
+    if (iter == shard.columns.end()) {
+        return paths;
+    }
+    _decay(&iter->second, now_sec);
+    for (const auto& [path, count] : iter->second.access_counts) {
+        if (count >= static_cast<uint64_t>(min_access)) {
+            paths.emplace_back(path);
+        }
+    }
+    return paths;
+}
+
 JsonFlattener::JsonFlattener(JsonPathDeriver& deriver) {
     DCHECK(deriver.flat_path_root() != nullptr);
     _dst_paths = deriver.flat_paths();
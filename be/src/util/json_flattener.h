@@ -17,14 +17,18 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "column/nullable_column.h"
@@ -38,6 +42,7 @@
 #include "storage/rowset/column_reader.h"
 #include "types/logical_type.h"
 #include "util/phmap/phmap.h"
+#include "util/time.h"
 #include "velocypack/vpack.h"
 
 namespace starrocks {
@@ -118,6 +123,11 @@ public:
 
     void set_generate_filter(bool generate_filter) { _generate_filter = generate_filter; }
 
+    // Paths read by queries, they are flattened before the others and with a lower sparsity limit.
+    void set_hot_paths(const std::vector<std::string>& hot_paths) {
+        _hot_paths.insert(hot_paths.begin(), hot_paths.end());
+    }
+
     std::shared_ptr<BloomFilter>& remain_fitler() { return _remain_filter; }
 
     std::shared_ptr<JsonFlatPath>& flat_path_root() { return _path_root; }
@@ -166,6 +176,55 @@ private:
 
     bool _generate_filter = false;
     std::shared_ptr<BloomFilter> _remain_filter = nullptr;
+
+    std::unordered_set<std::string> _hot_paths;
+};
+
+// Counts the scans reading the paths of json columns, so that compaction can flatten the paths the queries
+// actually use even if the data alone doesn't favor them. Columns are identified by the tablet schema id
+// and the column unique id. The counts are halved every config::json_flat_hot_path_access_decay_sec, so
+// the paths no longer read cool down, and the columns whose counts all decay to zero are evicted.
+class JsonPathAccessStats {
+public:
+    static JsonPathAccessStats* instance();
+
+    // The columns are keyed by (schema id, column unique id), the callers skip the tablet schemas without an id,
+    // which all share TabletSchema::invalid_id().
+
+    void record(int64_t schema_id, int32_t column_uid, const std::vector<std::string>& paths) {
+        record(schema_id, column_uid, paths, MonotonicSeconds());
+    }
+    void record(int64_t schema_id, int32_t column_uid, const std::vector<std::string>& paths, int64_t now_sec);
+
+    // The paths of the column read at least config::json_flat_hot_path_min_access times.
+    std::vector<std::string> hot_paths(int64_t schema_id, int32_t column_uid) {
+        return hot_paths(schema_id, column_uid, MonotonicSeconds());
+    }
+    std::vector<std::string> hot_paths(int64_t schema_id, int32_t column_uid, int64_t now_sec);
+
+private:
+    static constexpr size_t kNumShards = 16;
+    // bound the memory, the paths beyond the limits are not counted.
+    static constexpr size_t kMaxColumnsPerShard = 4096 / kNumShards;
+    static constexpr size_t kMaxPathsPerColumn = 256;
+
+    using ColumnKey = std::pair<int64_t, int32_t>;
+    struct ColumnStats {
+        int64_t last_decay_sec = 0;
+        std::unordered_map<std::string, uint64_t> access_counts;
+    };
+    struct Shard {
+        std::mutex lock;
+        std::map<ColumnKey, ColumnStats> columns;
+    };
+
+    Shard& _shard(const ColumnKey& key);
+    static void _decay(ColumnStats* stats, int64_t now_sec);
+    // Decay all the columns of the shard and evict the ones without counts, return false if the shard is
+    // still full.
+    static bool _evict(Shard* shard, int64_t now_sec);
+
+    std::array<Shard, kNumShards> _shards;
 };
 
 // flattern JsonColumn to flat json A,B,C
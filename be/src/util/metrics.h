@@ -161,12 +161,14 @@ protected:
     T _value;
 };
 
+// Metric sharded per core, so that updates from many threads don't contend on one cache line.
+// The shards are summed on read.
 template <typename T>
-class CoreLocalCounter : public Metric {
+class CoreLocalMetric : public Metric {
 public:
-    CoreLocalCounter(MetricUnit unit) : Metric(MetricType::COUNTER, unit), _value() {}
+    CoreLocalMetric(MetricType type, MetricUnit unit) : Metric(type, unit), _value() {}
 
-    ~CoreLocalCounter() override = default;
+    ~CoreLocalMetric() override = default;
 
     std::string to_string() const override {
         std::stringstream ss;
@@ -192,6 +194,22 @@ protected:
     CoreLocalValue<T> _value;
 };
 
+template <typename T>
+class CoreLocalCounter : public CoreLocalMetric<T> {
+public:
+    CoreLocalCounter(MetricUnit unit) : CoreLocalMetric<T>(MetricType::COUNTER, unit) {}
+    ~CoreLocalCounter() override = default;
+};
+
+// Gauge that is only changed by deltas, e.g. the bytes in use updated by every allocation.
+// There is no set_value(), since the shards can't be updated at once.
+template <typename T>
+class CoreLocalGauge : public CoreLocalMetric<T> {
+public:
+    CoreLocalGauge(MetricUnit unit) : CoreLocalMetric<T>(MetricType::GAUGE, unit) {}
+    ~CoreLocalGauge() override = default;
+};
+
 template <typename T>
 class AtomicCounter : public AtomicMetric<T> {
 public:
@@ -403,6 +421,7 @@ using IntAtomicCounter = AtomicCounter<int64_t>;
 using UIntCounter = CoreLocalCounter<uint64_t>;
 using DoubleCounter = LockCounter<double>;
 using IntGauge = AtomicGauge<int64_t>;
+using IntCoreLocalGauge = CoreLocalGauge<int64_t>;
 using UIntGauge = AtomicGauge<uint64_t>;
 using DoubleGauge = LockGauge<double>;
 
@@ -424,6 +443,9 @@ using DoubleGauge = LockGauge<double>;
 #define METRIC_DEFINE_INT_GAUGE(metric_name, unit) \
     starrocks::IntGauge metric_name { unit }
 
+#define METRIC_DEFINE_INT_CORE_LOCAL_GAUGE(metric_name, unit) \
+    starrocks::IntCoreLocalGauge metric_name { unit }
+
 #define METRIC_DEFINE_UINT_GAUGE(metric_name, unit) \
     starrocks::UIntGauge metric_name { unit }
 
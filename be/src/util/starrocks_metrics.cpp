@@ -190,6 +190,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
 
     // Gauge
     REGISTER_STARROCKS_METRIC(memory_pool_bytes_total);
+    REGISTER_STARROCKS_METRIC(pipe_driver_overloaded);
     REGISTER_STARROCKS_METRIC(process_thread_num);
     REGISTER_STARROCKS_METRIC(process_fd_num_used);
     REGISTER_STARROCKS_METRIC(process_fd_num_limit_soft);
@@ -280,6 +280,12 @@ void SystemMetrics::_install_memory_metrics(MetricRegistry* registry) {
     registry->register_metric("jit_cache_mem_bytes", &_memory_metrics->jit_cache_mem_bytes);
     registry->register_metric("update_mem_bytes", &_memory_metrics->update_mem_bytes);
     registry->register_metric("chunk_allocator_mem_bytes", &_memory_metrics->chunk_allocator_mem_bytes);
+    registry->register_metric("column_buffer_cache_mem_bytes", &_memory_metrics->column_buffer_cache_mem_bytes);
+    registry->register_metric("position_delete_cache_mem_bytes", &_memory_metrics->position_delete_cache_mem_bytes);
+    registry->register_metric("parquet_page_cache_mem_bytes", &_memory_metrics->parquet_page_cache_mem_bytes);
+    registry->register_metric("short_circuit_row_cache_mem_bytes",
+                              &_memory_metrics->short_circuit_row_cache_mem_bytes);
+    registry->register_metric("hdfs_file_handle_cache_mem_bytes", &_memory_metrics->hdfs_file_handle_cache_mem_bytes);
     registry->register_metric("clone_mem_bytes", &_memory_metrics->clone_mem_bytes);
     registry->register_metric("consistency_mem_bytes", &_memory_metrics->consistency_mem_bytes);
     registry->register_metric("datacache_mem_bytes", &_memory_metrics->datacache_mem_bytes);
@@ -344,6 +350,11 @@ void SystemMetrics::_update_memory_metrics() {
     SET_MEM_METRIC_VALUE(jit_cache_mem_tracker, jit_cache_mem_bytes)
     SET_MEM_METRIC_VALUE(update_mem_tracker, update_mem_bytes)
     SET_MEM_METRIC_VALUE(chunk_allocator_mem_tracker, chunk_allocator_mem_bytes)
+    SET_MEM_METRIC_VALUE(column_buffer_cache_mem_tracker, column_buffer_cache_mem_bytes)
+    SET_MEM_METRIC_VALUE(position_delete_cache_mem_tracker, position_delete_cache_mem_bytes)
+    SET_MEM_METRIC_VALUE(parquet_page_cache_mem_tracker, parquet_page_cache_mem_bytes)
+    SET_MEM_METRIC_VALUE(short_circuit_row_cache_mem_tracker, short_circuit_row_cache_mem_bytes)
+    SET_MEM_METRIC_VALUE(hdfs_file_handle_cache_mem_tracker, hdfs_file_handle_cache_mem_bytes)
     SET_MEM_METRIC_VALUE(clone_mem_tracker, clone_mem_bytes)
     SET_MEM_METRIC_VALUE(consistency_mem_tracker, consistency_mem_bytes)
     SET_MEM_METRIC_VALUE(datacache_mem_tracker, datacache_mem_bytes)
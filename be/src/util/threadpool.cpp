@@ -37,6 +37,7 @@
 #include <limits>
 #include <ostream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "gutil/map_util.h"
@@ -101,6 +102,11 @@ ThreadPoolBuilder& ThreadPoolBuilder::set_borrowed_cpuids(const std::vector<CpuU
     return *this;
 }
 
+ThreadPoolBuilder& ThreadPoolBuilder::set_numa_aware(bool numa_aware) {
+    _numa_aware = numa_aware;
+    return *this;
+}
+
 Status ThreadPoolBuilder::build(std::unique_ptr<ThreadPool>* pool) const {
     pool->reset(new ThreadPool(*this));
     RETURN_IF_ERROR((*pool)->init());
@@ -262,7 +268,8 @@ ThreadPool::ThreadPool(const ThreadPoolBuilder& builder)
           _total_queued_tasks(0),
           _tokenless(new_token(ExecutionMode::CONCURRENT)),
           _cpuids(builder._cpuids),
-          _borrowed_cpuids(builder._borrowed_cpuids) {}
+          _borrowed_cpuids(builder._borrowed_cpuids),
+          _numa_aware(builder._numa_aware) {}
 
 ThreadPool::~ThreadPool() noexcept {
     // There should only be one live token: the one used in tokenless submission.
@@ -276,6 +283,10 @@ Status ThreadPool::init() {
         return Status::NotSupported("The thread pool is already initialized");
     }
     _pool_status = Status::OK();
+    {
+        std::lock_guard l(_lock);
+        _log_numa_binding_skipped_inlock();
+    }
     _num_threads_pending_start = _min_threads;
     for (int i = 0; i < _min_threads; i++) {
         Status status = create_thread();
@@ -513,9 +524,13 @@ Status ThreadPool::update_min_threads(int min_threads) {
 }
 
 static void _bind_cpus_inlock(Thread* thread, const size_t thread_index, const CpuUtil::CpuIds& cpuids,
-                              const std::vector<CpuUtil::CpuIds>& borrowed_cpuids) {
+                              const std::vector<CpuUtil::CpuIds>& borrowed_cpuids, bool numa_aware) {
     if (borrowed_cpuids.empty() || thread_index < cpuids.size()) {
-        CpuUtil::bind_cpus(thread, cpuids);
+        if (numa_aware) {
+            CpuUtil::bind_cpus(thread, CpuUtil::numa_local_cpuids(cpuids, thread_index));
+        } else {
+            CpuUtil::bind_cpus(thread, cpuids);
+        }
         return;
     }
 
@@ -547,14 +562,26 @@ static void _bind_cpus_inlock(Thread* thread, const size_t thread_index, const C
     }
 }
 
+bool ThreadPool::_numa_binding_skipped_inlock() const {
+    return _numa_aware && (_cpuids.empty() || !config::enable_resource_group_bind_cpus);
+}
+
+void ThreadPool::_log_numa_binding_skipped_inlock() const {
+    if (_numa_binding_skipped_inlock()) {
+        LOG(INFO) << "thread pool " << _name << " is NUMA-aware, but its threads aren't bound to NUMA nodes: "
+                  << (_cpuids.empty() ? "it has no cpuids" : "enable_resource_group_bind_cpus is false");
+    }
+}
+
 void ThreadPool::bind_cpus(const CpuUtil::CpuIds& cpuids, const std::vector<CpuUtil::CpuIds>& borrowed_cpuids) {
     std::lock_guard<std::mutex> lock(_lock);
     _cpuids = cpuids;
     _borrowed_cpuids = borrowed_cpuids;
+    _log_numa_binding_skipped_inlock();
 
     int i = 0;
     for (auto* thread : _threads) {
-        _bind_cpus_inlock(thread, i++, cpuids, borrowed_cpuids);
+        _bind_cpus_inlock(thread, i++, cpuids, borrowed_cpuids, _numa_aware);
     }
 }
 
@@ -572,7 +599,7 @@ void ThreadPool::dispatch_thread() {
     // Owned by this worker thread and added/removed from _idle_threads as needed.
     IdleThread me;
 
-    _bind_cpus_inlock(current_thread, _num_threads - 1, _cpuids, _borrowed_cpuids);
+    _bind_cpus_inlock(current_thread, _num_threads - 1, _cpuids, _borrowed_cpuids, _numa_aware);
 
     while (true) {
         // Note: Status::Aborted() is used to indicate normal shutdown.
@@ -127,6 +127,9 @@ public:
     ThreadPoolBuilder& set_idle_timeout(const MonoDelta& idle_timeout);
     ThreadPoolBuilder& set_cpuids(const CpuUtil::CpuIds& cpuids);
     ThreadPoolBuilder& set_borrowed_cpuids(const std::vector<CpuUtil::CpuIds>& borrowed_cpuids);
+    // Bind each thread to the cpuids of a single NUMA node instead of all the cpuids,
+    // so that the memory first touched by the thread is allocated from its local node.
+    ThreadPoolBuilder& set_numa_aware(bool numa_aware);
 
     // Instantiate a new ThreadPool with the existing builder arguments.
     Status build(std::unique_ptr<ThreadPool>* pool) const;
@@ -140,6 +143,7 @@ private:
     MonoDelta _idle_timeout;
     CpuUtil::CpuIds _cpuids;
     std::vector<CpuUtil::CpuIds> _borrowed_cpuids;
+    bool _numa_aware = false;
 
     ThreadPoolBuilder(const ThreadPoolBuilder&) = delete;
     const ThreadPoolBuilder& operator=(const ThreadPoolBuilder&) = delete;
@@ -265,6 +269,13 @@ public:
 
     void bind_cpus(const CpuUtil::CpuIds& cpuids, const std::vector<CpuUtil::CpuIds>& borrowed_cpuids);
 
+    // Whether the pool is NUMA-aware but its threads aren't bound to NUMA nodes, because it has no cpuids
+    // or binding cpus is disabled by enable_resource_group_bind_cpus.
+    bool numa_binding_skipped() const {
+        std::lock_guard l(_lock);
+        return _numa_binding_skipped_inlock();
+    }
+
 private:
     friend class ThreadPoolBuilder;
     friend class ThreadPoolToken;
@@ -391,6 +402,10 @@ private:
 
     CpuUtil::CpuIds _cpuids;
     std::vector<CpuUtil::CpuIds> _borrowed_cpuids;
+    bool _numa_aware = false;
+
+    bool _numa_binding_skipped_inlock() const;
+    void _log_numa_binding_skipped_inlock() const;
 
     // Total number of tasks that have finished
     CoreLocalCounter<int64_t> _total_executed_tasks{MetricUnit::NOUNIT};
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <cstring>
 #include <vector>
 
@@ -97,6 +101,22 @@ static inline const char* skip_leading_utf8(const char* p, const char* end, size
                                             [[maybe_unused]] size_t* skipped_chars) {
     int char_size = 0;
     size_t i = 0;
+#if defined(__SSE2__)
+    // 16 ascii bytes are 16 utf8 chars, so they are skipped at once, only the chunks
+    // containing multi-byte chars are walked through char by char.
+    constexpr auto SSE2_BYTES = sizeof(__m128i);
+    while (n - i >= SSE2_BYTES && end - p >= static_cast<ptrdiff_t>(SSE2_BYTES)) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)p)) == 0) {
+            p += SSE2_BYTES;
+            i += SSE2_BYTES;
+            continue;
+        }
+        // at most SSE2_BYTES chars in the chunk, so i never exceeds n here.
+        for (const char* chunk_end = p + SSE2_BYTES; p < chunk_end; ++i, p += char_size) {
+            char_size = UTF8_BYTE_LENGTH_TABLE[static_cast<uint8_t>(*p)];
+        }
+    }
+#endif
     for (; i < n && p < end; ++i, p += char_size) {
         char_size = UTF8_BYTE_LENGTH_TABLE[static_cast<uint8_t>(*p)];
     }
@@ -112,7 +132,23 @@ static inline const char* skip_leading_utf8(const char* p, const char* end, size
 // scan from trailing to leading in order to locate n-th utf char
 static inline const char* skip_trailing_utf8(const char* p, const char* begin, size_t n) {
     constexpr auto threshold = static_cast<int8_t>(0xBF);
-    for (auto i = 0; i < n && p >= begin; ++i) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    constexpr auto SSE2_BYTES = sizeof(__m128i);
+    while (n - i >= SSE2_BYTES && p - begin >= static_cast<ptrdiff_t>(SSE2_BYTES)) {
+        const char* chunk_begin = p - SSE2_BYTES;
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)chunk_begin)) == 0) {
+            p = chunk_begin;
+            i += SSE2_BYTES;
+            continue;
+        }
+        for (; p > chunk_begin; ++i) {
+            --p;
+            while (p >= begin && static_cast<int8_t>(*p) <= threshold) --p;
+        }
+    }
+#endif
+    for (; i < n && p >= begin; ++i) {
         --p;
         while (p >= begin && static_cast<int8_t>(*p) <= threshold) --p;
     }
@@ -0,0 +1,103 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_admission.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class CacheAdmissionTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        config::datacache_admission_min_frequency = 0;
+        config::datacache_admission_large_scan_ratio = 0;
+        config::datacache_admission_large_scan_probability = 10;
+    }
+};
+
+TEST_F(CacheAdmissionTest, frequency_sketch) {
+    FrequencySketch sketch(1000);
+    ASSERT_EQ(1024, sketch.width());
+    ASSERT_EQ(0, sketch.frequency(42));
+    ASSERT_EQ(1, sketch.increment(42));
+    ASSERT_EQ(2, sketch.increment(42));
+    for (int i = 0; i < 20; i++) {
+        sketch.increment(7);
+    }
+    // saturated
+    ASSERT_EQ(15, sketch.frequency(7));
+    ASSERT_EQ(2, sketch.frequency(42));
+
+    // recording a full sample halves every counter
+    for (uint64_t i = 0; i < 10 * 1024; i++) {
+        sketch.increment(i * 0x9E3779B97F4A7C15ULL + 1000);
+    }
+    ASSERT_LE(sketch.frequency(7), 8);
+    ASSERT_GE(sketch.frequency(7), 7);
+}
+
+TEST_F(CacheAdmissionTest, admit_by_frequency) {
+    const size_t block_size = 1024;
+    const size_t capacity = 1024 * block_size;
+    auto* admission = CacheAdmission::instance();
+
+    // disabled by default
+    ASSERT_EQ(CacheAdmission::ADMIT, admission->admit("file_a", 0, 4096, 0, capacity, block_size));
+
+    config::datacache_admission_min_frequency = 2;
+    ASSERT_EQ(CacheAdmission::REJECT_FREQUENCY, admission->admit("file_b", 0, 4096, 0, capacity, block_size));
+    ASSERT_EQ(CacheAdmission::ADMIT, admission->admit("file_b", 0, 4096, 0, capacity, block_size));
+    // another block of the same file is counted on its own
+    ASSERT_EQ(CacheAdmission::REJECT_FREQUENCY,
+              admission->admit("file_b", block_size, 4096, 0, capacity, block_size));
+    // high priority blocks are always admitted
+    ASSERT_EQ(CacheAdmission::ADMIT, admission->admit("file_c", 0, 4096, 1, capacity, block_size));
+}
+
+TEST_F(CacheAdmissionTest, admit_large_scan) {
+    const size_t block_size = 1024;
+    const size_t capacity = 1024 * block_size;
+    auto* admission = CacheAdmission::instance();
+    config::datacache_admission_large_scan_ratio = 50;
+    config::datacache_admission_large_scan_probability = 10;
+
+    // small files are not sampled
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(CacheAdmission::ADMIT, admission->admit("small", i * block_size, capacity / 4, 0, capacity, block_size));
+    }
+
+    const int64_t file_size = 2 * capacity;
+    const int num_blocks = file_size / block_size;
+    std::vector<bool> admitted;
+    for (int i = 0; i < num_blocks; i++) {
+        admitted.push_back(admission->admit("large", i * block_size, file_size, 0, capacity, block_size) ==
+                           CacheAdmission::ADMIT);
+    }
+    int num_admitted = std::count(admitted.begin(), admitted.end(), true);
+    ASSERT_GT(num_admitted, num_blocks / 20);
+    ASSERT_LT(num_admitted, num_blocks / 5);
+
+    // a rescan samples the same blocks
+    for (int i = 0; i < num_blocks; i++) {
+        auto result = admission->admit("large", i * block_size, file_size, 0, capacity, block_size);
+        ASSERT_EQ(admitted[i], result == CacheAdmission::ADMIT);
+    }
+}
+
+} // namespace starrocks
@@ -291,6 +291,28 @@ PARALLEL_TEST(BinaryColumnTest, test_filter_range) {
     ASSERT_EQ(data[64], "c");
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_filter_runs) {
+    auto column = BinaryColumn::create();
+    std::vector<std::string> expected;
+    Filter filter;
+    for (int i = 0; i < 200; ++i) {
+        column->append(std::string(i % 7, 'a' + i % 26));
+        // runs of different lengths, which also cross the 32 rows batches
+        bool selected = (i / 3) % 4 != 0 && i % 50 != 49;
+        filter.push_back(selected);
+        if (selected) {
+            expected.emplace_back(std::string(i % 7, 'a' + i % 26));
+        }
+    }
+
+    ASSERT_EQ(expected.size(), column->filter(filter));
+    ASSERT_EQ(expected.size(), column->size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], column->get_slice(i).to_string());
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(BinaryColumnTest, test_resize) {
     auto c = BinaryColumn::create();
@@ -649,6 +671,26 @@ PARALLEL_TEST(BinaryColumnTest, test_replicate) {
     ASSERT_EQ("def", slices[4]);
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_append_selective) {
+    auto c1 = BinaryColumn::create();
+    for (int i = 0; i < 32; i++) {
+        c1->append(std::string(i % 7, 'a' + i % 26));
+    }
+
+    // runs of consecutive indexes mixed with random ones
+    std::vector<uint32_t> indexes{5, 3, 4, 5, 6, 31, 0, 0, 1, 2, 30, 31, 17, 9, 10, 11, 12, 13, 14, 15, 1, 28};
+    auto c2 = BinaryColumn::create();
+    c2->append("prefix");
+    c2->append_selective(*c1, indexes.data(), 1, indexes.size() - 1);
+
+    ASSERT_EQ(indexes.size(), c2->size());
+    ASSERT_EQ("prefix", c2->get_slice(0));
+    for (size_t i = 1; i < indexes.size(); i++) {
+        ASSERT_EQ(c1->get_slice(indexes[i]), c2->get_slice(i));
+    }
+}
+
 PARALLEL_TEST(BinaryColumnTest, test_reference_memory_usage) {
     auto column = BinaryColumn::create();
     column->append("");
@@ -395,6 +395,22 @@ TEST_F(ChunkTest, test_filter_with_extra_data) {
     check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk_extra_data1->columns()[1].get()), {2, 4});
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_filter_selected_prefix) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2, 6), make_schema(2));
+    // the first unselected row is in the middle
+    Buffer<uint8_t> selection{1, 1, 1, 0, 1, 0};
+    ASSERT_EQ(4, chunk->filter(selection));
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[0].get()), {0, 1, 2, 4});
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[1].get()), {1, 2, 3, 5});
+
+    // all selected, with and without force
+    selection.assign(4, 1);
+    ASSERT_EQ(4, chunk->filter(selection));
+    ASSERT_EQ(4, chunk->filter(selection, true));
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[0].get()), {0, 1, 2, 4});
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_clone_empty_with_extra_data) {
     auto extra_data1 = make_extra_data(2);
@@ -15,6 +15,7 @@
 #include "column/column_helper.h"
 
 #include "column/column_builder.h"
+#include "column/nullable_column.h"
 #include "gtest/gtest.h"
 
 namespace starrocks {
@@ -57,4 +58,16 @@ TEST_F(ColumnHelperTest, align_return_type) {
     ASSERT_FALSE(nullable_column->is_constant());
 }
 
+TEST_F(ColumnHelperTest, is_all_null) {
+    ASSERT_TRUE(ColumnHelper::is_all_null(ColumnHelper::create_const_null_column(10)));
+    ASSERT_FALSE(ColumnHelper::is_all_null(create_column()));
+
+    auto nullable_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    ASSERT_FALSE(ColumnHelper::is_all_null(nullable_column));
+    nullable_column->append_nulls(100);
+    ASSERT_TRUE(ColumnHelper::is_all_null(nullable_column));
+    nullable_column->append_datum(Datum(int32_t(1)));
+    ASSERT_FALSE(ColumnHelper::is_all_null(nullable_column));
+}
+
 } // namespace starrocks
@@ -114,4 +114,37 @@ TEST(TimestampValueTest, cast) {
     ASSERT_EQ("2004-02-29", ((DateValue)v).to_string());
 }
 
+TEST(TimestampValueTest, fromStandardString) {
+    // the specialized parser gives the same result as the generic one
+    for (const std::string s : {"2023-10-14 12:34:56", "2023-10-14T12:34:56", "2023-10-14 12:34:56.1",
+                                "2023-10-14 12:34:56.123", "2024-02-29 23:59:59.999999", "0000-00-00 00:00:00"}) {
+        date::ToDatetimeResult res;
+        ASSERT_TRUE(date::from_standard_datetime_string(s.data(), s.size(), &res)) << s;
+        int year, month, day, hour, minute, second, microsecond;
+        ASSERT_TRUE(date::from_string(s.data(), s.size(), &year, &month, &day, &hour, &minute, &second, &microsecond));
+        ASSERT_EQ(year, res.year);
+        ASSERT_EQ(month, res.month);
+        ASSERT_EQ(day, res.day);
+        ASSERT_EQ(hour, res.hour);
+        ASSERT_EQ(minute, res.minute);
+        ASSERT_EQ(second, res.second);
+        ASSERT_EQ(microsecond, res.microsecond);
+    }
+
+    // not exactly in the standard format or out of range, left to the generic parser
+    for (const std::string s : {"2023-10-14", " 2023-10-14 12:34:56", "2023/10/14 12:34:56", "2023-1a-14 12:34:56",
+                                "2023-10-14 12:34:5x", "2023-10-14 12:34:56.", "2023-10-14 12:34:56.1234567",
+                                "2023-10-14 24:00:00", "2023-02-29 00:00:00", "2023-13-01 00:00:00"}) {
+        date::ToDatetimeResult res;
+        ASSERT_FALSE(date::from_standard_datetime_string(s.data(), s.size(), &res)) << s;
+    }
+
+    TimestampValue v;
+    ASSERT_TRUE(v.from_string("2023-10-14 12:34:56.123", 23));
+    ASSERT_EQ("2023-10-14 12:34:56.123000", v.to_string());
+    ASSERT_TRUE(v.from_string(" 2023/10/14 12:34:56", 20));
+    ASSERT_EQ("2023-10-14 12:34:56", v.to_string());
+    ASSERT_FALSE(v.from_string("2023-02-29 00:00:00", 19));
+}
+
 } // namespace starrocks
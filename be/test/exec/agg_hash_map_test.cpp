@@ -154,6 +154,33 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, SortedKeyRuns) {
+    using TestAggHashMapKey = Int32AggHashMapWithOneNumberKey<PhmapSeed1>;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    const int chunk_size = 64;
+    TestAggHashMapKey key(chunk_size, &statis);
+    MemPool pool;
+    auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+
+    // keys come in runs of 8, the second chunk continues the last run of the first one
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    std::vector<AggDataPtr> states;
+    for (int chunk = 0; chunk < 2; chunk++) {
+        Columns key_columns{Int32Column::create()};
+        for (int i = 0; i < chunk_size; i++) {
+            key_columns[0]->append_datum(Datum((chunk * chunk_size + i + 4) / 8));
+        }
+        key.build_hash_map(chunk_size, key_columns, &pool, allocate_func, &agg_states);
+        states.insert(states.end(), agg_states.begin(), agg_states.end());
+    }
+    ASSERT_EQ(17, key.hash_map.size());
+    for (int i = 1; i < 2 * chunk_size; i++) {
+        ASSERT_EQ((i + 4) / 8 == (i + 3) / 8, states[i] == states[i - 1]);
+    }
+    ASSERT_EQ(states[0], key.hash_map.find(0)->second);
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
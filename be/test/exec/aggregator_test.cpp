@@ -0,0 +1,93 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/aggregator.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(AggrAutoContextTest, SlidingHitRatio) {
+    AggrAutoContext ctx;
+    ASSERT_EQ(0, ctx.hit_ratio);
+    // empty chunks do not move the window
+    ctx.update_hit_ratio(0, 0);
+    ASSERT_EQ(0, ctx.hit_ratio);
+
+    // input turning into fully aggregated becomes a high hit ratio after a bounded number of chunks
+    int chunks = 0;
+    while (!ctx.is_high_hit_ratio()) {
+        ctx.update_hit_ratio(4096, 4096);
+        chunks++;
+        ASSERT_LT(chunks, 32);
+    }
+    ASSERT_EQ(11, chunks);
+    ASSERT_FALSE(ctx.is_low_hit_ratio());
+
+    // and turning back into unique keys decays it again
+    chunks = 0;
+    while (!ctx.is_low_hit_ratio()) {
+        ctx.update_hit_ratio(0, 4096);
+        chunks++;
+        ASSERT_LT(chunks, 32);
+    }
+    ASSERT_EQ(7, chunks);
+}
+
+TEST(AggrAutoContextTest, LeavePassThrough) {
+    AggrAutoContext ctx;
+    // a single aggregated sample does not outweigh a window of unique keys
+    ctx.update_hit_ratio(4096, 4096);
+    ASSERT_FALSE(ctx.should_leave_pass_through(4096, 4096));
+    // a second one does
+    ctx.update_hit_ratio(4096, 4096);
+    ASSERT_TRUE(ctx.should_leave_pass_through(4096, 4096));
+    // a unique sample keeps the state regardless of the window
+    ASSERT_FALSE(ctx.should_leave_pass_through(0, 4096));
+}
+
+TEST(AggrAutoContextTest, LeaveSelectivePreagg) {
+    AggrAutoContext ctx;
+    // in the middle, stay
+    for (int i = 0; i < 32; i++) {
+        ctx.update_hit_ratio(2048, 4096);
+    }
+    ASSERT_FALSE(ctx.should_leave_selective_preagg(2048, 4096));
+    // the window still in the middle, a single extreme chunk is not enough
+    ASSERT_FALSE(ctx.should_leave_selective_preagg(4096, 4096));
+    ASSERT_FALSE(ctx.should_leave_selective_preagg(0, 4096));
+
+    for (int i = 0; i < 32; i++) {
+        ctx.update_hit_ratio(4096, 4096);
+    }
+    ASSERT_TRUE(ctx.should_leave_selective_preagg(4096, 4096));
+    ASSERT_FALSE(ctx.should_leave_selective_preagg(2048, 4096));
+
+    for (int i = 0; i < 32; i++) {
+        ctx.update_hit_ratio(0, 4096);
+    }
+    ASSERT_TRUE(ctx.should_leave_selective_preagg(0, 4096));
+}
+
+TEST(AggrAutoContextTest, ResetContinuousLimit) {
+    AggrAutoContext ctx;
+    for (int i = 0; i < 20; i++) {
+        ctx.update_continuous_limit();
+    }
+    ASSERT_EQ(AggrAutoContext::ContinuousUpperLimit, ctx.get_continuous_limit());
+    ctx.reset_continuous_limit();
+    ASSERT_EQ(AggrAutoContext::InitContinuousLimit, ctx.get_continuous_limit());
+}
+
+} // namespace starrocks
@@ -22,6 +22,29 @@ namespace starrocks {
 class AnalytorTest : public ::testing::Test {
 public:
     void SetUp() override { config::vector_chunk_size = 1024; }
+
+protected:
+    static TAnalyticWindowBoundary create_boundary(TAnalyticWindowBoundaryType::type type, int64_t rows_offset) {
+        TAnalyticWindowBoundary boundary;
+        boundary.__set_type(type);
+        if (type != TAnalyticWindowBoundaryType::CURRENT_ROW) {
+            boundary.__set_rows_offset_value(rows_offset);
+        }
+        return boundary;
+    }
+
+    // ROWS BETWEEN <start> AND <end>, an unset start is UNBOUNDED PRECEDING
+    static TPlanNode create_rows_window_node(const TAnalyticWindowBoundary* start, const TAnalyticWindowBoundary& end) {
+        TAnalyticWindow window;
+        window.__set_type(TAnalyticWindowType::ROWS);
+        if (start != nullptr) {
+            window.__set_window_start(*start);
+        }
+        window.__set_window_end(end);
+        TPlanNode plan_node;
+        plan_node.analytic_node.__set_window(window);
+        return plan_node;
+    }
 };
 
 // NOLINTNEXTLINE
@@ -126,4 +149,40 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, removable_chunk_num) {
+    const int64_t max_chunk_num = config::pipeline_analytic_removable_chunk_num;
+    RowDescriptor row_desc;
+    auto current_row = create_boundary(TAnalyticWindowBoundaryType::CURRENT_ROW, 0);
+    auto rows_preceding = [&](int64_t rows) {
+        auto start = create_boundary(TAnalyticWindowBoundaryType::PRECEDING, rows);
+        return create_rows_window_node(&start, current_row);
+    };
+
+    // the released chunks follow the rows the frame looks back
+    auto small_frame = rows_preceding(10);
+    ASSERT_EQ(1, Analytor(small_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+    auto medium_frame = rows_preceding(5000);
+    ASSERT_EQ(5, Analytor(medium_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+    auto large_frame = rows_preceding(1024 * max_chunk_num * 2);
+    ASSERT_EQ(max_chunk_num, Analytor(large_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+
+    // a frame starting at or after the current row keeps no history, still release one chunk at a time
+    auto following = create_boundary(TAnalyticWindowBoundaryType::FOLLOWING, 5);
+    auto following_frame = create_rows_window_node(&current_row, following);
+    ASSERT_EQ(1, Analytor(following_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+
+    // unbounded preceding, range and no window keep the configured number
+    auto unbounded_frame = create_rows_window_node(nullptr, current_row);
+    ASSERT_EQ(max_chunk_num, Analytor(unbounded_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+    TPlanNode range_frame;
+    TAnalyticWindow range_window;
+    range_window.__set_type(TAnalyticWindowType::RANGE);
+    range_window.__set_window_end(current_row);
+    range_frame.analytic_node.__set_window(range_window);
+    ASSERT_EQ(max_chunk_num, Analytor(range_frame, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+    TPlanNode no_window;
+    ASSERT_EQ(max_chunk_num, Analytor(no_window, row_desc, nullptr, false)._compute_removable_chunk_num(1024));
+}
+
 } // namespace starrocks
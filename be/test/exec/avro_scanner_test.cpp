@@ -1023,4 +1023,77 @@ TEST_F(AvroScannerTest, test_root_array) {
     EXPECT_EQ("DIAMONDS", chunk->get(0)[4].get_slice());
 }
 
+TEST_F(AvroScannerTest, test_columns_not_in_schema_order) {
+    std::string schema_path = "./be/test/exec/test_data/avro_scanner/avro_basic_schema.json";
+    AvroHelper avro_helper;
+    init_avro_value(schema_path, avro_helper);
+    DeferOp avro_helper_deleter([&] {
+        avro_schema_decref(avro_helper.schema);
+        avro_value_iface_decref(avro_helper.iface);
+        avro_value_decref(&avro_helper.avro_val);
+    });
+
+    // Several records, so the column index cached for each field is reused by the later rows.
+    std::string data_path = "./be/test/exec/test_data/avro_scanner/tmp/avro_basic_multi_data.json";
+    avro_file_writer_t db;
+    ASSERT_EQ(0, avro_file_writer_create(data_path.c_str(), avro_helper.schema, &db));
+    const int num_records = 3;
+    for (int i = 0; i < num_records; i++) {
+        avro_value_t value;
+        ASSERT_EQ(0, avro_value_get_by_name(&avro_helper.avro_val, "booleantype", &value, NULL));
+        avro_value_set_boolean(&value, i % 2);
+        ASSERT_EQ(0, avro_value_get_by_name(&avro_helper.avro_val, "longtype", &value, NULL));
+        avro_value_set_long(&value, 4294967296 + i);
+        ASSERT_EQ(0, avro_value_get_by_name(&avro_helper.avro_val, "doubletype", &value, NULL));
+        avro_value_set_double(&value, 1.5 + i);
+        ASSERT_EQ(0, avro_value_get_by_name(&avro_helper.avro_val, "stringtype", &value, NULL));
+        avro_value_set_string(&value, ("abc" + std::to_string(i)).c_str());
+        ASSERT_EQ(0, avro_value_get_by_name(&avro_helper.avro_val, "enumtype", &value, NULL));
+        avro_value_set_enum(&value, i);
+        ASSERT_EQ(0, avro_file_writer_append_value(db, &avro_helper.avro_val));
+    }
+    avro_file_writer_flush(db);
+    avro_file_writer_close(db);
+
+    // The slots are declared in the reverse order of the schema fields.
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TYPE_DOUBLE);
+    types.emplace_back(TYPE_BIGINT);
+    types.emplace_back(TYPE_BOOLEAN);
+    const std::vector<std::string> col_names = {"enumtype", "stringtype", "doubletype", "longtype", "booleantype"};
+    const std::vector<std::string> symbols = {"SPADES", "HEARTS", "DIAMONDS", "CLUBS"};
+
+    for (bool with_jsonpaths : {false, true}) {
+        std::vector<TBrokerRangeDesc> ranges;
+        TBrokerRangeDesc range;
+        range.format_type = TFileFormatType::FORMAT_AVRO;
+        if (with_jsonpaths) {
+            range.__isset.jsonpaths = true;
+            range.jsonpaths = R"(["$.enumtype", "$.stringtype", "$.doubletype", "$.longtype", "$.booleantype"])";
+        }
+        range.__set_path(data_path);
+        ranges.emplace_back(range);
+
+        auto scanner = create_avro_scanner(types, ranges, col_names, avro_helper.schema_text);
+        Status st = scanner->open();
+        ASSERT_TRUE(st.ok());
+
+        auto st2 = scanner->get_next();
+        ASSERT_TRUE(st2.ok());
+
+        ChunkPtr chunk = st2.value();
+        EXPECT_EQ(5, chunk->num_columns());
+        ASSERT_EQ(num_records, chunk->num_rows());
+        for (int i = 0; i < num_records; i++) {
+            EXPECT_EQ(symbols[i], chunk->get(i)[0].get_slice());
+            EXPECT_EQ("abc" + std::to_string(i), chunk->get(i)[1].get_slice());
+            EXPECT_FLOAT_EQ(1.5 + i, chunk->get(i)[2].get_double());
+            EXPECT_EQ(4294967296 + i, chunk->get(i)[3].get_int64());
+            EXPECT_EQ(i % 2, chunk->get(i)[4].get_int8());
+        }
+    }
+}
+
 } // namespace starrocks
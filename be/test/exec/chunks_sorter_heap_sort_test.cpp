@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <functional>
 #include <memory>
@@ -240,6 +241,75 @@ TEST_F(ChunksSorterHeapSortTest, single_column_order_by_notnull_test) {
     }
 }
 
+// The small offset and limit of a partition of partition topn, over several chunks.
+TEST_F(ChunksSorterHeapSortTest, small_limit_with_offset_test) {
+    std::vector<bool> is_asc = {true};
+    std::vector<bool> null_first = {true};
+    std::vector<TypeDescriptor*> type_descs = {_pool.add(new TypeDescriptor(TYPE_INT))};
+    std::vector<BuildOptions> build_options = {{{}, true, false}};
+
+    srand(0);
+    FakeChunks fake_chunks(&_pool, type_descs, build_options);
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(_pool.add(new ExprContext(fake_chunks.slot_refs()[0])));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    const size_t offset = 3;
+    const size_t limit = 5;
+    ChunksSorterHeapSort sorter(_runtime_state.get(), &sort_exprs, &is_asc, &null_first, "", offset, limit);
+    sorter.setup_runtime(_runtime_state.get(), _pool.add(new RuntimeProfile("")),
+                         _pool.add(new MemTracker(1L << 62, "parent", nullptr)));
+    std::vector<int32_t> values;
+    for (size_t num_rows : {2, 7, 100, 1, 50}) {
+        auto input = fake_chunks.next_chunk(num_rows);
+        const auto& data = ColumnHelper::cast_to_raw<TYPE_INT>(input->get_column_by_slot_id(0))->get_data();
+        values.insert(values.end(), data.begin(), data.end());
+        ASSERT_OK(sorter.update(nullptr, input));
+    }
+    ASSERT_OK(sorter.done(nullptr));
+    std::sort(values.begin(), values.end());
+
+    ChunkPtr chunk;
+    bool eos = false;
+    ASSERT_OK(sorter.get_next(&chunk, &eos));
+    ASSERT_FALSE(eos);
+    ASSERT_EQ(limit, chunk->num_rows());
+    const auto& data = ColumnHelper::cast_to_raw<TYPE_INT>(chunk->get_column_by_slot_id(0))->get_data();
+    for (size_t i = 0; i < limit; i++) {
+        ASSERT_EQ(values[offset + i], data[i]);
+    }
+    ASSERT_OK(sorter.get_next(&chunk, &eos));
+    ASSERT_TRUE(eos);
+}
+
+// A sorter which never gets any rows, e.g. a partition of partition topn with LIMIT 0.
+TEST_F(ChunksSorterHeapSortTest, no_rows_test) {
+    std::vector<bool> is_asc = {true};
+    std::vector<bool> null_first = {true};
+    std::vector<TypeDescriptor*> type_descs = {_pool.add(new TypeDescriptor(TYPE_INT))};
+    std::vector<BuildOptions> build_options = {{{}, true, false}};
+
+    FakeChunks fake_chunks(&_pool, type_descs, build_options);
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(_pool.add(new ExprContext(fake_chunks.slot_refs()[0])));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    ChunksSorterHeapSort sorter(_runtime_state.get(), &sort_exprs, &is_asc, &null_first, "", 0, 0);
+    sorter.setup_runtime(_runtime_state.get(), _pool.add(new RuntimeProfile("")),
+                         _pool.add(new MemTracker(1L << 62, "parent", nullptr)));
+    ASSERT_OK(sorter.update(nullptr, fake_chunks.next_chunk(10)));
+    ASSERT_OK(sorter.done(nullptr));
+    ASSERT_EQ(0, sorter.get_output_rows());
+
+    ChunkPtr chunk;
+    bool eos = false;
+    ASSERT_OK(sorter.get_next(&chunk, &eos));
+    ASSERT_TRUE(eos);
+    ASSERT_EQ(nullptr, chunk);
+}
+
 TEST_F(ChunksSorterHeapSortTest, single_column_order_by_nullable_test) {
     {
         std::vector<bool> is_asc = {true};
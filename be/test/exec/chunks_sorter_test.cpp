@@ -20,6 +20,8 @@
 
 #include <cstdio>
 #include <memory>
+#include <optional>
+#include <random>
 #include <string_view>
 
 #include "column/column_helper.h"
@@ -342,6 +344,103 @@ TEST_F(ChunksSorterTest, full_sort_incremental) {
     clear_sort_exprs(sort_exprs);
 }
 
+TEST_F(ChunksSorterTest, full_sort_yieldable) {
+    std::vector<bool> is_asc, is_null_first;
+    is_asc.push_back(false); // cust_key
+    is_asc.push_back(true);  // cust_key
+    is_null_first.push_back(true);
+    is_null_first.push_back(true);
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_region.get()));
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+    auto pool = std::make_unique<ObjectPool>();
+    std::vector<SlotId> slots{_expr_region->slot_id(), _expr_cust_key->slot_id()};
+    // Buffer at most 4 rows, so that each update schedules a partial sort.
+    ChunksSorterFullSort sorter(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 4, 16777216, slots);
+    sorter.set_yieldable(true);
+    sorter.setup_runtime(_runtime_state.get(), pool->add(new RuntimeProfile("", false)),
+                         pool->add(new MemTracker(1L << 62, "", nullptr)));
+    auto run_pending_work = [&]() {
+        size_t num_work_units = 0;
+        while (sorter.has_pending_work()) {
+            ASSERT_OK(sorter.do_pending_work(_runtime_state.get()));
+            ++num_work_units;
+        }
+        ASSERT_GT(num_work_units, 0);
+    };
+    for (const auto& chunk : {_chunk_1, _chunk_2, _chunk_3}) {
+        ASSERT_OK(sorter.update(_runtime_state.get(), chunk));
+        ASSERT_TRUE(sorter.has_pending_work());
+        run_pending_work();
+    }
+    ASSERT_OK(sorter.done(_runtime_state.get()));
+    ASSERT_TRUE(sorter.has_pending_work());
+    run_pending_work();
+
+    ChunkPtr page_1 = consume_page_from_sorter(sorter);
+
+    ASSERT_EQ(16, page_1->num_rows());
+    const size_t Size = 16;
+    std::vector<int32_t> permutation{69, 70, 71, 2, 4, 6, 12, 16, 24, 41, 49, 52, 54, 55, 56, 58};
+    std::vector<int> result;
+    for (size_t i = 0; i < Size; ++i) {
+        result.push_back(page_1->get(i).get(0).get_int32());
+    }
+    EXPECT_EQ(permutation, result);
+
+    clear_sort_exprs(sort_exprs);
+}
+
+TEST_F(ChunksSorterTest, full_sort_presorted_input) {
+    std::vector<bool> is_asc{false, true};
+    std::vector<bool> is_null_first{true, true};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_region.get()));
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+    auto pool = std::make_unique<ObjectPool>();
+    std::vector<SlotId> slots;
+
+    auto new_sorter = [&](RuntimeProfile** profile) {
+        auto sorter = std::make_unique<ChunksSorterFullSort>(_runtime_state.get(), &sort_exprs, &is_asc,
+                                                             &is_null_first, "", 4, 16777216, slots);
+        *profile = pool->add(new RuntimeProfile("", false));
+        sorter->setup_runtime(_runtime_state.get(), *profile, pool->add(new MemTracker(1L << 62, "", nullptr)));
+        return sorter;
+    };
+
+    RuntimeProfile* profile = nullptr;
+    auto sorter = new_sorter(&profile);
+    for (const auto& chunk : {_chunk_1, _chunk_2, _chunk_3}) {
+        ASSERT_OK(sorter->update(_runtime_state.get(), chunk));
+    }
+    ASSERT_OK(sorter->done(_runtime_state.get()));
+    ChunkPtr sorted = consume_page_from_sorter(*sorter);
+    ASSERT_EQ(16, sorted->num_rows());
+
+    // Feed the ordered rows again, 4 rows per run, every run skips sorting and the result keeps the same order.
+    RuntimeProfile* presorted_profile = nullptr;
+    auto presorted_sorter = new_sorter(&presorted_profile);
+    for (size_t offset = 0; offset < sorted->num_rows(); offset += 4) {
+        ChunkPtr chunk = sorted->clone_empty(4);
+        chunk->append(*sorted, offset, 4);
+        ASSERT_OK(presorted_sorter->update(_runtime_state.get(), chunk));
+    }
+    ASSERT_OK(presorted_sorter->done(_runtime_state.get()));
+    ChunkPtr result = consume_page_from_sorter(*presorted_sorter);
+
+    ASSERT_EQ(sorted->num_rows(), result->num_rows());
+    for (size_t i = 0; i < sorted->num_rows(); ++i) {
+        EXPECT_EQ(sorted->debug_row(i), result->debug_row(i));
+    }
+    EXPECT_EQ(4, presorted_profile->get_counter("NumPresortedRuns")->value());
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOTE: this test case runs too slow
 // TEST_F(ChunksSorterTest, full_sort_chunk_overflow) {
 //     std::vector<bool> is_asc{true};
@@ -1169,4 +1268,117 @@ TEST_F(ChunksSorterTest, test_nan) {
     ::pdqsort(begin, end, greater);
 }
 
+// Multiple fixed-length sort columns are packed into one normalized key, check it against a row-wise comparator
+TEST_F(ChunksSorterTest, sort_by_normalized_key) {
+    constexpr int N = 2000;
+    std::mt19937 rng(0);
+    ColumnPtr smallint_col = ColumnHelper::create_column(TypeDescriptor(TYPE_SMALLINT), false);
+    ColumnPtr int_col = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr bigint_col = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), true);
+    std::vector<std::optional<int64_t>> smallint_values, int_values, bigint_values;
+    for (int i = 0; i < N; i++) {
+        auto v1 = static_cast<int16_t>(static_cast<int>(rng() % 9) - 4);
+        smallint_col->append_datum(Datum(v1));
+        smallint_values.emplace_back(v1);
+        if (rng() % 5 == 0) {
+            int_col->append_nulls(1);
+            int_values.emplace_back(std::nullopt);
+        } else {
+            auto v2 = static_cast<int32_t>(static_cast<int>(rng() % 11) - 5);
+            int_col->append_datum(Datum(v2));
+            int_values.emplace_back(v2);
+        }
+        if (rng() % 7 == 0) {
+            bigint_col->append_nulls(1);
+            bigint_values.emplace_back(std::nullopt);
+        } else {
+            auto v3 = (static_cast<int64_t>(rng() % 7) - 3) << 40;
+            bigint_col->append_datum(Datum(v3));
+            bigint_values.emplace_back(v3);
+        }
+    }
+
+    // 16 + 33 bits fit into a 64-bit key, 33 + 65 + 16 bits need a 128-bit key
+    std::vector<std::pair<Columns, std::vector<std::vector<std::optional<int64_t>>*>>> cases = {
+            {{smallint_col, int_col}, {&smallint_values, &int_values}},
+            {{int_col, bigint_col, smallint_col}, {&int_values, &bigint_values, &smallint_values}}};
+    for (auto& [columns, values] : cases) {
+        for (int mask = 0; mask < (1 << (2 * columns.size())); mask++) {
+            SortDescs sort_desc;
+            for (int i = 0; i < columns.size(); i++) {
+                bool is_asc = (mask >> (2 * i)) & 1;
+                bool is_null_first = (mask >> (2 * i + 1)) & 1;
+                sort_desc.descs.emplace_back(is_asc, is_null_first);
+            }
+            auto compare_rows = [&](uint32_t lhs, uint32_t rhs) {
+                for (int i = 0; i < columns.size(); i++) {
+                    const auto& l = (*values[i])[lhs];
+                    const auto& r = (*values[i])[rhs];
+                    const auto& desc = sort_desc.get_column_desc(i);
+                    if (!l.has_value() || !r.has_value()) {
+                        if (l.has_value() == r.has_value()) {
+                            continue;
+                        }
+                        return (!l.has_value()) == desc.is_null_first() ? -1 : 1;
+                    }
+                    if (*l != *r) {
+                        return (*l < *r) == desc.asc_order() ? -1 : 1;
+                    }
+                }
+                return 0;
+            };
+
+            Permutation perm;
+            ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &perm));
+            ASSERT_EQ(N, perm.size());
+            for (int i = 1; i < N; i++) {
+                ASSERT_LE(compare_rows(perm[i - 1].index_in_chunk, perm[i].index_in_chunk), 0) << "mask=" << mask;
+            }
+        }
+    }
+}
+
+TEST_F(ChunksSorterTest, sort_binary_by_prefix) {
+    // Strings sharing 8-byte prefixes, shorter than a prefix, with embedded zero bytes and bytes above 0x7f.
+    std::vector<std::string> values{"https://b.com/x",
+                                    "https://a.com/y",
+                                    "https://a.com/x",
+                                    "",
+                                    "a",
+                                    std::string("a\0", 2),
+                                    std::string("a\0b", 3),
+                                    "ab",
+                                    "\xff\xfe",
+                                    "\x7f",
+                                    "\x80",
+                                    "abcdefgh",
+                                    "abcdefg",
+                                    "abcdefghi",
+                                    "https://a.com/x",
+                                    "https://"};
+    for (bool asc : {true, false}) {
+        ColumnPtr col = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), false);
+        ColumnPtr col2 = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+        for (int i = 0; i < values.size(); i++) {
+            col->append_datum(Datum(Slice(values[i])));
+            col2->append_datum(Datum(int32_t(i)));
+        }
+        Columns columns{col, col2};
+        SortDescs sort_desc(std::vector<int>{asc ? 1 : -1, 1}, std::vector<int>{1, 1});
+        Permutation perm;
+        ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &perm));
+        ASSERT_EQ(values.size(), perm.size());
+        for (int i = 1; i < perm.size(); i++) {
+            uint32_t lhs = perm[i - 1].index_in_chunk;
+            uint32_t rhs = perm[i].index_in_chunk;
+            int x = Slice(values[lhs]).compare(Slice(values[rhs]));
+            ASSERT_TRUE(asc ? x <= 0 : x >= 0) << i;
+            // ties on the string are broken by the second column
+            if (x == 0) {
+                ASSERT_LT(lhs, rhs);
+            }
+        }
+    }
+}
+
 } // namespace starrocks
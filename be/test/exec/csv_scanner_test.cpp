@@ -1042,6 +1042,43 @@ TEST_P(CSVScannerTest, test_large_record_size) {
     }
 }
 
+TEST_P(CSVScannerTest, test_wide_record) {
+    constexpr int kNumColumns = 40;
+    constexpr int kNumRecords = 4;
+
+    TypeDescriptor varchar_type;
+    varchar_type.type = TYPE_VARCHAR;
+    varchar_type.len = 16;
+    std::vector<TypeDescriptor> types(kNumColumns, varchar_type);
+
+    // Each field is (row * 7 + col) % 13 copies of 'a' + col % 26, so delimiters, including
+    // adjacent ones around empty fields, land at every offset of the vectorized split.
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.__set_path("./be/test/exec/test_data/csv_scanner/csv_file24");
+    range.__set_start_offset(0);
+    range.__set_num_of_columns_from_file(types.size());
+    ranges.push_back(range);
+
+    auto scanner = create_csv_scanner(types, ranges);
+    EXPECT_NE(scanner, nullptr);
+
+    Status st = scanner->open();
+    ASSERT_TRUE(st.ok()) << st.to_string();
+
+    scanner->use_v2(_use_v2);
+
+    ChunkPtr chunk = scanner->get_next().value();
+    ASSERT_EQ(kNumRecords, chunk->num_rows());
+    ASSERT_EQ(kNumColumns, chunk->num_columns());
+    for (int row = 0; row < kNumRecords; row++) {
+        for (int col = 0; col < kNumColumns; col++) {
+            std::string expected((row * 7 + col) % 13, 'a' + col % 26);
+            ASSERT_EQ(expected, chunk->get(row)[col].get_slice().to_string()) << row << " " << col;
+        }
+    }
+}
+
 TEST_P(CSVScannerTest, test_record_length_exceed_limit) {
     constexpr size_t record_length = TypeDescriptor::MAX_VARCHAR_LENGTH;
     constexpr size_t field_length = TypeDescriptor::MAX_VARCHAR_LENGTH;
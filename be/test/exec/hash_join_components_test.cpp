@@ -0,0 +1,244 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/hash_join_components.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exec/hash_joiner.h"
+#include "exec/join_hash_map.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "simd/simd.h"
+#include "testutil/assert.h"
+#include "util/failpoint/fail_point.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class AdaptivePartitionHashJoinBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _runtime_state->init_instance_mem_tracker();
+        _runtime_profile = std::make_shared<RuntimeProfile>("hash_join");
+
+        // tuple 0 with slot 0 is the probe side, tuple 1 with slot 1 is the build side.
+        TDescriptorTableBuilder builder;
+        for (int i = 0; i < 2; i++) {
+            TTupleDescriptorBuilder tuple_desc_builder;
+            TSlotDescriptorBuilder slot_desc_builder;
+            slot_desc_builder.type(TYPE_INT).column_name("c" + std::to_string(i)).column_pos(0).nullable(false);
+            tuple_desc_builder.add_slot(slot_desc_builder.build());
+            tuple_desc_builder.build(&builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_runtime_state.get(), &_pool, builder.desc_tbl(), &tbl,
+                                        config::vector_chunk_size));
+        _probe_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0});
+        _build_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1});
+
+        _join_node.join_op = TJoinOp::INNER_JOIN;
+        _join_node.distribution_mode = TJoinDistributionMode::BROADCAST;
+        _join_node.is_push_down = false;
+    }
+
+    void TearDown() override {
+        set_fail_point("partition_hash_join_force_double_partitions", false);
+        set_fail_point("partition_hash_join_double_partitions_failed", false);
+    }
+
+    ExprContext* create_slot_ref(SlotId slot_id) {
+        auto* ctx = _pool.add(new ExprContext(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), slot_id))));
+        CHECK(ctx->prepare(_runtime_state.get()).ok());
+        CHECK(ctx->open(_runtime_state.get()).ok());
+        return ctx;
+    }
+
+    std::unique_ptr<HashJoiner> create_hash_joiner() {
+        HashJoinerParam param(&_pool, _join_node, {false}, {create_slot_ref(1)}, {create_slot_ref(0)}, {}, {},
+                              *_build_desc, *_probe_desc, TPlanNodeType::EXCHANGE_NODE, TPlanNodeType::EXCHANGE_NODE,
+                              true, {}, {1}, {}, TJoinDistributionMode::BROADCAST, false, false, true);
+        return std::make_unique<HashJoiner>(param);
+    }
+
+    static ChunkPtr create_build_chunk(int32_t start, int32_t num_rows) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(start + i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 1);
+        return chunk;
+    }
+
+    static size_t num_ht_rows(HashJoiner* joiner) {
+        size_t num_rows = 0;
+        joiner->hash_join_builder()->visitHt([&](JoinHashTable* ht) { num_rows += ht->get_row_count(); });
+        return num_rows;
+    }
+
+    static void set_fail_point(const std::string& name, bool enable) {
+        PFailPointTriggerMode trigger_mode;
+        trigger_mode.set_mode(enable ? FailPointTriggerModeType::ENABLE : FailPointTriggerModeType::DISABLE);
+        auto* fp = failpoint::FailPointRegistry::GetInstance()->get(name);
+        ASSERT_TRUE(fp != nullptr);
+        fp->setMode(trigger_mode);
+    }
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _runtime_profile;
+    std::unique_ptr<RowDescriptor> _probe_desc;
+    std::unique_ptr<RowDescriptor> _build_desc;
+    THashJoinNode _join_node;
+};
+
+// The doubling moves all the rows to the new partitions.
+TEST_F(AdaptivePartitionHashJoinBuilderTest, test_double_partitions) {
+    auto joiner = create_hash_joiner();
+    ASSERT_OK(joiner->prepare_builder(_runtime_state.get(), _runtime_profile.get()));
+    auto* partition_nums = joiner->build_metrics().partition_nums;
+    ASSERT_EQ(16, partition_nums->value());
+
+    ASSERT_OK(joiner->append_chunk_to_ht(create_build_chunk(0, 1000)));
+    ASSERT_OK(joiner->append_chunk_to_ht(create_build_chunk(1000, 1000)));
+    ASSERT_EQ(2000, num_ht_rows(joiner.get()));
+
+    set_fail_point("partition_hash_join_force_double_partitions", true);
+    ASSERT_OK(joiner->append_chunk_to_ht(create_build_chunk(2000, 1000)));
+    ASSERT_EQ(32, partition_nums->value());
+    ASSERT_EQ(3000, num_ht_rows(joiner.get()));
+    set_fail_point("partition_hash_join_force_double_partitions", false);
+
+    ASSERT_OK(joiner->build_ht(_runtime_state.get()));
+    ASSERT_EQ(3000, num_ht_rows(joiner.get()));
+    joiner->close(_runtime_state.get());
+}
+
+// A failed doubling has released some of the old partitions, so the build fails, but the builder must still be
+// usable and closable.
+TEST_F(AdaptivePartitionHashJoinBuilderTest, test_double_partitions_failed) {
+    auto joiner = create_hash_joiner();
+    ASSERT_OK(joiner->prepare_builder(_runtime_state.get(), _runtime_profile.get()));
+    auto* partition_nums = joiner->build_metrics().partition_nums;
+
+    ASSERT_OK(joiner->append_chunk_to_ht(create_build_chunk(0, 1000)));
+    ASSERT_OK(joiner->append_chunk_to_ht(create_build_chunk(1000, 1000)));
+    ASSERT_EQ(2000, num_ht_rows(joiner.get()));
+
+    set_fail_point("partition_hash_join_force_double_partitions", true);
+    set_fail_point("partition_hash_join_double_partitions_failed", true);
+    ASSERT_FALSE(joiner->append_chunk_to_ht(create_build_chunk(2000, 1000)).ok());
+    ASSERT_EQ(16, partition_nums->value());
+    ASSERT_EQ(0, num_ht_rows(joiner.get()));
+    ASSERT_GE(joiner->hash_join_builder()->ht_mem_usage(), 0);
+
+    joiner->close(_runtime_state.get());
+}
+
+class HashJoinerOtherConjunctTest : public AdaptivePartitionHashJoinBuilderTest {
+protected:
+    ExprContext* create_binary_pred(TExprOpcode::type opcode, SlotId left, SlotId right) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::BINARY_PRED);
+        node.__set_opcode(opcode);
+        node.__set_child_type(TPrimitiveType::INT);
+        node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        node.__set_num_children(2);
+        auto* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), left)));
+        expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), right)));
+        auto* ctx = _pool.add(new ExprContext(expr));
+        CHECK(ctx->prepare(_runtime_state.get()).ok());
+        CHECK(ctx->open(_runtime_state.get()).ok());
+        return ctx;
+    }
+
+    // c0 = i, c1 = 80, c2 = 90 except for null every 4th row
+    static ChunkPtr create_candidate_chunk(int32_t num_rows) {
+        auto c0 = Int32Column::create();
+        auto c1 = Int32Column::create();
+        auto c2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (int32_t i = 0; i < num_rows; i++) {
+            c0->append(i);
+            c1->append(80);
+            if (i % 4 == 0) {
+                c2->append_nulls(1);
+            } else {
+                c2->append_datum(Datum(int32_t(90)));
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c0), 0);
+        chunk->append_column(std::move(c1), 1);
+        chunk->append_column(std::move(c2), 2);
+        return chunk;
+    }
+};
+
+// The conjuncts after the selective ones are evaluated over the selected rows only, with the same result.
+TEST_F(HashJoinerOtherConjunctTest, test_selective_other_conjuncts) {
+    auto joiner = create_hash_joiner();
+    // c0 > c1 keeps 19 of the 100 rows, then c0 < c2 is evaluated over those rows only
+    joiner->_other_join_conjunct_ctxs = {create_binary_pred(TExprOpcode::GT, 0, 1),
+                                         create_binary_pred(TExprOpcode::LT, 0, 2)};
+    ChunkPtr chunk = create_candidate_chunk(100);
+    Filter filter;
+    bool filter_all = false;
+    bool hit_all = false;
+    ASSERT_OK(joiner->_calc_filter_for_other_conjunct(&chunk, filter, filter_all, hit_all));
+    ASSERT_FALSE(filter_all);
+    ASSERT_FALSE(hit_all);
+    ASSERT_EQ(100, filter.size());
+    for (int32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(i > 80 && i < 90 && i % 4 != 0, filter[i]) << i;
+    }
+
+    // none of the selected rows survives
+    joiner->_other_join_conjunct_ctxs = {create_binary_pred(TExprOpcode::GT, 0, 1),
+                                         create_binary_pred(TExprOpcode::GT, 1, 0)};
+    ASSERT_OK(joiner->_calc_filter_for_other_conjunct(&chunk, filter, filter_all, hit_all));
+    ASSERT_TRUE(filter_all);
+}
+
+TEST_F(HashJoinerOtherConjunctTest, test_selective_filter_scatter) {
+    ChunkPtr chunk = create_candidate_chunk(100);
+    // only every 10th row is still selected, the others must stay filtered out
+    Filter filter(100, 0);
+    for (int32_t i = 0; i < 100; i += 10) {
+        filter[i] = 1;
+    }
+    bool filter_all = false;
+    ASSERT_OK(HashJoiner::_calc_selective_filter_for_other_conjunct(create_binary_pred(TExprOpcode::LT, 1, 0),
+                                                                    &chunk, filter, filter_all));
+    ASSERT_FALSE(filter_all);
+    for (int32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(i % 10 == 0 && i > 80, filter[i]) << i;
+    }
+    // the remaining row 90 fails c0 < c2
+    ASSERT_OK(HashJoiner::_calc_selective_filter_for_other_conjunct(create_binary_pred(TExprOpcode::LT, 0, 2),
+                                                                    &chunk, filter, filter_all));
+    ASSERT_TRUE(filter_all);
+    ASSERT_EQ(0, SIMD::count_nonzero(filter));
+}
+
+} // namespace starrocks
@@ -1372,6 +1372,62 @@ TEST_F(HdfsScannerTest, TestOrcLazyLoad) {
     scanner->close();
 }
 
+// Same file as TestOrcLazyLoad, the lazy column c1 is only decoded from the first to the last row that survives.
+TEST_F(HdfsScannerTest, TestOrcLazyLoadSurvivingRange) {
+    static const std::string input_orc_file = "./be/test/exec/test_data/orc_scanner/orc_test_struct_basic.orc";
+
+    SlotDesc c0{"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)};
+    SlotDesc c1{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_STRUCT)};
+    c1.type.children.push_back(TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR));
+    c1.type.field_names.emplace_back("Cc1");
+    SlotDesc slot_descs[] = {c0, c1, {""}};
+
+    struct Case {
+        std::vector<std::pair<TExprOpcode::type, int>> preds;
+        std::vector<std::string> rows;
+        int64_t skip_rows;
+    };
+    std::vector<Case> cases = {
+            // only the first row
+            {{{TExprOpcode::EQ, 1}}, {"[1, {Cc1:'Smith'}]"}, 3},
+            // only the last row
+            {{{TExprOpcode::EQ, 4}}, {"[4, {Cc1:'World'}]"}, 3},
+            // only the middle rows, every row in the range survives
+            {{{TExprOpcode::GE, 2}, {TExprOpcode::LE, 3}}, {"[2, {Cc1:'Cruise'}]", "[3, {Cc1:'hello'}]"}, 2},
+            // a row filtered out inside the range
+            {{{TExprOpcode::NE, 2}, {TExprOpcode::LE, 3}}, {"[1, {Cc1:'Smith'}]", "[3, {Cc1:'hello'}]"}, 1},
+    };
+
+    for (const auto& c : cases) {
+        auto scanner = std::make_shared<HdfsOrcScanner>();
+        auto* range = _create_scan_range(input_orc_file, 0, 0);
+        auto* tuple_desc = _create_tuple_desc(slot_descs);
+        auto* param = _create_param(input_orc_file, range, tuple_desc);
+        for (const auto& [opcode, value] : c.preds) {
+            std::vector<TExprNode> nodes;
+            TExprNode lit_node = create_int_literal_node(TPrimitiveType::INT, value);
+            push_binary_pred_texpr_node(nodes, opcode, tuple_desc->slots()[0], TPrimitiveType::INT, lit_node);
+            param->conjunct_ctxs_by_slot[0].push_back(create_expr_context(&_pool, nodes));
+        }
+        for (auto& it : param->conjunct_ctxs_by_slot) {
+            ASSERT_OK(Expr::prepare(it.second, _runtime_state));
+            ASSERT_OK(Expr::open(it.second, _runtime_state));
+        }
+
+        ASSERT_OK(scanner->init(_runtime_state, *param));
+        ASSERT_OK(scanner->open(_runtime_state));
+        ChunkPtr chunk = ChunkHelper::new_chunk(*tuple_desc, 0);
+        ASSERT_OK(scanner->get_next(_runtime_state, &chunk));
+        ASSERT_EQ(c.rows.size(), chunk->num_rows());
+        for (size_t i = 0; i < c.rows.size(); i++) {
+            EXPECT_EQ(c.rows[i], chunk->debug_row(i));
+        }
+        EXPECT_EQ(c.skip_rows, scanner->_app_stats.late_materialize_skip_rows);
+        EXPECT_TRUE(scanner->get_next(_runtime_state, &chunk).is_end_of_file());
+        scanner->close();
+    }
+}
+
 /**
  * ORC format: struct<col1:int,col2:map<string,string>>
  * Data:
@@ -1703,6 +1759,58 @@ TEST_F(HdfsScannerTest, TestParquetRuntimeFilter) {
     }
 }
 
+// A runtime filter arriving after the scanner has been opened, like the TopN filter, still skips the row groups
+// which haven't been read yet.
+TEST_F(HdfsScannerTest, TestParquetLateRuntimeFilter) {
+    SlotDesc parquet_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR, 22)},
+                                {""}};
+
+    const std::string parquet_file = "./be/test/exec/test_data/parquet_scanner/small_row_group_data.parquet";
+
+    auto* range = _create_scan_range(parquet_file, 0, 0);
+    auto* tuple_desc = _create_tuple_desc(parquet_descs);
+    auto* param = _create_param(parquet_file, range, tuple_desc);
+
+    auto scanner = std::make_shared<HdfsParquetScanner>();
+    RuntimeFilterProbeCollector rf_collector;
+    RuntimeFilterProbeDescriptor rf_probe_desc;
+    ColumnRef c1ref(tuple_desc->slots()[0]);
+    ExprContext probe_expr_ctx(&c1ref);
+    ASSERT_OK(probe_expr_ctx.prepare(_runtime_state));
+    ASSERT_OK(probe_expr_ctx.open(_runtime_state));
+    // the runtime filter hasn't arrived when the scanner is opened
+    ASSERT_OK(rf_probe_desc.init(0, &probe_expr_ctx));
+    rf_collector.add_descriptor(&rf_probe_desc);
+    param->runtime_filter_collector = &rf_collector;
+
+    Status status = scanner->init(_runtime_state, *param);
+    ASSERT_TRUE(status.ok()) << status.message();
+    status = scanner->open(_runtime_state);
+    ASSERT_TRUE(status.ok()) << status.message();
+
+    ChunkPtr first_chunk = ChunkHelper::new_chunk(*tuple_desc, 0);
+    ASSERT_OK(scanner->get_next(_runtime_state, &first_chunk));
+    ASSERT_GT(first_chunk->num_rows(), 0);
+
+    // c1 is never negative, so none of the row groups left can match the filter
+    JoinRuntimeFilter* f = RuntimeFilterHelper::create_join_runtime_filter(&_pool, LogicalType::TYPE_BIGINT);
+    f->init(10);
+    ColumnPtr column = ColumnHelper::create_column(tuple_desc->slots()[0]->type(), false);
+    ColumnHelper::cast_to_raw<LogicalType::TYPE_BIGINT>(column)->append(-10);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(column, LogicalType::TYPE_BIGINT, f, 0, false));
+    rf_probe_desc.set_runtime_filter(f);
+
+    // only the rest of the row group being read is returned
+    uint64_t records = first_chunk->num_rows();
+    READ_SCANNER_RETURN_ROWS(scanner, records);
+    ASSERT_LT(records, 100000);
+
+    scanner->close();
+    probe_expr_ctx.close(_runtime_state);
+}
+
 // =============================================================================
 
 /*
@@ -18,6 +18,7 @@
 
 #include "fs/fs.h"
 #include "runtime/descriptor_helper.h"
+#include "runtime/exec_env.h"
 #include "testutil/assert.h"
 
 namespace starrocks {
@@ -42,4 +43,29 @@ TEST_F(IcebergDeleteBuilderTest, TestParquetBuilder) {
     ASSERT_EQ(1, _need_skip_rowids.size());
 }
 
+TEST_F(IcebergDeleteBuilderTest, TestPositionDeleteCache) {
+    LazyLRUCache* cache = GlobalEnv::GetInstance()->position_delete_cache();
+    ASSERT_TRUE(cache->enabled());
+    TIcebergDeleteFile delete_file;
+    delete_file.__set_full_path(_parquet_delete_path);
+    delete_file.__set_file_content(TIcebergFileContent::POSITION_DELETES);
+    delete_file.__set_length(845);
+
+    std::string cache_key = strings::Substitute("$0:$1:$2", _parquet_delete_path, 845, _parquet_data_path);
+    cache->erase(CacheKey(cache_key));
+
+    // the first build populates the cache, the second one is served from it
+    for (int i = 0; i < 2; i++) {
+        std::set<int64_t> need_skip_rowids;
+        IcebergDeleteBuilder builder(FileSystem::Default(), _parquet_data_path, &need_skip_rowids);
+        ASSERT_OK(builder.build_parquet(TQueryGlobals().time_zone, delete_file, {}, nullptr, nullptr, nullptr,
+                                        nullptr));
+        ASSERT_EQ(1, need_skip_rowids.size());
+
+        Cache::Handle* handle = cache->lookup(CacheKey(cache_key));
+        ASSERT_NE(nullptr, handle);
+        cache->release(handle);
+    }
+}
+
 } // namespace starrocks
\ No newline at end of file
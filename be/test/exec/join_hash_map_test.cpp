@@ -1126,6 +1126,126 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, OpenAddressingJoinBuildProbeFunc) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_column(100, 0), 0, 100);
+    // half of the probe keys have no match.
+    auto probe_column = JoinHashMapTest::create_int32_column(200, 0);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = 100;
+    table_items.enable_open_addressing = true;
+    probe_state.probe_row_count = 200;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+
+    JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
+    JoinProbeFunc<TYPE_INT>::prepare(_runtime_state.get(), &probe_state);
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_TRUE(table_items.open_addressing);
+    JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+
+    auto data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    for (size_t i = 0; i < 200; i++) {
+        size_t found_count = 0;
+        size_t probe_index = probe_state.next[i];
+        while (probe_index != 0) {
+            ASSERT_EQ(static_cast<int32_t>(i), data[probe_index]);
+            found_count++;
+            probe_index = table_items.next[probe_index];
+        }
+        ASSERT_EQ(found_count, i < 100 ? 1 : 0);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, OpenAddressingFallbackOnDuplicatedKeys) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    // every key appears twice.
+    build_column->append(*JoinHashMapTest::create_int32_column(50, 0), 0, 50);
+    build_column->append(*JoinHashMapTest::create_int32_column(50, 0), 0, 50);
+    auto probe_column = JoinHashMapTest::create_int32_column(50, 0);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = 100;
+    table_items.enable_open_addressing = true;
+    probe_state.probe_row_count = 50;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+
+    JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
+    JoinProbeFunc<TYPE_INT>::prepare(_runtime_state.get(), &probe_state);
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    ASSERT_FALSE(table_items.open_addressing);
+    JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+
+    auto data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    for (size_t i = 0; i < 50; i++) {
+        size_t found_count = 0;
+        size_t probe_index = probe_state.next[i];
+        while (probe_index != 0) {
+            if (i == data[probe_index]) {
+                found_count++;
+            }
+            probe_index = table_items.next[probe_index];
+        }
+        ASSERT_EQ(found_count, 2);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, BloomFilterJoinBuildProbeFunc) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_column(100, 0), 0, 100);
+    // only a quarter of the probe keys have a match.
+    auto probe_column = JoinHashMapTest::create_int32_column(400, 0);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = 100;
+    probe_state.probe_row_count = 400;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+
+    JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
+    JoinProbeFunc<TYPE_INT>::prepare(_runtime_state.get(), &probe_state);
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    auto data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    JoinHashMapHelper::build_bloom_filter<int32_t>(&table_items, data, nullptr);
+    JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+    ASSERT_TRUE(probe_state.use_bloom_filter);
+
+    for (size_t i = 0; i < 400; i++) {
+        size_t found_count = 0;
+        size_t probe_index = probe_state.next[i];
+        while (probe_index != 0) {
+            if (i == data[probe_index]) {
+                found_count++;
+            }
+            probe_index = table_items.next[probe_index];
+        }
+        ASSERT_EQ(found_count, i < 100 ? 1 : 0);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -2082,6 +2202,40 @@ TEST_F(JoinHashMapTest, SerializeJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, MemUsageBreakdown) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    auto build_chunk = create_binary_build_chunk(10, false);
+    Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+    hash_table.append_chunk(build_chunk, build_key_columns);
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+
+    auto usage = hash_table.mem_usage_breakdown();
+    ASSERT_GT(usage.build_chunk, 0);
+    ASSERT_GT(usage.buckets, 0);
+    // the serialized keys are held by the build pool
+    ASSERT_GT(usage.keys, 0);
+    ASSERT_EQ(usage.build_chunk + usage.buckets + usage.keys, usage.total());
+    ASSERT_EQ(hash_table.mem_usage(), usage.total());
+
+    hash_table.close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForNotNullableColumn) {
     JoinHashTableItems table_items;
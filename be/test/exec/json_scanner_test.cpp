@@ -232,6 +232,36 @@ TEST_F(JsonScannerTest, test_json_without_path) {
     EXPECT_EQ("['fiction', 'EvelynWaugh', 'SwordofHonour', 12.99]", chunk->debug_row(1));
 }
 
+TEST_F(JsonScannerTest, test_json_escaped_key) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.file_type = TFileType::FILE_LOCAL;
+    range.strip_outer_array = true;
+    range.__isset.strip_outer_array = true;
+    range.__isset.jsonpaths = false;
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_escaped_key.json");
+    ranges.emplace_back(range);
+
+    // keys matching the previous object both as raw text and only after being unescaped
+    auto scanner = create_json_scanner(types, ranges, {"a", "a\\b"});
+
+    ASSERT_OK(scanner->open());
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(2, chunk->num_columns());
+    EXPECT_EQ(4, chunk->num_rows());
+
+    EXPECT_EQ("[1, 10]", chunk->debug_row(0));
+    EXPECT_EQ("[2, 20]", chunk->debug_row(1));
+    EXPECT_EQ("[3, 30]", chunk->debug_row(2));
+    EXPECT_EQ("[4, 40]", chunk->debug_row(3));
+}
+
 TEST_F(JsonScannerTest, test_json_path_with_asterisk_basic) {
     std::vector<TypeDescriptor> types;
     types.emplace_back(TYPE_INT);
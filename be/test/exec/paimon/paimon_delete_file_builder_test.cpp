@@ -14,10 +14,13 @@
 
 #include "exec/paimon/paimon_delete_file_builder.h"
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "fs/fs.h"
 #include "gen_cpp/PlanNodes_types.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
 
 namespace starrocks {
@@ -48,4 +51,34 @@ TEST_F(PaimonDeleteFileBuilderTest, TestParquetBuilder) {
     ASSERT_EQ(1, _need_skip_rowids.size());
 }
 
+TEST_F(PaimonDeleteFileBuilderTest, TestDeletionVectorCache) {
+    LazyLRUCache* cache = GlobalEnv::GetInstance()->position_delete_cache();
+    ASSERT_TRUE(cache->enabled());
+    std::string cache_key = fmt::format("paimon:{}:{}:{}", _path, _offset, _length);
+    cache->erase(CacheKey(cache_key));
+    MemTracker* tracker = cache->mem_tracker();
+    ASSERT_NE(nullptr, tracker);
+    int64_t consumption = tracker->consumption();
+
+    TPaimonDeletionFile deletion_file;
+    deletion_file.__set_path(_path);
+    deletion_file.__set_offset(_offset);
+    deletion_file.__set_length(_length);
+    // the first build populates the cache, the second one is served from it
+    for (int i = 0; i < 2; i++) {
+        std::set<int64_t> need_skip_rowids;
+        PaimonDeleteFileBuilder builder(FileSystem::Default(), &need_skip_rowids);
+        ASSERT_OK(builder.build(&deletion_file));
+        ASSERT_EQ(1, need_skip_rowids.size());
+
+        Cache::Handle* handle = cache->lookup(CacheKey(cache_key));
+        ASSERT_NE(nullptr, handle);
+        cache->release(handle);
+    }
+    // the entry is charged to the cache until it is evicted
+    ASSERT_GT(tracker->consumption(), consumption);
+    cache->erase(CacheKey(cache_key));
+    ASSERT_EQ(consumption, tracker->consumption());
+}
+
 } // namespace starrocks
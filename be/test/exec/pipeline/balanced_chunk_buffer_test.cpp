@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/pipeline/scan/balanced_chunk_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "column/fixed_length_column.h"
+
+namespace starrocks::pipeline {
+
+static ChunkPtr make_chunk(int32_t value) {
+    auto column = Int32Column::create();
+    column->append(value);
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(column, 0);
+    return chunk;
+}
+
+TEST(BalancedChunkBufferTest, test_direct) {
+    auto limiter = std::make_shared<UnlimitedChunkBufferLimiter>();
+    BalancedChunkBuffer buffer(BalanceStrategy::kDirect, 2, limiter);
+    ASSERT_TRUE(buffer.all_empty());
+
+    for (int32_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(buffer.put(0, make_chunk(i), limiter->pin(1)));
+    }
+    ASSERT_EQ(10, buffer.size(0));
+    ASSERT_TRUE(buffer.empty(1));
+    ASSERT_EQ(10, limiter->size());
+
+    ChunkPtr chunk;
+    ASSERT_FALSE(buffer.try_get(1, &chunk));
+    for (int32_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(buffer.try_get(0, &chunk));
+        ASSERT_EQ(i, chunk->get_column_by_index(0)->get(0).get_int32());
+    }
+    ASSERT_FALSE(buffer.try_get(0, &chunk));
+    ASSERT_TRUE(buffer.all_empty());
+    ASSERT_EQ(0, limiter->size());
+    ASSERT_EQ(0, buffer.memory_usage());
+
+    // a finished buffer releases its chunks and rejects new ones
+    ASSERT_TRUE(buffer.put(1, make_chunk(0), limiter->pin(1)));
+    buffer.set_finished(1);
+    ASSERT_TRUE(buffer.empty(1));
+    ASSERT_EQ(0, limiter->size());
+    ASSERT_FALSE(buffer.put(1, make_chunk(0), limiter->pin(1)));
+}
+
+TEST(BalancedChunkBufferTest, test_concurrent_put) {
+    constexpr int kProducers = 4;
+    constexpr int32_t kChunksPerProducer = 1000;
+    BalancedChunkBuffer buffer(BalanceStrategy::kRoundRobin, 3, std::make_shared<UnlimitedChunkBufferLimiter>());
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++) {
+        producers.emplace_back([&buffer]() {
+            for (int32_t i = 0; i < kChunksPerProducer; i++) {
+                ASSERT_TRUE(buffer.put(0, make_chunk(i), nullptr));
+            }
+        });
+    }
+
+    int64_t num_chunks = 0;
+    ChunkPtr chunk;
+    while (num_chunks < kProducers * kChunksPerProducer) {
+        for (int i = 0; i < 3; i++) {
+            num_chunks += buffer.try_get(i, &chunk);
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(buffer.all_empty());
+    ASSERT_EQ(0, buffer.memory_usage());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive/collect_stats_context.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/adaptive/adaptive_dop_param.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+static ChunkPtr make_chunk(size_t num_rows) {
+    auto column = Int32Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        column->append(static_cast<int32_t>(i));
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(std::move(column), 0);
+    return chunk;
+}
+
+static CollectStatsContextPtr make_context(size_t max_scale_up_factor, size_t max_scaled_up_dop) {
+    AdaptiveDopParam param;
+    param.max_block_rows_per_driver_seq = 1;
+    param.max_scale_up_factor = max_scale_up_factor;
+    auto ctx = std::make_shared<CollectStatsContext>(nullptr, 2, param);
+    ctx->incr_sinker();
+    ctx->incr_sinker();
+    ctx->set_max_scaled_up_dop(max_scaled_up_dop);
+    return ctx;
+}
+
+TEST(CollectStatsContextTest, test_scale_up_without_limit) {
+    auto ctx = make_context(4, std::numeric_limits<size_t>::max());
+    ASSERT_OK(ctx->push_chunk(0, make_chunk(2)));
+    ASSERT_EQ("Passthrough", ctx->readable_state());
+    ASSERT_TRUE(ctx->is_scaled_up());
+    ASSERT_EQ(8, ctx->downstream_dop());
+}
+
+TEST(CollectStatsContextTest, test_scale_up_bounded_by_sinks) {
+    // The downstream sinks are only prepared for 6 drivers, so the factor 4 is lowered to 2.
+    auto ctx = make_context(4, 6);
+    ASSERT_OK(ctx->push_chunk(0, make_chunk(2)));
+    ASSERT_TRUE(ctx->is_scaled_up());
+    ASSERT_EQ(4, ctx->downstream_dop());
+}
+
+TEST(CollectStatsContextTest, test_scale_up_disabled_by_sinks) {
+    // The sinks can not take more drivers than the upstream DOP.
+    auto ctx = make_context(4, 2);
+    ASSERT_OK(ctx->push_chunk(0, make_chunk(2)));
+    ASSERT_FALSE(ctx->is_scaled_up());
+    ASSERT_EQ(2, ctx->downstream_dop());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/pipeline/continuous_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks::pipeline {
+
+class ContinuousProfilerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _window_minutes = config::continuous_profiler_window_minutes;
+        _max_keys = config::continuous_profiler_max_keys_per_minute;
+        config::continuous_profiler_window_minutes = 3;
+    }
+    void TearDown() override {
+        config::continuous_profiler_window_minutes = _window_minutes;
+        config::continuous_profiler_max_keys_per_minute = _max_keys;
+    }
+
+protected:
+    static constexpr int64_t kMinute = 1'000'020;
+
+    ContinuousProfiler _profiler;
+    int32_t _window_minutes = 0;
+    int32_t _max_keys = 0;
+};
+
+TEST_F(ContinuousProfilerTest, test_aggregate) {
+    int64_t now = kMinute * 60 + 5;
+    _profiler.add({{"wg1", "q1", "f1", "hash_join_probe_3", 100}, {"wg1", "q1", "f1", "olap_scan_0", 200}}, now);
+    _profiler.add({{"wg1", "q1", "f1", "hash_join_probe_3", 50}, {"wg2", "q2", "f2", "olap_scan_0", 0}}, now + 10);
+    // the same operator of another fragment instance, added by another driver
+    _profiler.add({{"wg1", "q1", "f3", "hash_join_probe_3", 10}}, now + 10);
+
+    auto buckets = _profiler.snapshot(1, now + 20);
+    ASSERT_EQ(1, buckets.size());
+    ASSERT_EQ(kMinute * 60, buckets[0].start_time);
+    // samples without time are skipped
+    ASSERT_EQ(3, buckets[0].samples.size());
+
+    ASSERT_EQ(
+            "wg1;q1;f1;hash_join_probe_3 150\nwg1;q1;f1;olap_scan_0 200\nwg1;q1;f3;hash_join_probe_3 10\n",
+            _profiler.folded_stacks(1, now + 20));
+}
+
+TEST_F(ContinuousProfilerTest, test_folded_samples) {
+    int64_t now = kMinute * 60;
+    auto key = ContinuousProfiler::make_key({"wg", "q", "f", "project_1", 0});
+    ASSERT_EQ("wg;q;f;project_1", key);
+    // drivers add the increase of the time of their operators on each report
+    _profiler.add(std::vector<ContinuousProfiler::FoldedSample>{{&key, 10}}, now);
+    _profiler.add(std::vector<ContinuousProfiler::FoldedSample>{{&key, 5}}, now + 60);
+
+    auto buckets = _profiler.snapshot(2, now + 60);
+    ASSERT_EQ(2, buckets.size());
+    ASSERT_EQ(1, buckets[0].samples.size());
+    ASSERT_EQ("f", buckets[0].samples[0].fragment_id);
+    ASSERT_EQ(10, buckets[0].samples[0].time_ns);
+    ASSERT_EQ(5, buckets[1].samples[0].time_ns);
+    ASSERT_EQ("wg;q;f;project_1 15\n", _profiler.folded_stacks(2, now + 60));
+}
+
+TEST_F(ContinuousProfilerTest, test_window) {
+    int64_t now = kMinute * 60;
+    for (int i = 0; i < 5; i++) {
+        _profiler.add({{"wg", "q" + std::to_string(i), "f", "project_1", 10}}, now + i * 60);
+    }
+    int64_t last = now + 4 * 60;
+    // only the buckets in the window of 3 minutes are kept
+    auto buckets = _profiler.snapshot(10, last);
+    ASSERT_EQ(3, buckets.size());
+    ASSERT_EQ(now + 2 * 60, buckets[0].start_time);
+    ASSERT_EQ(last, buckets[2].start_time);
+    ASSERT_EQ("wg;q3;f;project_1 10\nwg;q4;f;project_1 10\n", _profiler.folded_stacks(2, last));
+
+    config::continuous_profiler_window_minutes = 0;
+    _profiler.add({{"wg", "q5", "f", "project_1", 10}}, last);
+    ASSERT_EQ("wg;q4;f;project_1 10\n", _profiler.folded_stacks(1, last));
+}
+
+TEST_F(ContinuousProfilerTest, test_max_keys) {
+    // the cap is split over 16 shards, one driver adds into a single shard
+    config::continuous_profiler_max_keys_per_minute = 2 * 16;
+    int64_t now = kMinute * 60;
+    _profiler.add({{"wg", "q1", "f", "project_1", 1},
+                   {"wg", "q2", "f", "project_1", 2},
+                   {"wg", "q3", "f", "project_1", 3},
+                   {"wg", "q4", "f", "project_1", 4}},
+                  now);
+    ASSERT_EQ("wg;others;others;project_1 7\nwg;q1;f;project_1 1\nwg;q2;f;project_1 2\n",
+              _profiler.folded_stacks(1, now));
+}
+
+TEST_F(ContinuousProfilerTest, test_escape) {
+    _profiler.add({{"my wg", "q;1", "f 1", "project_1", 1}}, kMinute * 60);
+    ASSERT_EQ("my_wg;q_1;f_1;project_1 1\n", _profiler.folded_stacks(1, kMinute * 60));
+}
+
+} // namespace starrocks::pipeline
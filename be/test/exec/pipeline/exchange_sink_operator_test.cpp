@@ -0,0 +1,53 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/exchange_sink_operator.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+PARALLEL_TEST(CompressionBackoffTest, test_skip_after_reject) {
+    CompressionBackoff backoff;
+    // every chunk tries to compress until one is rejected
+    ASSERT_FALSE(backoff.should_skip());
+    ASSERT_FALSE(backoff.should_skip());
+
+    backoff.on_reject(3);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(backoff.should_skip());
+    }
+    // probe the codec again
+    ASSERT_FALSE(backoff.should_skip());
+
+    // another reject restarts the backoff, rather than adding to it
+    backoff.on_reject(2);
+    ASSERT_TRUE(backoff.should_skip());
+    backoff.on_reject(2);
+    ASSERT_TRUE(backoff.should_skip());
+    ASSERT_TRUE(backoff.should_skip());
+    ASSERT_FALSE(backoff.should_skip());
+}
+
+PARALLEL_TEST(CompressionBackoffTest, test_no_backoff) {
+    CompressionBackoff backoff;
+    backoff.on_reject(0);
+    ASSERT_FALSE(backoff.should_skip());
+    backoff.on_reject(-1);
+    ASSERT_FALSE(backoff.should_skip());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,222 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "exec/pipeline/sort/partition_topn_heaps.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/object_pool.h"
+#include "exprs/column_ref.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+using Key = std::optional<int32_t>;
+
+class PartitionTopnHeapsTest : public testing::Test {
+public:
+    void SetUp() override {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+
+        _sort_exprs.push_back(_pool.add(new ExprContext(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 0)))));
+        ASSERT_OK(Expr::prepare(_sort_exprs, _runtime_state.get()));
+        ASSERT_OK(Expr::open(_sort_exprs, _runtime_state.get()));
+    }
+
+    void TearDown() override { Expr::close(_sort_exprs, _runtime_state.get()); }
+
+protected:
+    // the sort key is in the slot 0, and the slot 1 keeps the key too, to check that the whole rows are output
+    static ChunkPtr _build_chunk(const std::vector<Key>& keys) {
+        auto key_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        auto payload_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (const auto& key : keys) {
+            if (key.has_value()) {
+                key_column->append_datum(Datum(key.value()));
+                payload_column->append_datum(Datum(key.value()));
+            } else {
+                key_column->append_nulls(1);
+                payload_column->append_nulls(1);
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(key_column), 0);
+        chunk->append_column(std::move(payload_column), 1);
+        return chunk;
+    }
+
+    static std::vector<Key> _column_keys(const ColumnPtr& column, size_t from, size_t to) {
+        std::vector<Key> keys;
+        for (size_t i = from; i < to; i++) {
+            if (column->is_null(i)) {
+                keys.emplace_back(std::nullopt);
+            } else {
+                keys.emplace_back(column->get(i).get_int32());
+            }
+        }
+        return keys;
+    }
+
+    // Push `input[p]` into the partition p in chunks of `batch_size` rows, and check the output of every partition
+    // against a full sort.
+    void _test_topn(const std::vector<std::vector<Key>>& input, bool is_asc, bool is_null_first, int64_t offset,
+                    int64_t limit, size_t batch_size) {
+        PartitionTopnHeaps heaps(&_sort_exprs, {is_asc}, {is_null_first}, offset, limit);
+        for (size_t p = 0; p < input.size(); p++) {
+            heaps.add_partition();
+        }
+        ASSERT_EQ(input.size(), heaps.num_partitions());
+
+        // interleave the partitions, as the partitioner does
+        for (size_t from = 0;; from += batch_size) {
+            bool has_more = false;
+            for (size_t p = 0; p < input.size(); p++) {
+                if (from >= input[p].size()) {
+                    continue;
+                }
+                has_more = true;
+                const size_t to = std::min(from + batch_size, input[p].size());
+                std::vector<Key> keys(input[p].begin() + from, input[p].begin() + to);
+                ASSERT_OK(heaps.update(p, _build_chunk(keys)));
+            }
+            if (!has_more) {
+                break;
+            }
+        }
+        heaps.done();
+        ASSERT_EQ(0, heaps.num_buffered_rows());
+
+        std::vector<Key> output_keys;
+        std::vector<Key> output_payloads;
+        while (auto chunk = heaps.get_next(7)) {
+            ASSERT_LE(chunk->num_rows(), 7);
+            auto keys = _column_keys(chunk->get_column_by_slot_id(0), 0, chunk->num_rows());
+            auto payloads = _column_keys(chunk->get_column_by_slot_id(1), 0, chunk->num_rows());
+            output_keys.insert(output_keys.end(), keys.begin(), keys.end());
+            output_payloads.insert(output_payloads.end(), payloads.begin(), payloads.end());
+        }
+        ASSERT_EQ(output_keys, output_payloads);
+        ASSERT_EQ(nullptr, heaps.get_next(7));
+
+        auto less = [&](const Key& lhs, const Key& rhs) {
+            if (!lhs.has_value() || !rhs.has_value()) {
+                return lhs.has_value() != rhs.has_value() && lhs.has_value() != is_null_first;
+            }
+            return is_asc ? lhs.value() < rhs.value() : lhs.value() > rhs.value();
+        };
+        std::vector<Key> expected;
+        for (auto keys : input) {
+            std::stable_sort(keys.begin(), keys.end(), less);
+            for (size_t i = offset; i < std::min<size_t>(offset + limit, keys.size()); i++) {
+                expected.emplace_back(keys[i]);
+            }
+        }
+        ASSERT_EQ(expected, output_keys);
+    }
+
+    static std::vector<std::vector<Key>> _random_input(size_t num_partitions, size_t max_rows, bool has_null) {
+        std::mt19937 rand(num_partitions * 31 + max_rows);
+        std::vector<std::vector<Key>> input(num_partitions);
+        for (auto& keys : input) {
+            const size_t num_rows = rand() % (max_rows + 1);
+            for (size_t i = 0; i < num_rows; i++) {
+                if (has_null && rand() % 5 == 0) {
+                    keys.emplace_back(std::nullopt);
+                } else {
+                    keys.emplace_back(static_cast<int32_t>(rand() % 1000));
+                }
+            }
+        }
+        return input;
+    }
+
+    std::shared_ptr<RuntimeState> _runtime_state;
+    ObjectPool _pool;
+    std::vector<ExprContext*> _sort_exprs;
+};
+
+TEST_F(PartitionTopnHeapsTest, test_offset_limit) {
+    auto input = _random_input(10, 100, false);
+    for (auto [offset, limit] : std::vector<std::pair<int64_t, int64_t>>{{0, 1}, {0, 5}, {3, 4}, {0, 16}, {6, 10}}) {
+        _test_topn(input, true, true, offset, limit, 9);
+        _test_topn(input, false, true, offset, limit, 9);
+    }
+}
+
+TEST_F(PartitionTopnHeapsTest, test_nulls) {
+    auto input = _random_input(10, 60, true);
+    input.push_back({std::nullopt, std::nullopt, std::nullopt, 5, std::nullopt});
+    for (bool is_asc : {true, false}) {
+        for (bool is_null_first : {true, false}) {
+            _test_topn(input, is_asc, is_null_first, 2, 3, 4);
+        }
+    }
+}
+
+TEST_F(PartitionTopnHeapsTest, test_limit_zero) {
+    auto input = _random_input(3, 20, true);
+    _test_topn(input, true, true, 0, 0, 5);
+}
+
+// A descending input makes every row evict the top of its heap, so the evicted rows need to be compacted.
+TEST_F(PartitionTopnHeapsTest, test_compact_evicted_rows) {
+    constexpr size_t num_partitions = 4;
+    constexpr int64_t limit = 3;
+    PartitionTopnHeaps heaps(&_sort_exprs, {true}, {true}, 0, limit);
+    for (size_t p = 0; p < num_partitions; p++) {
+        heaps.add_partition();
+    }
+    const size_t max_buffered_rows = 2 * PartitionTopnHeaps::MIN_EVICTED_ROWS_TO_COMPACT + 1024;
+    int32_t min_value = 0;
+    for (int32_t value = 100000; value > 0; value -= 1024) {
+        for (size_t p = 0; p < num_partitions; p++) {
+            std::vector<Key> keys;
+            for (int32_t i = 0; i < 1024; i++) {
+                keys.emplace_back(value - i);
+            }
+            min_value = value - 1023;
+            ASSERT_OK(heaps.update(p, _build_chunk(keys)));
+            ASSERT_LE(heaps.num_buffered_rows(), max_buffered_rows);
+        }
+    }
+    heaps.done();
+
+    std::vector<Key> output_keys;
+    while (auto chunk = heaps.get_next(4096)) {
+        auto keys = _column_keys(chunk->get_column_by_slot_id(0), 0, chunk->num_rows());
+        output_keys.insert(output_keys.end(), keys.begin(), keys.end());
+    }
+    std::vector<Key> expected;
+    for (size_t p = 0; p < num_partitions; p++) {
+        for (int32_t i = 0; i < limit; i++) {
+            expected.emplace_back(min_value + i);
+        }
+    }
+    ASSERT_EQ(expected, output_keys);
+}
+
+} // namespace starrocks::pipeline
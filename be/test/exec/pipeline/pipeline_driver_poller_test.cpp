@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_driver_poller.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+static constexpr int64_t kIntervalUs = 1000;
+
+PARALLEL_TEST(PollerFallbackTimerTest, test_not_event_driven) {
+    PollerFallbackTimer timer(0);
+    for (int64_t now = 0; now < 3 * kIntervalUs; now += kIntervalUs / 4) {
+        ASSERT_TRUE(timer.start_round(false, kIntervalUs, now));
+        timer.end_wait(true);
+    }
+}
+
+PARALLEL_TEST(PollerFallbackTimerTest, test_notified_rounds_check_notified_drivers) {
+    PollerFallbackTimer timer(0);
+    // The first round checks all the drivers.
+    ASSERT_TRUE(timer.start_round(true, kIntervalUs, 0));
+    ASSERT_EQ(kIntervalUs, timer.wait_us(kIntervalUs, 0));
+
+    // The rounds woken up by notifications within the interval check only the notified drivers,
+    // and the poller sleeps at most until the interval elapses.
+    timer.end_wait(true);
+    ASSERT_FALSE(timer.start_round(true, kIntervalUs, 300));
+    ASSERT_EQ(kIntervalUs - 300, timer.wait_us(kIntervalUs, 300));
+    timer.end_wait(true);
+    ASSERT_FALSE(timer.start_round(true, kIntervalUs, kIntervalUs - 1));
+    ASSERT_EQ(1, timer.wait_us(kIntervalUs, kIntervalUs - 1));
+
+    // Even with notifications, all the drivers are checked once the interval elapses.
+    timer.end_wait(true);
+    ASSERT_TRUE(timer.start_round(true, kIntervalUs, kIntervalUs));
+    ASSERT_EQ(kIntervalUs, timer.wait_us(kIntervalUs, kIntervalUs));
+}
+
+// The drivers blocked by the operators which never notify are still checked once every interval.
+PARALLEL_TEST(PollerFallbackTimerTest, test_fallback_without_notification) {
+    PollerFallbackTimer timer(0);
+    int64_t now = 0;
+    ASSERT_TRUE(timer.start_round(true, kIntervalUs, now));
+    for (int i = 0; i < 3; i++) {
+        // The sleep times out.
+        now += timer.wait_us(kIntervalUs, now);
+        timer.end_wait(false);
+        ASSERT_TRUE(timer.start_round(true, kIntervalUs, now));
+        ASSERT_EQ((i + 1) * kIntervalUs, now);
+    }
+
+    // A round which takes longer than the interval leaves no time to sleep, and the next round checks all.
+    now += 2 * kIntervalUs;
+    ASSERT_LE(timer.wait_us(kIntervalUs, now), 0);
+    timer.end_wait(false);
+    ASSERT_TRUE(timer.start_round(true, kIntervalUs, now));
+}
+
+} // namespace starrocks::pipeline
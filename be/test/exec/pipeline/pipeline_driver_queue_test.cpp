@@ -16,11 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
 #include <thread>
 
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -165,6 +167,216 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_local_and_shared) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 2);
+    queue.bind_worker(0);
+
+    QueryContext query_context;
+    auto short_driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto short_driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto short_driver3 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto long_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    long_driver->driver_acct().update_last_time_spent(config::pipeline_driver_queue_level_time_slice_base_ns * 2);
+
+    // The short drivers are kept in the local queue until it is full, the others go to the shared queue.
+    queue.put_back_from_executor(short_driver1.get());
+    queue.put_back_from_executor(short_driver2.get());
+    queue.put_back_from_executor(short_driver3.get());
+    queue.put_back_from_executor(long_driver.get());
+    ASSERT_EQ(2, queue.num_local_drivers());
+    ASSERT_EQ(4, queue.size());
+    ASSERT_TRUE(short_driver1->is_in_ready_queue());
+
+    // The local queue is LIFO, and then the shared queue.
+    std::vector<DriverRawPtr> out_drivers = {short_driver2.get(), short_driver1.get(), short_driver3.get(),
+                                             long_driver.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+        ASSERT_FALSE(out_driver->is_in_ready_queue());
+    }
+    ASSERT_TRUE(queue.empty());
+
+    // The non-executor threads always use the shared queue.
+    std::thread([&queue, &short_driver1] { queue.put_back_from_executor(short_driver1.get()); }).join();
+    ASSERT_EQ(0, queue.num_local_drivers());
+    ASSERT_EQ(1, queue.size());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+    queue.bind_worker(0);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    queue.put_back_from_executor(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+    ASSERT_EQ(2, queue.num_local_drivers());
+
+    // The other worker steals the oldest driver from the front of the local queue of worker 0.
+    std::thread([&queue, &driver1] {
+        queue.bind_worker(1);
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    }).join();
+
+    auto maybe_driver = queue.take(true);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver2.get(), maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_cancel) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 1, 4);
+    queue.bind_worker(0);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver3 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    queue.put_back(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+    queue.put_back_from_executor(driver3.get());
+
+    // The cancelled driver is moved from the local queue to the shared queue, and is taken before the others.
+    queue.cancel(driver2.get());
+    ASSERT_EQ(1, queue.num_local_drivers());
+    ASSERT_EQ(3, queue.size());
+
+    std::vector<DriverRawPtr> out_drivers = {driver3.get(), driver2.get(), driver1.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        queue.bind_worker(0);
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_put_wakes_blocked_taker) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+
+    QueryContext query_context;
+    auto driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    auto taken = std::async(std::launch::async, [&queue] {
+        queue.bind_worker(1);
+        return queue.take(true);
+    });
+    sleep(1);
+
+    // The idle worker is blocked on the shared queue, so the yielded driver must not be kept in a local queue.
+    std::thread([&queue, &driver] {
+        queue.bind_worker(0);
+        queue.put_back_from_executor(driver.get());
+    }).join();
+    ASSERT_EQ(0, queue.num_local_drivers());
+
+    if (taken.wait_for(std::chrono::seconds(10)) != std::future_status::ready) {
+        queue.close();
+        FAIL() << "the blocked worker is not woken up";
+    }
+    auto maybe_driver = taken.get();
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver.get(), maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_unbind_worker) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    std::thread([&queue, &driver1, &driver2] {
+        queue.bind_worker(0);
+        queue.put_back_from_executor(driver1.get());
+        queue.put_back_from_executor(driver2.get());
+        ASSERT_EQ(2, queue.num_local_drivers());
+        // The exiting worker hands its local drivers back to the shared queue.
+        queue.unbind_worker();
+    }).join();
+    ASSERT_EQ(0, queue.num_local_drivers());
+    ASSERT_EQ(2, queue.size());
+
+    for (auto* out_driver : {driver1.get(), driver2.get()}) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+        ASSERT_FALSE(out_driver->is_in_ready_queue());
+    }
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_multi_thread_take_all) {
+    constexpr int num_workers = 4;
+    constexpr int num_drivers = 16;
+    constexpr int num_rounds = 200;
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), num_workers, 4);
+
+    QueryContext query_context;
+    std::vector<std::shared_ptr<PipelineDriver>> drivers;
+    std::unordered_map<DriverRawPtr, int> driver_index;
+    for (int i = 0; i < num_drivers; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1));
+        driver_index[drivers.back().get()] = i;
+    }
+    std::vector<std::atomic<int>> rounds(num_drivers);
+    std::atomic<int> num_takes = 0;
+
+    // Every worker yields the taken driver back through its local queue until the driver has run num_rounds
+    // times, so the drivers keep moving among the local queues, the shared queue and the blocked workers.
+    std::vector<std::thread> workers;
+    for (int worker_id = 0; worker_id < num_workers; ++worker_id) {
+        workers.emplace_back([&, worker_id] {
+            queue.bind_worker(worker_id);
+            while (true) {
+                auto maybe_driver = queue.take(true);
+                if (!maybe_driver.ok()) {
+                    return;
+                }
+                auto* driver = maybe_driver.value();
+                if (driver == nullptr) {
+                    continue;
+                }
+                num_takes++;
+                if (rounds[driver_index.at(driver)].fetch_add(1) + 1 < num_rounds) {
+                    queue.put_back_from_executor(driver);
+                }
+            }
+        });
+    }
+    std::vector<DriverRawPtr> raw_drivers;
+    for (const auto& driver : drivers) {
+        raw_drivers.emplace_back(driver.get());
+    }
+    queue.put_back(raw_drivers);
+
+    const int64_t deadline = MonotonicMillis() + 30 * 1000;
+    while (num_takes < num_drivers * num_rounds && MonotonicMillis() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    queue.close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ASSERT_EQ(num_drivers * num_rounds, num_takes);
+    ASSERT_EQ(0, queue.num_local_drivers());
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -269,6 +481,90 @@ TEST_F(WorkGroupDriverQueueTest, test_basic) {
     }
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_latency_slo) {
+    TWorkGroup twg;
+    twg.__set_id(500);
+    twg.__set_name("wg500");
+    twg.__set_version(workgroup::WorkGroup::DEFAULT_VERSION);
+    twg.__set_cpu_core_limit(1);
+    twg.__set_mem_limit(0.5);
+    twg.__set_target_latency_ms(1);
+    auto slo_wg =
+            ExecEnv::GetInstance()->workgroup_manager()->add_workgroup(std::make_shared<workgroup::WorkGroup>(twg));
+    ASSERT_TRUE(slo_wg->has_latency_slo());
+
+    WorkGroupDriverQueue queue;
+
+    QueryContext query_ctx;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    driver1->set_workgroup(_wg1);
+
+    QueryContext slo_query_ctx;
+    slo_query_ctx.init_query_begin_time();
+    auto slo_driver = std::make_shared<PipelineDriver>(_gen_operators(), &slo_query_ctx, nullptr, nullptr, -1);
+    slo_driver->driver_acct().update_last_time_spent(10'000'000L);
+    slo_driver->set_workgroup(slo_wg);
+
+    queue.update_statistics(slo_driver.get());
+    queue.put_back(slo_driver.get());
+    queue.update_statistics(driver1.get());
+    queue.put_back(driver1.get());
+    // The query of slo_wg becomes urgent after half of its target latency.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(slo_driver.get(), maybe_driver.value());
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+}
+
+TEST_F(WorkGroupDriverQueueTest, test_latency_slo_becomes_urgent) {
+    TWorkGroup twg;
+    twg.__set_id(501);
+    twg.__set_name("wg501");
+    twg.__set_version(workgroup::WorkGroup::DEFAULT_VERSION);
+    twg.__set_cpu_core_limit(1);
+    twg.__set_mem_limit(0.5);
+    twg.__set_target_latency_ms(100);
+    auto slo_wg =
+            ExecEnv::GetInstance()->workgroup_manager()->add_workgroup(std::make_shared<workgroup::WorkGroup>(twg));
+    ASSERT_TRUE(slo_wg->has_latency_slo());
+
+    WorkGroupDriverQueue queue;
+
+    // driver1 is running in the executor thread, and isn't in the queue.
+    QueryContext query_ctx;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    driver1->set_workgroup(_wg1);
+
+    QueryContext slo_query_ctx;
+    slo_query_ctx.init_query_begin_time();
+    auto slo_driver = std::make_shared<PipelineDriver>(_gen_operators(), &slo_query_ctx, nullptr, nullptr, -1);
+    // Make the vruntime of slo_wg large enough, so that driver1 doesn't yield because of vruntime.
+    slo_driver->driver_acct().update_last_time_spent(100'000'000'000L);
+    slo_driver->set_workgroup(slo_wg);
+    queue.update_statistics(slo_driver.get());
+    queue.put_back(slo_driver.get());
+
+    // The query of slo_wg isn't urgent yet.
+    ASSERT_FALSE(queue.should_yield(driver1.get(), 0));
+
+    // The query of slo_wg becomes urgent after half of its target latency, which is noticed when driver1
+    // updates its statistics, even though no workgroup is enqueued or dequeued.
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    queue.update_statistics(driver1.get());
+    ASSERT_TRUE(queue.should_yield(driver1.get(), 0));
+    ASSERT_FALSE(queue.should_yield(slo_driver.get(), 0));
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(slo_driver.get(), maybe_driver.value());
+    // There is no urgent driver in the queue anymore.
+    ASSERT_FALSE(queue.should_yield(driver1.get(), 0));
+}
+
 TEST_F(WorkGroupDriverQueueTest, test_take_block) {
     QueryContext query_ctx;
     WorkGroupDriverQueue queue;
@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+PARALLEL_TEST(PipelineObserverTest, test_fetch_event) {
+    PipelineObserver observer;
+    ASSERT_FALSE(observer.fetch_event());
+
+    // Notifying the observer without any poller only marks the event.
+    observer.notify();
+    ASSERT_TRUE(observer.fetch_event());
+    ASSERT_FALSE(observer.fetch_event());
+
+    observer.mark_event();
+    observer.mark_event();
+    ASSERT_TRUE(observer.fetch_event());
+    ASSERT_FALSE(observer.fetch_event());
+}
+
+PARALLEL_TEST(PipelineObserverTest, test_observable) {
+    PipelineObserver observer1;
+    PipelineObserver observer2;
+    Observable observable;
+    observable.add_observer(&observer1);
+    observable.add_observer(&observer2);
+    observable.add_observer(nullptr);
+
+    std::thread([&observable] { observable.notify_observers(); }).join();
+    ASSERT_TRUE(observer1.fetch_event());
+    ASSERT_TRUE(observer2.fetch_event());
+
+    // The removed observer is not notified anymore.
+    observable.remove_observer(&observer1);
+    observable.notify_observers();
+    ASSERT_FALSE(observer1.fetch_event());
+    ASSERT_TRUE(observer2.fetch_event());
+
+    // The cleared observers are not notified anymore.
+    observable.clear_observers();
+    observable.notify_observers();
+    ASSERT_FALSE(observer1.fetch_event());
+    ASSERT_FALSE(observer2.fetch_event());
+}
+
+} // namespace starrocks::pipeline
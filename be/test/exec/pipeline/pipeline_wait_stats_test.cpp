@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_wait_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+TEST(DriverWaitStatsTest, test_buckets) {
+    DriverWaitStats stats;
+    stats.add(DriverWaitReason::INPUT_EMPTY, 10'000);        // 10us
+    stats.add(DriverWaitReason::INPUT_EMPTY, 1'000'000);     // 1ms
+    stats.add(DriverWaitReason::INPUT_EMPTY, 50'000'000);    // 50ms
+    stats.add(DriverWaitReason::INPUT_EMPTY, 999'999'999);   // < 1s
+    stats.add(DriverWaitReason::INPUT_EMPTY, 5'000'000'000); // 5s
+    stats.add(DriverWaitReason::READY_QUEUE, 20'000);
+    // Invalid waits are ignored.
+    stats.add(DriverWaitReason::OUTPUT_FULL, -1);
+    stats.add(DriverWaitReason::NUM_REASONS, 1);
+
+    auto snapshot = stats.snapshot();
+    const auto& input_empty = snapshot[static_cast<size_t>(DriverWaitReason::INPUT_EMPTY)];
+    ASSERT_EQ(5, input_empty.count);
+    ASSERT_EQ(10'000 + 1'000'000 + 50'000'000 + 999'999'999 + 5'000'000'000L, input_empty.total_time_ns);
+    ASSERT_EQ(1, input_empty.buckets[0]);
+    ASSERT_EQ(1, input_empty.buckets[1]);
+    ASSERT_EQ(1, input_empty.buckets[2]);
+    ASSERT_EQ(1, input_empty.buckets[3]);
+    ASSERT_EQ(1, input_empty.buckets[4]);
+
+    const auto& ready_queue = snapshot[static_cast<size_t>(DriverWaitReason::READY_QUEUE)];
+    ASSERT_EQ(1, ready_queue.count);
+    ASSERT_EQ(1, ready_queue.buckets[0]);
+
+    ASSERT_EQ(0, snapshot[static_cast<size_t>(DriverWaitReason::OUTPUT_FULL)].count);
+}
+
+TEST(DriverWaitStatsTest, test_concurrent_add) {
+    DriverWaitStats stats;
+    constexpr int num_threads = 4;
+    constexpr int num_adds = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&stats]() {
+            for (int j = 0; j < num_adds; ++j) {
+                stats.add(DriverWaitReason::SPILL_IO, 2'000'000);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto snapshot = stats.snapshot();
+    const auto& spill_io = snapshot[static_cast<size_t>(DriverWaitReason::SPILL_IO)];
+    ASSERT_EQ(num_threads * num_adds, spill_io.count);
+    ASSERT_EQ(num_threads * num_adds, spill_io.buckets[1]);
+    ASSERT_EQ(int64_t(num_threads) * num_adds * 2'000'000, spill_io.total_time_ns);
+}
+
+TEST(DriverWaitStatsTest, test_names) {
+    ASSERT_STREQ("PRECONDITION_NOT_READY", driver_wait_reason_to_string(DriverWaitReason::PRECONDITION_NOT_READY));
+    ASSERT_STREQ("READY_QUEUE", driver_wait_reason_to_string(DriverWaitReason::READY_QUEUE));
+    ASSERT_EQ("lt_1ms", DriverWaitStats::bucket_name(0));
+    ASSERT_EQ("ge_1s", DriverWaitStats::bucket_name(DriverWaitStats::NUM_BUCKETS - 1));
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,157 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/aggregate/sorted_aggregate_streaming_sink_operator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/sorted_streaming_aggregator.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+
+namespace starrocks::pipeline {
+
+class SortedAggregateStreamingSinkOperatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _runtime_state = _pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr));
+        _runtime_state->set_query_ctx(_query_ctx.get());
+        std::vector<SlotTypeInfoArray> slot_infos{
+                // input slots
+                {{"c0", TYPE_BIGINT, false}, {"c1", TYPE_BIGINT, false}},
+                // intermediate slots
+                {{"c0", TYPE_BIGINT, false}, {"count_c1", TYPE_BIGINT, false}},
+                // result slots
+                {{"c0", TYPE_BIGINT, false}, {"count_c1", TYPE_BIGINT, false}},
+        };
+        _runtime_state->set_desc_tbl(DescTblHelper::generate_desc_tbl(
+                _runtime_state, _pool, DescTblHelper::create_slot_type_desc_info_arrays(slot_infos)));
+    }
+
+    // select c0, count(c1) from t group by c0 limit <limit>, the input is sorted on c0
+    std::shared_ptr<SortedStreamingAggregator> create_aggregator(int64_t limit) {
+        auto params = std::make_shared<AggregatorParams>();
+        params->needs_finalize = true;
+        params->has_outer_join_child = false;
+        params->limit = limit;
+        params->enable_pipeline_share_limit = false;
+        params->streaming_preaggregation_mode = TStreamingPreaggregationMode::FORCE_PREAGGREGATION;
+        params->intermediate_tuple_id = 1;
+        params->output_tuple_id = 2;
+        params->is_testing = true;
+        params->is_append_only = true;
+        params->is_generate_retract = false;
+        params->count_agg_idx = 0;
+
+        auto bigint_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+        params->grouping_exprs = {
+                ExprsTestHelper::create_slot_expr(ExprsTestHelper::create_slot_expr_node(0, 0, bigint_type, false))};
+        auto count_fn = ExprsTestHelper::create_builtin_function("count", {bigint_type}, bigint_type, bigint_type);
+        params->aggregate_functions = {ExprsTestHelper::create_aggregate_expr(
+                count_fn, {ExprsTestHelper::create_slot_expr_node(0, 1, bigint_type, false)})};
+        params->init();
+        return std::make_shared<SortedStreamingAggregator>(std::move(params));
+    }
+
+    static ChunkPtr create_chunk(const std::vector<int64_t>& keys) {
+        auto c0 = Int64Column::create();
+        auto c1 = Int64Column::create();
+        for (int64_t key : keys) {
+            c0->append(key);
+            c1->append(key);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c0), 0);
+        chunk->append_column(std::move(c1), 1);
+        return chunk;
+    }
+
+    // the groups offered to the buffer, as (c0, count(c1)) pairs
+    static std::vector<std::pair<int64_t, int64_t>> poll_groups(SortedStreamingAggregator* aggregator) {
+        std::vector<std::pair<int64_t, int64_t>> groups;
+        while (!aggregator->is_chunk_buffer_empty()) {
+            auto chunk = aggregator->poll_chunk_buffer();
+            if (chunk == nullptr) {
+                continue;
+            }
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                groups.emplace_back(chunk->get_column_by_index(0)->get(i).get_int64(),
+                                    chunk->get_column_by_index(1)->get(i).get_int64());
+            }
+        }
+        return groups;
+    }
+
+    ObjectPool _pool;
+    std::unique_ptr<QueryContext> _query_ctx = std::make_unique<QueryContext>();
+    RuntimeState* _runtime_state = nullptr;
+};
+
+TEST_F(SortedAggregateStreamingSinkOperatorTest, test_finish_early_at_limit) {
+    auto aggregator = create_aggregator(2);
+    SortedAggregateStreamingSinkOperatorFactory factory(1, 1, nullptr);
+    SortedAggregateStreamingSinkOperator op(&factory, 1, 1, 0, aggregator);
+    ASSERT_OK(op.prepare(_runtime_state));
+
+    // groups 1 and 2 are complete once 3 shows up, the limit is reached
+    ASSERT_TRUE(op.need_input());
+    ASSERT_OK(op.push_chunk(_runtime_state, create_chunk({1, 1, 2, 2, 2, 3})));
+    ASSERT_TRUE(op.is_finished());
+    ASSERT_FALSE(op.need_input());
+    ASSERT_TRUE(aggregator->is_sink_complete());
+
+    // finishing again does not emit the dropped group 3
+    ASSERT_OK(op.set_finishing(_runtime_state));
+    std::vector<std::pair<int64_t, int64_t>> expected{{1, 2}, {2, 3}};
+    ASSERT_EQ(expected, poll_groups(aggregator.get()));
+    op.close(_runtime_state);
+}
+
+TEST_F(SortedAggregateStreamingSinkOperatorTest, test_consume_all_below_limit) {
+    auto aggregator = create_aggregator(3);
+    SortedAggregateStreamingSinkOperatorFactory factory(1, 1, nullptr);
+    SortedAggregateStreamingSinkOperator op(&factory, 1, 1, 0, aggregator);
+    ASSERT_OK(op.prepare(_runtime_state));
+
+    // only group 1 is complete, keep consuming
+    ASSERT_OK(op.push_chunk(_runtime_state, create_chunk({1, 1, 2})));
+    ASSERT_FALSE(op.is_finished());
+    // group 2 spans both chunks
+    ASSERT_OK(op.push_chunk(_runtime_state, create_chunk({2, 3})));
+    ASSERT_FALSE(op.is_finished());
+
+    ASSERT_OK(op.set_finishing(_runtime_state));
+    ASSERT_TRUE(op.is_finished());
+    std::vector<std::pair<int64_t, int64_t>> expected{{1, 2}, {2, 2}, {3, 1}};
+    ASSERT_EQ(expected, poll_groups(aggregator.get()));
+    op.close(_runtime_state);
+}
+
+TEST_F(SortedAggregateStreamingSinkOperatorTest, test_no_limit) {
+    auto aggregator = create_aggregator(-1);
+    SortedAggregateStreamingSinkOperatorFactory factory(1, 1, nullptr);
+    SortedAggregateStreamingSinkOperator op(&factory, 1, 1, 0, aggregator);
+    ASSERT_OK(op.prepare(_runtime_state));
+
+    ASSERT_OK(op.push_chunk(_runtime_state, create_chunk({1, 2, 3, 4, 5, 6})));
+    ASSERT_FALSE(op.is_finished());
+    ASSERT_OK(op.set_finishing(_runtime_state));
+    ASSERT_EQ(6, poll_groups(aggregator.get()).size());
+    op.close(_runtime_state);
+}
+
+} // namespace starrocks::pipeline
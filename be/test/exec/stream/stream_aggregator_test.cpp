@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "exec/stream/stream_test.h"
+#include "testutil/assert.h"
 #include "testutil/desc_tbl_helper.h"
 
 namespace starrocks::stream {
@@ -180,6 +181,35 @@ TEST_F(CountStreamAggregateTest, TestNoRetracts_NoGenerateRetracts) {
     _stream_aggregator->close(_runtime_state);
 }
 
+TEST_F(CountStreamAggregateTest, TestMemoryUsageCounters) {
+    DCHECK_IF_ERROR(_stream_aggregator->prepare(_runtime_state, &_obj_pool, _runtime_profile));
+    DCHECK_IF_ERROR(_stream_aggregator->open(_runtime_state));
+    // The counters are added once the input is consumed.
+    ASSERT_EQ(nullptr, _runtime_profile->get_counter("AggMemoryUsage"));
+
+    auto input_chunk = MakeStreamChunk<int64_t>({{1, 2, 1, 3}, {1, 2, 2, 3}}, {0, 0, 0, 0});
+    ASSERT_OK(_stream_aggregator->process_chunk(input_chunk.get()));
+    _stream_aggregator->update_memory_usage_counters();
+
+    auto* total = _runtime_profile->get_counter("AggMemoryUsage");
+    auto* hash_table = _runtime_profile->get_counter("HashBucketsMemoryUsage");
+    auto* mem_pool = _runtime_profile->get_counter("MemPoolMemoryUsage");
+    auto* agg_state = _runtime_profile->get_counter("AggStateMemoryUsage");
+    auto* allocator = _runtime_profile->get_counter("AggStateAllocatorMemoryUsage");
+    ASSERT_NE(nullptr, total);
+    ASSERT_NE(nullptr, hash_table);
+    ASSERT_NE(nullptr, mem_pool);
+    ASSERT_NE(nullptr, agg_state);
+    ASSERT_NE(nullptr, allocator);
+    ASSERT_GT(hash_table->value(), 0);
+    ASSERT_GT(allocator->value(), 0);
+    ASSERT_EQ(total->value(), hash_table->value() + mem_pool->value() + agg_state->value() + allocator->value());
+    ASSERT_EQ(_stream_aggregator->memory_usage(), total->value());
+
+    DCHECK_IF_ERROR(_stream_aggregator->reset_state(_runtime_state));
+    _stream_aggregator->close(_runtime_state);
+}
+
 TEST_F(CountStreamAggregateTest, TestWithRetracts_NoGenerateRetracts) {
     DCHECK_IF_ERROR(_stream_aggregator->prepare(_runtime_state, &_obj_pool, _runtime_profile));
     DCHECK_IF_ERROR(_stream_aggregator->open(_runtime_state));
@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/topn_node.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+class TopNNodeTest : public ::testing::Test {
+protected:
+    static std::unique_ptr<RuntimeState> create_runtime_state(bool enable_sort_spill) {
+        TQueryOptions query_options;
+        query_options.__set_enable_spill(true);
+        query_options.__set_spillable_operator_mask(enable_sort_spill ? (1LL << TSpillableOperatorType::SORT) : 0);
+        return std::make_unique<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    }
+};
+
+TEST_F(TopNNodeTest, test_can_spill_sort) {
+    auto state = create_runtime_state(true);
+    TSortNode sort_node;
+    int64_t threshold = config::spillable_topn_limit_threshold;
+
+    // full sort
+    ASSERT_TRUE(TopNNode::_can_spill_sort(state.get(), sort_node, -1, 0, false));
+    // small limit stays in memory
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), sort_node, 100, 0, false));
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold, 0, false));
+    // the offset counts toward the rows to keep
+    ASSERT_TRUE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold, 1, false));
+    ASSERT_TRUE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold + 1, 0, false));
+
+    sort_node.__set_topn_type(TTopNType::ROW_NUMBER);
+    ASSERT_TRUE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold + 1, 0, false));
+    // rank keeps ties beyond the limit, the full sort can't reproduce it
+    sort_node.__set_topn_type(TTopNType::RANK);
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold + 1, 0, false));
+    ASSERT_TRUE(TopNNode::_can_spill_sort(state.get(), sort_node, -1, 0, false));
+
+    // partition topn keeps its in-memory path
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), TSortNode(), -1, 0, true));
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), TSortNode(), threshold + 1, 0, true));
+}
+
+TEST_F(TopNNodeTest, test_can_spill_sort_disabled) {
+    auto state = create_runtime_state(false);
+    TSortNode sort_node;
+    int64_t threshold = config::spillable_topn_limit_threshold;
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), sort_node, -1, 0, false));
+    ASSERT_FALSE(TopNNode::_can_spill_sort(state.get(), sort_node, threshold + 1, 0, false));
+
+    // a negative threshold turns the large limit path off
+    auto spill_state = create_runtime_state(true);
+    config::spillable_topn_limit_threshold = -1;
+    ASSERT_FALSE(TopNNode::_can_spill_sort(spill_state.get(), sort_node, threshold + 1, 0, false));
+    ASSERT_TRUE(TopNNode::_can_spill_sort(spill_state.get(), sort_node, -1, 0, false));
+    config::spillable_topn_limit_threshold = threshold;
+}
+
+} // namespace starrocks
@@ -21,13 +21,16 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
+#include "runtime/exec_env.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -95,4 +98,69 @@ PARALLEL_TEST(ScanExecutorTest, test_yield) {
     ASSERT_EQ(submit_tasks, finished_tasks.load());
 }
 
+static WorkGroupPtr add_test_workgroup(int64_t id, int64_t target_latency_ms) {
+    TWorkGroup twg;
+    twg.__set_id(id);
+    twg.__set_name("wg" + std::to_string(id));
+    twg.__set_version(WorkGroup::DEFAULT_VERSION);
+    twg.__set_cpu_core_limit(1);
+    twg.__set_mem_limit(0.5);
+    if (target_latency_ms > 0) {
+        twg.__set_target_latency_ms(target_latency_ms);
+    }
+    return ExecEnv::GetInstance()->workgroup_manager()->add_workgroup(std::make_shared<WorkGroup>(twg));
+}
+
+static ScanTask make_test_scan_task(const WorkGroupPtr& wg, int64_t query_begin_time_ns) {
+    ScanTask task(wg, [](auto& ctx) {});
+    task.query_begin_time_ns = query_begin_time_ns;
+    return task;
+}
+
+TEST(WorkGroupScanTaskQueueTest, test_latency_slo_not_urgent) {
+    auto wg = add_test_workgroup(600, 0);
+    // The query is far from its target latency.
+    auto slo_wg = add_test_workgroup(601, 100'000);
+    ASSERT_FALSE(wg->has_latency_slo());
+    ASSERT_TRUE(slo_wg->has_latency_slo());
+
+    WorkGroupScanTaskQueue queue(ScanSchedEntityType::OLAP);
+
+    auto slo_task = make_test_scan_task(slo_wg, MonotonicNanos());
+    queue.update_statistics(slo_task, 100'000'000L);
+    queue.force_put(std::move(slo_task));
+    queue.force_put(make_test_scan_task(wg, MonotonicNanos()));
+
+    // The workgroup without latency SLO has the smaller vruntime, and still makes progress.
+    ASSERT_FALSE(queue.should_yield(wg.get(), 0));
+    ASSIGN_OR_ABORT(auto task, queue.take());
+    ASSERT_EQ(wg.get(), task.workgroup.get());
+    ASSIGN_OR_ABORT(task, queue.take());
+    ASSERT_EQ(slo_wg.get(), task.workgroup.get());
+}
+
+TEST(WorkGroupScanTaskQueueTest, test_latency_slo_urgent) {
+    auto wg = add_test_workgroup(602, 0);
+    auto slo_wg = add_test_workgroup(603, 1);
+
+    WorkGroupScanTaskQueue queue(ScanSchedEntityType::OLAP);
+
+    auto slo_task = make_test_scan_task(slo_wg, MonotonicNanos());
+    queue.update_statistics(slo_task, 100'000'000L);
+    queue.force_put(std::move(slo_task));
+    // The query of slo_wg becomes urgent after half of its target latency.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    queue.force_put(make_test_scan_task(wg, MonotonicNanos()));
+
+    ASSERT_TRUE(queue.should_yield(wg.get(), 0));
+    ASSERT_FALSE(queue.should_yield(slo_wg.get(), 0));
+    ASSIGN_OR_ABORT(auto task, queue.take());
+    ASSERT_EQ(slo_wg.get(), task.workgroup.get());
+
+    // There is no urgent scan task in the queue anymore.
+    ASSERT_FALSE(queue.should_yield(wg.get(), 0));
+    ASSIGN_OR_ABORT(task, queue.take());
+    ASSERT_EQ(wg.get(), task.workgroup.get());
+}
+
 } // namespace starrocks::workgroup
@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include "common/config.h"
+#include "exec/spill/executor.h"
+#include "exec/workgroup/scan_executor.h"
+#include "exec/workgroup/scan_task_queue.h"
+#include "exec/workgroup/work_group.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/time.h"
+
+namespace starrocks::workgroup {
+
+class SpillIOThrottleTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _old_bytes_per_second = config::spill_io_bytes_per_second_per_workgroup;
+        _wg = std::make_shared<WorkGroup>("wg", 100, WorkGroup::DEFAULT_VERSION, 1, 0.5, 10, 1.0,
+                                          WorkGroupType::WG_NORMAL);
+    }
+    void TearDown() override { config::spill_io_bytes_per_second_per_workgroup = _old_bytes_per_second; }
+
+protected:
+    int64_t _old_bytes_per_second = 0;
+    WorkGroupPtr _wg;
+};
+
+TEST_F(SpillIOThrottleTest, test_unlimited) {
+    config::spill_io_bytes_per_second_per_workgroup = 0;
+    _wg->account_spill_io(1L << 40);
+    ASSERT_FALSE(_wg->is_spill_io_throttled());
+}
+
+TEST_F(SpillIOThrottleTest, test_budget) {
+    // 1MB/s, so 100KB takes about 100ms of budget.
+    config::spill_io_bytes_per_second_per_workgroup = 1024 * 1024;
+    ASSERT_FALSE(_wg->is_spill_io_throttled());
+    _wg->account_spill_io(100 * 1024);
+    ASSERT_TRUE(_wg->is_spill_io_throttled());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_FALSE(_wg->is_spill_io_throttled());
+
+    // Disabling the limit stops the throttle at once.
+    _wg->account_spill_io(100 * 1024 * 1024);
+    ASSERT_TRUE(_wg->is_spill_io_throttled());
+    config::spill_io_bytes_per_second_per_workgroup = 0;
+    ASSERT_FALSE(_wg->is_spill_io_throttled());
+}
+
+TEST_F(SpillIOThrottleTest, test_yield_if_throttled) {
+    config::spill_io_bytes_per_second_per_workgroup = 1024 * 1024;
+    YieldContext yield_ctx;
+    ASSERT_FALSE(spill::yield_if_spill_io_throttled(yield_ctx, nullptr));
+    ASSERT_FALSE(spill::yield_if_spill_io_throttled(yield_ctx, _wg.get()));
+    ASSERT_FALSE(yield_ctx.need_yield);
+
+    _wg->account_spill_io(100 * 1024 * 1024);
+    // A task which has not set its yield points yet stays unfinished, so that the executor reschedules it.
+    ASSERT_TRUE(yield_ctx.is_finished());
+    ASSERT_TRUE(spill::yield_if_spill_io_throttled(yield_ctx, _wg.get()));
+    ASSERT_TRUE(yield_ctx.need_yield);
+    ASSERT_FALSE(yield_ctx.is_finished());
+    // The executor requeues it only when the budget is available again.
+    ASSERT_EQ(_wg->spill_io_next_free_ns(), yield_ctx.resubmit_after_ns);
+}
+
+TEST_F(SpillIOThrottleTest, test_throttled_task_is_rescheduled) {
+    auto queue = std::make_unique<PriorityScanTaskQueue>(100);
+    std::unique_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPoolBuilder("spill_io_throttle")
+                      .set_min_threads(0)
+                      .set_max_threads(2)
+                      .set_max_queue_size(100)
+                      .build(&thread_pool));
+    auto executor = std::make_unique<ScanExecutor>(std::move(thread_pool), std::move(queue), false);
+    DeferOp op([&]() { executor->close(); });
+    executor->initialize(2);
+
+    config::spill_io_bytes_per_second_per_workgroup = 1024 * 1024;
+    // 50KB takes about 50ms of budget.
+    _wg->account_spill_io(50 * 1024);
+    const int64_t deadline_ns = _wg->spill_io_next_free_ns();
+
+    std::atomic<int> num_runs = 0;
+    std::atomic<int> num_throttled_runs = 0;
+    std::atomic<int64_t> finish_ns = 0;
+    std::promise<void> finished;
+    ScanTask task(_wg, [&](YieldContext& ctx) {
+        num_runs++;
+        ctx.need_yield = false;
+        if (spill::yield_if_spill_io_throttled(ctx, _wg.get())) {
+            num_throttled_runs++;
+            return;
+        }
+        finish_ns = MonotonicNanos();
+        ctx.set_finished();
+        finished.set_value();
+    });
+    ASSERT_TRUE(executor->submit(std::move(task)));
+    finished.get_future().get();
+
+    // The throttled task is parked until the budget is available and runs only once more, instead of being
+    // picked up and yielding again and again.
+    ASSERT_GE(finish_ns.load(), deadline_ns);
+    ASSERT_EQ(1, num_throttled_runs.load());
+    ASSERT_EQ(2, num_runs.load());
+}
+
+} // namespace starrocks::workgroup
@@ -831,6 +831,30 @@ TEST_F(ArrayFunctionsTest, array_contains_all) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ArrayFunctionsTest, array_contains_const_target) {
+    // array elements are nullable
+    auto array = ColumnHelper::create_column(TYPE_ARRAY_INT, false);
+    array->append_datum(Datum(DatumArray{Datum((int32_t)1), Datum((int32_t)3), Datum((int32_t)3)}));
+    array->append_datum(Datum(DatumArray{}));
+    array->append_datum(Datum(DatumArray{Datum(), Datum((int32_t)2)}));
+    array->append_datum(Datum(DatumArray{Datum(), Datum((int32_t)4), Datum((int32_t)5), Datum((int32_t)3)}));
+    array->append_datum(Datum(DatumArray{Datum((int32_t)3)}));
+
+    auto data = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+    data->append_datum(Datum((int32_t)3));
+    auto target = ConstColumn::create(data, array->size());
+
+    auto contains = ArrayFunctions::array_contains(nullptr, {array, target}).value();
+    auto position = ArrayFunctions::array_position(nullptr, {array, target}).value();
+    std::vector<int> expect_positions = {2, 0, 0, 4, 1};
+    ASSERT_EQ(expect_positions.size(), contains->size());
+    for (size_t i = 0; i < expect_positions.size(); i++) {
+        EXPECT_EQ(expect_positions[i] > 0, contains->get(i).get_int8());
+        EXPECT_EQ(expect_positions[i], position->get(i).get_int32());
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(ArrayFunctionsTest, array_position_empty_array) {
     // array_position([], 1) : 0
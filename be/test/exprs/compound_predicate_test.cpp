@@ -17,10 +17,25 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <functional>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/column_viewer.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
 #include "exprs/exprs_test_helper.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -433,4 +448,154 @@ TEST_F(VectorizedCompoundPredicateTest, testOnlyNullAndZeroRow) {
     }
 }
 
+class PatternOrCompoundPredicateTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (const char* v : {"123abc456", "xyz", "xyzz", "100%", "1000", "42", "", "ab c", "hello", "world"}) {
+            str->append_datum(Datum(Slice(v)));
+        }
+        str->append_nulls(2);
+        _chunk = std::make_shared<Chunk>();
+        _chunk->append_column(std::move(str), kSlotId);
+    }
+
+protected:
+    static constexpr SlotId kSlotId = 1;
+
+    Expr* _column_ref() { return _pool.add(new ColumnRef(TypeDescriptor::create_varchar_type(64), kSlotId)); }
+
+    Expr* _string_literal(const std::string& value) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        node.__set_type(TypeDescriptor::create_varchar_type(64).to_thrift());
+        node.__set_num_children(0);
+        TStringLiteral literal;
+        literal.__set_value(value);
+        node.__set_string_literal(literal);
+        return _pool.add(new VectorizedLiteral(node));
+    }
+
+    // `col LIKE pattern` if is_like, otherwise `col REGEXP pattern`.
+    Expr* _pattern_match(const std::string& pattern, bool is_like) {
+        TFunctionName fn_name;
+        fn_name.__set_function_name(is_like ? "LIKE" : "REGEXP");
+        TFunction fn;
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_arg_types({gen_type_desc(TPrimitiveType::VARCHAR), gen_type_desc(TPrimitiveType::VARCHAR)});
+        fn.__set_ret_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+        fn.__set_has_var_args(false);
+        fn.__set_fid(is_like ? 60010 : 60020);
+
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+        node.__set_num_children(2);
+        node.__set_fn(fn);
+        node.__set_is_nullable(true);
+        auto* expr = _pool.add(new VectorizedFunctionCallExpr(node));
+        expr->add_child(_column_ref());
+        expr->add_child(_string_literal(pattern));
+        return expr;
+    }
+
+    Expr* _equals(const std::string& value) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::BINARY_PRED);
+        node.__set_opcode(TExprOpcode::EQ);
+        node.__set_child_type(TPrimitiveType::VARCHAR);
+        node.__set_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+        node.__set_num_children(2);
+        node.__set_is_nullable(true);
+        auto* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        expr->add_child(_column_ref());
+        expr->add_child(_string_literal(value));
+        return expr;
+    }
+
+    Expr* _or(const std::vector<Expr*>& leaves) {
+        Expr* root = leaves[0];
+        for (size_t i = 1; i < leaves.size(); ++i) {
+            TExprNode node;
+            node.__set_node_type(TExprNodeType::COMPOUND_PRED);
+            node.__set_opcode(TExprOpcode::COMPOUND_OR);
+            node.__set_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+            node.__set_num_children(2);
+            node.__set_is_nullable(true);
+            auto* or_expr = _pool.add(VectorizedCompoundPredicateFactory::from_thrift(node));
+            or_expr->add_child(root);
+            or_expr->add_child(leaves[i]);
+            root = or_expr;
+        }
+        return root;
+    }
+
+    // Evaluate the OR chain of the leaves made by make_leaves, with and without the multi-pattern rewrite,
+    // and check both give the same result.
+    void _check_same_result(const std::function<std::vector<Expr*>()>& make_leaves) {
+        auto old_min_num = config::like_multi_pattern_min_num;
+        DeferOp defer([&]() { config::like_multi_pattern_min_num = old_min_num; });
+
+        config::like_multi_pattern_min_num = 2;
+        ASSIGN_OR_ABORT(auto rewritten, _evaluate(_or(make_leaves())));
+        config::like_multi_pattern_min_num = 0;
+        ASSIGN_OR_ABORT(auto expected, _evaluate(_or(make_leaves())));
+
+        ColumnViewer<TYPE_BOOLEAN> rewritten_viewer(rewritten);
+        ColumnViewer<TYPE_BOOLEAN> expected_viewer(expected);
+        ASSERT_EQ(_chunk->num_rows(), rewritten_viewer.size());
+        ASSERT_EQ(_chunk->num_rows(), expected_viewer.size());
+        for (size_t i = 0; i < _chunk->num_rows(); ++i) {
+            ASSERT_EQ(expected_viewer.is_null(i), rewritten_viewer.is_null(i)) << i;
+            if (!expected_viewer.is_null(i)) {
+                ASSERT_EQ(expected_viewer.value(i), rewritten_viewer.value(i)) << i;
+            }
+        }
+    }
+
+    StatusOr<ColumnPtr> _evaluate(Expr* root) {
+        ExprContext context(root);
+        DeferOp defer([&]() { context.close(&_runtime_state); });
+        RETURN_IF_ERROR(context.prepare(&_runtime_state));
+        RETURN_IF_ERROR(context.open(&_runtime_state));
+        return context.evaluate(_chunk.get());
+    }
+
+    RuntimeState _runtime_state;
+    ObjectPool _pool;
+    ChunkPtr _chunk;
+};
+
+TEST_F(PatternOrCompoundPredicateTest, test_like_or_chain) {
+    _check_same_result([this]() {
+        return std::vector<Expr*>{_pattern_match("%abc%", true), _pattern_match("x_z", true),
+                                  _pattern_match("100\\%", true), _pattern_match("^[0-9]+$", false)};
+    });
+}
+
+TEST_F(PatternOrCompoundPredicateTest, test_like_or_equals_chain) {
+    // the equality predicates keep the chain from being rewritten
+    _check_same_result([this]() {
+        return std::vector<Expr*>{_pattern_match("%abc%", true), _equals("hello"), _pattern_match("x_z", true),
+                                  _equals("42"), _pattern_match("^w", false)};
+    });
+    _check_same_result([this]() {
+        return std::vector<Expr*>{_equals("world"), _pattern_match("%o%", true), _pattern_match("1%", true)};
+    });
+}
+
+TEST_F(PatternOrCompoundPredicateTest, test_like_or_chain_with_null_pattern) {
+    // a null pattern keeps the chain from being rewritten, and makes the unmatched values null
+    _check_same_result([this]() {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::NULL_LITERAL);
+        node.__set_type(TypeDescriptor::create_varchar_type(64).to_thrift());
+        node.__set_num_children(0);
+        auto* like = _pattern_match("%abc%", true);
+        like->_children[1] = _pool.add(new VectorizedLiteral(node));
+        return std::vector<Expr*>{_pattern_match("x_z", true), like, _pattern_match("%0%", true)};
+    });
+}
+
 } // namespace starrocks
@@ -24,9 +24,11 @@
 #include "column/fixed_length_column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "gen_cpp/Exprs_types.h"
 #include "gutil/casts.h"
+#include "runtime/runtime_state.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
@@ -62,8 +64,29 @@ private:
     std::vector<TTypeDesc> tttype_desc;
     std::vector<TTypeDesc> tttype_desc1;
     TExprNode expr_node;
+    RuntimeState runtime_state;
 };
 
+// Evaluate the expression both interpreted and compiled by JIT, and check that they produce the same rows.
+template <LogicalType Type>
+static void verify_same_with_jit(Expr* expr, RuntimeState* state, size_t num_rows) {
+    state->set_jit_level(-1);
+    ASSERT_TRUE(expr->is_compilable(state));
+    ColumnPtr expected = expr->evaluate(nullptr, nullptr);
+    ASSERT_EQ(num_rows, expected->size());
+    ExprsTestHelper::verify_with_jit(expected, expr, state, [&](const ColumnPtr& ptr) {
+        ASSERT_EQ(num_rows, ptr->size());
+        ColumnViewer<Type> expected_viewer(expected);
+        ColumnViewer<Type> viewer(ptr);
+        for (size_t i = 0; i < num_rows; ++i) {
+            ASSERT_EQ(expected_viewer.is_null(i), viewer.is_null(i)) << "row " << i;
+            if (!expected_viewer.is_null(i)) {
+                ASSERT_EQ(expected_viewer.value(i), viewer.value(i)) << "row " << i;
+            }
+        }
+    });
+}
+
 TEST_F(VectorizedConditionExprTest, ifNullLArray) {
     expr_node.type = tttype_desc[1];
     auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_null_expr(expr_node));
@@ -479,4 +502,143 @@ TEST_F(VectorizedConditionExprTest, ifExpr) {
     }
 }
 
+TEST_F(VectorizedConditionExprTest, ifNullWithJit) {
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    expr_node.is_nullable = true;
+    MockNullVectorizedExpr<TYPE_BIGINT> lhs(expr_node, 10, 10);
+    MockNullVectorizedExpr<TYPE_BIGINT> nullable_rhs(expr_node, 10, 20);
+    expr_node.is_nullable = false;
+    MockConstVectorizedExpr<TYPE_BIGINT> const_rhs(expr_node, 30);
+
+    // ifnull(nullable, const)
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_null_expr(expr_node));
+        expr->_children.push_back(&lhs);
+        expr->_children.push_back(&const_rhs);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+    // ifnull(nullable, nullable), both of them are null in the odd rows
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_null_expr(expr_node));
+        expr->_children.push_back(&lhs);
+        expr->_children.push_back(&nullable_rhs);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+}
+
+TEST_F(VectorizedConditionExprTest, nullIfWithJit) {
+    // nullif(not nullable, const)
+    {
+        expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+        expr_node.is_nullable = false;
+        MockMultiVectorizedExpr<TYPE_BIGINT> lhs(expr_node, 10, 10, 20);
+        MockConstVectorizedExpr<TYPE_BIGINT> rhs(expr_node, 10);
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_null_if_expr(expr_node));
+        expr->_children.push_back(&lhs);
+        expr->_children.push_back(&rhs);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+    // nullif(nullable, nullable), lhs is null in the odd rows and rhs is null in the even rows
+    {
+        expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+        expr_node.is_nullable = true;
+        MockNullVectorizedExpr<TYPE_BIGINT> lhs(expr_node, 10, 10);
+        MockNullVectorizedExpr<TYPE_BIGINT> rhs(expr_node, 10, 10);
+        rhs.flag = 1;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_null_if_expr(expr_node));
+        expr->_children.push_back(&lhs);
+        expr->_children.push_back(&rhs);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+    // nullif(not nullable double, const double)
+    {
+        expr_node.type = gen_type_desc(TPrimitiveType::DOUBLE);
+        expr_node.is_nullable = false;
+        MockMultiVectorizedExpr<TYPE_DOUBLE> lhs(expr_node, 10, 1.5, 2.5);
+        MockConstVectorizedExpr<TYPE_DOUBLE> rhs(expr_node, 2.5);
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_null_if_expr(expr_node));
+        expr->_children.push_back(&lhs);
+        expr->_children.push_back(&rhs);
+        verify_same_with_jit<TYPE_DOUBLE>(expr.get(), &runtime_state, 10);
+    }
+}
+
+TEST_F(VectorizedConditionExprTest, ifWithJit) {
+    expr_node.is_nullable = true;
+    expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    // the null conditions take the else branch
+    MockNullVectorizedExpr<TYPE_BOOLEAN> nullable_cond(expr_node, 10, true);
+    expr_node.is_nullable = false;
+    MockMultiVectorizedExpr<TYPE_BOOLEAN> cond(expr_node, 10, true, false);
+
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    MockMultiVectorizedExpr<TYPE_INT> then_col(expr_node, 10, 1, 2);
+    MockConstVectorizedExpr<TYPE_INT> const_else(expr_node, 3);
+    expr_node.is_nullable = true;
+    MockNullVectorizedExpr<TYPE_INT> nullable_then(expr_node, 10, 4);
+    MockNullVectorizedExpr<TYPE_INT> nullable_else(expr_node, 10, 5);
+    nullable_else.flag = 1;
+
+    // if(nullable, not nullable, const)
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_expr(expr_node));
+        expr->_children.push_back(&nullable_cond);
+        expr->_children.push_back(&then_col);
+        expr->_children.push_back(&const_else);
+        verify_same_with_jit<TYPE_INT>(expr.get(), &runtime_state, 10);
+    }
+    // if(not nullable, nullable, nullable)
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_expr(expr_node));
+        expr->_children.push_back(&cond);
+        expr->_children.push_back(&nullable_then);
+        expr->_children.push_back(&nullable_else);
+        verify_same_with_jit<TYPE_INT>(expr.get(), &runtime_state, 10);
+    }
+}
+
+TEST_F(VectorizedConditionExprTest, coalesceWithJit) {
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    expr_node.is_nullable = true;
+    MockNullVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+    MockNullVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 20);
+    MockNullVectorizedExpr<TYPE_BIGINT> col3(expr_node, 10, 30);
+    col3.flag = 1;
+    expr_node.is_nullable = false;
+    MockConstVectorizedExpr<TYPE_BIGINT> const_col(expr_node, 40);
+
+    // coalesce(nullable, nullable, const)
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_coalesce_expr(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        expr->_children.push_back(&const_col);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+    // coalesce(nullable, nullable), both of them are null in the odd rows
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_coalesce_expr(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+    // coalesce(nullable, nullable, nullable), the third one isn't null in the odd rows
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_coalesce_expr(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        expr->_children.push_back(&col3);
+        verify_same_with_jit<TYPE_BIGINT>(expr.get(), &runtime_state, 10);
+    }
+}
+
 } // namespace starrocks
@@ -3130,6 +3130,59 @@ TEST_F(DecimalBinaryFunctionTest, test_decimal_fast_mul_64x64) {
                                                                                                 4, 38, 8);
 }
 
+// The overflow check is skipped when the magnitude of the operands proves no product overflows, the results
+// must be the same as the checked ones.
+TEST_F(DecimalBinaryFunctionTest, test_decimal128_mul_overflow_free) {
+    using ColumnWiseOp = UnpackConstColumnDecimalBinaryFunction<MulOp, OverflowMode::OUTPUT_NULL>;
+    const size_t num_rows = 1024;
+    auto lhs_column = Decimal128Column::create(38, 10, num_rows);
+    auto rhs_column = Decimal128Column::create(38, 4, num_rows);
+    auto& lhs_data = lhs_column->get_data();
+    auto& rhs_data = rhs_column->get_data();
+    std::mt19937_64 rand(0);
+    for (size_t i = 0; i < num_rows; ++i) {
+        lhs_data[i] = static_cast<int128_t>(static_cast<int64_t>(rand())) * (i % 2 == 0 ? 1 : -1);
+        rhs_data[i] = static_cast<int128_t>(static_cast<int32_t>(rand()));
+    }
+    lhs_data[0] = 0;
+    lhs_data[1] = std::numeric_limits<int64_t>::min();
+
+    auto check = [&](const ColumnPtr& result, size_t overflow_row) {
+        auto* data_column = ColumnHelper::cast_to_raw<TYPE_DECIMAL128>(ColumnHelper::get_data_column(result.get()));
+        ASSERT_EQ(num_rows, result->size());
+        ASSERT_EQ(14, data_column->scale());
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (i == overflow_row) {
+                ASSERT_TRUE(result->is_null(i));
+            } else {
+                ASSERT_FALSE(result->is_null(i));
+                ASSERT_EQ(lhs_data[i] * rhs_data[i], data_column->get_data()[i]);
+            }
+        }
+    };
+
+    auto result = ColumnWiseOp::evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(lhs_column, rhs_column);
+    ASSERT_FALSE(result->is_nullable());
+    check(result, num_rows);
+
+    // one large value forces the checked path, only its row overflows
+    lhs_data[7] = std::numeric_limits<int128_t>::max() / 2;
+    rhs_data[7] = 4;
+    result = ColumnWiseOp::evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(lhs_column, rhs_column);
+    ASSERT_TRUE(result->is_nullable());
+    check(result, 7);
+
+    // a const operand is only scanned once
+    auto const_column = Decimal128Column::create(38, 4, 1);
+    const_column->get_data()[0] = 3;
+    result = ColumnWiseOp::evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(
+            lhs_column, ConstColumn::create(const_column, num_rows));
+    ASSERT_TRUE(result->is_nullable());
+    ASSERT_TRUE(result->is_null(7));
+    auto* data_column = ColumnHelper::cast_to_raw<TYPE_DECIMAL128>(ColumnHelper::get_data_column(result.get()));
+    ASSERT_EQ(lhs_data[8] * 3, data_column->get_data()[8]);
+}
+
 TEST_F(DecimalBinaryFunctionTest, test_overflow_report_error) {
     ASSERT_THROW((test_overflow_report_error<TYPE_DECIMAL32, TYPE_DECIMAL32, TYPE_DECIMAL32, MulOp>(
                          "274.97790", "1.0000", 9, 5, 9, 4)),
@@ -20,13 +20,16 @@
 #include <cmath>
 
 #include "butil/time.h"
+#include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/cast_expr.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -307,4 +310,128 @@ TEST_F(VectorizedFunctionCallExprTest, prepare_close) {
     expr_context.close(&_runtime_state);
 }
 
+TEST_F(VectorizedFunctionCallExprTest, dictEvaluationTest) {
+    TFunction function;
+    TFunctionName functionName;
+    functionName.__set_db_name("db");
+    functionName.__set_function_name("url_extract_host");
+
+    function.__set_name(functionName);
+    function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    function.__set_has_var_args(false);
+    function.__set_fid(30412);
+
+    expr_node.__set_fn(function);
+    expr_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+
+    std::vector<std::string> urls = {"https://starrocks.io/docs", "http://www.example.com:8080/a?b=c", "not a url",
+                                     "https://a.b.c/"};
+    auto repetitive = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    // nullable without any null
+    auto repetitive_not_null = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto distinct = BinaryColumn::create();
+    for (int i = 0; i < 1024; i++) {
+        if (i % 7 == 0) {
+            repetitive->append_nulls(1);
+        } else {
+            repetitive->append_datum(Slice(urls[i % urls.size()]));
+        }
+        repetitive_not_null->append_datum(Slice(urls[i % urls.size()]));
+        distinct->append("https://host" + std::to_string(i) + ".com/path");
+    }
+
+    double old_ratio = config::function_dict_eval_max_distinct_ratio;
+    DeferOp defer([&]() { config::function_dict_eval_max_distinct_ratio = old_ratio; });
+    for (const ColumnPtr& input : std::vector<ColumnPtr>{repetitive, repetitive_not_null, distinct}) {
+        std::vector<ColumnPtr> results;
+        for (double ratio : {0.25, 0.0}) {
+            config::function_dict_eval_max_distinct_ratio = ratio;
+            VectorizedFunctionCallExpr expr(expr_node);
+            MockExpr col(TypeDescriptor(TYPE_VARCHAR), input);
+            expr.add_child(&col);
+
+            ExprContext exprContext(&expr);
+            std::vector<ExprContext*> expr_ctxs = {&exprContext};
+            ASSERT_OK(Expr::prepare(expr_ctxs, &_runtime_state));
+            ASSERT_OK(Expr::open(expr_ctxs, &_runtime_state));
+            ASSIGN_OR_ABORT(auto result, exprContext.evaluate(&expr, nullptr));
+            results.emplace_back(result);
+            Expr::close(expr_ctxs, &_runtime_state);
+        }
+        // the results over the distinct values are the same as the row by row ones
+        ASSERT_EQ(input->size(), results[0]->size());
+        ASSERT_EQ(input->size(), results[1]->size());
+        if (input->is_nullable()) {
+            ASSERT_TRUE(results[0]->is_nullable());
+        }
+        for (size_t i = 0; i < input->size(); i++) {
+            ASSERT_EQ(results[1]->debug_item(i), results[0]->debug_item(i));
+        }
+    }
+}
+
+TEST_F(VectorizedFunctionCallExprTest, dictEvaluationBackoffTest) {
+    TFunction function;
+    TFunctionName functionName;
+    functionName.__set_db_name("db");
+    functionName.__set_function_name("url_extract_host");
+
+    function.__set_name(functionName);
+    function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    function.__set_has_var_args(false);
+    function.__set_fid(30412);
+
+    expr_node.__set_fn(function);
+    expr_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+
+    auto repetitive = BinaryColumn::create();
+    auto distinct = BinaryColumn::create();
+    for (int i = 0; i < 1024; i++) {
+        repetitive->append("https://host" + std::to_string(i % 4) + ".com/path");
+        distinct->append("https://host" + std::to_string(i) + ".com/path");
+    }
+
+    double old_ratio = config::function_dict_eval_max_distinct_ratio;
+    DeferOp defer([&]() { config::function_dict_eval_max_distinct_ratio = old_ratio; });
+    config::function_dict_eval_max_distinct_ratio = 0.25;
+    VectorizedFunctionCallExpr expr(expr_node);
+    MockExpr col(TypeDescriptor(TYPE_VARCHAR), distinct);
+    expr.add_child(&col);
+    ExprContext exprContext(&expr);
+    std::vector<ExprContext*> expr_ctxs = {&exprContext};
+    ASSERT_OK(Expr::prepare(expr_ctxs, &_runtime_state));
+    ASSERT_OK(Expr::open(expr_ctxs, &_runtime_state));
+    auto evaluate = [&]() {
+        ASSIGN_OR_ABORT(auto result, exprContext.evaluate(&expr, nullptr));
+        ASSERT_EQ(1024, result->size());
+    };
+
+    // a high cardinality chunk skips the distinct values of the next 2 chunks, then of the next 4
+    evaluate();
+    ASSERT_EQ(1, expr._dict_eval_backoff.fallbacks.load());
+    ASSERT_EQ(2, expr._dict_eval_backoff.skip_chunks.load());
+    evaluate();
+    evaluate();
+    ASSERT_EQ(0, expr._dict_eval_backoff.skip_chunks.load());
+    evaluate();
+    ASSERT_EQ(2, expr._dict_eval_backoff.fallbacks.load());
+    ASSERT_EQ(4, expr._dict_eval_backoff.skip_chunks.load());
+
+    // the backoff is bounded
+    for (int i = 0; i < 1000; i++) {
+        evaluate();
+    }
+    ASSERT_EQ(VectorizedFunctionCallExpr::DictEvalBackoff::kMaxShift, expr._dict_eval_backoff.fallbacks.load());
+    ASSERT_LE(expr._dict_eval_backoff.skip_chunks.load(), 1 << VectorizedFunctionCallExpr::DictEvalBackoff::kMaxShift);
+
+    // a repetitive chunk after the skipped ones resets it
+    col._column = repetitive;
+    expr._dict_eval_backoff.skip_chunks.store(0);
+    evaluate();
+    ASSERT_EQ(0, expr._dict_eval_backoff.fallbacks.load());
+    ASSERT_EQ(0, expr._dict_eval_backoff.skip_chunks.load());
+
+    Expr::close(expr_ctxs, &_runtime_state);
+}
+
 } // namespace starrocks
@@ -15,6 +15,8 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "butil/time.h"
 #include "column/column_hash.h"
 #include "column/fixed_length_column.h"
@@ -22,6 +24,7 @@
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -200,4 +203,47 @@ TEST_F(JITFunctionCacheTest, cache) {
         }
     }
 }
+
+// The query starts with the original expr, and swaps in the function compiled in the background at a chunk boundary.
+TEST_F(JITFunctionCacheTest, async_compile) {
+    if (!engine->support_jit()) {
+        return;
+    }
+    config::jit_async_compile = true;
+    DeferOp defer([]() { config::jit_async_compile = false; });
+
+    expr_node.opcode = TExprOpcode::MULTIPLY;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    MockVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 3);
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 4);
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    runtime_state.set_jit_level(-1);
+    ObjectPool pool;
+    auto* jit_expr = JITExpr::create(&pool, expr.get());
+    jit_expr->set_uncompilable_children(&runtime_state);
+    ExprContext expr_ctx(jit_expr);
+    std::vector<ExprContext*> expr_ctxs = {&expr_ctx};
+    ASSERT_OK(Expr::prepare(expr_ctxs, &runtime_state));
+    ASSERT_OK(Expr::open(expr_ctxs, &runtime_state));
+
+    auto check = [](const ColumnPtr& ptr) {
+        auto v = std::static_pointer_cast<Int64Column>(ptr);
+        ASSERT_EQ(10, v->size());
+        for (int j = 0; j < v->size(); ++j) {
+            ASSERT_EQ(12, v->get_data()[j]);
+        }
+    };
+    for (int i = 0; i < 1000 && !jit_expr->is_jit_compiled(); i++) {
+        ASSERT_TRUE(jit_expr->is_async_compiling());
+        check(jit_expr->evaluate(&expr_ctx, nullptr));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(jit_expr->is_jit_compiled());
+    check(jit_expr->evaluate(&expr_ctx, nullptr));
+    Expr::close(expr_ctxs, &runtime_state);
+}
+
 } // namespace starrocks
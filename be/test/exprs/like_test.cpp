@@ -694,4 +694,31 @@ TEST_F(LikeTest, splitLikePatternIntoNgramSet) {
     VectorizedFunctionCallExpr::split_like_string_to_ngram(pattern, options, ngram_set);
     ASSERT_EQ(0, ngram_set.size());
 }
+
+TEST_F(LikeTest, multiPatternMatch) {
+    MultiPatternMatcher matcher;
+    ASSERT_TRUE(matcher.compile({{"%abc%", true}, {"x_z", true}, {"100\\%", true}, {"^[0-9]+$", false}}).ok());
+
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    std::vector<std::string> values = {"123abc456", "xyz", "xyzz", "100%", "1000", "42", "", "ab c"};
+    for (const auto& v : values) {
+        str->append_datum(Datum(Slice(v)));
+    }
+    str->append_nulls(1);
+
+    auto result = matcher.match(str);
+    ASSERT_TRUE(result.ok());
+    ColumnViewer<TYPE_BOOLEAN> viewer(result.value());
+    std::vector<bool> expected = {true, true, false, true, true, true, false, false};
+    ASSERT_EQ(expected.size() + 1, viewer.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_FALSE(viewer.is_null(i));
+        ASSERT_EQ(expected[i], viewer.value(i)) << values[i];
+    }
+    ASSERT_TRUE(viewer.is_null(expected.size()));
+
+    // an invalid regex fails the compilation, the predicates are evaluated one by one then
+    MultiPatternMatcher invalid;
+    ASSERT_FALSE(invalid.compile({{"%a%", true}, {"(", false}}).ok());
+}
 } // namespace starrocks
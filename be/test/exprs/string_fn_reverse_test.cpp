@@ -89,4 +89,43 @@ TEST_F(StringFunctionReverseTest, reverseUtf8Test) {
     }
 }
 
+TEST_F(StringFunctionReverseTest, reverseMixedUtf8Test) {
+    // long ascii runs between multi-byte chars, so both the ascii chunks and the utf8 chunks are reversed
+    std::vector<std::string> chars;
+    for (int j = 0; j < 100; ++j) {
+        if (j % 23 == 0) {
+            chars.emplace_back("博");
+        } else if (j % 37 == 0) {
+            chars.emplace_back("é");
+        } else {
+            chars.emplace_back(1, 'a' + j % 26);
+        }
+    }
+
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    Columns columns;
+    auto str = BinaryColumn::create();
+    std::vector<std::string> expects;
+    for (int j = 0; j < chars.size(); ++j) {
+        std::string s;
+        std::string expect;
+        for (int k = 0; k < j; ++k) {
+            s.append(chars[k]);
+            expect.append(chars[j - 1 - k]);
+        }
+        str->append(s);
+        expects.emplace_back(std::move(expect));
+    }
+
+    columns.emplace_back(str);
+
+    ColumnPtr result = StringFunctions::reverse(ctx.get(), columns).value();
+    ASSERT_EQ(str->size(), result->size());
+
+    auto v = ColumnHelper::cast_to<TYPE_VARCHAR>(result);
+    for (auto i = 0; i < str->size(); ++i) {
+        ASSERT_EQ(expects[i], v->get_data()[i].to_string());
+    }
+}
+
 } // namespace starrocks
@@ -286,6 +286,55 @@ PARALLEL_TEST(VecStringFunctionsTest, substrConstUtf8Test) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, substrConstMixedUtf8Test) {
+    // ascii runs longer than a simd chunk between multi-byte chars
+    std::vector<std::string> chars;
+    for (int i = 0; i < 80; ++i) {
+        if (i % 19 == 0) {
+            chars.emplace_back("博");
+        } else if (i % 31 == 0) {
+            chars.emplace_back("😀");
+        } else {
+            chars.emplace_back(1, '0' + i % 10);
+        }
+    }
+    std::string s;
+    for (const auto& c : chars) {
+        s.append(c);
+    }
+    auto expect_substr = [&](int off, int len) {
+        int num_chars = chars.size();
+        int from = off > 0 ? off - 1 : num_chars + off;
+        std::string expect;
+        if (off == 0 || from < 0 || from >= num_chars) {
+            return expect;
+        }
+        for (int i = from; i < std::min(num_chars, from + len); ++i) {
+            expect.append(chars[i]);
+        }
+        return expect;
+    };
+
+    auto str = BinaryColumn::create();
+    str->append(s);
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto state = std::make_unique<SubstrState>();
+    ctx->set_function_state(FunctionContext::FRAGMENT_LOCAL, state.get());
+    starrocks::Columns columns;
+    columns.emplace_back(str);
+    for (int offset : {1, 2, 17, 20, 33, 50, 80, 81, -1, -16, -17, -40, -80, -81}) {
+        for (int len : {1, 15, 16, 17, 40, 100}) {
+            state->is_const = true;
+            state->pos = offset;
+            state->len = len;
+            ColumnPtr result = StringFunctions::substring(ctx.get(), columns).value();
+            auto* binary = down_cast<BinaryColumn*>(result.get());
+            ASSERT_EQ(binary->size(), 1);
+            ASSERT_EQ(binary->get_slice(0).to_string(), expect_substr(offset, len)) << offset << ", " << len;
+        }
+    }
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, substringOverleftTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
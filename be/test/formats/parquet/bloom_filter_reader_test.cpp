@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter_reader.h"
+
+#include <gtest/gtest.h>
+
+#include "formats/parquet/parquet_ut_base.h"
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+class ParquetBloomFilterTest : public testing::Test {
+public:
+    void SetUp() override { _runtime_state = _pool.add(new RuntimeState(TQueryGlobals())); }
+
+protected:
+    static std::string serialize_header(int32_t num_bytes) {
+        tparquet::BloomFilterHeader header;
+        header.numBytes = num_bytes;
+        header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+        header.hash.__set_XXHASH(tparquet::XxHash());
+        header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* buffer = nullptr;
+        CHECK(ser.serialize(&header, &len, &buffer).ok());
+        return std::string((char*)buffer, len);
+    }
+
+    RuntimeState* _runtime_state = nullptr;
+    ObjectPool _pool;
+};
+
+TEST_F(ParquetBloomFilterTest, test_read_and_probe) {
+    // one small filter that fits in the header read and one that needs a second read
+    for (int32_t num_bytes : {32, 4096}) {
+        ParquetBloomFilter writer(std::string(num_bytes, '\0'));
+        for (int32_t i = 0; i < 100; i++) {
+            writer.insert_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+        }
+
+        std::string padding(10, 'x');
+        std::string buffer = padding + serialize_header(num_bytes);
+        buffer.append(writer.bitset());
+        size_t file_size = buffer.size();
+        RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+
+        ASSIGN_OR_ABORT(auto bloom_filter, ParquetBloomFilter::read(&file, file_size, padding.size()));
+        ASSERT_EQ(num_bytes, bloom_filter->num_bytes());
+        for (int32_t i = 0; i < 100; i++) {
+            ASSERT_TRUE(bloom_filter->test_hash(ParquetBloomFilter::hash(&i, sizeof(i))));
+        }
+        if (num_bytes > 32) {
+            int false_positives = 0;
+            for (int32_t i = 100; i < 1100; i++) {
+                false_positives += bloom_filter->test_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+            }
+            ASSERT_LT(false_positives, 50);
+        }
+    }
+}
+
+TEST_F(ParquetBloomFilterTest, test_read_invalid) {
+    std::string buffer = serialize_header(100);
+    buffer.append(std::string(100, '\0'));
+    size_t file_size = buffer.size();
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+    // size is not a multiple of the block size
+    ASSERT_FALSE(ParquetBloomFilter::read(&file, file_size, 0).ok());
+    ASSERT_FALSE(ParquetBloomFilter::read(&file, file_size, file_size).ok());
+}
+
+TEST_F(ParquetBloomFilterTest, test_hash_predicate_values) {
+    std::set<int32_t> in_oprands{2, 3, 7};
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::create_in_predicate_int_conjunct_ctxs(TExprOpcode::FILTER_IN, 0, in_oprands, &t_conjuncts);
+    ParquetUTBase::create_in_predicate_int_conjunct_ctxs(TExprOpcode::FILTER_NOT_IN, 0, in_oprands, &t_conjuncts);
+    std::vector<ExprContext*> ctxs;
+    ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctxs);
+    ASSERT_EQ(2, ctxs.size());
+
+    ParquetField field;
+    field.physical_type = tparquet::Type::type::INT32;
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(ParquetBloomFilter::hash_predicate_values(ctxs[0], field, &hashes));
+    ASSERT_EQ(3, hashes.size());
+    int32_t v = 7;
+    ASSERT_TRUE(std::find(hashes.begin(), hashes.end(), ParquetBloomFilter::hash(&v, sizeof(v))) != hashes.end());
+
+    // NOT IN can't be checked with a bloom filter
+    hashes.clear();
+    ASSERT_FALSE(ParquetBloomFilter::hash_predicate_values(ctxs[1], field, &hashes));
+
+    // values stored with a different physical type are hashed differently
+    field.physical_type = tparquet::Type::type::INT64;
+    ASSERT_FALSE(ParquetBloomFilter::hash_predicate_values(ctxs[0], field, &hashes));
+
+    // dates are stored as INT32 but read with a conversion
+    field.physical_type = tparquet::Type::type::INT32;
+    field.schema_element.__set_converted_type(tparquet::ConvertedType::DATE);
+    ASSERT_FALSE(ParquetBloomFilter::hash_predicate_values(ctxs[0], field, &hashes));
+}
+
+} // namespace starrocks::parquet
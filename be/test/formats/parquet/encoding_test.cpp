@@ -18,6 +18,7 @@
 
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 
@@ -356,6 +357,57 @@ TEST_F(ParquetEncodingTest, Int32) {
     }
 }
 
+TEST_F(ParquetEncodingTest, Int32DictWithNulls) {
+    std::vector<uint16_t> is_nulls;
+    std::vector<int32_t> values;
+    for (int i = 0; i < 1000; i++) {
+        // mix single nulls, long null runs and long value runs
+        bool is_null = (i % 7 == 0) || (i >= 300 && i < 400);
+        is_nulls.push_back(is_null);
+        if (!is_null) {
+            values.push_back(i % 13);
+        }
+    }
+
+    DictEncoder<int32_t> encoder;
+    ASSERT_TRUE(encoder.append(reinterpret_cast<uint8_t*>(values.data()), values.size()).ok());
+    Slice data = encoder.build();
+    PlainEncoder<int32_t> dict_encoder;
+    size_t num_dicts = 0;
+    ASSERT_TRUE(encoder.encode_dict(&dict_encoder, &num_dicts).ok());
+    Slice dict_data = dict_encoder.build();
+
+    auto decode = [&](bool fused, size_t batch_size) {
+        PlainDecoder<int32_t> dict_page_decoder;
+        CHECK(dict_page_decoder.set_data(dict_data).ok());
+        DictDecoder<int32_t> decoder;
+        CHECK(decoder.set_dict(config::vector_chunk_size, num_dicts, &dict_page_decoder).ok());
+        CHECK(decoder.set_data(data).ok());
+        auto column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (size_t offset = 0; offset < is_nulls.size(); offset += batch_size) {
+            size_t count = std::min(batch_size, is_nulls.size() - offset);
+            Status st = fused ? decoder.next_batch_with_nulls(count, &is_nulls[offset], VALUE, column.get())
+                              : decoder.Decoder::next_batch_with_nulls(count, &is_nulls[offset], VALUE, column.get());
+            CHECK(st.ok()) << st;
+        }
+        return column;
+    };
+
+    for (size_t batch_size : {1, 7, 100, 1000}) {
+        auto expected = decode(false, batch_size);
+        auto actual = decode(true, batch_size);
+        ASSERT_EQ(is_nulls.size(), actual->size());
+        ASSERT_TRUE(actual->has_null());
+        for (size_t i = 0; i < is_nulls.size(); i++) {
+            ASSERT_EQ(expected->is_null(i), actual->is_null(i)) << i;
+            ASSERT_EQ(is_nulls[i] != 0, actual->is_null(i)) << i;
+            if (!actual->is_null(i)) {
+                ASSERT_EQ(expected->get(i).get_int32(), actual->get(i).get_int32()) << i;
+            }
+        }
+    }
+}
+
 TEST_F(ParquetEncodingTest, String) {
     std::vector<std::string> values;
     for (int i = 0; i < 20; i++) {
@@ -27,16 +27,22 @@
 #include "exec/hdfs_scanner.h"
 #include "exprs/binary_predicate.h"
 #include "exprs/expr_context.h"
+#include "formats/parquet/bloom_filter_reader.h"
 #include "formats/parquet/column_chunk_reader.h"
 #include "formats/parquet/metadata.h"
 #include "formats/parquet/page_reader.h"
 #include "formats/parquet/parquet_test_util/util.h"
 #include "formats/parquet/parquet_ut_base.h"
 #include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
 #include "io/shared_buffered_input_stream.h"
+#include "io/string_input_stream.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
+#include "util/coding.h"
+#include "util/defer_op.h"
+#include "util/thrift_util.h"
 
 namespace starrocks::parquet {
 
@@ -1072,6 +1078,78 @@ TEST_F(FileReaderTest, TestSkipRowGroup) {
     ASSERT_TRUE(status.is_end_of_file());
 }
 
+TEST_F(FileReaderTest, TestBloomFilterSkipRowGroup) {
+    // file2 has a single row group with c1 in [0, 9]. Put a bloom filter of c1 holding only 2 in front of the
+    // footer, so that c1 = 5 passes the min/max check but not the bloom filter.
+    ASSIGN_OR_ABORT(std::string data, _create_file(_file2_path)->read_all());
+    uint32_t footer_size = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data.data()) + data.size() - 8);
+    size_t footer_offset = data.size() - 8 - footer_size;
+    tparquet::FileMetaData file_metadata;
+    ASSERT_OK(deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(data.data()) + footer_offset, &footer_size,
+                                     TProtocolType::COMPACT, &file_metadata));
+    ASSERT_EQ(1, file_metadata.row_groups.size());
+    data.resize(footer_offset);
+
+    ParquetBloomFilter bloom_filter(std::string(4096, '\0'));
+    int32_t value = 2;
+    bloom_filter.insert_hash(ParquetBloomFilter::hash(&value, sizeof(value)));
+    value = 5;
+    ASSERT_FALSE(bloom_filter.test_hash(ParquetBloomFilter::hash(&value, sizeof(value))));
+    tparquet::BloomFilterHeader header;
+    header.numBytes = bloom_filter.num_bytes();
+    header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(tparquet::XxHash());
+    header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+    ThriftSerializer ser(true, 100);
+    std::string header_buffer;
+    ASSERT_OK(ser.serialize(&header, &header_buffer));
+    file_metadata.row_groups[0].columns[0].meta_data.__set_bloom_filter_offset(data.size());
+    data.append(header_buffer).append(bloom_filter.bitset());
+
+    std::string footer_buffer;
+    ASSERT_OK(ser.serialize(&file_metadata, &footer_buffer));
+    data.append(footer_buffer);
+    put_fixed32_le(&data, footer_buffer.size());
+    data.append("PAR1");
+
+    auto read_with_eq = [&](int32_t c1, bool enable_bloom_filter, size_t* num_rows) -> int64_t {
+        auto old_enable = config::parquet_reader_bloom_filter_enable;
+        config::parquet_reader_bloom_filter_enable = enable_bloom_filter;
+        DeferOp defer([&]() { config::parquet_reader_bloom_filter_enable = old_enable; });
+
+        RandomAccessFile file(std::make_shared<io::StringInputStream>(data), "bloom_filter_test.parquet");
+        auto file_reader =
+                std::make_shared<FileReader>(config::vector_chunk_size, &file, data.size(), _mock_datacache_options());
+        auto* ctx = _create_file2_base_context();
+        ctx->scan_range->file_length = data.size();
+        ctx->scan_range->length = data.size();
+        _create_int_conjunct_ctxs(TExprOpcode::EQ, 0, c1, &ctx->conjunct_ctxs_by_slot[0]);
+        int64_t skip = ctx->stats->group_bloom_filter_skip;
+        CHECK(file_reader->init(ctx).ok());
+
+        *num_rows = 0;
+        while (true) {
+            auto chunk = _create_chunk();
+            Status status = file_reader->get_next(&chunk);
+            if (status.is_end_of_file()) break;
+            CHECK(status.ok()) << status;
+            *num_rows += chunk->num_rows();
+        }
+        return ctx->stats->group_bloom_filter_skip - skip;
+    };
+
+    size_t num_rows = 0;
+    ASSERT_EQ(0, read_with_eq(2, true, &num_rows));
+    size_t num_rows_without_filter = 0;
+    ASSERT_EQ(0, read_with_eq(2, false, &num_rows_without_filter));
+    ASSERT_EQ(num_rows_without_filter, num_rows);
+
+    ASSERT_EQ(1, read_with_eq(5, true, &num_rows));
+    ASSERT_EQ(0, num_rows);
+    // off by default, the row group is read
+    ASSERT_EQ(0, read_with_eq(5, false, &num_rows));
+}
+
 TEST_F(FileReaderTest, TestMultiFilterWithMultiPage) {
     auto file = _create_file(_file3_path);
     auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
@@ -1107,6 +1185,39 @@ TEST_F(FileReaderTest, TestMultiFilterWithMultiPage) {
     ASSERT_TRUE(status.is_end_of_file() || status.ok());
 }
 
+TEST_F(FileReaderTest, TestDecompressedPageCache) {
+    int64_t old_capacity = config::parquet_page_cache_capacity;
+    config::parquet_page_cache_capacity = 64 * 1024 * 1024;
+    DeferOp defer([&]() { config::parquet_page_cache_capacity = old_capacity; });
+
+    // the pages of file3 are snappy compressed, the second read is served from the cache
+    std::vector<std::string> rows[2];
+    int64_t hit_counts[2];
+    for (int i = 0; i < 2; i++) {
+        auto file = _create_file(_file3_path);
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                        std::filesystem::file_size(_file3_path),
+                                                        _mock_datacache_options());
+        auto* ctx = _create_context_for_multi_filter();
+        ASSERT_OK(file_reader->init(ctx));
+
+        int64_t hit_count = ctx->stats->page_cache_hit_count;
+        auto chunk = _create_multi_page_chunk();
+        Status status;
+        while ((status = file_reader->get_next(&chunk)).ok()) {
+            for (int j = 0; j < chunk->num_rows(); ++j) {
+                rows[i].emplace_back(chunk->debug_row(j));
+            }
+            chunk = _create_multi_page_chunk();
+        }
+        ASSERT_TRUE(status.is_end_of_file());
+        hit_counts[i] = ctx->stats->page_cache_hit_count - hit_count;
+    }
+    ASSERT_FALSE(rows[0].empty());
+    ASSERT_EQ(rows[0], rows[1]);
+    ASSERT_GT(hit_counts[1], hit_counts[0]);
+}
+
 TEST_F(FileReaderTest, TestOtherFilterWithMultiPage) {
     auto file = _create_file(_file3_path);
     auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+
 namespace starrocks {
 
 class EncryptionTest : public testing::Test {
@@ -49,4 +52,40 @@ TEST_F(EncryptionTest, WrapKeyAES128) {
     ASSERT_EQ(_plain_key, ret.value());
 }
 
+// Decrypting the plaintext of a CTR cipher gives its ciphertext.
+static std::string ctr_transform(const std::string& data, const FileEncryptionInfo& info) {
+    EncryptSeekableInputStream stream(std::make_unique<io::StringInputStream>(data), info);
+    std::string out(data.size(), '\0');
+    CHECK(stream.read_at_fully(0, out.data(), out.size()).ok());
+    return out;
+}
+
+TEST_F(EncryptionTest, DecryptWithAlternatingKeys) {
+    std::string plain(1000, '\0');
+    for (size_t i = 0; i < plain.size(); i++) {
+        plain[i] = static_cast<char>(i * 31 + 7);
+    }
+    std::string other_key(16, '\0');
+    ssl_random_bytes(other_key.data(), 16);
+    FileEncryptionInfo info1(AES_128, _plain_key);
+    FileEncryptionInfo info2(AES_128, other_key);
+    std::string cipher1 = ctr_transform(plain, info1);
+    std::string cipher2 = ctr_transform(plain, info2);
+    ASSERT_NE(plain, cipher1);
+    ASSERT_NE(cipher1, cipher2);
+
+    EncryptSeekableInputStream stream1(std::make_unique<io::StringInputStream>(cipher1), info1);
+    EncryptSeekableInputStream stream2(std::make_unique<io::StringInputStream>(cipher2), info2);
+    // unaligned ranges, the key of the thread's cipher context switches on every read
+    for (auto [offset, count] : std::vector<std::pair<int64_t, int64_t>>{{0, 16}, {5, 100}, {17, 3}, {500, 500}}) {
+        std::string buf(count, '\0');
+        ASSERT_OK(stream1.read_at_fully(offset, buf.data(), count));
+        ASSERT_EQ(plain.substr(offset, count), buf);
+        ASSERT_OK(stream1.read_at_fully(offset, buf.data(), count));
+        ASSERT_EQ(plain.substr(offset, count), buf);
+        ASSERT_OK(stream2.read_at_fully(offset, buf.data(), count));
+        ASSERT_EQ(plain.substr(offset, count), buf);
+    }
+}
+
 } // namespace starrocks
@@ -18,6 +18,7 @@
 
 #include <filesystem>
 
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "testutil/sync_point.h"
 #include "util/defer_op.h"
@@ -39,6 +40,8 @@ public:
     void TearDown() override { ASSERT_TRUE(fs::remove_all(_root_path).ok()); }
 
     void create_file_and_destroy();
+    void read_with_file_handle_cache();
+    void read_rewritten_file_with_file_handle_cache();
 
 public:
     std::string _root_path;
@@ -76,4 +79,78 @@ TEST_F(HdfsFileSystemTest, create_file_and_destroy) {
     thread.join();
 }
 
+void HdfsFileSystemTest::read_with_file_handle_cache() {
+    auto fs = new_fs_hdfs(FSOptions());
+    std::string filepath = "file://" + _root_path + "/read_with_file_handle_cache";
+    const std::string content = "0123456789";
+    {
+        auto wfile = fs->new_writable_file(filepath);
+        ASSERT_TRUE(wfile.ok());
+        ASSERT_TRUE((*wfile)->append(content).ok());
+        ASSERT_TRUE((*wfile)->close().ok());
+    }
+
+    config::hdfs_file_handle_cache_capacity = 16;
+    DeferOp defer([]() { config::hdfs_file_handle_cache_capacity = 0; });
+    // the second file reuses the handle opened by the first one, which outlives both
+    for (int i = 0; i < 3; i++) {
+        auto rfile = fs->new_random_access_file(filepath);
+        ASSERT_TRUE(rfile.ok());
+        (*rfile)->set_size(content.size());
+        char buf[4];
+        ASSERT_TRUE((*rfile)->read_at_fully(3 + i, buf, sizeof(buf)).ok());
+        ASSERT_EQ(content.substr(3 + i, sizeof(buf)), std::string(buf, sizeof(buf)));
+    }
+}
+
+TEST_F(HdfsFileSystemTest, read_with_file_handle_cache) {
+    auto thread = std::thread([this] { read_with_file_handle_cache(); });
+    thread.join();
+}
+
+void HdfsFileSystemTest::read_rewritten_file_with_file_handle_cache() {
+    auto fs = new_fs_hdfs(FSOptions());
+    std::string filepath = "file://" + _root_path + "/read_rewritten_file_with_file_handle_cache";
+    auto write_file = [&](const std::string& content) {
+        auto wfile = fs->new_writable_file(filepath);
+        ASSERT_TRUE(wfile.ok());
+        ASSERT_TRUE((*wfile)->append(content).ok());
+        ASSERT_TRUE((*wfile)->close().ok());
+    };
+    auto read_file = [&](int64_t modification_time, size_t size) {
+        RandomAccessFileOptions opts;
+        opts.modification_time = modification_time;
+        auto rfile = fs->new_random_access_file(opts, filepath);
+        EXPECT_TRUE(rfile.ok());
+        (*rfile)->set_size(size);
+        std::string buf(size, '\0');
+        EXPECT_TRUE((*rfile)->read_at_fully(0, buf.data(), size).ok());
+        return buf;
+    };
+
+    config::hdfs_file_handle_cache_capacity = 16;
+    DeferOp defer([]() { config::hdfs_file_handle_cache_capacity = 0; });
+    write_file("0123456789");
+    ASSERT_EQ("0123456789", read_file(1, 10));
+    // the rewritten file has the same size, and is told apart by its modification time
+    write_file("abcdefghij");
+    ASSERT_EQ("abcdefghij", read_file(2, 10));
+}
+
+TEST_F(HdfsFileSystemTest, read_rewritten_file_with_file_handle_cache) {
+    auto thread = std::thread([this] { read_rewritten_file_with_file_handle_cache(); });
+    thread.join();
+}
+
+// It disables the file handle cache for the rest of the process.
+TEST_F(HdfsFileSystemTest, close_file_handle_cache) {
+    auto thread = std::thread([this] {
+        read_with_file_handle_cache();
+        close_hdfs_file_handle_cache();
+        // the files are opened without the cache after it is closed
+        read_with_file_handle_cache();
+    });
+    thread.join();
+}
+
 } // namespace starrocks
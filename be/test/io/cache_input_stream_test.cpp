@@ -183,6 +183,39 @@ TEST_F(CacheInputStreamTest, test_random_read) {
     ASSERT_EQ(stats.read_cache_count, 2);
 }
 
+TEST_F(CacheInputStreamTest, test_sequential_read_ahead) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 6;
+
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const std::string file_name = "test_file_read_ahead";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_read_ahead_blocks(2);
+
+    for (int i = 0; i < block_count; ++i) {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    // block 0 alone, then 1-3 and 4-5 as the reads became sequential
+    ASSERT_EQ(3, sb_stream->direct_io_count());
+
+    // a random read doesn't read ahead
+    char buffer[block_size];
+    read_stream_data(&cache_stream, 0, block_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, block_size, 'a'));
+    ASSERT_EQ(4, sb_stream->direct_io_count());
+    ASSERT_EQ(block_size * (block_count + 1), sb_stream->direct_io_bytes());
+}
+
 TEST_F(CacheInputStreamTest, test_file_overwrite) {
     CacheOptions options = cache_options();
     ASSERT_OK(BlockCache::instance()->init(options));
@@ -0,0 +1,38 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::io {
+
+TEST(IOLatencyHistogramTest, test_add) {
+    IOLatencyHistogram histogram;
+    histogram.add(0);
+    histogram.add(999'999);
+    histogram.add(1'000'000);
+    histogram.add(50'000'000);
+    histogram.add(999'999'999);
+    histogram.add(1'000'000'000);
+    histogram.add(60'000'000'000);
+
+    ASSERT_EQ(2, histogram.counts[0]);
+    ASSERT_EQ(1, histogram.counts[1]);
+    ASSERT_EQ(1, histogram.counts[2]);
+    ASSERT_EQ(1, histogram.counts[3]);
+    ASSERT_EQ(2, histogram.counts[4]);
+}
+
+} // namespace starrocks::io
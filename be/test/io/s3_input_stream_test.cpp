@@ -26,7 +26,10 @@
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "runtime/exec_env.h"
 #include "testutil/assert.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -189,6 +192,53 @@ TEST_F(S3InputStreamTest, test_read_at) {
     ASSERT_FALSE(f->read_at(-1, buf, sizeof(buf)).ok());
 }
 
+TEST_F(S3InputStreamTest, test_read_all_with_size) {
+    auto f = new_random_access_file();
+    f->set_size(std::string_view(kObjectContent).size());
+    ASSIGN_OR_ABORT(auto s, f->read_all());
+    EXPECT_EQ(kObjectContent, s);
+}
+
+TEST_F(S3InputStreamTest, test_hedged_read) {
+    config::object_storage_hedge_read_enable = true;
+    // every read is hedged
+    config::object_storage_hedge_read_min_delay_ms = 0;
+    auto f = new_random_access_file();
+    char buf[6];
+    for (int i = 0; i < 10; i++) {
+        ASSIGN_OR_ABORT(auto r, f->read_at(3, buf, sizeof(buf)));
+        ASSERT_EQ("345678", std::string_view(buf, r));
+    }
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("9", std::string_view(buf, r));
+    config::object_storage_hedge_read_enable = false;
+    config::object_storage_hedge_read_min_delay_ms = 50;
+}
+
+TEST_F(S3InputStreamTest, test_hedged_read_with_busy_pool) {
+    config::object_storage_hedge_read_enable = true;
+    config::object_storage_hedge_read_min_delay_ms = 0;
+    // a single thread, the hedged GET is rejected while the first one runs
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("hedge_read_test").set_max_threads(1).set_max_queue_size(0).build(&pool));
+    std::swap(ExecEnv::GetInstance()->_object_storage_hedge_read_pool, pool);
+    auto f = new_random_access_file();
+    char buf[6];
+    ASSIGN_OR_ABORT(auto r, f->read_at(3, buf, sizeof(buf)));
+    ASSERT_EQ("345678", std::string_view(buf, r));
+
+    // no free thread at all, the read doesn't wait for one
+    CountDownLatch latch(1);
+    ASSERT_OK(ExecEnv::GetInstance()->object_storage_hedge_read_pool()->submit_func([&]() { latch.wait(); }));
+    ASSIGN_OR_ABORT(r, f->read_at(0, buf, sizeof(buf)));
+    ASSERT_EQ("012345", std::string_view(buf, r));
+    latch.count_down();
+
+    std::swap(ExecEnv::GetInstance()->_object_storage_hedge_read_pool, pool);
+    config::object_storage_hedge_read_enable = false;
+    config::object_storage_hedge_read_min_delay_ms = 50;
+}
+
 TEST_F(S3InputStreamTest, test_read_all) {
     auto f = new_random_access_file();
 
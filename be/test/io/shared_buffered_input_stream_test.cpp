@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
@@ -179,4 +182,51 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
+TEST_F(SharedBufferedInputStreamTest, test_read_cost_model) {
+    ReadCostModel model;
+    ASSERT_EQ(-1, model.break_even_distance());
+
+    // same size reads can't tell latency from bandwidth
+    for (int i = 0; i < 100; i++) {
+        model.update(1024 * 1024, 20 * 1000 * 1000);
+    }
+    ASSERT_EQ(-1, model.break_even_distance());
+
+    // 10ms latency and 100MB/s, reading 1MB takes as long as the latency of one request
+    const int64_t latency_ns = 10 * 1000 * 1000;
+    const double ns_per_byte = 1e9 / (100 * 1000 * 1000);
+    for (int i = 0; i < 1000; i++) {
+        int64_t bytes = (i % 16 + 1) * 256 * 1024;
+        model.update(bytes, latency_ns + static_cast<int64_t>(bytes * ns_per_byte));
+    }
+    int64_t distance = model.break_even_distance();
+    ASSERT_GT(distance, 900 * 1000);
+    ASSERT_LT(distance, 1100 * 1000);
+
+    ASSERT_EQ(ReadCostModel::of("s3://bucket/a.parquet"), ReadCostModel::of("s3://bucket/b.parquet"));
+    ASSERT_NE(ReadCostModel::of("s3://bucket/a.parquet"), ReadCostModel::of("hdfs://nn/a.parquet"));
+}
+
+TEST_F(SharedBufferedInputStreamTest, test_read_cost_model_concurrent_update) {
+    ReadCostModel model;
+    // the reads of each thread go to its own shard, and the fit merges all of them
+    const int64_t latency_ns = 10 * 1000 * 1000;
+    const double ns_per_byte = 1e9 / (100 * 1000 * 1000);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 200; i++) {
+                int64_t bytes = ((i + t) % 16 + 1) * 256 * 1024;
+                model.update(bytes, latency_ns + static_cast<int64_t>(bytes * ns_per_byte));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    int64_t distance = model.break_even_distance();
+    ASSERT_GT(distance, 900 * 1000);
+    ASSERT_LT(distance, 1100 * 1000);
+}
+
 } // namespace starrocks::io
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <chrono>
 #include <filesystem>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -323,4 +324,21 @@ TEST_F(SpillBlockManagerTest, hybird_block_allocation_test) {
         ASSERT_EQ(block->debug_string(), expected);
     }
 }
+
+TEST_F(SpillBlockManagerTest, remote_block_read_buffer_bytes) {
+    auto old_buffer_bytes = config::spill_remote_read_buffer_bytes;
+    DeferOp defer([&]() { config::spill_remote_read_buffer_bytes = old_buffer_bytes; });
+    config::spill_remote_read_buffer_bytes = 1024 * 1024;
+
+    // a single stream without a budget gets the whole buffer
+    ASSERT_EQ(1024 * 1024, spill::remote_block_read_buffer_bytes(std::numeric_limits<size_t>::max(), 1));
+    ASSERT_EQ(1024 * 1024, spill::remote_block_read_buffer_bytes(16 * 1024 * 1024, 1));
+    // the streams read at the same time share the budget
+    ASSERT_EQ(512 * 1024, spill::remote_block_read_buffer_bytes(8 * 1024 * 1024, 16));
+    ASSERT_EQ(1024 * 1024, spill::remote_block_read_buffer_bytes(64 * 1024 * 1024, 16));
+    ASSERT_EQ(0, spill::remote_block_read_buffer_bytes(8 * 1024 * 1024, 0));
+
+    config::spill_remote_read_buffer_bytes = 0;
+    ASSERT_EQ(0, spill::remote_block_read_buffer_bytes(std::numeric_limits<size_t>::max(), 1));
+}
 } // namespace starrocks::vectorized
@@ -20,6 +20,7 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <random>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -573,6 +574,78 @@ TEST_F(SpillTest, partition_process) {
     }
 }
 
+// With max_in_mem_partition_bytes the partitions which fit in it stay in memory, and only the others are spilled.
+TEST_F(SpillTest, hybrid_partition_process) {
+    ObjectPool pool;
+
+    std::vector<bool> nullables = {false};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+    std::vector<ExprContext*> tuple;
+    ASSERT_OK(Expr::create_expr_trees(&pool, tuple_slots, &tuple, &dummy_rt_st));
+    RandomChunkBuilder chunk_builder;
+    std::mt19937 rng(0);
+
+    struct Result {
+        size_t in_mem_partitions = 0;
+        size_t spilled_partitions = 0;
+        size_t in_mem_bytes = 0;
+    };
+    // spill about 3MB into 4 partitions with 1MB mem tables
+    auto run = [&](size_t max_in_mem_partition_bytes) {
+        SpilledOptions spill_options(4);
+        spill_options.mem_table_pool_size = 1;
+        spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+        spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        spill_options.block_manager = dummy_block_mgr.get();
+        auto spiller = spill::make_spilled_factory()->create(spill_options);
+        spiller->set_metrics(metrics);
+        spiller->set_max_in_mem_partition_bytes(max_in_mem_partition_bytes);
+        CHECK(spiller->prepare(&dummy_rt_st).ok());
+
+        for (size_t i = 0; i < 100; ++i) {
+            auto chunk = chunk_builder.gen(tuple, nullables);
+            auto hash_column = spill::SpillHashColumn::create(chunk->num_rows());
+            for (auto& hash : hash_column->get_data()) {
+                hash = rng();
+            }
+            chunk->append_column(std::move(hash_column), -1);
+            CHECK(spiller->spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}).ok());
+        }
+        CHECK(spiller->flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}).ok());
+        CHECK(spiller->_spilled_task_status.ok());
+
+        Result result;
+        auto writer = spiller->_writer->as<spill::PartitionedSpillerWriter*>();
+        for (const auto& [pid, partition] : writer->_id_to_partitions) {
+            if (partition->in_mem) {
+                result.in_mem_partitions++;
+                result.in_mem_bytes += partition->spill_writer->mem_table()->mem_usage();
+            } else {
+                result.spilled_partitions++;
+            }
+        }
+        return result;
+    };
+
+    // without a budget the full mem tables are spilled
+    Result result = run(0);
+    ASSERT_GT(result.spilled_partitions, 0);
+
+    // every partition fits
+    result = run(64 * 1024 * 1024);
+    ASSERT_EQ(0, result.spilled_partitions);
+    ASSERT_GT(result.in_mem_partitions, 0);
+
+    // only a part of them fits, the resident ones stay within the budget
+    const size_t budget = 1536 * 1024;
+    result = run(budget);
+    ASSERT_GT(result.spilled_partitions, 0);
+    ASSERT_GT(result.in_mem_partitions, 0);
+    ASSERT_LE(result.in_mem_bytes, budget);
+}
+
 TEST_F(SpillTest, aligned_buffer) {
     spill::AlignedBuffer buffer;
     ASSERT_EQ(buffer.data(), nullptr);
@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/lazy_lru_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+class LazyLRUCacheTest : public testing::Test {
+protected:
+    void SetUp() override { _mem_tracker = std::make_unique<MemTracker>(-1, "lazy_lru_cache"); }
+
+    void open() {
+        _cache.open([this]() { return _capacity; }, _mem_tracker.get());
+    }
+
+    static void delete_value(const CacheKey& /*key*/, void* value) { delete reinterpret_cast<std::string*>(value); }
+
+    void insert(const std::string& key, const std::string& value) {
+        _cache.release(_cache.insert(CacheKey(key), new std::string(value), value.size(), kMemSize, delete_value));
+    }
+
+    bool contains(const std::string& key) {
+        Cache::Handle* handle = _cache.lookup(CacheKey(key));
+        _cache.release(handle);
+        return handle != nullptr;
+    }
+
+    static constexpr int64_t kMemSize = 64;
+
+    std::unique_ptr<MemTracker> _mem_tracker;
+    int64_t _capacity = 1024 * 1024;
+    LazyLRUCache _cache;
+};
+
+TEST_F(LazyLRUCacheTest, test_open_and_close) {
+    // not enabled until opened, a value inserted then is deleted at once
+    ASSERT_FALSE(_cache.enabled());
+    insert("k0", "v0");
+    ASSERT_FALSE(contains("k0"));
+    ASSERT_EQ(0, _mem_tracker->consumption());
+
+    open();
+    ASSERT_TRUE(_cache.enabled());
+    insert("k1", "v1");
+    Cache::Handle* handle = _cache.lookup(CacheKey("k1"));
+    ASSERT_NE(nullptr, handle);
+    ASSERT_EQ("v1", *reinterpret_cast<std::string*>(_cache.value(handle)));
+
+    // an entry in use is kept until it is released
+    _cache.close();
+    ASSERT_FALSE(_cache.enabled());
+    ASSERT_FALSE(contains("k1"));
+    ASSERT_EQ("v1", *reinterpret_cast<std::string*>(_cache.value(handle)));
+    ASSERT_GT(_mem_tracker->consumption(), 0);
+    _cache.release(handle);
+    ASSERT_EQ(0, _mem_tracker->consumption());
+}
+
+TEST_F(LazyLRUCacheTest, test_mem_tracker) {
+    open();
+    insert("k1", "v1");
+    int64_t entry_mem_size = _mem_tracker->consumption();
+    ASSERT_GT(entry_mem_size, kMemSize);
+    insert("k2", "v2");
+    ASSERT_EQ(2 * entry_mem_size, _mem_tracker->consumption());
+
+    _cache.erase(CacheKey("k1"));
+    ASSERT_FALSE(contains("k1"));
+    ASSERT_EQ(entry_mem_size, _mem_tracker->consumption());
+
+    _cache.reset();
+    ASSERT_EQ(0, _mem_tracker->consumption());
+}
+
+TEST_F(LazyLRUCacheTest, test_capacity) {
+    open();
+    for (int i = 0; i < 10; i++) {
+        insert("k" + std::to_string(i), "v");
+    }
+    ASSERT_TRUE(contains("k0"));
+
+    // a capacity of 0 disables the cache and frees the entries
+    _capacity = 0;
+    ASSERT_FALSE(_cache.enabled());
+    ASSERT_EQ(0, _mem_tracker->consumption());
+
+    _capacity = 1024 * 1024;
+    ASSERT_TRUE(_cache.enabled());
+    ASSERT_FALSE(contains("k0"));
+    insert("k0", "v");
+    ASSERT_TRUE(contains("k0"));
+    _cache.reset();
+}
+
+} // namespace starrocks
@@ -236,4 +236,15 @@ TEST_F(LocalTabletsChannelTest, test_profile) {
     ASSERT_EQ(chunk.num_rows(), profile->get_counter("AddRowNum")->value());
 }
 
+TEST_F(LocalTabletsChannelTest, test_num_memtables_to_reclaim) {
+    std::vector<int64_t> sizes{400, 300, 200, 100};
+    ASSERT_EQ(0, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 0, 0));
+    ASSERT_EQ(1, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 400, 0));
+    ASSERT_EQ(2, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 401, 0));
+    // the memtables already queued or flushing are counted as reclaimed
+    ASSERT_EQ(1, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 600, 300));
+    ASSERT_EQ(0, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 600, 600));
+    ASSERT_EQ(4, LocalTabletsChannel::num_memtables_to_reclaim(sizes, 2000, 100));
+}
+
 } // namespace starrocks
@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_allocator.h"
+
+#include <gtest/gtest.h>
+#include <malloc.h>
+
+#include <thread>
+
+#include "common/config.h"
+#include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+TEST(CachedColumnAllocatorTest, test_reuse) {
+    auto old_value = config::column_buffer_cache_max_bytes_per_thread;
+    config::column_buffer_cache_max_bytes_per_thread = 64 * 1024 * 1024;
+    DeferOp defer([&]() { config::column_buffer_cache_max_bytes_per_thread = old_value; });
+
+    CachedColumnAllocator allocator;
+    void* ptr = allocator.alloc(8192);
+    ASSERT_NE(nullptr, ptr);
+    size_t usable_size = malloc_usable_size(ptr);
+    size_t cached_bytes = CachedColumnAllocator::thread_cached_bytes();
+    allocator.free(ptr);
+    ASSERT_EQ(cached_bytes + usable_size, CachedColumnAllocator::thread_cached_bytes());
+
+    // a smaller allocation of the same size class reuses the buffer
+    void* reused = allocator.alloc(6000);
+    ASSERT_EQ(ptr, reused);
+    ASSERT_EQ(cached_bytes, CachedColumnAllocator::thread_cached_bytes());
+
+    // small and large allocations don't go through the cache
+    allocator.free(reused);
+    cached_bytes = CachedColumnAllocator::thread_cached_bytes();
+    void* small = allocator.alloc(100);
+    void* large = allocator.alloc(2 * 1024 * 1024);
+    ASSERT_NE(reused, small);
+    ASSERT_EQ(cached_bytes, CachedColumnAllocator::thread_cached_bytes());
+    allocator.free(small);
+    allocator.free(large);
+    ASSERT_EQ(cached_bytes, CachedColumnAllocator::thread_cached_bytes());
+}
+
+TEST(CachedColumnAllocatorTest, test_max_cached_bytes) {
+    auto old_value = config::column_buffer_cache_max_bytes_per_thread;
+    config::column_buffer_cache_max_bytes_per_thread = 0;
+    DeferOp defer([&]() { config::column_buffer_cache_max_bytes_per_thread = old_value; });
+
+    CachedColumnAllocator allocator;
+    void* ptr = allocator.alloc(8192);
+    size_t cached_bytes = CachedColumnAllocator::thread_cached_bytes();
+    allocator.free(ptr);
+    ASSERT_EQ(cached_bytes, CachedColumnAllocator::thread_cached_bytes());
+}
+
+TEST(CachedColumnAllocatorTest, test_cache_mem_tracker) {
+    auto old_value = config::column_buffer_cache_max_bytes_per_thread;
+    config::column_buffer_cache_max_bytes_per_thread = 64 * 1024 * 1024;
+    MemTracker cache_tracker(-1, "column_buffer_cache");
+    CachedColumnAllocator::set_mem_tracker(&cache_tracker);
+    DeferOp defer([&]() {
+        CachedColumnAllocator::set_mem_tracker(nullptr);
+        config::column_buffer_cache_max_bytes_per_thread = old_value;
+    });
+
+    // run in a new thread, so that its cache starts empty and is destroyed at the end
+    std::thread thread([&]() {
+        CachedColumnAllocator allocator;
+        void* ptr1 = allocator.alloc(8192);
+        void* ptr2 = allocator.alloc(64 * 1024);
+        size_t usable_size1 = malloc_usable_size(ptr1);
+        size_t usable_size2 = malloc_usable_size(ptr2);
+        ASSERT_EQ(0, cache_tracker.consumption());
+
+        // the cached buffers are charged to the cache tracker
+        allocator.free(ptr1);
+        allocator.free(ptr2);
+        ASSERT_EQ(usable_size1 + usable_size2, cache_tracker.consumption());
+        ASSERT_EQ(CachedColumnAllocator::thread_cached_bytes(), cache_tracker.consumption());
+
+        // and released from it when reused
+        void* reused = allocator.alloc(6000);
+        ASSERT_EQ(ptr1, reused);
+        ASSERT_EQ(usable_size2, cache_tracker.consumption());
+        allocator.free(reused);
+        ASSERT_EQ(usable_size1 + usable_size2, cache_tracker.consumption());
+    });
+    thread.join();
+    // the buffers cached by the exited thread are freed
+    ASSERT_EQ(0, cache_tracker.consumption());
+}
+
+} // namespace starrocks
@@ -0,0 +1,117 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/buffer_control_block.h"
+#include "runtime/http_result_writer.h"
+#include "runtime/mysql_result_writer.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class ResultWriterTest : public testing::Test {
+public:
+    void SetUp() override {
+        auto* ctx = _pool.add(new ExprContext(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 0))));
+        ASSERT_OK(ctx->prepare(&_runtime_state));
+        ASSERT_OK(ctx->open(&_runtime_state));
+        _output_expr_ctxs.push_back(ctx);
+
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < kNumRows; i++) {
+            column->append(i);
+        }
+        _chunk = std::make_shared<Chunk>();
+        _chunk->append_column(std::move(column), 0);
+    }
+
+    void TearDown() override { Expr::close(_output_expr_ctxs, &_runtime_state); }
+
+protected:
+    static constexpr int32_t kNumRows = 100;
+
+    // The rows of |results| in order, each passed through |decode|.
+    template <typename Decode>
+    static std::vector<std::string> collect_rows(const TFetchDataResultPtrs& results, Decode&& decode) {
+        std::vector<std::string> rows;
+        for (const auto& result : results) {
+            for (const auto& row : result->result_batch.rows) {
+                rows.push_back(decode(row));
+            }
+        }
+        return rows;
+    }
+
+    static std::vector<std::string> expected_rows() {
+        std::vector<std::string> rows;
+        for (int32_t i = 0; i < kNumRows; i++) {
+            rows.push_back(std::to_string(i));
+        }
+        return rows;
+    }
+
+    ObjectPool _pool;
+    RuntimeState _runtime_state;
+    RuntimeProfile _profile{"ResultWriterTest"};
+    BufferControlBlock _sinker{TUniqueId(), 1024};
+    std::vector<ExprContext*> _output_expr_ctxs;
+    ChunkPtr _chunk;
+};
+
+// The rows of a chunk split into several batches all arrive, in order.
+TEST_F(ResultWriterTest, mysql_result_writer_split_chunk) {
+    MysqlResultWriter writer(&_sinker, _output_expr_ctxs, false, &_profile, 16);
+    ASSERT_OK(writer.init(&_runtime_state));
+
+    ASSIGN_OR_ABORT(auto results, writer.process_chunk(_chunk.get()));
+    ASSERT_GT(results.size(), 1);
+    for (const auto& result : results) {
+        ASSERT_FALSE(result->result_batch.rows.empty());
+    }
+    // A text row is the length of the value in one byte followed by the value.
+    auto rows = collect_rows(results, [](const std::string& row) {
+        EXPECT_EQ(row.size() - 1, static_cast<uint8_t>(row[0]));
+        return row.substr(1);
+    });
+    ASSERT_EQ(expected_rows(), rows);
+}
+
+TEST_F(ResultWriterTest, http_result_writer_split_chunk) {
+    HttpResultWriter writer(&_sinker, _output_expr_ctxs, &_profile, TResultSinkFormatType::type::JSON, 64);
+    ASSERT_OK(writer.init(&_runtime_state));
+
+    ASSIGN_OR_ABORT(auto results, writer.process_chunk(_chunk.get()));
+    ASSERT_GT(results.size(), 1);
+    for (const auto& result : results) {
+        ASSERT_FALSE(result->result_batch.rows.empty());
+    }
+    const std::string prefix = "{\"data\":[";
+    const std::string suffix = "]}\n";
+    auto rows = collect_rows(results, [&](const std::string& row) {
+        EXPECT_EQ(0, row.find(prefix));
+        EXPECT_EQ(row.size() - suffix.size(), row.rfind(suffix));
+        return row.substr(prefix.size(), row.size() - prefix.size() - suffix.size());
+    });
+    ASSERT_EQ(expected_rows(), rows);
+}
+
+} // namespace starrocks
@@ -25,6 +25,7 @@
 #include "column/json_column.h"
 #include "column/nullable_column.h"
 #include "gutil/strings/substitute.h"
+#include "serde/encode_context.h"
 #include "testutil/parallel_test.h"
 #include "util/json.h"
 
@@ -215,6 +216,59 @@ PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, nullable_column_without_nulls) {
+    std::vector<int32_t> numbers{1, 2, 3, 4, 5, 6, 7};
+    auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    c1->append_numbers(numbers.data(), numbers.size() * sizeof(int32_t));
+    ASSERT_FALSE(c1->has_null());
+
+    std::vector<uint8_t> buffer;
+    for (auto level = -1; level < 16; ++level) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        if (level == 8) {
+            // only the flag byte is written instead of the null map
+            ASSERT_EQ(sizeof(uint8_t) + ColumnArraySerde::max_serialized_size(*c1->data_column(), level),
+                      end - buffer.data());
+        }
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+        ASSERT_EQ(c1->size(), c2->size());
+        ASSERT_FALSE(c2->has_null());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_FALSE(c2->is_null(i));
+            ASSERT_EQ(c1->get(i).get_int32(), c2->get(i).get_int32());
+        }
+    }
+
+    c1->append_nulls(2);
+    for (auto level = 8; level < 16; ++level) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level);
+        ASSERT_EQ(c1->size(), c2->size());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->is_null(i), c2->is_null(i));
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, encode_null_map_level) {
+    ASSERT_TRUE(EncodeContext::enable_encode_null_map(8));
+    ASSERT_TRUE(EncodeContext::enable_encode_null_map(15));
+    ASSERT_FALSE(EncodeContext::enable_encode_null_map(7));
+    // negative levels are not a combination of encoding bits
+    ASSERT_FALSE(EncodeContext::enable_encode_null_map(-1));
+    ASSERT_FALSE(EncodeContext::enable_encode_null_map(-9));
+
+    ASSERT_EQ(7, EncodeContext::disable_encode_null_map(15));
+    ASSERT_EQ(7, EncodeContext::disable_encode_null_map(7));
+    ASSERT_EQ(-1, EncodeContext::disable_encode_null_map(-1));
+    ASSERT_EQ(0, EncodeContext::disable_encode_null_map(0));
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, binary_column) {
     std::vector<Slice> strings{{"bbb"}, {"bbc"}, {"ccc"}};
@@ -1549,6 +1549,53 @@ TEST_F(LakeServiceTest, test_publish_version_issue28244) {
     ASSERT_TRUE(_tablet_mgr->get_txn_log(_tablet_id, 102301).status().is_not_found());
 }
 
+TEST_F(LakeServiceTest, test_publish_combined_txn_log_evict_split_logs) {
+    auto txn_id = next_id();
+    auto other_tablet_id = next_id();
+    CombinedTxnLogPB combined_txn_log;
+    for (auto tablet_id : {_tablet_id, other_tablet_id}) {
+        auto* log = combined_txn_log.add_txn_logs();
+        log->set_tablet_id(tablet_id);
+        log->set_txn_id(txn_id);
+        log->mutable_op_write()->mutable_rowset()->set_overlapped(true);
+        log->mutable_op_write()->mutable_rowset()->set_num_rows(0);
+        log->mutable_op_write()->mutable_rowset()->set_data_size(0);
+    }
+    ASSERT_OK(_tablet_mgr->put_combined_txn_log(combined_txn_log));
+
+    TxnInfoPB txn_info;
+    txn_info.set_txn_id(txn_id);
+    txn_info.set_combined_txn_log(true);
+    txn_info.set_txn_type(TXN_NORMAL);
+    txn_info.set_commit_time(::time(nullptr));
+    auto* metacache = _tablet_mgr->metacache();
+    {
+        PublishVersionRequest request;
+        PublishVersionResponse response;
+        request.set_base_version(1);
+        request.set_new_version(2);
+        request.add_tablet_ids(_tablet_id);
+        request.add_txn_infos()->CopyFrom(txn_info);
+        _lake_service.publish_version(nullptr, &request, &response, nullptr);
+        ASSERT_EQ(0, response.failed_tablets_size());
+    }
+    // The published tablet drops its split entry, the other tablet's entry stays for its own publish.
+    EXPECT_EQ(nullptr, metacache->lookup_txn_log(_tablet_mgr->txn_log_location(_tablet_id, txn_id)));
+    EXPECT_NE(nullptr, metacache->lookup_txn_log(_tablet_mgr->txn_log_location(other_tablet_id, txn_id)));
+    {
+        PublishLogVersionRequest request;
+        PublishLogVersionResponse response;
+        request.add_tablet_ids(other_tablet_id);
+        request.set_version(10);
+        request.mutable_txn_info()->CopyFrom(txn_info);
+        brpc::Controller cntl;
+        _lake_service.publish_log_version(&cntl, &request, &response, nullptr);
+        ASSERT_FALSE(cntl.Failed());
+        ASSERT_EQ(0, response.failed_tablets_size());
+    }
+    EXPECT_EQ(nullptr, metacache->lookup_txn_log(_tablet_mgr->txn_log_location(other_tablet_id, txn_id)));
+}
+
 TEST_F(LakeServiceTest, test_get_tablet_stats) {
     TabletStatRequest request;
     TabletStatResponse response;
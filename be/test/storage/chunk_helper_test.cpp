@@ -24,6 +24,7 @@
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -185,6 +186,23 @@ TEST_F(ChunkHelperTest, Accumulator) {
     EXPECT_TRUE(accumulator.reach_limit());
 }
 
+TEST_F(ChunkHelperTest, ChunkSizeForRowBytes) {
+    auto old_target_bytes = config::chunk_target_bytes;
+    DeferOp defer([&]() { config::chunk_target_bytes = old_target_bytes; });
+
+    config::chunk_target_bytes = 16 * 1024 * 1024;
+    // narrow rows keep the chunk size
+    ASSERT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(8, 4096));
+    ASSERT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(4096, 4096));
+    // 2000 BIGINT columns
+    ASSERT_EQ(1048, ChunkHelper::chunk_size_for_row_bytes(2000 * 8, 4096));
+    ASSERT_EQ(64, ChunkHelper::chunk_size_for_row_bytes(1024 * 1024, 4096));
+    ASSERT_EQ(10, ChunkHelper::chunk_size_for_row_bytes(1024 * 1024, 10));
+
+    config::chunk_target_bytes = 0;
+    ASSERT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(2000 * 8, 4096));
+}
+
 class ChunkPipelineAccumulatorTest : public ::testing::Test {
 protected:
     ChunkPtr _generate_chunk(size_t rows, size_t cols, size_t reserve_size = 0);
@@ -272,6 +290,19 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_max_bytes) {
+    auto old_max_bytes = config::chunk_accumulator_max_bytes;
+    DeferOp defer([&]() { config::chunk_accumulator_max_bytes = old_max_bytes; });
+    config::chunk_accumulator_max_bytes = 16 * 1000;
+
+    ChunkPipelineAccumulator accumulator;
+    accumulator.push(_generate_chunk(1000, 10));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(1000, 10));
+    ASSERT_TRUE(accumulator.has_output());
+    ASSERT_EQ(2000, accumulator.pull()->num_rows());
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
@@ -31,6 +31,7 @@
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -143,6 +144,62 @@ TEST_F(CompactionManagerTest, test_candidates) {
     }
 }
 
+TEST_F(CompactionManagerTest, test_query_scan_count) {
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    ASSERT_EQ(0, tablet->recent_query_scan_count());
+    for (int i = 0; i < 3; i++) {
+        tablet->increase_query_scan_count();
+    }
+    ASSERT_EQ(3, tablet->recent_query_scan_count());
+}
+
+TEST_F(CompactionManagerTest, test_pick_weighted_candidates) {
+    std::vector<CompactionCandidate> candidates;
+    std::vector<TabletSharedPtr> tablets;
+    DataDir data_dir("./data_dir");
+    for (int i = 0; i < 5; i++) {
+        TabletSharedPtr tablet = std::make_shared<Tablet>();
+        TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+        tablet_meta->set_tablet_id(i);
+        tablet->set_tablet_meta(tablet_meta);
+        tablet->set_data_dir(&data_dir);
+        tablet->set_tablet_state(TABLET_RUNNING);
+        tablets.push_back(tablet);
+
+        CompactionCandidate candidate;
+        candidate.tablet = tablet;
+        candidate.score = 1 + i;
+        candidates.push_back(candidate);
+    }
+    _engine->compaction_manager()->update_candidates(candidates);
+
+    // The scans happen after the candidates are updated, and are still taken into account when picking.
+    for (int i = 0; i < 1023; i++) {
+        tablets[0]->increase_query_scan_count();
+    }
+    ASSERT_DOUBLE_EQ(11, CompactionManager::weighted_score(1, tablets[0]->recent_query_scan_count(), 1));
+
+    auto old_weight = config::compaction_query_scan_score_weight;
+    config::compaction_query_scan_score_weight = 1;
+    DeferOp defer([&] { config::compaction_query_scan_score_weight = old_weight; });
+
+    // The max score reported stays the raw compaction score.
+    ASSERT_DOUBLE_EQ(5, _engine->compaction_manager()->max_score());
+
+    // tablet 0 is scanned most, and is picked before the tablets with higher compaction score.
+    std::vector<int64_t> picked_tablet_ids;
+    while (true) {
+        CompactionCandidate candidate;
+        if (!_engine->compaction_manager()->pick_candidate(&candidate)) {
+            break;
+        }
+        picked_tablet_ids.push_back(candidate.tablet->tablet_id());
+        ASSERT_DOUBLE_EQ(1 + candidate.tablet->tablet_id(), candidate.score);
+        ASSERT_DOUBLE_EQ(candidate.score, _engine->compaction_manager()->last_score());
+    }
+    ASSERT_EQ((std::vector<int64_t>{0, 4, 3, 2, 1}), picked_tablet_ids);
+}
+
 TEST_F(CompactionManagerTest, test_candidates_exceede) {
     config::max_compaction_candidate_num = 10;
     std::vector<CompactionCandidate> candidates;
@@ -209,6 +209,54 @@ TEST(ConjunctivePredicatesTest, test_evaluate_and) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ConjunctivePredicatesTest, test_predicate_tree_reorder_children) {
+    SchemaPtr schema(new Schema());
+    auto c0_field = std::make_shared<Field>(0, "c0", TYPE_INT, true);
+    schema->append(c0_field);
+    auto c0 = ChunkHelper::column_from_field(*c0_field);
+    for (int i = 0; i < 100; i++) {
+        c0->append_datum(i % 10 == 0 ? Datum() : Datum(i));
+    }
+    ChunkPtr chunk = std::make_shared<Chunk>(Columns{c0}, schema);
+
+    // c0 is not null and c0 >= 0 and c0 = 42, the most selective predicate comes last.
+    PredicatePtr p0(new_column_null_predicate(get_type_info(TYPE_INT), 0, false));
+    PredicatePtr p1(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "0"));
+    PredicatePtr p2(new_column_eq_predicate(get_type_info(TYPE_INT), 0, "42"));
+    PredicateAndNode root;
+    root.add_child(PredicateColumnNode{p0.get()});
+    root.add_child(PredicateColumnNode{p1.get()});
+    root.add_child(PredicateColumnNode{p2.get()});
+    auto pred_tree = PredicateTree::create(std::move(root));
+
+    auto vec_children_preds = [&]() {
+        std::vector<const ColumnPredicate*> preds;
+        const auto& ctx = pred_tree.compound_node_context(pred_tree.root().id()).and_context.value();
+        for (const auto& child : ctx.vec_children) {
+            preds.emplace_back(std::get<const PredicateColumnNode*>(child.node_ptr_var)->col_pred());
+        }
+        return preds;
+    };
+
+    // Evaluate enough times for the children to be reordered, the result must not change.
+    for (int round = 0; round < 100; round++) {
+        std::vector<uint8_t> selection(chunk->num_rows(), 0);
+        ASSERT_OK(pred_tree.evaluate(chunk.get(), selection.data(), 0, chunk->num_rows()));
+        for (int i = 0; i < chunk->num_rows(); i++) {
+            ASSERT_EQ(i == 42, selection[i] != 0);
+        }
+
+        // The children are reordered before the 32nd evaluation: c0 = 42 keeps 1 of 90 rows, c0 is not null keeps
+        // 90 of 100 rows and c0 >= 0 keeps all of its 90 rows.
+        if (round == 30) {
+            ASSERT_EQ((std::vector<const ColumnPredicate*>{p0.get(), p1.get(), p2.get()}), vec_children_preds());
+        } else if (round >= 31) {
+            ASSERT_EQ((std::vector<const ColumnPredicate*>{p2.get(), p0.get(), p1.get()}), vec_children_preds());
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST(ConjunctivePredicatesTest, test_evaluate_or) {
     SchemaPtr schema(new Schema());
@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "storage/index/inverted/inverted_index_query_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/exec_env.h"
+
+namespace starrocks {
+
+class InvertedIndexQueryCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _key = InvertedIndexQueryCache::key("/path/to/index", "c1", InvertedIndexQueryType::EQUAL_QUERY, "term");
+        cache()->erase(CacheKey(_key));
+    }
+
+    void TearDown() override { cache()->erase(CacheKey(_key)); }
+
+    static LazyLRUCache* cache() { return GlobalEnv::GetInstance()->inverted_index_query_cache(); }
+    static MemTracker* mem_tracker() { return GlobalEnv::GetInstance()->inverted_index_query_cache_mem_tracker(); }
+
+    std::string _key;
+};
+
+TEST_F(InvertedIndexQueryCacheTest, test_key) {
+    // every part of the query is in the key, and the separators keep the parts from running into each other
+    ASSERT_NE(_key, InvertedIndexQueryCache::key("/path/to/index", "c2", InvertedIndexQueryType::EQUAL_QUERY, "term"));
+    ASSERT_NE(_key, InvertedIndexQueryCache::key("/path/to/index", "c1", InvertedIndexQueryType::MATCH_PHRASE_QUERY,
+                                                 "term"));
+    ASSERT_NE(_key, InvertedIndexQueryCache::key("/path/to/index", "c1", InvertedIndexQueryType::EQUAL_QUERY, "terms"));
+    ASSERT_NE(InvertedIndexQueryCache::key("/a", "bc", InvertedIndexQueryType::EQUAL_QUERY, "term"),
+              InvertedIndexQueryCache::key("/ab", "c", InvertedIndexQueryType::EQUAL_QUERY, "term"));
+}
+
+TEST_F(InvertedIndexQueryCacheTest, test_lookup_and_insert) {
+    ASSERT_TRUE(cache()->enabled());
+    roaring::Roaring bit_map;
+    ASSERT_FALSE(InvertedIndexQueryCache::lookup(_key, &bit_map));
+
+    int64_t consumption = mem_tracker()->consumption();
+    roaring::Roaring result = roaring::Roaring::bitmapOf(3, 1, 100, 100000);
+    InvertedIndexQueryCache::insert(_key, result);
+    ASSERT_GE(mem_tracker()->consumption() - consumption, result.getSizeInBytes());
+
+    // a hit is a copy, it stays valid after the entry is evicted
+    ASSERT_TRUE(InvertedIndexQueryCache::lookup(_key, &bit_map));
+    ASSERT_EQ(result, bit_map);
+    cache()->erase(CacheKey(_key));
+    ASSERT_EQ(consumption, mem_tracker()->consumption());
+    ASSERT_EQ(3, bit_map.cardinality());
+    ASSERT_FALSE(InvertedIndexQueryCache::lookup(_key, &bit_map));
+}
+
+} // namespace starrocks
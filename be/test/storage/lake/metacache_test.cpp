@@ -23,6 +23,7 @@
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/tablet_manager.h"
@@ -32,6 +33,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -242,6 +244,30 @@ TEST_F(LakeMetacacheTest, test_prune) {
     ASSERT_TRUE(meta3 == nullptr);
 }
 
+TEST_F(LakeMetacacheTest, test_durable_metadata) {
+    auto old_value = config::lake_metacache_durable_metadata;
+    DeferOp defer([&]() { config::lake_metacache_durable_metadata = old_value; });
+    for (bool durable : {true, false}) {
+        config::lake_metacache_durable_metadata = durable;
+        Metacache metacache(1024 * 1024);
+        auto meta = std::make_shared<TabletMetadataPB>();
+        metacache.cache_latest_tablet_metadata("latest_meta", meta);
+        metacache.cache_tablet_metadata("meta1", meta);
+        // overflow the cache with txn logs
+        for (int i = 0; i < 100000; i++) {
+            metacache.cache_txn_log(fmt::format("log{}", i), std::make_shared<TxnLogPB>());
+        }
+        // metadata of a specific version is never durable
+        ASSERT_TRUE(metacache.lookup_tablet_metadata("meta1") == nullptr);
+        auto meta2 = metacache.lookup_tablet_metadata("latest_meta");
+        if (durable) {
+            ASSERT_TRUE(meta2 != nullptr);
+        } else {
+            ASSERT_TRUE(meta2 == nullptr);
+        }
+    }
+}
+
 TEST_F(LakeMetacacheTest, test_cache_segment_if_absent) {
     // intend empty value for the following two variables
     std::shared_ptr<FileSystem> fs;
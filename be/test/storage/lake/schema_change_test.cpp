@@ -21,6 +21,7 @@
 #include "column/datum_tuple.h"
 #include "column/fixed_length_column.h"
 #include "fs/fs_util.h"
+#include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/delta_writer.h"
 #include "storage/lake/fixed_location_provider.h"
@@ -34,6 +35,7 @@
 #include "storage/lake/versioned_tablet.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -615,6 +617,76 @@ TEST_P(SchemaChangeModifyColumnTypeTest, test_alter_column_type) {
     }
 }
 
+TEST_P(SchemaChangeModifyColumnTypeTest, test_alter_column_type_parallel) {
+    if (GetParam().writes_before != 2 || GetParam().writes_after != 0 || GetParam().concurrency != 1) {
+        GTEST_SKIP() << "run once for each keys type";
+    }
+    auto old_parallelism = config::lake_schema_change_max_parallel_rowsets;
+    config::lake_schema_change_max_parallel_rowsets = 4;
+    DeferOp defer([&]() { config::lake_schema_change_max_parallel_rowsets = old_parallelism; });
+    ASSERT_NE(nullptr, ExecEnv::GetInstance()->lake_schema_change_pool());
+
+    const int num_writes = 10;
+    int64_t version = 1;
+    int64_t txn_id = 1000;
+    auto base_tablet_id = _base_tablet_metadata->id();
+    for (int i = 0; i < num_writes; i++) {
+        auto c0 = Int32Column::create();
+        auto c1 = Int32Column::create();
+        c0->append_datum(Datum(i * 1));
+        c1->append_datum(Datum(i * 2));
+
+        VChunk chunk0({c0, c1}, _base_schema);
+        uint32_t indexes[1] = {0};
+
+        ASSIGN_OR_ABORT(auto delta_writer, DeltaWriterBuilder()
+                                                   .set_tablet_manager(_tablet_manager.get())
+                                                   .set_tablet_id(base_tablet_id)
+                                                   .set_txn_id(txn_id)
+                                                   .set_partition_id(_partition_id)
+                                                   .set_mem_tracker(_mem_tracker.get())
+                                                   .set_schema_id(_base_tablet_schema->id())
+                                                   .build());
+        ASSERT_OK(delta_writer->open());
+        ASSERT_OK(delta_writer->write(chunk0, indexes, sizeof(indexes) / sizeof(indexes[0])));
+        ASSERT_OK(delta_writer->finish_with_txnlog());
+        delta_writer->close();
+        ASSERT_OK(TEST_publish_single_version(_tablet_manager.get(), base_tablet_id, version + 1, txn_id).status());
+        version++;
+        txn_id++;
+    }
+
+    auto new_tablet_id = _new_tablet_metadata->id();
+    int64_t alter_txn_id = txn_id++;
+    {
+        TAlterTabletReqV2 request;
+        request.base_tablet_id = base_tablet_id;
+        request.new_tablet_id = new_tablet_id;
+        request.alter_version = version;
+        request.txn_id = alter_txn_id;
+
+        SchemaChangeHandler handler(_tablet_manager.get());
+        ASSERT_OK(handler.process_alter_tablet(request));
+    }
+    ASSERT_OK(publish_version_for_schema_change(new_tablet_id, version + 1, alter_txn_id));
+    version++;
+
+    // The rowsets converted in parallel keep the order and the ids of the base rowsets.
+    ASSIGN_OR_ABORT(auto new_tablet, _tablet_manager->get_tablet(new_tablet_id, version));
+    const auto& rowsets = new_tablet.metadata()->rowsets();
+    ASSERT_EQ(num_writes, rowsets.size());
+    for (int i = 1; i < rowsets.size(); i++) {
+        ASSERT_LT(rowsets[i - 1].id(), rowsets[i].id());
+    }
+
+    auto chunk = read(new_tablet, /*sorted=*/GetParam().keys_type != DUP_KEYS);
+    ASSERT_EQ(num_writes, chunk->num_rows());
+    for (int i = 0; i < num_writes; i++) {
+        EXPECT_EQ(i * 1, chunk->get(i)[0].get_int32());
+        EXPECT_EQ(i * 2, chunk->get(i)[1].get_int64());
+    }
+}
+
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(SchemaChangeModifyColumnTypeTest, SchemaChangeModifyColumnTypeTest,
                          ::testing::Values(SchemaChangeParam{DUP_KEYS, 0, 0},
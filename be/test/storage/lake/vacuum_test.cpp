@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <ctime>
 #include <set>
 
@@ -30,6 +31,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/sync_point.h"
+#include "util/defer_op.h"
 #include "util/uid_util.h"
 
 namespace starrocks::lake {
@@ -964,6 +966,87 @@ TEST_P(LakeVacuumTest, test_delete_file_failed) {
     SyncPoint::GetInstance()->DisableProcessing();
 }
 
+// NOLINTNEXTLINE
+TEST_P(LakeVacuumTest, test_delete_tablets_data_file_failed) {
+    create_data_file("00000000000559e4_27dc159f-6bfc-4a3a-9d9c-c97c10bb2e1d.dat");
+    create_data_file("00000000000559e4_a542395a-bff5-48a7-a3a7-2ed05691b58c.dat");
+    create_data_file("00000000000559e4_3d9c9edb-a69d-4a06-9093-a9f557e4c3b0.dat");
+
+    ASSERT_OK(_tablet_mgr->put_tablet_metadata(json_to_pb<TabletMetadataPB>(R"DEL(
+        {
+        "id": 900,
+        "version": 2,
+        "rowsets": [
+            {
+                "segments": [
+                    "00000000000559e4_27dc159f-6bfc-4a3a-9d9c-c97c10bb2e1d.dat",
+                    "00000000000559e4_a542395a-bff5-48a7-a3a7-2ed05691b58c.dat"
+                ]
+            }
+        ]
+        }
+        )DEL")));
+    ASSERT_OK(_tablet_mgr->put_txn_log(json_to_pb<TxnLogPB>(R"DEL(
+        {
+        "tablet_id": 900,
+        "txn_id": 9000,
+        "op_write": {
+            "rowset": {
+                "segments": [
+                    "00000000000559e4_3d9c9edb-a69d-4a06-9093-a9f557e4c3b0.dat"
+                ]
+            }
+        }
+        }
+        )DEL")));
+
+    // One file per batch, so that the data file batches run concurrently with each other.
+    auto old_batch_size = config::lake_vacuum_min_batch_delete_size;
+    config::lake_vacuum_min_batch_delete_size = 1;
+    std::atomic<int> num_deletes = 0;
+    SyncPoint::GetInstance()->SetCallBack("PosixFileSystem::delete_file", [&](void* arg) {
+        // Fail the first deletion, which must be a data file.
+        if (num_deletes++ == 0) {
+            ((Status*)arg)->update(Status::IOError("injected error"));
+        }
+    });
+    SyncPoint::GetInstance()->EnableProcessing();
+    DeferOp defer([&]() {
+        config::lake_vacuum_min_batch_delete_size = old_batch_size;
+        SyncPoint::GetInstance()->ClearCallBack("PosixFileSystem::delete_file");
+        SyncPoint::GetInstance()->DisableProcessing();
+    });
+
+    {
+        DeleteTabletRequest request;
+        DeleteTabletResponse response;
+        request.add_tablet_ids(900);
+        delete_tablets(_tablet_mgr.get(), request, &response);
+        ASSERT_TRUE(response.has_status());
+        ASSERT_NE(0, response.status().status_code());
+        EXPECT_TRUE(MatchPattern(response.status().error_msgs(0), "injected error"))
+                << response.status().error_msgs(0);
+
+        // The txn log and the metadata are kept, so that a retry finds the data files left.
+        EXPECT_TRUE(file_exist(txn_log_filename(900, 9000)));
+        EXPECT_TRUE(file_exist(tablet_metadata_filename(900, 2)));
+    }
+    {
+        DeleteTabletRequest request;
+        DeleteTabletResponse response;
+        request.add_tablet_ids(900);
+        delete_tablets(_tablet_mgr.get(), request, &response);
+        ASSERT_TRUE(response.has_status());
+        EXPECT_EQ(0, response.status().status_code()) << response.status().error_msgs(0);
+
+        EXPECT_FALSE(file_exist(txn_log_filename(900, 9000)));
+        EXPECT_FALSE(file_exist(tablet_metadata_filename(900, 2)));
+        EXPECT_FALSE(file_exist("00000000000559e4_27dc159f-6bfc-4a3a-9d9c-c97c10bb2e1d.dat"));
+        EXPECT_FALSE(file_exist("00000000000559e4_a542395a-bff5-48a7-a3a7-2ed05691b58c.dat"));
+        EXPECT_FALSE(file_exist("00000000000559e4_3d9c9edb-a69d-4a06-9093-a9f557e4c3b0.dat"));
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_P(LakeVacuumTest, test_dont_delete_txn_log) {
     ASSERT_OK(_tablet_mgr->put_txn_log(json_to_pb<TxnLogPB>(R"DEL(
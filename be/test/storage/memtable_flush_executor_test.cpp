@@ -17,7 +17,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <future>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "fs/fs_util.h"
@@ -375,6 +377,37 @@ TEST_F(MemTableFlushExecutorTest, testMemtableFlushWithNullSeg) {
     ASSERT_TRUE(flush_token->wait().ok());
 }
 
+TEST_F(MemTableFlushExecutorTest, testPendingFlushBytes) {
+    const string path = "./MemTableFlushExecutorTest_testPendingFlushBytes";
+    MySetUp("pk int,name varchar,pv int", "pk int,name varchar,pv int", 1, KeysType::DUP_KEYS, path);
+    auto mem_table = make_unique<MemTable>(1, &_vectorized_schema, _slots, _mem_table_sink.get(), _mem_tracker.get());
+    const size_t n = 1000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    ASSERT_TRUE(mem_table->insert(*pchunk, indexes.data(), 0, indexes.size()).ok());
+    ASSERT_TRUE(mem_table->finalize().ok());
+    int64_t memory_usage = mem_table->memory_usage();
+    ASSERT_GT(memory_usage, 0);
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("flush_test").set_min_threads(1).set_max_threads(1).build(&pool));
+    // occupy the only thread so that the memtable stays in the queue
+    std::promise<void> blocker;
+    auto blocked = blocker.get_future().share();
+    ASSERT_OK(pool->submit_func([blocked]() { blocked.wait(); }));
+
+    FlushToken flush_token(pool->new_token(ThreadPool::ExecutionMode::SERIAL));
+    ASSERT_OK(flush_token.submit(std::move(mem_table)));
+    ASSERT_OK(flush_token.submit(nullptr, true));
+    ASSERT_EQ(memory_usage, flush_token.get_stats().pending_flush_bytes);
+
+    blocker.set_value();
+    ASSERT_OK(flush_token.wait());
+    ASSERT_EQ(0, flush_token.get_stats().pending_flush_bytes);
+    checkResult(n);
+}
+
 TEST_F(MemTableFlushExecutorTest, testMemtableFlushStatusNotOk) {
     const string path = "./MemTableFlushExecutorTest_testMemtableFlushStatusNotOk";
     MySetUp("pk int,name varchar,pv int", "pk int,name varchar,pv int", 1, KeysType::DUP_KEYS, path);
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -291,6 +292,28 @@ TEST_F(MemTableTest, testDupKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testDupKeysPresortedInsert) {
+    const string path = "./MemTableTest_testDupKeysPresortedInsert";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 3000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    // insert in key order, in several batches
+    for (size_t from = 0; from < n; from += 1000) {
+        auto res = _mem_table->insert(*pchunk, indexes.data(), from, 1000);
+        ASSERT_TRUE(res.ok());
+    }
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    auto result = _mem_table->get_result_chunk();
+    ASSERT_EQ(n, result->num_rows());
+    auto column = result->get_column_by_index(0);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(pchunk->get_column_by_index(0)->get(i).get_int32(), column->get(i).get_int32());
+    }
+}
+
 TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     const string path = "./MemTableTest_testUniqKeysInsertFlushRead";
     MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
@@ -36,6 +36,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "runtime/mem_tracker.h"
 
 namespace starrocks {
@@ -184,4 +185,44 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, admission_filter) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+    StoragePageCache::CacheKey key1("abc", 0);
+    StoragePageCache::CacheKey key2("abc", 4096);
+
+    ASSERT_TRUE(cache.admit(key1));
+
+    config::enable_storage_page_cache_admission_filter = true;
+    DeferOp defer([] { config::enable_storage_page_cache_admission_filter = false; });
+    // the first miss is only remembered, the second one admits the page.
+    ASSERT_FALSE(cache.admit(key1));
+    ASSERT_TRUE(cache.admit(key1));
+    ASSERT_FALSE(cache.admit(key2));
+    ASSERT_TRUE(cache.admit(key2));
+}
+
+TEST_F(StoragePageCacheTest, admission_filter_window) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+    config::enable_storage_page_cache_admission_filter = true;
+    DeferOp defer([] { config::enable_storage_page_cache_admission_filter = false; });
+
+    StoragePageCache::CacheKey key("window", 0);
+    ASSERT_FALSE(cache.admit(key));
+    // fill the rest of the window with other keys, the key is forgotten once the window ends
+    const size_t window = StoragePageCache::kAdmissionFilterWords * StoragePageCache::kAdmissionFilterBitsPerWord / 4;
+    int64_t offset = 1;
+    while (cache._admission_filter_epoch.load() == 0) {
+        cache.admit(StoragePageCache::CacheKey("window", offset++));
+        ASSERT_LE(offset, window * 2);
+    }
+    ASSERT_FALSE(cache.admit(key));
+    ASSERT_TRUE(cache.admit(key));
+
+    // the epoch wraps around
+    cache._admission_filter_epoch.store(StoragePageCache::kAdmissionFilterEpochMask);
+    cache._admission_filter_keys.store(window - 1);
+    ASSERT_FALSE(cache.admit(StoragePageCache::CacheKey("window", -1)));
+    ASSERT_EQ(0, cache._admission_filter_epoch.load());
+}
+
 } // namespace starrocks
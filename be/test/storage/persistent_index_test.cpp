@@ -3254,6 +3254,138 @@ TEST_P(PersistentIndexTest, test_multi_l2_not_tmp_l1_update) {
     config::max_allow_pindex_l2_num = old_config;
 }
 
+TEST_P(PersistentIndexTest, test_major_compaction_reload_l2) {
+    config::l0_max_mem_usage = 1 * 1024 * 1024; // 1MB
+    FileSystem* fs = FileSystem::Default();
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_major_compaction_reload_l2";
+    const std::string kIndexFile = "./PersistentIndexTest_test_major_compaction_reload_l2/index.l0.0.0";
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+
+    using Key = uint64_t;
+    PersistentIndexMetaPB index_meta;
+    // total size
+    const int N = 100000;
+    // upsert size
+    const int M = 1000;
+    // K means each step size
+    const int K = N / M;
+    int64_t cur_version = 0;
+
+    {
+        ASSIGN_OR_ABORT(auto wfile, FileSystem::Default()->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+
+    // build index
+    EditVersion version(cur_version++, 0);
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    MutableIndexMetaPB* l0_meta = index_meta.mutable_l0_meta();
+    l0_meta->set_format_version(PERSISTENT_INDEX_VERSION_5);
+    IndexSnapshotMetaPB* snapshot_meta = l0_meta->mutable_snapshot();
+    version.to_pb(snapshot_meta->mutable_version());
+
+    auto verify_fn = [&](PersistentIndex& cur_index) {
+        vector<Key> keys(N);
+        vector<Slice> key_slices;
+        vector<IndexValue> values;
+        key_slices.reserve(N);
+        for (int i = 0; i < N; i++) {
+            keys[i] = i;
+            values.emplace_back(i);
+            key_slices.emplace_back((uint8_t*)(&keys[i]), sizeof(Key));
+        }
+
+        std::vector<IndexValue> get_values(keys.size());
+        ASSERT_TRUE(cur_index.get(keys.size(), key_slices.data(), get_values.data()).ok());
+        ASSERT_EQ(keys.size(), get_values.size());
+        for (int i = 0; i < values.size(); i++) {
+            ASSERT_EQ(values[i], get_values[i]);
+        }
+    };
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        // continue upsert key from 0 to N
+        vector<Key> keys(M);
+        vector<Slice> key_slices(M);
+        vector<IndexValue> values(M);
+
+        auto incre_key = [&](int step) {
+            for (int i = 0; i < M; i++) {
+                keys[i] = i + step * M;
+                values[i] = i + step * M;
+                key_slices[i] = Slice((uint8_t*)(&keys[i]), sizeof(Key));
+            }
+        };
+
+        // 1. upsert
+        for (int i = 0; i < K; i++) {
+            incre_key(i);
+            std::vector<IndexValue> old_values(M, IndexValue(NullIndexValue));
+            ASSERT_OK(index.load(index_meta));
+            ASSERT_OK(index.prepare(EditVersion(cur_version++, 0), M));
+            ASSERT_OK(index.upsert(M, key_slices.data(), values.data(), old_values.data()));
+            ASSERT_OK(index.commit(&index_meta));
+            ASSERT_OK(index.on_commited());
+        }
+        ASSERT_GT(index._l2_vec.size(), 1);
+        verify_fn(index);
+
+        auto* l0 = index._l0.get();
+        std::vector<ImmutableIndex*> l1s;
+        for (auto& l1 : index._l1_vec) {
+            l1s.push_back(l1.get());
+        }
+        std::vector<ImmutableIndex*> l2s;
+        for (auto& l2 : index._l2_vec) {
+            l2s.push_back(l2.get());
+        }
+
+        // 2. the l2 files already in memory are kept, l0 and l1 are untouched
+        ASSERT_OK(index._reload_l2(index_meta, EditVersion(), nullptr));
+        ASSERT_EQ(l0, index._l0.get());
+        ASSERT_EQ(l1s.size(), index._l1_vec.size());
+        for (int i = 0; i < l1s.size(); i++) {
+            ASSERT_EQ(l1s[i], index._l1_vec[i].get());
+        }
+        ASSERT_EQ(l2s.size(), index._l2_vec.size());
+        for (int i = 0; i < l2s.size(); i++) {
+            ASSERT_EQ(l2s[i], index._l2_vec[i].get());
+        }
+        verify_fn(index);
+
+        // 3. an l2 file unknown to memory is loaded from disk, the others are still kept
+        index._l2_versions.erase(index._l2_versions.begin());
+        index._l2_vec.erase(index._l2_vec.begin());
+        ASSERT_OK(index._reload_l2(index_meta, EditVersion(), nullptr));
+        ASSERT_EQ(l2s.size(), index._l2_vec.size());
+        ASSERT_NE(nullptr, index._l2_vec[0]);
+        for (int i = 1; i < l2s.size(); i++) {
+            ASSERT_EQ(l2s[i], index._l2_vec[i].get());
+        }
+        verify_fn(index);
+
+        // 4. after major compaction only the merged output is left
+        ASSERT_OK(index.TEST_major_compaction(index_meta));
+        ASSERT_EQ(l0, index._l0.get());
+        ASSERT_EQ(1, index._l2_vec.size());
+        ASSERT_TRUE(index._l2_versions[0].merged);
+        verify_fn(index);
+    }
+
+    {
+        // rebuild mutableindex according to PersistentIndexMetaPB
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_TRUE(index.load(index_meta).ok());
+        verify_fn(index);
+    }
+
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
 TEST_P(PersistentIndexTest, pindex_major_compact_meta) {
     // (1.0), (1.1), (3.0), (4.1), (5.0)
     // merge (1.0), (1.1), (3.0) into (3.0)
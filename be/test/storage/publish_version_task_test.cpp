@@ -386,4 +386,34 @@ TEST_F(PublishVersionTaskTest, test_publish_version2) {
     }
 }
 
+TEST_F(PublishVersionTaskTest, test_sort_tablet_publish_version_tasks) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    auto schema = TabletSchema::create(schema_pb);
+    auto create_rowset = [&](size_t disk_size) {
+        RowsetMetaPB rowset_meta_pb;
+        rowset_meta_pb.set_total_disk_size(disk_size);
+        return Rowset::create(schema, "", std::make_shared<RowsetMeta>(rowset_meta_pb));
+    };
+
+    // (tablet id, rowset disk size), a tablet without rowset costs nothing
+    std::vector<std::pair<int64_t, size_t>> tablets{{1, 100}, {2, 0}, {3, 10000}, {4, 100}, {5, 1}, {6, 10000}};
+    std::vector<TabletPublishVersionTask> tablet_tasks;
+    for (auto& [tablet_id, disk_size] : tablets) {
+        auto& task = tablet_tasks.emplace_back();
+        task.tablet_id = tablet_id;
+        if (disk_size > 0) {
+            task.rowset = create_rowset(disk_size);
+        }
+    }
+
+    sort_tablet_publish_version_tasks(tablet_tasks);
+    // the largest rowsets first, tablets of the same size keep their order
+    std::vector<int64_t> expected{3, 6, 1, 4, 5, 2};
+    ASSERT_EQ(expected.size(), tablet_tasks.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], tablet_tasks[i].tablet_id);
+    }
+}
+
 } // namespace starrocks
@@ -56,6 +56,7 @@
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -284,6 +285,79 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentReaderWriterTest, TestParallelAppendWrite) {
+    const int num_columns = 20;
+    std::vector<ColumnPB> columns;
+    columns.push_back(create_int_key_pb(1));
+    columns.push_back(create_int_key_pb(2));
+    for (int cid = 2; cid < num_columns; ++cid) {
+        columns.push_back(create_int_value_pb(cid + 1));
+    }
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(columns);
+
+    auto old_min_columns = config::segment_writer_parallel_append_min_columns;
+    config::segment_writer_parallel_append_min_columns = 8;
+    DeferOp defer([&]() { config::segment_writer_parallel_append_min_columns = old_min_columns; });
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+
+    std::string file_name = kSegmentDir + "/parallel_append_write_case";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    int32_t chunk_size = config::vector_chunk_size;
+    size_t num_rows = 10000;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    for (size_t base = 0; base < num_rows; base += chunk_size) {
+        chunk->reset();
+        auto& cols = chunk->columns();
+        for (size_t rid = base; rid < std::min<size_t>(base + chunk_size, num_rows); ++rid) {
+            for (int cid = 0; cid < num_columns; ++cid) {
+                cols[cid]->append_datum(Datum(static_cast<int32_t>(rid * num_columns + cid)));
+            }
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+    }
+
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    auto res = segment->new_iterator(schema, seg_options);
+    ASSERT_TRUE(res.ok()) << res.status();
+    auto seg_iterator = res.value();
+
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); ++i) {
+            for (int cid = 0; cid < num_columns; ++cid) {
+                ASSERT_EQ(count * num_columns + cid, chunk->get(i)[cid].get_int32());
+            }
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, num_rows);
+}
+
 // NOLINTNEXTLINE
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
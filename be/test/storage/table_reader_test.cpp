@@ -22,6 +22,7 @@
 
 #include "column/datum_tuple.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptor_helper.h"
 #include "storage/chunk_helper.h"
@@ -37,6 +38,7 @@
 #include "storage/union_iterator.h"
 #include "storage/update_manager.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -326,4 +328,84 @@ TEST_F(TableReaderTest, test_basic_read) {
     verify_chunk_eq(scan_value_schema, expect_scan_result.get(), scan_result.get());
 }
 
+TEST_F(TableReaderTest, test_multi_get_with_row_cache) {
+    auto old_capacity = config::short_circuit_row_cache_capacity;
+    config::short_circuit_row_cache_capacity = 1024 * 1024;
+    DeferOp defer([&]() { config::short_circuit_row_cache_capacity = old_capacity; });
+
+    DatumTupleVector rows;
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)1, (int16_t)1, (int32_t)1);
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)2, (int16_t)2, (int32_t)1);
+    create_row(rows, (int64_t)2, (int32_t)1, (int32_t)3, (int16_t)3, (int32_t)2);
+    create_rowset(_tablets[1], 2, rows, 0, 3);
+    while (true) {
+        std::vector<RowsetSharedPtr> dummy_rowsets;
+        EditVersion full_version;
+        ASSERT_TRUE(_tablets[1]->updates()->get_applied_rowsets(2, &dummy_rowsets, &full_version).ok());
+        if (full_version.major_number() == 2) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    LocalTableReaderParams params;
+    params.version = 2;
+    params.tablet_id = _tablets[1]->tablet_id();
+    std::shared_ptr<TableReader> table_reader = std::make_shared<TableReader>();
+    ASSERT_OK(table_reader->init(params));
+
+    // first round fills the cache with (1, 1, 2), then (2, 1, 3) is read from segments and
+    // (1, 1, 2) from the cache in the second round
+    std::vector<std::vector<int>> rounds = {{1}, {1, -1, 2}};
+    for (const auto& round : rounds) {
+        ChunkPtr key_chunk = ChunkHelper::new_chunk(_key_schema, 10);
+        std::vector<bool> expected_found;
+        ChunkPtr expected_value_chunk = ChunkHelper::new_chunk(_value_schema, 10);
+        for (int idx : round) {
+            if (idx < 0) {
+                // key (3, 3, 3) not found
+                key_chunk->get_column_by_index(0)->append_datum(Datum((int64_t)3));
+                key_chunk->get_column_by_index(1)->append_datum(Datum((int32_t)3));
+                key_chunk->get_column_by_index(2)->append_datum(Datum((int32_t)3));
+                expected_found.push_back(false);
+            } else {
+                build_multi_get_request(rows[idx], key_chunk.get(), expected_found, expected_value_chunk.get());
+            }
+        }
+        std::vector<bool> found;
+        ChunkPtr value_chunk = ChunkHelper::new_chunk(_value_schema, 10);
+        ASSERT_OK(table_reader->multi_get(*key_chunk, {"v1", "v2"}, found, *value_chunk));
+        ASSERT_EQ(expected_found, found);
+        verify_chunk_eq(_value_schema, expected_value_chunk.get(), value_chunk.get());
+    }
+
+    // the apply of version 3 updates (1, 1, 2) and erases it from the cache
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)2, (int16_t)9, (int32_t)9);
+    create_rowset(_tablets[1], 3, rows, 3, 4);
+    while (true) {
+        std::vector<RowsetSharedPtr> dummy_rowsets;
+        EditVersion full_version;
+        ASSERT_TRUE(_tablets[1]->updates()->get_applied_rowsets(3, &dummy_rowsets, &full_version).ok());
+        if (full_version.major_number() == 3) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    for (int64_t version : {3, 2, 3}) {
+        params.version = version;
+        table_reader = std::make_shared<TableReader>();
+        ASSERT_OK(table_reader->init(params));
+        ChunkPtr key_chunk = ChunkHelper::new_chunk(_key_schema, 10);
+        std::vector<bool> expected_found;
+        ChunkPtr expected_value_chunk = ChunkHelper::new_chunk(_value_schema, 10);
+        build_multi_get_request(rows[version == 3 ? 3 : 1], key_chunk.get(), expected_found,
+                                expected_value_chunk.get());
+        std::vector<bool> found;
+        ChunkPtr value_chunk = ChunkHelper::new_chunk(_value_schema, 10);
+        ASSERT_OK(table_reader->multi_get(*key_chunk, {"v1", "v2"}, found, *value_chunk));
+        ASSERT_EQ(expected_found, found);
+        verify_chunk_eq(_value_schema, expected_value_chunk.get(), value_chunk.get());
+    }
+}
+
 } // namespace starrocks
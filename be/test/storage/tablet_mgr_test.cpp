@@ -58,6 +58,7 @@
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "storage/txn_manager.h"
+#include "testutil/assert.h"
 
 #ifndef BE_TEST
 #define BE_TEST
@@ -516,4 +517,35 @@ TEST_F(TabletMgrTest, RemoveTabletInDiskDisable) {
     StorageEngine::instance()->tablet_manager()->drop_tablets_on_error_root_path(tablet_info_vec);
 }
 
+TEST_F(TabletMgrTest, LoadTabletsOfDataDirInParallel) {
+    const int num_tablets = 32;
+    std::vector<DataDir*> data_dirs{_data_dirs[0]};
+    for (int i = 0; i < num_tablets; i++) {
+        ASSERT_OK(_tablet_mgr->create_tablet(get_create_tablet_request(1000 + i, 5555), data_dirs));
+    }
+
+    // load the metas written above into a new tablet manager, as BE does when it starts
+    auto load_into_new_tablet_mgr = [&](int32_t num_threads) {
+        auto tablet_mgr = std::make_unique<TabletManager>(1);
+        int32_t old_threads = config::load_tablet_threads_per_data_dir;
+        config::load_tablet_threads_per_data_dir = num_threads;
+        _data_dirs[0]->_tablet_manager = tablet_mgr.get();
+        Status st = _data_dirs[0]->load();
+        _data_dirs[0]->_tablet_manager = nullptr;
+        config::load_tablet_threads_per_data_dir = old_threads;
+        EXPECT_OK(st);
+        return tablet_mgr;
+    };
+
+    for (int32_t num_threads : {1, 4}) {
+        auto tablet_mgr = load_into_new_tablet_mgr(num_threads);
+        for (int i = 0; i < num_tablets; i++) {
+            TabletSharedPtr tablet = tablet_mgr->get_tablet(1000 + i);
+            ASSERT_TRUE(tablet != nullptr) << "threads: " << num_threads << " tablet: " << 1000 + i;
+            ASSERT_EQ(5555, tablet->schema_hash());
+            ASSERT_EQ(_data_dirs[0], tablet->data_dir());
+        }
+    }
+}
+
 } // namespace starrocks
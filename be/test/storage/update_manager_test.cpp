@@ -31,6 +31,8 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/starrocks_metrics.h"
 
 using namespace std;
 
@@ -160,6 +162,48 @@ TEST_F(UpdateManagerTest, testDelVec) {
     ASSERT_EQ(5, tmp->version());
 }
 
+TEST_F(UpdateManagerTest, testPrevDelVecCache) {
+    config::enable_pk_previous_del_vec_cache = true;
+    DeferOp defer([]() { config::enable_pk_previous_del_vec_cache = false; });
+    TabletSegmentId rssid;
+    rssid.tablet_id = 0;
+    rssid.segment_id = 0;
+    DelVector empty;
+    DelVectorPtr delvec3;
+    vector<uint32_t> dels3 = {1, 3, 5, 70, 9000};
+    empty.add_dels_as_new_version(dels3, 3, &delvec3);
+    _update_manager->set_del_vec_in_meta(_meta.get(), rssid, *delvec3);
+    _update_manager->set_cached_del_vec(rssid, delvec3);
+    vector<uint32_t> dels5 = {2, 4, 6, 80, 9000};
+    DelVectorPtr delvec5;
+    delvec3->add_dels_as_new_version(dels5, 5, &delvec5);
+    _update_manager->set_del_vec_in_meta(_meta.get(), rssid, *delvec5);
+    _update_manager->set_cached_del_vec(rssid, delvec5);
+    ASSERT_EQ(delvec3->memory_usage() + delvec5->memory_usage(), _root_mem_tracker->consumption());
+
+    // readers of version 3 and 4 share the replaced delvec instead of loading it from meta
+    DelVectorPtr tmp;
+    ASSERT_OK(_update_manager->get_del_vec(_meta.get(), rssid, 4, &tmp));
+    ASSERT_EQ(delvec3.get(), tmp.get());
+    ASSERT_OK(_update_manager->get_del_vec(_meta.get(), rssid, 3, &tmp));
+    ASSERT_EQ(delvec3.get(), tmp.get());
+    ASSERT_OK(_update_manager->get_del_vec(_meta.get(), rssid, 5, &tmp));
+    ASSERT_EQ(delvec5.get(), tmp.get());
+    ASSERT_OK(_update_manager->get_del_vec(_meta.get(), rssid, 2, &tmp));
+    ASSERT_TRUE(tmp->empty());
+
+    // the metrics count the replaced delvec too
+    _update_manager->expire_cache();
+    ASSERT_EQ(2, StarRocksMetrics::instance()->update_del_vector_num.value());
+    ASSERT_EQ(delvec3->memory_usage() + delvec5->memory_usage(),
+              StarRocksMetrics::instance()->update_del_vector_bytes_total.value());
+
+    _update_manager->clear_cached_del_vec({rssid});
+    ASSERT_EQ(0, _root_mem_tracker->consumption());
+    _update_manager->expire_cache();
+    ASSERT_EQ(0, StarRocksMetrics::instance()->update_del_vector_num.value());
+}
+
 TEST_F(UpdateManagerTest, testExpireEntry) {
     srand(time(nullptr));
     create_tablet(rand(), rand());
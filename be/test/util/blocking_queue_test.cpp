@@ -71,6 +71,24 @@ TEST(BlockingQueueTest, TestGetFromShutdownQueue) {
     ASSERT_FALSE(test_queue.blocking_get(&i));
 }
 
+// NOLINTNEXTLINE
+TEST(BlockingQueueTest, TestGetBatch) {
+    BlockingQueue<int32_t> test_queue(5);
+    for (int32_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(test_queue.blocking_put(i));
+    }
+    std::vector<int32_t> items;
+    ASSERT_EQ(3, test_queue.blocking_get_batch(&items, 3));
+    ASSERT_EQ(2, test_queue.blocking_get_batch(&items, 3));
+    ASSERT_EQ((std::vector<int32_t>{0, 1, 2, 3, 4}), items);
+
+    ASSERT_TRUE(test_queue.blocking_put(5));
+    test_queue.shutdown();
+    ASSERT_EQ(1, test_queue.blocking_get_batch(&items, 3));
+    ASSERT_EQ(5, items.back());
+    ASSERT_EQ(0, test_queue.blocking_get_batch(&items, 3));
+}
+
 class MultiThreadTest {
 public:
     MultiThreadTest() : _queue(_iterations * _nthreads / 10), _num_inserters(_nthreads) {}
@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/hardware_perf_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+static uint64_t busy_loop(int n) {
+    volatile uint64_t sum = 0;
+    for (int i = 0; i < n; ++i) {
+        sum += i * i;
+    }
+    return sum;
+}
+
+TEST(HardwarePerfCountersTest, test_disabled_counters) {
+    ScopedHardwarePerfCounters null_counters(nullptr);
+
+    HardwarePerfProfileCounters counters;
+    ASSERT_FALSE(counters.enabled());
+    { ScopedHardwarePerfCounters scoped(&counters); }
+}
+
+TEST(HardwarePerfCountersTest, test_accumulate) {
+    RuntimeProfile profile("test");
+    HardwarePerfProfileCounters counters;
+    counters.init(&profile);
+    ASSERT_TRUE(counters.enabled());
+
+    HardwarePerfCounters::Values values;
+    bool available = HardwarePerfCounters::current()->read(&values);
+    {
+        ScopedHardwarePerfCounters scoped(&counters);
+        busy_loop(1000000);
+    }
+    // perf_event may be forbidden in the test environment, then nothing is accumulated.
+    if (available) {
+        ASSERT_GT(counters.instructions->value(), 0);
+        ASSERT_GT(counters.cycles->value(), 0);
+    } else {
+        ASSERT_EQ(0, counters.instructions->value());
+        ASSERT_EQ(0, counters.cycles->value());
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,50 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/huge_pages.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+TEST(HugePagesTest, test_allocator) {
+    bool old_value = config::madvise_huge_pages;
+    config::madvise_huge_pages = true;
+
+    // large enough to contain aligned huge pages
+    std::vector<uint32_t, HugePageAllocator<uint32_t>> buffer(3 * kHugePageSize / sizeof(uint32_t), 1);
+    ASSERT_EQ(1, buffer.back());
+
+    using Allocator = HugePageAllocator<phmap::priv::Pair<const int32_t, int32_t>>;
+    phmap::flat_hash_map<int32_t, int32_t, phmap::priv::hash_default_hash<int32_t>,
+                         phmap::priv::hash_default_eq<int32_t>, Allocator>
+            map;
+    for (int32_t i = 0; i < 1000000; i++) {
+        map.emplace(i, i * 2);
+    }
+    ASSERT_EQ(1000000, map.size());
+    ASSERT_EQ(20, map[10]);
+
+    // unaligned and small ranges are ignored
+    madvise_huge_pages(buffer.data() + 1, kHugePageSize);
+    madvise_huge_pages(buffer.data(), 4096);
+
+    config::madvise_huge_pages = old_value;
+}
+
+} // namespace starrocks
@@ -19,9 +19,11 @@
 #include <gtest/gtest.h>
 #include <velocypack/vpack.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
+#include "column/column_access_path.h"
 #include "column/const_column.h"
 #include "column/json_column.h"
 #include "column/nullable_column.h"
@@ -35,6 +37,7 @@
 #include "gutil/strings/strip.h"
 #include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 #include "util/json.h"
 #include "util/json_flattener.h"
 
@@ -438,4 +441,104 @@ TEST_F(JsonFlattenerTest, testPointJson) {
     EXPECT_EQ("4", result_col[0]->debug_item(1));
 }
 
+TEST_F(JsonFlattenerTest, testHotPaths) {
+    // clang-format off
+    std::vector<std::string> jsons = {
+    R"({"k1": 1, "k2": "a", "k3": {"f1": 1}})",
+    R"({"k1": 2, "k2": "b", "k4": {"f2": 2}})",
+    R"({"k1": 3, "k2": "c"})",
+    R"({"k1": 4, "k2": "d"})",
+    R"({"k1": 5, "k2": "e"})",
+    };
+    // clang-format on
+
+    ColumnPtr input = JsonColumn::create();
+    JsonColumn* json_input = down_cast<JsonColumn*>(input.get());
+    for (const auto& json : jsons) {
+        ASSIGN_OR_ABORT(auto json_value, JsonValue::parse(json));
+        json_input->append(&json_value);
+    }
+
+    int32_t old_min_access = config::json_flat_hot_path_min_access;
+    double old_sparsity = config::json_flat_sparsity_factor;
+    double old_hot_sparsity = config::json_flat_hot_path_sparsity_factor;
+    config::json_flat_hot_path_min_access = 3;
+    config::json_flat_sparsity_factor = 0.9;
+    config::json_flat_hot_path_sparsity_factor = 0.2;
+    DeferOp defer([&]() {
+        config::json_flat_hot_path_min_access = old_min_access;
+        config::json_flat_sparsity_factor = old_sparsity;
+        config::json_flat_hot_path_sparsity_factor = old_hot_sparsity;
+    });
+
+    // k3.f1 is read by the queries often enough, k4.f2 isn't
+    auto* stats = JsonPathAccessStats::instance();
+    for (int i = 0; i < 3; i++) {
+        stats->record(100, 1, {"k3.f1"});
+    }
+    stats->record(100, 1, {"k4.f2"});
+    stats->record(101, 1, {"k4.f2", "k4.f2", "k4.f2"});
+    auto hot_paths = stats->hot_paths(100, 1);
+    ASSERT_EQ(std::vector<std::string>{"k3.f1"}, hot_paths);
+
+    {
+        JsonPathDeriver jf;
+        jf.derived({json_input});
+        std::vector<std::string> paths = {"k1", "k2"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+    {
+        JsonPathDeriver jf;
+        jf.set_hot_paths(hot_paths);
+        jf.derived({json_input});
+        std::vector<std::string> paths = {"k1", "k2", "k3.f1"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+}
+
+TEST_F(JsonFlattenerTest, testHotPathsDecay) {
+    int32_t old_min_access = config::json_flat_hot_path_min_access;
+    int64_t old_decay_sec = config::json_flat_hot_path_access_decay_sec;
+    config::json_flat_hot_path_min_access = 4;
+    config::json_flat_hot_path_access_decay_sec = 100;
+    DeferOp defer([&]() {
+        config::json_flat_hot_path_min_access = old_min_access;
+        config::json_flat_hot_path_access_decay_sec = old_decay_sec;
+    });
+
+    JsonPathAccessStats stats;
+    for (int i = 0; i < 4; i++) {
+        stats.record(200, 1, {"a", "b"}, 1000);
+        stats.record(200, 1, {"b"}, 1000);
+    }
+    auto hot_paths = stats.hot_paths(200, 1, 1099);
+    std::sort(hot_paths.begin(), hot_paths.end());
+    ASSERT_EQ((std::vector<std::string>{"a", "b"}), hot_paths);
+    // the counts are halved after each decay interval
+    ASSERT_EQ(std::vector<std::string>{"b"}, stats.hot_paths(200, 1, 1100));
+    ASSERT_TRUE(stats.hot_paths(200, 1, 1300).empty());
+
+    // fill up all the shards, the new columns are not counted any more
+    for (int i = 0; i < 8192; i++) {
+        stats.record(300, i, {"a"}, 2000);
+    }
+    for (int i = 0; i < 4; i++) {
+        stats.record(400, 1, {"a"}, 2000);
+    }
+    ASSERT_TRUE(stats.hot_paths(400, 1, 2000).empty());
+    // the columns whose counts decay to zero are evicted for the new columns
+    for (int i = 0; i < 4; i++) {
+        stats.record(400, 1, {"a"}, 2100);
+    }
+    ASSERT_EQ(std::vector<std::string>{"a"}, stats.hot_paths(400, 1, 2100));
+}
+
+TEST_F(JsonFlattenerTest, testJsonAccessRecordedOncePerPath) {
+    ASSIGN_OR_ABORT(auto path, ColumnAccessPath::create(TAccessPathType::FIELD, "k1", 0));
+    ASSERT_TRUE(path->mark_json_access_recorded());
+    ASSERT_FALSE(path->mark_json_access_recorded());
+}
+
 } // namespace starrocks
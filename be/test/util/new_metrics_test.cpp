@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "common/config.h"
 #include "util/logging.h"
@@ -170,6 +171,26 @@ TEST_F(MetricsTest, Gauge) {
 
         ASSERT_STREQ("100", gauge.to_string().c_str());
     }
+    // IntCoreLocalGauge
+    {
+        IntCoreLocalGauge gauge(MetricUnit::BYTES);
+        ASSERT_EQ(MetricType::GAUGE, gauge.type());
+        ASSERT_EQ(0, gauge.value());
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&gauge]() {
+                for (int j = 0; j < 1000; ++j) {
+                    gauge.increment(3);
+                    gauge.increment(-1);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        ASSERT_EQ(8000, gauge.value());
+        ASSERT_STREQ("8000", gauge.to_string().c_str());
+    }
     // DoubleGauge
     {
         DoubleGauge gauge(MetricUnit::NOUNIT);
@@ -265,6 +265,13 @@ TEST_F(StarRocksMetricsTest, Normal) {
         ASSERT_TRUE(metric != nullptr);
         ASSERT_STREQ("40", metric->to_string().c_str());
     }
+    {
+        instance->pipe_driver_overloaded.increment(3);
+        auto metric = metrics->get_metric("pipe_driver_overloaded");
+        ASSERT_TRUE(metric != nullptr);
+        ASSERT_EQ(MetricType::GAUGE, metric->type());
+        ASSERT_STREQ("3", metric->to_string().c_str());
+    }
 }
 
 TEST_F(StarRocksMetricsTest, PageCacheMetrics) {
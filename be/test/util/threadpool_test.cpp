@@ -35,6 +35,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "gutil/atomicops.h"
@@ -423,6 +424,25 @@ TEST_F(ThreadPoolTest, TestDeadlocks) {
 }
 #endif
 
+// A NUMA-aware pool without cpuids has nothing to pick the cpus of a node from, so its threads stay unbound.
+TEST_F(ThreadPoolTest, TestNumaBindingSkippedWithoutCpuids) {
+    ASSERT_TRUE(rebuild_pool_with_builder(
+                        ThreadPoolBuilder(kDefaultPoolName).set_min_threads(1).set_max_threads(1).set_numa_aware(true))
+                        .ok());
+    ASSERT_TRUE(_pool->numa_binding_skipped());
+
+    _pool->bind_cpus({0}, {});
+    ASSERT_EQ(!config::enable_resource_group_bind_cpus, _pool->numa_binding_skipped());
+
+    _pool->bind_cpus({}, {});
+    ASSERT_TRUE(_pool->numa_binding_skipped());
+    _pool->shutdown();
+
+    // A pool which isn't NUMA-aware skips nothing.
+    ASSERT_TRUE(rebuild_pool_with_min_max(1, 1).ok());
+    ASSERT_FALSE(_pool->numa_binding_skipped());
+}
+
 class SlowDestructorRunnable : public Runnable {
 public:
     void run() override {}
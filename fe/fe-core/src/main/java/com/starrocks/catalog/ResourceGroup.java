@@ -52,6 +52,7 @@ public class ResourceGroup {
     public static final String DISABLE_RESOURCE_GROUP_NAME = "disable_resource_group";
     public static final String DEFAULT_MV_RESOURCE_GROUP_NAME = "default_mv_wg";
     public static final String SPILL_MEM_LIMIT_THRESHOLD = "spill_mem_limit_threshold";
+    public static final String TARGET_LATENCY_MS = "target_latency_ms";
 
     /**
      * In the old version, DEFAULT_WG and DEFAULT_MV_WG are not saved and persisted in the FE, but are only created in each
@@ -165,6 +166,10 @@ public class ResourceGroup {
     private Integer concurrencyLimit;
     @SerializedName(value = "spillMemLimitThreshold")
     private Double spillMemLimitThreshold;
+    // The target latency of the queries in this group. The BE schedules the queries close to it first.
+    // 0 or null means that the group declares no target latency.
+    @SerializedName(value = "targetLatencyMs")
+    private Long targetLatencyMs;
     @SerializedName(value = "workGroupType")
     private TWorkGroupType resourceGroupType;
     @SerializedName(value = "version")
@@ -254,6 +259,9 @@ public class ResourceGroup {
         if (spillMemLimitThreshold != null) {
             twg.setSpill_mem_limit_threshold(spillMemLimitThreshold);
         }
+        if (targetLatencyMs != null) {
+            twg.setTarget_latency_ms(targetLatencyMs);
+        }
         if (resourceGroupType != null) {
             twg.setWorkgroup_type(resourceGroupType);
         }
@@ -373,6 +381,14 @@ public class ResourceGroup {
         this.spillMemLimitThreshold = spillMemLimitThreshold;
     }
 
+    public Long getTargetLatencyMs() {
+        return targetLatencyMs;
+    }
+
+    public void setTargetLatencyMs(long targetLatencyMs) {
+        this.targetLatencyMs = targetLatencyMs;
+    }
+
     public TWorkGroupType getResourceGroupType() {
         return resourceGroupType;
     }
@@ -417,6 +417,11 @@ public class ResourceGroupMgr implements Writable {
                     wg.setSpillMemLimitThreshold(spillMemLimitThreshold);
                 }
 
+                Long targetLatencyMs = changedProperties.getTargetLatencyMs();
+                if (targetLatencyMs != null) {
+                    wg.setTargetLatencyMs(targetLatencyMs);
+                }
+
                 // Type is guaranteed to be immutable during the analyzer phase.
                 TWorkGroupType workGroupType = changedProperties.getResourceGroupType();
                 Preconditions.checkState(workGroupType == null);
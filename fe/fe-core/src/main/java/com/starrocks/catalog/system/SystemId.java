@@ -104,6 +104,10 @@ public class SystemId {
 
     public static final long TEMP_TABLES_ID = 43L;
 
+    public static final long BE_PIPELINE_WAIT_STATS_ID = 44L;
+
+    public static final long BE_CONTINUOUS_PROFILE_ID = 45L;
+
     public static final long SYS_DB_ID = 100L;
 
     public static final long ROLE_EDGES_ID = 101L;
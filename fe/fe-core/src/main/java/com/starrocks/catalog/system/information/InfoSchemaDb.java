@@ -80,6 +80,8 @@ public class InfoSchemaDb extends Database {
             super.registerTableUnlocked(BeConfigsSystemTable.create());
             super.registerTableUnlocked(FeTabletSchedulesSystemTable.create());
             super.registerTableUnlocked(BeThreadsSystemTable.create());
+            super.registerTableUnlocked(BePipelineWaitStatsSystemTable.create());
+            super.registerTableUnlocked(BeContinuousProfileSystemTable.create());
             super.registerTableUnlocked(BeLogsSystemTable.create());
             super.registerTableUnlocked(BeBvarsSystemTable.create());
             super.registerTableUnlocked(BeCloudNativeCompactionsSystemTable.create());
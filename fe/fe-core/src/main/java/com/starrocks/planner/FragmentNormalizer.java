@@ -484,10 +484,10 @@ public class FragmentNormalizer {
             PartitionKey lowerKey = new PartitionKey();
             PartitionKey upperKey = new PartitionKey();
             lowerKey.pushColumn(lowerBound, partitionColumn.getPrimitiveType());
-            lowerKey.pushColumn(upperBound, partitionColumn.getPrimitiveType());
+            upperKey.pushColumn(upperBound, partitionColumn.getPrimitiveType());
             if (predicate.isNotBetween()) {
                 result.add(Range.open(minKey, lowerKey));
-                result.add(Range.open(upperKey, upperKey));
+                result.add(Range.open(upperKey, maxKey));
             } else {
                 result.add(Range.closed(lowerKey, upperKey));
             }
@@ -346,6 +346,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     public static final String CBO_ENABLE_LOW_CARDINALITY_OPTIMIZE = "cbo_enable_low_cardinality_optimize";
     public static final String LOW_CARDINALITY_OPTIMIZE_V2 = "low_cardinality_optimize_v2";
     public static final String ARRAY_LOW_CARDINALITY_OPTIMIZE = "array_low_cardinality_optimize";
+    public static final String LOW_CARDINALITY_OPTIMIZE_ON_JOIN = "low_cardinality_optimize_on_join";
     public static final String CBO_USE_NTH_EXEC_PLAN = "cbo_use_nth_exec_plan";
     public static final String CBO_CTE_REUSE = "cbo_cte_reuse";
     public static final String CBO_CTE_REUSE_RATE = "cbo_cte_reuse_rate";
@@ -1326,6 +1327,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = ARRAY_LOW_CARDINALITY_OPTIMIZE)
     private boolean enableArrayLowCardinalityOptimize = true;
 
+    // join low-cardinality string columns on their global dict codes when both sides share the same dict
+    @VarAttr(name = LOW_CARDINALITY_OPTIMIZE_ON_JOIN)
+    private boolean enableLowCardinalityOptimizeOnJoin = false;
+
     @VariableMgr.VarAttr(name = ENABLE_OPTIMIZER_REWRITE_GROUPINGSETS_TO_UNION_ALL)
     private boolean enableRewriteGroupingSetsToUnionAll = false;
 
@@ -1357,6 +1362,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // for transmission_encode_level,
     // 2 for encoding integers or types supported by integers,
     // 4 for encoding string,
+    // 8 for omitting the null map of nullable columns that contain no nulls, only used when
+    //   the BE config enable_transmission_encode_null_map is set,
     // json and object columns are left to be supported later.
     @VariableMgr.VarAttr(name = TRANSMISSION_ENCODE_LEVEL)
     private int transmissionEncodeLevel = 7;
@@ -1589,6 +1596,14 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         return enableArrayLowCardinalityOptimize;
     }
 
+    public boolean isEnableLowCardinalityOptimizeOnJoin() {
+        return enableLowCardinalityOptimizeOnJoin;
+    }
+
+    public void setEnableLowCardinalityOptimizeOnJoin(boolean enableLowCardinalityOptimizeOnJoin) {
+        this.enableLowCardinalityOptimizeOnJoin = enableLowCardinalityOptimizeOnJoin;
+    }
+
     @VarAttr(name = ENABLE_REWRITE_BITMAP_UNION_TO_BITMAP_AGG)
     private boolean enableRewriteBitmapUnionToBitmapAgg = true;
 
@@ -253,6 +253,15 @@ public class ResourceGroupAnalyzer {
                 continue;
             }
 
+            if (key.equalsIgnoreCase(ResourceGroup.TARGET_LATENCY_MS)) {
+                long targetLatencyMs = Long.parseLong(value);
+                if (targetLatencyMs < 0) {
+                    throw new SemanticException("target_latency_ms should greater than 0 or equal to 0");
+                }
+                resourceGroup.setTargetLatencyMs(targetLatencyMs);
+                continue;
+            }
+
             if (key.equalsIgnoreCase(ResourceGroup.GROUP_TYPE)) {
                 try {
                     resourceGroup.setResourceGroupType(TWorkGroupType.valueOf("WG_" + value.toUpperCase()));
@@ -28,13 +28,18 @@ import com.starrocks.catalog.OlapTable;
 import com.starrocks.catalog.Partition;
 import com.starrocks.catalog.Type;
 import com.starrocks.common.FeConstants;
+import com.starrocks.common.Pair;
 import com.starrocks.qe.SessionVariable;
 import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.sql.optimizer.OptExpression;
 import com.starrocks.sql.optimizer.OptExpressionVisitor;
+import com.starrocks.sql.optimizer.Utils;
 import com.starrocks.sql.optimizer.base.ColumnRefSet;
+import com.starrocks.sql.optimizer.base.DistributionSpec;
 import com.starrocks.sql.optimizer.operator.Operator;
+import com.starrocks.sql.optimizer.operator.physical.PhysicalDistributionOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalHashAggregateOperator;
+import com.starrocks.sql.optimizer.operator.physical.PhysicalHashJoinOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalJoinOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalOlapScanOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalTableFunctionOperator;
@@ -132,6 +137,9 @@ public class DecodeCollector extends OptExpressionVisitor<DecodeInfo, DecodeInfo
 
     private final ColumnRefSet physicalOlapScanColumns = new ColumnRefSet();
 
+    // equal join keys (a = b) which can be compared on dict codes, both sides must be encoded together
+    private final List<Pair<Integer, Integer>> dictCodeJoinKeys = Lists.newArrayList();
+
     public DecodeCollector(SessionVariable session) {
         this.sessionVariable = session;
     }
@@ -220,8 +228,38 @@ public class DecodeCollector extends OptExpressionVisitor<DecodeInfo, DecodeInfo
         }
     }
 
+    private void fillDisableDictCodeJoinKeys() {
+        // a join key compared on dict codes can't meet a string column on the other side,
+        // so if one side is disabled, disable the other side too
+        boolean changed = true;
+        while (changed) {
+            changed = false;
+            for (Pair<Integer, Integer> key : dictCodeJoinKeys) {
+                boolean disableLeft =
+                        disableRewriteStringColumns.contains(key.first) || matchChildren.contains(key.first);
+                boolean disableRight =
+                        disableRewriteStringColumns.contains(key.second) || matchChildren.contains(key.second);
+                if (disableLeft != disableRight) {
+                    disableRewriteStringColumns.union(key.first);
+                    disableRewriteStringColumns.union(key.second);
+                    changed = true;
+                }
+            }
+            if (changed) {
+                fillDisableStringColumns();
+            }
+        }
+    }
+
     private void initContext(DecodeContext context) {
         fillDisableStringColumns();
+        fillDisableDictCodeJoinKeys();
+
+        Set<Integer> dictCodeJoinColumns = Sets.newHashSet();
+        dictCodeJoinKeys.forEach(k -> {
+            dictCodeJoinColumns.add(k.first);
+            dictCodeJoinColumns.add(k.second);
+        });
 
         // choose the profitable string columns
         for (Integer cid : scanStringColumns) {
@@ -231,6 +269,11 @@ public class DecodeCollector extends OptExpressionVisitor<DecodeInfo, DecodeInfo
             if (matchChildren.contains(cid)) {
                 continue;
             }
+            if (dictCodeJoinColumns.contains(cid)) {
+                // must keep the same encoding as the other side of join key
+                context.allStringColumns.add(cid);
+                continue;
+            }
             if (expressionStringRefCounter.getOrDefault(cid, 0) > 1) {
                 context.allStringColumns.add(cid);
                 continue;
@@ -392,9 +435,10 @@ public class DecodeCollector extends OptExpressionVisitor<DecodeInfo, DecodeInfo
         if (!result.inputStringColumns.containsAny(onColumns)) {
             return result;
         }
+        ColumnRefSet dictCodeJoinColumns = collectDictCodeJoinKeys(optExpression, result);
         result.outputStringColumns.clear();
         result.inputStringColumns.getStream().forEach(c -> {
-            if (onColumns.contains(c)) {
+            if (onColumns.contains(c) && !dictCodeJoinColumns.contains(c)) {
                 disableRewriteStringColumns.union(c);
             } else {
                 result.outputStringColumns.union(c);
@@ -405,6 +449,78 @@ public class DecodeCollector extends OptExpressionVisitor<DecodeInfo, DecodeInfo
         return result;
     }
 
+    // collect the equal join keys which can be compared on dict codes instead of strings:
+    // 1. both sides are string columns from scan with the same global dict content
+    // 2. the join is shuffle or broadcast join, the colocate/bucket-shuffle join depends on
+    //    the storage distribution of string value
+    private ColumnRefSet collectDictCodeJoinKeys(OptExpression optExpression, DecodeInfo info) {
+        ColumnRefSet result = new ColumnRefSet();
+        if (!sessionVariable.isEnableLowCardinalityOptimizeOnJoin()) {
+            return result;
+        }
+        if (!(optExpression.getOp() instanceof PhysicalHashJoinOperator) || !isShuffleOrBroadcastJoin(optExpression)) {
+            return result;
+        }
+        PhysicalJoinOperator join = optExpression.getOp().cast();
+        List<BinaryPredicateOperator> candidates = Lists.newArrayList();
+        ColumnRefSet otherUsedColumns = new ColumnRefSet();
+        for (ScalarOperator conjunct : Utils.extractConjuncts(join.getOnPredicate())) {
+            if (isDictCodeJoinKey(conjunct, info)) {
+                candidates.add(conjunct.cast());
+            } else {
+                otherUsedColumns.union(conjunct.getUsedColumns());
+            }
+        }
+        for (BinaryPredicateOperator key : candidates) {
+            ColumnRefOperator left = key.getChild(0).cast();
+            ColumnRefOperator right = key.getChild(1).cast();
+            if (otherUsedColumns.contains(left) || otherUsedColumns.contains(right)) {
+                continue;
+            }
+            dictCodeJoinKeys.add(Pair.create(left.getId(), right.getId()));
+            result.union(left);
+            result.union(right);
+        }
+        return result;
+    }
+
+    private boolean isShuffleOrBroadcastJoin(OptExpression optExpression) {
+        Operator right = optExpression.inputAt(1).getOp();
+        if (!(right instanceof PhysicalDistributionOperator)) {
+            return false;
+        }
+        DistributionSpec.DistributionType type = ((PhysicalDistributionOperator) right).getDistributionSpec().getType();
+        if (type == DistributionSpec.DistributionType.BROADCAST) {
+            return true;
+        }
+        return type == DistributionSpec.DistributionType.SHUFFLE &&
+                optExpression.inputAt(0).getOp() instanceof PhysicalDistributionOperator;
+    }
+
+    private boolean isDictCodeJoinKey(ScalarOperator conjunct, DecodeInfo info) {
+        if (!(conjunct instanceof BinaryPredicateOperator)) {
+            return false;
+        }
+        BinaryPredicateOperator predicate = conjunct.cast();
+        if (!predicate.getBinaryType().isEqual() && predicate.getBinaryType() != EQ_FOR_NULL) {
+            return false;
+        }
+        if (!predicate.getChild(0).isColumnRef() || !predicate.getChild(1).isColumnRef()) {
+            return false;
+        }
+        ColumnRefOperator left = predicate.getChild(0).cast();
+        ColumnRefOperator right = predicate.getChild(1).cast();
+        if (!left.getType().isStringType() || !right.getType().isStringType()) {
+            return false;
+        }
+        if (!info.inputStringColumns.contains(left) || !info.inputStringColumns.contains(right)) {
+            return false;
+        }
+        ColumnDict leftDict = globalDicts.get(left.getId());
+        ColumnDict rightDict = globalDicts.get(right.getId());
+        return leftDict != null && rightDict != null && leftDict.getDict().equals(rightDict.getDict());
+    }
+
     @Override
     public DecodeInfo visitPhysicalHashAggregate(OptExpression optExpression, DecodeInfo context) {
         if (context.outputStringColumns.isEmpty()) {
@@ -26,6 +26,7 @@ import com.starrocks.catalog.Type;
 import com.starrocks.common.Pair;
 import com.starrocks.sql.optimizer.OptExpression;
 import com.starrocks.sql.optimizer.OptExpressionVisitor;
+import com.starrocks.sql.optimizer.Utils;
 import com.starrocks.sql.optimizer.base.ColumnRefFactory;
 import com.starrocks.sql.optimizer.base.ColumnRefSet;
 import com.starrocks.sql.optimizer.base.DistributionCol;
@@ -39,10 +40,12 @@ import com.starrocks.sql.optimizer.operator.Projection;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalDecodeOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalDistributionOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalHashAggregateOperator;
+import com.starrocks.sql.optimizer.operator.physical.PhysicalHashJoinOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalOlapScanOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalTableFunctionOperator;
 import com.starrocks.sql.optimizer.operator.physical.PhysicalTopNOperator;
+import com.starrocks.sql.optimizer.operator.scalar.BinaryPredicateOperator;
 import com.starrocks.sql.optimizer.operator.scalar.CallOperator;
 import com.starrocks.sql.optimizer.operator.scalar.ColumnRefOperator;
 import com.starrocks.sql.optimizer.operator.scalar.ScalarOperator;
@@ -201,6 +204,38 @@ public class DecodeRewriter extends OptExpressionVisitor<OptExpression, ColumnRe
         return rewriteOptExpression(optExpression, op, info.outputStringColumns);
     }
 
+    @Override
+    public OptExpression visitPhysicalHashJoin(OptExpression optExpression, ColumnRefSet fragmentUseDictExprs) {
+        PhysicalHashJoinOperator join = optExpression.getOp().cast();
+        DecodeInfo info = context.operatorDecodeInfo.getOrDefault(join, DecodeInfo.EMPTY);
+        ScalarOperator onPredicate = join.getOnPredicate();
+        if (onPredicate == null || !info.inputStringColumns.containsAny(onPredicate.getUsedColumns())) {
+            return visit(optExpression, fragmentUseDictExprs);
+        }
+
+        // the join keys kept by DecodeCollector are compared on dict codes, both sides share the same dict
+        List<ScalarOperator> onPredicates = Lists.newArrayList();
+        for (ScalarOperator conjunct : Utils.extractConjuncts(onPredicate)) {
+            if (!(conjunct instanceof BinaryPredicateOperator) || !conjunct.getChild(0).isColumnRef() ||
+                    !conjunct.getChild(1).isColumnRef() ||
+                    !info.inputStringColumns.containsAll(conjunct.getUsedColumns())) {
+                onPredicates.add(conjunct);
+                continue;
+            }
+            BinaryPredicateOperator key = conjunct.cast();
+            ColumnRefOperator left = context.stringRefToDictRefMap.get(key.getChild(0));
+            ColumnRefOperator right = context.stringRefToDictRefMap.get(key.getChild(1));
+            onPredicates.add(new BinaryPredicateOperator(key.getBinaryType(), left, right));
+        }
+
+        ScalarOperator predicate = rewritePredicate(join.getPredicate(), info.inputStringColumns);
+        Projection projection = rewriteProjection(join.getProjection(), info.inputStringColumns);
+        PhysicalHashJoinOperator op = new PhysicalHashJoinOperator(join.getJoinType(),
+                Utils.compoundAnd(onPredicates), join.getJoinHint(), join.getLimit(), predicate, projection);
+        op.setCanLocalShuffle(join.getCanLocalShuffle());
+        return rewriteOptExpression(optExpression, op, info.outputStringColumns);
+    }
+
     @Override
     public OptExpression visitPhysicalDistribution(OptExpression optExpression, ColumnRefSet fragmentUseDictExprs) {
         PhysicalDistributionOperator exchange = optExpression.getOp().cast();
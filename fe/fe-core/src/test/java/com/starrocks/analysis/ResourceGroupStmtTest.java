@@ -1767,6 +1767,39 @@ public class ResourceGroupStmtTest {
         starRocksAssert.executeResourceGroupDdlSql("DROP RESOURCE GROUP rg2");
     }
 
+    @Test
+    public void testTargetLatencyMs() throws Exception {
+        starRocksAssert.executeResourceGroupDdlSql("CREATE RESOURCE GROUP rg1\n" +
+                "TO (user='rg1_user')\n" +
+                "WITH (" +
+                "   'mem_limit' = '20%'," +
+                "   'cpu_weight' = '1'" +
+                ");");
+        ResourceGroup rg = GlobalStateMgr.getCurrentState().getResourceGroupMgr().getResourceGroup("rg1");
+        Assert.assertFalse(rg.toThrift().isSetTarget_latency_ms());
+
+        starRocksAssert.executeResourceGroupDdlSql("ALTER RESOURCE GROUP rg1 WITH ('target_latency_ms' = '200')");
+        rg = GlobalStateMgr.getCurrentState().getResourceGroupMgr().getResourceGroup("rg1");
+        Assert.assertEquals(200L, rg.toThrift().getTarget_latency_ms());
+
+        Assert.assertThrows("target_latency_ms should greater than 0 or equal to 0", SemanticException.class,
+                () -> starRocksAssert.executeResourceGroupDdlSql(
+                        "ALTER RESOURCE GROUP rg1 WITH ('target_latency_ms' = '-1')"));
+
+        starRocksAssert.executeResourceGroupDdlSql("DROP RESOURCE GROUP rg1");
+
+        starRocksAssert.executeResourceGroupDdlSql("CREATE RESOURCE GROUP rg2\n" +
+                "TO (user='rg2_user')\n" +
+                "WITH (" +
+                "   'mem_limit' = '20%'," +
+                "   'cpu_weight' = '1'," +
+                "   'target_latency_ms' = '100'" +
+                ");");
+        rg = GlobalStateMgr.getCurrentState().getResourceGroupMgr().getResourceGroup("rg2");
+        Assert.assertEquals(100L, rg.toThrift().getTarget_latency_ms());
+        starRocksAssert.executeResourceGroupDdlSql("DROP RESOURCE GROUP rg2");
+    }
+
     @Test
     public void testCreateBuiltinGroup() throws Exception {
         Assert.assertThrows("RESOURCE_GROUP(default_wg) already exists",
@@ -16,12 +16,14 @@
 package com.starrocks.planner;
 
 import com.google.common.collect.Range;
+import com.starrocks.analysis.BetweenPredicate;
 import com.starrocks.analysis.DateLiteral;
 import com.starrocks.analysis.Expr;
 import com.starrocks.analysis.FunctionCallExpr;
 import com.starrocks.analysis.IntLiteral;
 import com.starrocks.analysis.LargeIntLiteral;
 import com.starrocks.analysis.LiteralExpr;
+import com.starrocks.analysis.SlotRef;
 import com.starrocks.catalog.Column;
 import com.starrocks.catalog.FunctionSet;
 import com.starrocks.catalog.PartitionKey;
@@ -88,6 +90,29 @@ public class FragmentNormalizerTest {
         testHelper(partitionColumn, lower, lowerSucc, upper, upperSucc);
     }
 
+    @Test
+    public void testConvertBetweenPredicateToRange() throws AnalysisException {
+        Column partitionColumn = new Column("dt", Type.fromPrimitiveType(PrimitiveType.DATE));
+        List<Column> partitionColumns = Arrays.asList(partitionColumn);
+        PartitionKey minKey = PartitionKey.createInfinityPartitionKey(partitionColumns, false);
+        PartitionKey maxKey = PartitionKey.createInfinityPartitionKey(partitionColumns, true);
+        LiteralExpr lower = new DateLiteral(2022, 1, 1);
+        LiteralExpr upper = new DateLiteral(2022, 1, 10);
+        PartitionKey lowerKey = new PartitionKey();
+        PartitionKey upperKey = new PartitionKey();
+        lowerKey.pushColumn(lower, partitionColumn.getPrimitiveType());
+        upperKey.pushColumn(upper, partitionColumn.getPrimitiveType());
+
+        FragmentNormalizer normalizer = new FragmentNormalizer(null, null);
+        Expr between = new BetweenPredicate(new SlotRef(null, "dt"), lower, upper, false);
+        Assert.assertEquals(Arrays.asList(Range.closed(lowerKey, upperKey)),
+                normalizer.convertPredicateToRange(partitionColumn, between));
+
+        Expr notBetween = new BetweenPredicate(new SlotRef(null, "dt"), lower, upper, true);
+        Assert.assertEquals(Arrays.asList(Range.open(minKey, lowerKey), Range.open(upperKey, maxKey)),
+                normalizer.convertPredicateToRange(partitionColumn, notBetween));
+    }
+
     @Test
     public void testToClosedAndOpenRangeForDatetime() throws AnalysisException {
         Column partitionColumn = new Column("ts", Type.fromPrimitiveType(PrimitiveType.DATETIME));
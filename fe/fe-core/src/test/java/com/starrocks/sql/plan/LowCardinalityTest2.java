@@ -984,6 +984,33 @@ public class LowCardinalityTest2 extends PlanTestBase {
         Assert.assertFalse(plan, plan.contains("DecodeNode"));
     }
 
+    @Test
+    public void testJoinOnDictCode() throws Exception {
+        String sql = "select count(*) from supplier l join [shuffle] supplier r on l.S_ADDRESS = r.S_ADDRESS";
+        String plan = getVerboseExplain(sql);
+        assertNotContains(plan, "dict_col=S_ADDRESS");
+
+        connectContext.getSessionVariable().setEnableLowCardinalityOptimizeOnJoin(true);
+        try {
+            plan = getVerboseExplain(sql);
+            assertContains(plan, "dict_col=S_ADDRESS");
+            assertNotContains(plan, "Decode");
+
+            sql = "select count(*) from supplier l join [broadcast] supplier r on l.S_ADDRESS = r.S_ADDRESS";
+            plan = getVerboseExplain(sql);
+            assertContains(plan, "dict_col=S_ADDRESS");
+            assertNotContains(plan, "Decode");
+
+            // the join key is used by other expression, can't compare on dict code
+            sql = "select count(*) from supplier l join [shuffle] supplier r " +
+                    "on l.S_ADDRESS = r.S_ADDRESS and upper(l.S_ADDRESS) = r.S_COMMENT";
+            plan = getVerboseExplain(sql);
+            assertNotContains(plan, "dict_col=S_ADDRESS");
+        } finally {
+            connectContext.getSessionVariable().setEnableLowCardinalityOptimizeOnJoin(false);
+        }
+    }
+
     @Test
     public void testJoin() throws Exception {
         String sql;
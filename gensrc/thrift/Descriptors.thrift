@@ -171,6 +171,8 @@ enum TSchemaTableType {
     SCH_PARTITIONS_META,
     SYS_FE_MEMORY_USAGE,
     SCH_TEMP_TABLES,
+    SCH_BE_PIPELINE_WAIT_STATS,
+    SCH_BE_CONTINUOUS_PROFILE,
 }
 
 enum THdfsCompression {
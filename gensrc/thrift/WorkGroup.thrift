@@ -41,6 +41,9 @@ struct TWorkGroup {
 
   15: optional i32 exclusive_cpu_cores
 
+  // The target latency of the queries in the workgroup, which makes the workgroup a latency-SLO workgroup.
+  16: optional i64 target_latency_ms
+
   100: optional i32 max_cpu_cores
 }
 